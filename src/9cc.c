@@ -1,47 +1,308 @@
 #include "9cc.h"
 
-// 指定されたファイルの内容を返す
-char *read_file(char *path) {
-  // ファイルを開く
-  FILE *fp = fopen(path, "r");
-  if (!fp) error("cannot open %s: %s", path, strerror(errno));
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
-  int filemax = 10 * 1024 * 1024;
-  // ファイル内容を読み込む
-  char *buf = calloc(1, filemax);
-  int size = fread(buf, 1, filemax - 2, fp);
-  if (!feof(fp)) error("%s: file too large");
+// 指定されたファイルの内容を返す。開けなければ NULL を返す
+static char *read_file(char *path) {
+  FILE *fp = fopen(path, "r");
+  if (!fp) return NULL;
 
-  // ファイルが必ず"\n\0"で終わっているようにする
-  if (size == 0 || buf[size - 1] != '\n') buf[size++] = '\n';
-  buf[size] = '\0';
+  char *buf;
+  size_t size;
+  FILE *out = open_memstream(&buf, &size);
+  char tmp[4096];
+  for (size_t n; (n = fread(tmp, 1, sizeof(tmp), fp)) > 0;)
+    fwrite(tmp, 1, n, out);
   fclose(fp);
+  fclose(out);
   return buf;
 }
 
-int main(int argc, char **argv) {
-  if (argc != 2) {
+static char **inputs;
+static int ninputs;
+static char *output_path;  // -o
+static bool opt_c;         // -c: 複数のファイルをまとめてオブジェクトファイルにする
+static bool opt_S;         // -S: -c と同じだがアセンブリを出力する
+static char *server_path;  // --server
+static char *client_path;  // --client
+static char *cache_dir;    // --cache
+static long long cache_size = 1024;  // --cache-size: MB 単位
+static bool cache_stats;             // --cache-stats
+
+static void parse_args(int argc, char **argv, CcOptions *opts) {
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-fopt-report")) {
+      opts->report = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fPIC") || !strcmp(argv[i], "-fpic")) {
+      opts->pic = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fvectorize")) {
+      opts->vectorize = true;
+      continue;
+    }
+
+    if (!strncmp(argv[i], "-funroll-factor=", 16)) {
+      opts->unroll_factor = atoi(argv[i] + 16);
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fpipeline")) {
+      opts->pipeline = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-j")) {
+      if (i + 1 == argc) error("-j にスレッド数がありません");
+      opts->jobs = atoi(argv[++i]);
+      continue;
+    }
+
+    if (!strncmp(argv[i], "-j", 2)) {
+      opts->jobs = atoi(argv[i] + 2);
+      continue;
+    }
+
+    if (!strcmp(argv[i], "--server") || !strcmp(argv[i], "--client")) {
+      if (i + 1 == argc) error("%s にソケットのパスがありません", argv[i]);
+      if (argv[i][2] == 's')
+        server_path = argv[++i];
+      else
+        client_path = argv[++i];
+      continue;
+    }
+
+    if (!strcmp(argv[i], "--cache")) {
+      if (i + 1 == argc) error("--cache にディレクトリがありません");
+      cache_dir = argv[++i];
+      continue;
+    }
+
+    if (!strcmp(argv[i], "--cache-size")) {
+      if (i + 1 == argc) error("--cache-size に大きさがありません");
+      cache_size = atoll(argv[++i]);
+      continue;
+    }
+
+    if (!strcmp(argv[i], "--cache-stats")) {
+      cache_stats = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-c")) {
+      opt_c = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-S")) {
+      opt_S = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-o")) {
+      if (i + 1 == argc) error("-o に出力先がありません");
+      output_path = argv[++i];
+      continue;
+    }
+
+    if (argv[i][0] == '-' && argv[i][1])
+      error("unknown argument: %s", argv[i]);
+    inputs = realloc(inputs, sizeof(char *) * (ninputs + 1));
+    inputs[ninputs++] = argv[i];
+  }
+
+  if (server_path) {
+    if (ninputs) error("--server には入力ファイルを指定できません");
+    return;
+  }
+  if (cache_stats && !cache_dir) error("--cache-stats には --cache が必要です");
+  if (cache_stats && ninputs == 0) return;
+  if (opt_c && opt_S) error("-c と -S は同時に指定できません");
+  if (ninputs == 0 || (!opt_c && !opt_S && ninputs > 1))
     error("引数の個数が正しくありません");
-    return 1;
+}
+
+// 1つのファイルをコンパイルして out_path (NULL なら標準出力) に書く。
+// 診断メッセージはファイルごとにまとめて出力する
+static bool compile_file(char *path, char *out_path, CcOptions *opts) {
+  char *src = read_file(path);
+  if (!src) {
+    fprintf(stderr, "cannot open %s: %s\n", path, strerror(errno));
+    return false;
   }
 
-  // トークナイズしてパースする
-  filename = argv[1];
-  user_input = read_file(filename);
-  token = tokenize();
-  Program *prog = program();
+  // --cache: ヒットすればトークナイズからコード生成までをすべて省く
+  char key[65];
+  CcResult res;
+  bool ok;
+  if (cache_dir) cache_key(path, src, opts, key);
+  if (cache_dir && cache_get(key, path, &res)) {
+    ok = true;
+  } else {
+    ok = client_path ? remote_compile(client_path, path, src, opts, &res)
+                     : cc_compile(path, src, opts, &res);
+    if (ok && cache_dir) cache_put(key, &res);
+  }
+  free(src);
 
-  for (Function *fn = prog->fns; fn; fn = fn->next) {
-    int offset = 0;
-    for (VarList *vl = fn->locals; vl; vl = vl->next) {
-      offset = align_to(offset, vl->var->ty->align);
-      offset += vl->var->ty->size;
-      vl->var->offset = offset;
+  flockfile(stderr);
+  for (CcDiag *d = res.diags; d; d = d->next) fputs(d->text, stderr);
+  funlockfile(stderr);
+
+  // -c: キャッシュから取り出したものも含め、組み込みのアセンブラにかける
+  char *out = res.asm_text;
+  size_t out_len = res.asm_len;
+  if (ok && opt_c) {
+    char *err;
+    ok = assemble(res.asm_text, res.asm_len, &out, &out_len, &err);
+    if (!ok) {
+      fprintf(stderr, "%s: assembler: %s\n", path, err);
+      free(err);
     }
-    fn->stack_size = align_to(offset, 8);
   }
 
-  codegen(prog);
+  if (ok) {
+    FILE *fp = out_path ? fopen(out_path, "wb") : stdout;
+    if (fp) {
+      fwrite(out, 1, out_len, fp);
+      if (out_path) fclose(fp);
+    } else {
+      fprintf(stderr, "cannot open %s: %s\n", out_path, strerror(errno));
+      ok = false;
+    }
+  }
+  if (out != res.asm_text) free(out);
+  cc_free_result(&res);
+  return ok;
+}
+
+//
+// -c, -S: 各スレッドが自分の両端キューからファイルを取り、
+// 空になったら他のスレッドのキューの反対側から盗む
+//
+
+// a/b/foo.c -> <-o のディレクトリ>/foo.o (-o がなければ a/b/foo.o)。
+// -S なら foo.s
+static char *output_for(char *path) {
+  char *base = strrchr(path, '/');
+  base = base ? base + 1 : path;
+  char *dot = strrchr(base, '.');
+  int len = dot && dot != base ? dot - base : strlen(base);
+
+  char *dir = output_path;
+  int dirlen = dir ? strlen(dir) : base - path;
+  if (!dir) dir = path;
+  bool slash = dirlen && dir[dirlen - 1] != '/';
+
+  char *buf = malloc(dirlen + len + 4);
+  sprintf(buf, "%.*s%s%.*s.%c", dirlen, dir, slash ? "/" : "", len, base,
+          opt_c ? 'o' : 's');
+  return buf;
+}
+
+typedef struct {
+  pthread_mutex_t mu;
+  int *files;  // inputs の添字
+  int head;
+  int tail;
+} Deque;
+
+static Deque *deques;
+static int nworkers;
+static CcOptions batch_opts;
+static atomic_bool batch_failed;
+
+// 自分のキューなら先頭から、他のスレッドのキューなら末尾から取る
+static bool take(Deque *d, bool steal, int *file) {
+  pthread_mutex_lock(&d->mu);
+  bool found = d->head < d->tail;
+  if (found) *file = steal ? d->files[--d->tail] : d->files[d->head++];
+  pthread_mutex_unlock(&d->mu);
+  return found;
+}
+
+static void *batch_worker(void *arg) {
+  int id = *(int *)arg;
+  for (;;) {
+    int file;
+    bool found = take(&deques[id], false, &file);
+    for (int i = 1; !found && i < nworkers; i++)
+      found = take(&deques[(id + i) % nworkers], true, &file);
+    if (!found) return NULL;
+
+    char *out = output_for(inputs[file]);
+    if (!compile_file(inputs[file], out, &batch_opts)) batch_failed = true;
+    free(out);
+  }
+}
+
+static bool compile_batch(CcOptions *opts) {
+  // 同じ出力先になるファイルがあれば上書きしてしまうのでエラーにする
+  char **outs = calloc(ninputs, sizeof(char *));
+  for (int i = 0; i < ninputs; i++) {
+    outs[i] = output_for(inputs[i]);
+    for (int j = 0; j < i; j++)
+      if (!strcmp(outs[i], outs[j]))
+        error("%s と %s の出力先が同じです: %s", inputs[j], inputs[i], outs[i]);
+  }
+  for (int i = 0; i < ninputs; i++) free(outs[i]);
+  free(outs);
+
+  if (output_path && mkdir(output_path, 0777) && errno != EEXIST)
+    error("cannot create %s: %s", output_path, strerror(errno));
+
+  // スレッドはファイルの単位で使い、ファイルの中は逐次にコンパイルする
+  nworkers = opts->jobs > 0 ? opts->jobs : sysconf(_SC_NPROCESSORS_ONLN);
+  if (nworkers < 1) nworkers = 1;
+  if (nworkers > ninputs) nworkers = ninputs;
+  batch_opts = *opts;
+  batch_opts.jobs = 1;
+
+  deques = calloc(nworkers, sizeof(Deque));
+  int *ids = calloc(nworkers, sizeof(int));
+  for (int i = 0; i < nworkers; i++) {
+    pthread_mutex_init(&deques[i].mu, NULL);
+    deques[i].files = calloc(ninputs, sizeof(int));
+    ids[i] = i;
+  }
+  for (int i = 0; i < ninputs; i++) {
+    Deque *d = &deques[i % nworkers];
+    d->files[d->tail++] = i;
+  }
+
+  pthread_t *th = calloc(nworkers, sizeof(pthread_t));
+  for (int i = 1; i < nworkers; i++) {
+    // pthread_create は errno ではなく戻り値でエラーを返す
+    int err = pthread_create(&th[i], NULL, batch_worker, &ids[i]);
+    if (err) error("cannot create thread: %s", strerror(err));
+  }
+  batch_worker(&ids[0]);  // このスレッドも 0 番として働く
+  for (int i = 1; i < nworkers; i++) pthread_join(th[i], NULL);
+  return !batch_failed;
+}
+
+int main(int argc, char **argv) {
+  CcOptions opts;
+  cc_default_options(&opts);
+  parse_args(argc, argv, &opts);
+  if (server_path) run_server(server_path);
+  if (cache_dir) {
+    cache_open(cache_dir, cache_size * 1024 * 1024);
+    opts.incremental = true;
+  }
 
-  return 0;
+  bool ok = true;
+  if (ninputs)
+    ok = opt_c || opt_S ? compile_batch(&opts)
+               : compile_file(inputs[0], output_path, &opts);
+  if (cache_dir) cache_close();
+  if (cache_stats) cache_print_stats(stderr);
+  return ok ? 0 : 1;
 }
@@ -1,12 +1,18 @@
+#define _POSIX_C_SOURCE 200809L
 #include <assert.h>
 #include <ctype.h>
 #include <errno.h>
+#include <limits.h>
+#include <setjmp.h>
 #include <stdarg.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+#include "lib9cc.h"
+
 //
 // Tokenizer
 //
@@ -23,12 +29,13 @@ typedef enum {
 } TokenKind;
 
 typedef struct Token Token;
+typedef struct TokenBatch TokenBatch;
 
 // トークン型
 struct Token {
   TokenKind kind;  // トークンの型
   Token *next;     // 次の入力トークン
-  int val;         // kindがTK_NUMの場合、その数値
+  long val;        // kindがTK_NUMの場合、その数値
   char *str;       // トークン文字列
   int len;         // トークンの長さ
 
@@ -37,25 +44,24 @@ struct Token {
   int cont_len;
 };
 
-char *strndup(char *s, size_t n);
 void error(char *fmt, ...);
 void error_at(char *loc, char *fmt, ...);
 void error_tok(Token *tok, char *fmt, ...);
 void warn_tok(Token *tok, char *fmt, ...);
+void note_tok(Token *tok, char *fmt, ...);
 Token *peek(char *s);
 Token *consume(char *op);
 Token *consume_ident(void);
 void expect(char *op);
-int expect_number(void);
+long expect_number(void);
 char *expect_ident(void);
 bool at_eof(void);
 
 Token *tokenize(void);
-
-extern char *filename;
-extern char *user_input;
-
-extern Token *token;
+Token *tokenize_lazy(void);
+Token *next_token(Token *tok);
+void release_tokens(void);
+void free_token_batches(TokenBatch *b);
 
 //
 // Parser
@@ -69,6 +75,9 @@ struct Var {
   int len;
   int offset;
   bool is_local;
+  bool is_static;
+  bool is_live;  // 到達可能な関数から参照されている
+  bool addr_taken;  // アドレスが取られ、ポインタ経由で書き換わりうる
 
   // for string
   char *contents;
@@ -93,7 +102,16 @@ typedef enum {
   ND_NE,         // !=
   ND_LT,         // <
   ND_LE,         // <=
+  ND_LOGAND,     // &&
+  ND_LOGOR,      // ||
+  ND_NOT,        // !
   ND_ASSIGN,     // =
+  ND_ADD_ASSIGN,  // +=
+  ND_SUB_ASSIGN,  // -=
+  ND_MUL_ASSIGN,  // *=
+  ND_DIV_ASSIGN,  // /=
+  ND_POST_INC,    // x++
+  ND_POST_DEC,    // x--
   ND_VAR,        // ローカル変数
   ND_RETURN,     // Return
   ND_EXPR_STMT,  // Expression statement
@@ -101,6 +119,9 @@ typedef enum {
   ND_IF,        // If
   ND_WHILE,     // While
   ND_FOR,       // For
+  ND_SWITCH,    // Switch
+  ND_CASE,      // case または default のラベル
+  ND_BREAK,     // Break
   ND_BLOCK,     // Block
   ND_FUNCALL,   // Function call
   ND_ADDR,      // &
@@ -110,7 +131,13 @@ typedef enum {
   ND_PTR_DIFF,  // ptr - ptr
   ND_MEMBER,
   ND_CAST,
+  ND_SELECT,  // cond ? then : els (分岐なしで両方評価する)
   ND_NULL,
+  ND_VEC_LOAD,   // 16バイト分の要素の読み出し
+  ND_VEC_SPLAT,  // 定数を全要素に並べたベクトル
+  ND_VEC_ADD,    // 要素ごとの +
+  ND_VEC_SUB,    // 要素ごとの -
+  ND_VEC_STORE,  // 16バイト分の要素の書き込み
 } NodeKind;
 
 typedef struct Node Node;
@@ -136,6 +163,11 @@ struct Node {
 
   Node *body;  // "block" statement
 
+  // "switch" statement
+  Node *case_next;     // switch の case のリスト。case 同士もこれでつなぐ
+  Node *default_case;
+  int case_label;
+
   long val;  // kind==ND_NUM
   Var *var;  // kind==ND_LVAR
 
@@ -153,6 +185,19 @@ struct Function {
   VarList *locals;
   VarList *args;
   int stack_size;
+  Type *return_ty;
+  bool is_static;
+  bool is_live;  // 外部から見える関数から到達可能
+
+  // --cache: 関数ごとのキャッシュ
+  char *cache_key;   // NULL ならキャッシュに入れない
+  char *cache_strs;  // 使う文字列リテラル ("S 長さ\n中身\n" の並び)
+  size_t cache_strs_len;
+  bool has_diag;     // 診断メッセージを出したのでキャッシュに入れない
+  char *cached;      // キャッシュから取り出したアセンブリ
+  size_t cached_len;
+  char **refs;  // cached のときに参照するグローバルな名前
+  int nrefs;
 };
 
 typedef struct {
@@ -211,7 +256,117 @@ Type *func_type(Type *return_ty);
 Type *enum_type(void);
 void add_type(Node *node);
 
+//
+// Optimizer
+//
+void optimize(Program *prog);
+void optimize_function(Function *fn);
+void write_refs(Function *fn, FILE *fp);
+
 //
 // Code generator
 //
 void codegen(Program *prog);
+void codegen_begin(void);
+void codegen_function(Function *fn);
+void codegen_end(Program *prog);
+
+//
+// Assembler
+//
+bool assemble(char *text, size_t len, char **obj, size_t *obj_len,
+              char **err);
+
+//
+// Server
+//
+void run_server(char *path);
+bool remote_compile(char *sock, const char *filename, const char *src,
+                    const CcOptions *opts, CcResult *res);
+
+//
+// Cache
+//
+typedef struct {
+  uint32_t h[8];
+  uint64_t len;
+  unsigned char buf[64];
+} Sha256;
+
+void sha256_init(Sha256 *s);
+void sha256_update(Sha256 *s, const void *data, size_t len);
+void sha256_final(Sha256 *s, unsigned char out[32]);
+void sha256_hex(Sha256 *s, char hex[65]);
+
+void cache_open(char *dir, long long max_size);
+void cache_close(void);
+void cache_hash_options(Sha256 *s, const CcOptions *opts);
+void cache_key(const char *filename, const char *src, const CcOptions *opts,
+               char key[65]);
+bool cache_get(char *key, const char *filename, CcResult *res);
+void cache_put(char *key, CcResult *res);
+char *cache_get_function(char *key, size_t *len);
+void cache_put_function(char *key, char *buf, size_t len);
+void cache_print_stats(FILE *fp);
+
+//
+// Compiler context
+//
+typedef struct VarScope VarScope;
+typedef struct TagScope TagScope;
+typedef struct StrEntry StrEntry;
+typedef struct StrRef StrRef;
+typedef struct ArenaBlock ArenaBlock;
+
+#define STR_POOL_SIZE 1024
+
+// 1回のコンパイルが使う状態をすべてまとめたもの。
+// スレッドごとに ctx が現在のコンテキストを指す。
+typedef struct {
+  CcOptions opts;
+
+  // tokenize.c
+  char *filename;
+  char *user_input;  // "\n\0" で終わる入力プログラム
+  Token *token;      // 現在着目しているトークン
+  char *lex_pos;        // -fpipeline: まだトークナイズしていない位置
+  TokenBatch *batches;  // -fpipeline: 読み終わっていないトークン
+
+  // parse.c
+  VarList *locals;
+  VarList *globals;
+  VarScope *var_scope;
+  TagScope *tag_scope;
+  Node *current_switch;
+  StrEntry *str_pool[STR_POOL_SIZE];
+  StrRef *str_refs;  // ラベルをまだ付けていない文字列リテラル
+
+  // opt.c, codegen.c
+  Function *current_fn;
+  Function *functions;
+  int label_counter;
+  int brkseq;  // break の飛び先の .Lend の番号
+  FILE *out;   // アセンブリの出力先
+
+  // --cache: それまでのトップレベルの宣言のハッシュ
+  Sha256 decls;
+
+  // 診断メッセージ。エラーのときは bail へ longjmp する
+  CcDiag *diags;
+  CcDiag *diags_last;
+  Function *diag_fn;  // 診断メッセージを出したら has_diag を立てる関数
+  jmp_buf bail;
+
+  // ノードや型などはすべてここから確保し、コンパイル後にまとめて解放する
+  ArenaBlock *arena;
+  ArenaBlock *scratch;  // -fpipeline: 関数1つの間だけ使うもの
+  ArenaBlock **alloc;   // arena_calloc の確保先
+} Compiler;
+
+extern _Thread_local Compiler *ctx;
+
+void *arena_calloc(size_t n, size_t size);
+char *arena_strndup(char *s, size_t n);
+void free_arena(ArenaBlock *b);
+void emit_function(Function *fn);
+void parallel_for(int n, void (*fn)(int i, void *arg), void *arg);
@@ -0,0 +1,1428 @@
+#include "9cc.h"
+
+//
+// -c: 組み込みのアセンブラ
+//
+// codegen.c が出力する Intel 記法のアセンブリを機械語に直し、ELF の
+// 再配置可能オブジェクトファイルを作る。関数ごとのキャッシュから取り出した
+// アセンブリも同じ形なので、そのまま扱える。命令とディレクティブは
+// codegen.c が使うものだけを受け付ける。
+//
+// 分岐はすべて32ビットの相対アドレスで出力する。.L で始まるラベルへの
+// 参照はこのファイルの中で解決し、それ以外のシンボルへの参照は再配置として残す。
+//
+
+// ELF の定数
+#define SHT_PROGBITS 1
+#define SHT_SYMTAB 2
+#define SHT_STRTAB 3
+#define SHT_RELA 4
+#define SHT_NOBITS 8
+
+#define SHF_WRITE 0x1
+#define SHF_ALLOC 0x2
+#define SHF_EXECINSTR 0x4
+#define SHF_MERGE 0x10
+#define SHF_STRINGS 0x20
+#define SHF_INFO_LINK 0x40
+
+#define STB_LOCAL 0
+#define STB_GLOBAL 1
+#define STT_NOTYPE 0
+#define STT_SECTION 3
+
+#define R_X86_64_PC32 2
+#define R_X86_64_PLT32 4
+#define R_X86_64_GOTPCREL 9
+#define R_X86_64_REX_GOTPCRELX 42
+
+typedef struct {
+  char *data;
+  size_t len;
+  size_t cap;
+} Buf;
+
+static void buf_add(Buf *b, const void *p, size_t n) {
+  if (!n) return;
+  if (b->len + n > b->cap) {
+    b->cap = b->cap ? b->cap * 2 : 256;
+    if (b->cap < b->len + n) b->cap = b->len + n;
+    b->data = realloc(b->data, b->cap);
+  }
+  memcpy(b->data + b->len, p, n);
+  b->len += n;
+}
+
+static void buf_byte(Buf *b, int v) {
+  unsigned char c = v;
+  buf_add(b, &c, 1);
+}
+
+// リトルエンディアンで n バイト書く
+static void buf_int(Buf *b, uint64_t v, int n) {
+  for (int i = 0; i < n; i++) buf_byte(b, v >> (i * 8));
+}
+
+static void put_int(char *p, uint64_t v, int n) {
+  for (int i = 0; i < n; i++) p[i] = v >> (i * 8);
+}
+
+typedef struct Reloc Reloc;
+typedef struct Symbol Symbol;
+
+typedef struct Section Section;
+struct Section {
+  Section *next;
+  char *name;
+  int type;
+  long flags;
+  int entsize;
+  int align;
+  Buf buf;      // SHT_NOBITS では使わない
+  size_t size;  // SHT_NOBITS の大きさ
+  Reloc *relocs;
+  Reloc *relocs_last;
+  int index;  // セクションヘッダの番号
+  int sym;    // セクションシンボルの番号
+};
+
+struct Symbol {
+  Symbol *next;  // ハッシュ表の同じバケット
+  char *name;
+  Section *sec;  // 未定義なら NULL
+  long value;
+  bool global;
+  bool referenced;  // 再配置から参照される
+  int index;        // シンボルテーブルの番号
+
+  // .set name, alias+offset
+  Symbol *alias;
+  long alias_offset;
+};
+
+struct Reloc {
+  Reloc *next;
+  size_t offset;
+  int type;
+  Symbol *sym;  // NULL ならセクションシンボル
+  Section *sec;
+  long addend;
+};
+
+// あとで値を埋める場所
+typedef enum {
+  FIX_PC32,      // 32ビットの相対アドレス
+  FIX_PLT32,     // call
+  FIX_GOTPCREL,  // sym@GOTPCREL[rip]
+  FIX_REX_GOTPCRELX,  // REX の付いた命令の sym@GOTPCREL[rip]
+  FIX_DIFF,      // .long sym-minus
+} FixupKind;
+
+typedef struct Fixup Fixup;
+struct Fixup {
+  Fixup *next;
+  FixupKind kind;
+  Section *sec;
+  size_t offset;
+  Symbol *sym;
+  Symbol *minus;  // FIX_DIFF
+  long addend;
+  int line;
+};
+
+#define SYM_HASH_SIZE 4096
+
+typedef struct {
+  Section *sections;
+  Section *sections_last;
+  Section *cur;
+  Symbol *syms[SYM_HASH_SIZE];
+  Fixup *fixups;
+  Fixup *fixups_last;
+
+  int line;
+  char *err;
+  jmp_buf bail;
+} Asm;
+
+static _Noreturn void asm_error(Asm *as, char *fmt, ...) {
+  va_list ap;
+  va_start(ap, fmt);
+  size_t size;
+  FILE *fp = open_memstream(&as->err, &size);
+  fprintf(fp, "line %d: ", as->line);
+  vfprintf(fp, fmt, ap);
+  fclose(fp);
+  longjmp(as->bail, 1);
+}
+
+//
+// セクションとシンボル
+//
+
+static Section *find_section(Asm *as, char *name, int type, long flags,
+                             int entsize) {
+  for (Section *s = as->sections; s; s = s->next)
+    if (!strcmp(s->name, name)) return s;
+
+  Section *s = calloc(1, sizeof(Section));
+  s->name = strdup(name);
+  s->type = type;
+  s->flags = flags;
+  s->entsize = entsize;
+  s->align = 1;
+  if (as->sections_last)
+    as->sections_last->next = s;
+  else
+    as->sections = s;
+  as->sections_last = s;
+  return s;
+}
+
+static size_t section_size(Section *s) {
+  return s->type == SHT_NOBITS ? s->size : s->buf.len;
+}
+
+static Symbol *find_symbol(Asm *as, char *name, int len) {
+  unsigned h = 2166136261;  // FNV-1a
+  for (int i = 0; i < len; i++) h = (h ^ (unsigned char)name[i]) * 16777619;
+
+  Symbol **bucket = &as->syms[h % SYM_HASH_SIZE];
+  for (Symbol *sym = *bucket; sym; sym = sym->next)
+    if (!strncmp(sym->name, name, len) && !sym->name[len]) return sym;
+
+  Symbol *sym = calloc(1, sizeof(Symbol));
+  sym->name = strndup(name, len);
+  sym->next = *bucket;
+  *bucket = sym;
+  return sym;
+}
+
+// .L で始まるシンボルは、再配置から参照されない限りシンボルテーブルに出さない
+static bool is_local_label(Symbol *sym) {
+  return !strncmp(sym->name, ".L", 2);
+}
+
+static Section *cur_section(Asm *as) {
+  if (!as->cur)
+    as->cur = find_section(as, ".text", SHT_PROGBITS,
+                           SHF_ALLOC | SHF_EXECINSTR, 0);
+  return as->cur;
+}
+
+static Buf *code(Asm *as) {
+  Section *s = cur_section(as);
+  if (s->type == SHT_NOBITS) asm_error(as, "data in %s", s->name);
+  return &s->buf;
+}
+
+static void add_fixup(Asm *as, FixupKind kind, Symbol *sym, long addend) {
+  Fixup *f = calloc(1, sizeof(Fixup));
+  f->kind = kind;
+  f->sec = cur_section(as);
+  f->offset = f->sec->buf.len;
+  f->sym = sym;
+  f->addend = addend;
+  f->line = as->line;
+  if (as->fixups_last)
+    as->fixups_last->next = f;
+  else
+    as->fixups = f;
+  as->fixups_last = f;
+}
+
+//
+// 字句
+//
+
+static char *skip(char *p) {
+  while (*p == ' ' || *p == '\t') p++;
+  return p;
+}
+
+static bool is_ident1(char c) { return isalpha(c) || c == '_' || c == '.'; }
+
+static bool is_ident2(char c) { return isalnum(c) || c == '_' || c == '.'; }
+
+static int ident_len(char *p) {
+  if (!is_ident1(*p)) return 0;
+  int n = 1;
+  while (is_ident2(p[n])) n++;
+  return n;
+}
+
+static bool starts_with(char *p, char *q) {
+  return !strncmp(p, q, strlen(q));
+}
+
+// p が単語 word で始まっていれば、その次を返す
+static char *word(char *p, char *w) {
+  int n = strlen(w);
+  if (strncmp(p, w, n) || is_ident2(p[n])) return NULL;
+  return skip(p + n);
+}
+
+static long number(Asm *as, char **p) {
+  char *end;
+  errno = 0;
+  long v = strtol(*p, &end, 0);
+  if (end == *p || errno) asm_error(as, "bad number: %s", *p);
+  *p = skip(end);
+  return v;
+}
+
+//
+// オペランド
+//
+
+typedef enum { OP_REG, OP_XMM, OP_MEM, OP_IMM, OP_SYM } OpKind;
+
+#define RIP 16
+
+typedef struct {
+  OpKind kind;
+  int size;  // バイト数。メモリで "ptr" がなければ0
+  int reg;   // OP_REG, OP_XMM
+  bool rex;  // spl, bpl, sil, dil は REX が必要
+
+  // OP_MEM: [base + index*scale + disp] または [rip + sym + disp]
+  int base;
+  int index;
+  int scale;
+  long disp;
+
+  Symbol *sym;  // OP_MEM の rip 相対の相手、OP_SYM の飛び先
+  bool got;     // sym@GOTPCREL[rip]
+  long imm;
+} Operand;
+
+static char *regs64[] = {"rax", "rcx", "rdx", "rbx", "rsp", "rbp",
+                         "rsi", "rdi", "r8",  "r9",  "r10", "r11",
+                         "r12", "r13", "r14", "r15"};
+static char *regs32[] = {"eax",  "ecx",  "edx",  "ebx",  "esp",  "ebp",
+                         "esi",  "edi",  "r8d",  "r9d",  "r10d", "r11d",
+                         "r12d", "r13d", "r14d", "r15d"};
+static char *regs16[] = {"ax",   "cx",   "dx",   "bx",   "sp",   "bp",
+                         "si",   "di",   "r8w",  "r9w",  "r10w", "r11w",
+                         "r12w", "r13w", "r14w", "r15w"};
+static char *regs8[] = {"al",   "cl",   "dl",   "bl",   "spl",  "bpl",
+                        "sil",  "dil",  "r8b",  "r9b",  "r10b", "r11b",
+                        "r12b", "r13b", "r14b", "r15b"};
+
+// name がレジスタならその番号と大きさを返す
+static bool parse_reg(char *name, int len, Operand *op) {
+  char **tables[] = {regs64, regs32, regs16, regs8};
+  int sizes[] = {8, 4, 2, 1};
+  for (int t = 0; t < 4; t++) {
+    for (int i = 0; i < 16; i++) {
+      if (strlen(tables[t][i]) == len && !strncmp(tables[t][i], name, len)) {
+        *op = (Operand){OP_REG, sizes[t], i};
+        op->rex = sizes[t] == 1 && 4 <= i && i < 8;
+        return true;
+      }
+    }
+  }
+  if (len >= 4 && !strncmp(name, "xmm", 3)) {
+    int n = atoi(name + 3);
+    if (n < 16) {
+      *op = (Operand){OP_XMM, 16, n};
+      return true;
+    }
+  }
+  return false;
+}
+
+static void parse_mem(Asm *as, char **rest, Operand *op) {
+  char *p = skip(*rest + 1);
+  op->kind = OP_MEM;
+  op->base = op->index = -1;
+  op->scale = 1;
+
+  int sign = 1;
+  for (;;) {
+    int len = ident_len(p);
+    Operand r;
+    if (len == 3 && !strncmp(p, "rip", 3) && op->base == -1) {
+      op->base = RIP;
+      p = skip(p + len);
+    } else if (len && op->base == RIP) {
+      // rip の後ろの名前は、rax のようにレジスタと同じ名前でもシンボル
+      if (op->sym) asm_error(as, "bad address: %s", *rest);
+      op->sym = find_symbol(as, p, len);
+      p = skip(p + len);
+    } else if (len && parse_reg(p, len, &r)) {
+      if (r.kind != OP_REG || r.size != 8)
+        asm_error(as, "bad address register");
+      p = skip(p + len);
+      if (*p == '*') {
+        p = skip(p + 1);
+        op->index = r.reg;
+        op->scale = number(as, &p);
+      } else if (op->base == -1) {
+        op->base = r.reg;
+      } else {
+        op->index = r.reg;
+      }
+    } else if (len) {
+      op->sym = find_symbol(as, p, len);
+      p = skip(p + len);
+    } else {
+      op->disp += sign * number(as, &p);
+    }
+
+    if (*p == ']') break;
+    if (*p != '+' && *p != '-') asm_error(as, "bad address: %s", *rest);
+    sign = *p == '+' ? 1 : -1;
+    p = skip(p + 1);
+    if (*p == '-') {
+      // [rbp+-8] のような形
+      sign = -sign;
+      p = skip(p + 1);
+    }
+  }
+
+  if (op->sym && op->base != RIP)
+    asm_error(as, "absolute address is not supported");
+  if (op->index == 4) asm_error(as, "rsp cannot be an index");
+  *rest = skip(p + 1);
+}
+
+static void parse_operand(Asm *as, char **rest, Operand *op) {
+  char *p = *rest;
+  *op = (Operand){0};
+
+  int size = 0;
+  char *q;
+  if ((q = word(p, "byte")))
+    size = 1;
+  else if ((q = word(p, "word")))
+    size = 2;
+  else if ((q = word(p, "dword")))
+    size = 4;
+  else if ((q = word(p, "qword")))
+    size = 8;
+  if (size) {
+    if (!(q = word(q, "ptr"))) asm_error(as, "expected ptr");
+    p = q;
+  }
+
+  if (*p == '[') {
+    *rest = p;
+    parse_mem(as, rest, op);
+    op->size = size;
+    return;
+  }
+
+  int len = ident_len(p);
+  if (len && p[len] != '@' && parse_reg(p, len, op)) {
+    *rest = skip(p + len);
+    return;
+  }
+
+  if (len) {
+    // sym, sym@PLT, sym@GOTPCREL[rip]
+    Symbol *sym = find_symbol(as, p, len);
+    p += len;
+    if (starts_with(p, "@PLT")) {
+      p += 4;
+    } else if (starts_with(p, "@GOTPCREL[rip]")) {
+      *op = (Operand){OP_MEM, size, .base = RIP, .index = -1, .scale = 1};
+      op->sym = sym;
+      op->got = true;
+      *rest = skip(p + 14);
+      return;
+    }
+    *op = (Operand){OP_SYM};
+    op->sym = sym;
+    *rest = skip(p);
+    return;
+  }
+
+  *op = (Operand){OP_IMM};
+  op->imm = number(as, &p);
+  *rest = p;
+}
+
+//
+// 命令のエンコード
+//
+
+static bool is_imm8(long v) { return -128 <= v && v <= 127; }
+static bool is_imm32(long v) { return v == (int)v; }
+
+// prefix (0x66 や 0xf3)、REX、opcode、ModR/M、SIB、変位、即値の順に出力する。
+// rm が NULL なら ModR/M を出力しない (opcode に r を足す形)
+static void encode(Asm *as, int prefix, bool w, char *opcode, int oplen,
+                   int reg, bool reg_rex, Operand *rm, int immsize,
+                   long imm) {
+  Buf *b = code(as);
+  if (prefix) buf_byte(b, prefix);
+
+  int rex = (w ? 8 : 0) | (reg >= 8 ? 4 : 0);
+  if (rm && rm->kind == OP_MEM) {
+    if (rm->index >= 8) rex |= 2;
+    if (rm->base >= 8 && rm->base != RIP) rex |= 1;
+  } else if (rm && rm->reg >= 8) {
+    rex |= 1;
+  }
+  bool has_rex = rex || reg_rex || (rm && rm->rex);
+  if (has_rex) buf_byte(b, 0x40 | rex);
+  buf_add(b, opcode, oplen);
+
+  if (!rm) {
+    if (immsize) buf_int(b, imm, immsize);
+    return;
+  }
+
+  int r = (reg & 7) << 3;
+  if (rm->kind != OP_MEM) {
+    buf_byte(b, 0xc0 | r | (rm->reg & 7));
+  } else if (rm->base == RIP) {
+    if (!rm->sym) asm_error(as, "rip-relative address without symbol");
+    buf_byte(b, 0x05 | r);
+    // GOT からの読み込みは、リンカが lea に書き換えられるよう
+    // REX_GOTPCRELX にする
+    FixupKind kind = FIX_PC32;
+    if (rm->got) kind = has_rex ? FIX_REX_GOTPCRELX : FIX_GOTPCREL;
+    // 変位は命令の終わりからの距離なので、後ろの即値の分も引く
+    add_fixup(as, kind, rm->sym, rm->disp - 4 - immsize);
+    buf_int(b, 0, 4);
+  } else {
+    if (rm->base < 0) asm_error(as, "address without base register");
+    int mod = 2;
+    if (rm->disp == 0 && (rm->base & 7) != 5)
+      mod = 0;
+    else if (is_imm8(rm->disp))
+      mod = 1;
+    else if (!is_imm32(rm->disp))
+      asm_error(as, "displacement too large");
+
+    if (rm->index < 0 && (rm->base & 7) != 4) {
+      buf_byte(b, mod << 6 | r | (rm->base & 7));
+    } else {
+      int ss = rm->scale == 8 ? 3 : rm->scale == 4 ? 2 : rm->scale == 2;
+      if (rm->scale != 1 << ss) asm_error(as, "bad scale");
+      int index = rm->index < 0 ? 4 : rm->index & 7;
+      buf_byte(b, mod << 6 | r | 4);
+      buf_byte(b, ss << 6 | index << 3 | (rm->base & 7));
+    }
+    if (mod == 1) buf_byte(b, rm->disp);
+    if (mod == 2) buf_int(b, rm->disp, 4);
+  }
+
+  if (immsize) buf_int(b, imm, immsize);
+}
+
+static void op1(Asm *as, int prefix, bool w, int opcode, int reg,
+                bool reg_rex, Operand *rm) {
+  char c = opcode;
+  encode(as, prefix, w, &c, 1, reg, reg_rex, rm, 0, 0);
+}
+
+static void op2(Asm *as, int prefix, bool w, int opcode, int reg,
+                bool reg_rex, Operand *rm) {
+  char c[] = {0x0f, opcode};
+  encode(as, prefix, w, c, 2, reg, reg_rex, rm, 0, 0);
+}
+
+// 条件コード
+static int cond_code(char *cc) {
+  static char *names[][3] = {
+      {"o"},        {"no"},       {"b", "c", "nae"}, {"ae", "nb", "nc"},
+      {"e", "z"},   {"ne", "nz"}, {"be", "na"},      {"a", "nbe"},
+      {"s"},        {"ns"},       {"p", "pe"},       {"np", "po"},
+      {"l", "nge"}, {"ge", "nl"}, {"le", "ng"},      {"g", "nle"},
+  };
+  for (int i = 0; i < 16; i++)
+    for (int j = 0; j < 3 && names[i][j]; j++)
+      if (!strcmp(cc, names[i][j])) return i;
+  return -1;
+}
+
+// オペランドの大きさ。両方わからなければエラー
+static int operand_size(Asm *as, Operand *a, Operand *b) {
+  int size = a->size ? a->size : b ? b->size : 0;
+  if (!size || size == 16) asm_error(as, "unknown operand size");
+  return size;
+}
+
+static int size_prefix(int size) { return size == 2 ? 0x66 : 0; }
+
+// add, or, and, sub, xor, cmp
+static void alu(Asm *as, int n, Operand *dst, Operand *src) {
+  if (dst->kind != OP_REG && dst->kind != OP_MEM)
+    asm_error(as, "bad operand");
+  int size = operand_size(as, dst, src->kind == OP_IMM ? NULL : src);
+  int pre = size_prefix(size);
+  bool w = size == 8;
+
+  if (src->kind == OP_IMM) {
+    char c;
+    int immsize;
+    if (size == 1) {
+      c = 0x80;
+      immsize = 1;
+    } else if (is_imm8(src->imm)) {
+      c = 0x83;
+      immsize = 1;
+    } else {
+      c = 0x81;
+      immsize = size == 2 ? 2 : 4;
+      if (!is_imm32(src->imm)) asm_error(as, "immediate too large");
+    }
+    encode(as, pre, w, &c, 1, n, false, dst, immsize, src->imm);
+    return;
+  }
+
+  if (src->kind == OP_REG) {
+    op1(as, pre, w, n << 3 | (size == 1 ? 0 : 1), src->reg, src->rex, dst);
+    return;
+  }
+  if (src->kind == OP_MEM && dst->kind == OP_REG) {
+    op1(as, pre, w, n << 3 | (size == 1 ? 2 : 3), dst->reg, dst->rex, src);
+    return;
+  }
+  asm_error(as, "bad operand");
+}
+
+static void mov(Asm *as, Operand *dst, Operand *src) {
+  if (src->kind == OP_IMM) {
+    int size = operand_size(as, dst, NULL);
+    int pre = size_prefix(size);
+    if (dst->kind == OP_REG && size != 8) {
+      // mov r, imm
+      char c = (size == 1 ? 0xb0 : 0xb8) + (dst->reg & 7);
+      Buf *b = code(as);
+      if (pre) buf_byte(b, pre);
+      if (dst->reg >= 8 || dst->rex) buf_byte(b, 0x40 | (dst->reg >= 8));
+      buf_add(b, &c, 1);
+      buf_int(b, src->imm, size);
+      return;
+    }
+    if (!is_imm32(src->imm)) asm_error(as, "immediate too large");
+    char c = size == 1 ? 0xc6 : 0xc7;
+    encode(as, pre, size == 8, &c, 1, 0, false, dst, size == 8 ? 4 : size,
+           src->imm);
+    return;
+  }
+
+  int size = operand_size(as, dst, src);
+  int pre = size_prefix(size);
+  if (src->kind == OP_REG) {
+    op1(as, pre, size == 8, size == 1 ? 0x88 : 0x89, src->reg, src->rex,
+        dst);
+    return;
+  }
+  if (dst->kind == OP_REG && src->kind == OP_MEM) {
+    op1(as, pre, size == 8, size == 1 ? 0x8a : 0x8b, dst->reg, dst->rex,
+        src);
+    return;
+  }
+  asm_error(as, "bad operand");
+}
+
+// opcode に レジスタ番号を足す形 (push, pop, movabs)
+static void short_reg(Asm *as, bool w, int opcode, Operand *r, int immsize,
+                      long imm) {
+  char c = opcode + (r->reg & 7);
+  Buf *b = code(as);
+  if (w || r->reg >= 8) buf_byte(b, 0x40 | (w ? 8 : 0) | (r->reg >= 8));
+  buf_add(b, &c, 1);
+  if (immsize) buf_int(b, imm, immsize);
+}
+
+static void branch(Asm *as, char *opcode, int oplen, FixupKind kind,
+                   Operand *target) {
+  if (target->kind != OP_SYM) asm_error(as, "bad branch target");
+  buf_add(code(as), opcode, oplen);
+  add_fixup(as, kind, target->sym, -4);
+  buf_int(code(as), 0, 4);
+}
+
+static bool is_reg(Operand *op, int size) {
+  return op->kind == OP_REG && (!size || op->size == size);
+}
+
+static bool is_rm(Operand *op) {
+  return op->kind == OP_REG || op->kind == OP_MEM;
+}
+
+static void instruction(Asm *as, char *p) {
+  int len = ident_len(p);
+  if (!len) asm_error(as, "syntax error: %s", p);
+  char name[16];
+  if (len >= sizeof(name)) asm_error(as, "unknown instruction: %s", p);
+  memcpy(name, p, len);
+  name[len] = '\0';
+  p = skip(p + len);
+
+  if (!strcmp(name, "rep")) {
+    if (word(p, "stosb"))
+      buf_add(code(as), "\xf3\xaa", 2);
+    else if (word(p, "movsb"))
+      buf_add(code(as), "\xf3\xa4", 2);
+    else
+      asm_error(as, "unknown instruction: rep %s", p);
+    return;
+  }
+
+  Operand ops[3];
+  int nops = 0;
+  while (*p) {
+    if (nops == 3) asm_error(as, "too many operands");
+    parse_operand(as, &p, &ops[nops++]);
+    if (*p == ',')
+      p = skip(p + 1);
+    else if (*p)
+      asm_error(as, "syntax error: %s", p);
+  }
+  Operand *a = &ops[0];
+  Operand *b = &ops[1];
+
+#define NOPS(n) \
+  if (nops != n) asm_error(as, "%s takes %d operands", name, n)
+
+  static char *alu_names[] = {"add", "or", NULL, NULL, "and", "sub", "xor",
+                              "cmp"};
+  for (int i = 0; i < 8; i++) {
+    if (alu_names[i] && !strcmp(name, alu_names[i])) {
+      NOPS(2);
+      alu(as, i, a, b);
+      return;
+    }
+  }
+
+  if (!strcmp(name, "mov")) {
+    NOPS(2);
+    mov(as, a, b);
+    return;
+  }
+
+  if (!strcmp(name, "movabs")) {
+    NOPS(2);
+    if (!is_reg(a, 8) || b->kind != OP_IMM) asm_error(as, "bad operand");
+    short_reg(as, true, 0xb8, a, 8, b->imm);
+    return;
+  }
+
+  if (!strcmp(name, "push")) {
+    NOPS(1);
+    if (is_reg(a, 8)) {
+      short_reg(as, false, 0x50, a, 0, 0);
+    } else if (a->kind == OP_IMM && is_imm8(a->imm)) {
+      buf_byte(code(as), 0x6a);
+      buf_byte(code(as), a->imm);
+    } else if (a->kind == OP_IMM && is_imm32(a->imm)) {
+      buf_byte(code(as), 0x68);
+      buf_int(code(as), a->imm, 4);
+    } else {
+      asm_error(as, "bad operand");
+    }
+    return;
+  }
+
+  if (!strcmp(name, "pop")) {
+    NOPS(1);
+    if (!is_reg(a, 8)) asm_error(as, "bad operand");
+    short_reg(as, false, 0x58, a, 0, 0);
+    return;
+  }
+
+  if (!strcmp(name, "lea")) {
+    NOPS(2);
+    if (!is_reg(a, 0) || b->kind != OP_MEM) asm_error(as, "bad operand");
+    op1(as, size_prefix(a->size), a->size == 8, 0x8d, a->reg, false, b);
+    return;
+  }
+
+  if (!strcmp(name, "imul")) {
+    if (nops == 2 && b->kind == OP_IMM) {
+      ops[2] = *b;
+      *b = *a;
+      nops = 3;
+    }
+    if (!is_reg(a, 0) || !is_rm(b)) asm_error(as, "bad operand");
+    int pre = size_prefix(a->size);
+    if (nops == 2) {
+      op2(as, pre, a->size == 8, 0xaf, a->reg, false, b);
+      return;
+    }
+    NOPS(3);
+    long imm = ops[2].imm;
+    if (ops[2].kind != OP_IMM || !is_imm32(imm)) asm_error(as, "bad operand");
+    char c = is_imm8(imm) ? 0x6b : 0x69;
+    encode(as, pre, a->size == 8, &c, 1, a->reg, false, b,
+           is_imm8(imm) ? 1 : a->size == 2 ? 2 : 4, imm);
+    return;
+  }
+
+  if (!strcmp(name, "idiv")) {
+    NOPS(1);
+    int size = operand_size(as, a, NULL);
+    op1(as, size_prefix(size), size == 8, size == 1 ? 0xf6 : 0xf7, 7, false,
+        a);
+    return;
+  }
+
+  if (!strcmp(name, "cqo")) {
+    buf_add(code(as), "\x48\x99", 2);
+    return;
+  }
+  if (!strcmp(name, "cdq")) {
+    buf_byte(code(as), 0x99);
+    return;
+  }
+  if (!strcmp(name, "ret")) {
+    buf_byte(code(as), 0xc3);
+    return;
+  }
+
+  if (!strcmp(name, "movsxd")) {
+    NOPS(2);
+    if (!is_reg(a, 8) || !is_rm(b)) asm_error(as, "bad operand");
+    op1(as, 0, true, 0x63, a->reg, false, b);
+    return;
+  }
+
+  if (!strcmp(name, "movsx") || !strcmp(name, "movzx")) {
+    NOPS(2);
+    if (!is_reg(a, 0) || !is_rm(b)) asm_error(as, "bad operand");
+    int size = operand_size(as, b, NULL);
+    if (size > 2) asm_error(as, "bad operand");
+    int opcode = (name[3] == 's' ? 0xbe : 0xb6) + (size == 2);
+    op2(as, size_prefix(a->size), a->size == 8, opcode, a->reg, false, b);
+    return;
+  }
+
+  if (!strncmp(name, "set", 3) && cond_code(name + 3) >= 0) {
+    NOPS(1);
+    if (!is_rm(a) || (a->size && a->size != 1)) asm_error(as, "bad operand");
+    op2(as, 0, false, 0x90 + cond_code(name + 3), 0, false, a);
+    return;
+  }
+
+  if (!strncmp(name, "cmov", 4) && cond_code(name + 4) >= 0) {
+    NOPS(2);
+    if (!is_reg(a, 0) || !is_rm(b)) asm_error(as, "bad operand");
+    op2(as, size_prefix(a->size), a->size == 8, 0x40 + cond_code(name + 4),
+        a->reg, false, b);
+    return;
+  }
+
+  if (!strcmp(name, "jmp")) {
+    NOPS(1);
+    if (is_reg(a, 8))
+      op1(as, 0, false, 0xff, 4, false, a);
+    else
+      branch(as, "\xe9", 1, FIX_PC32, a);
+    return;
+  }
+
+  if (!strcmp(name, "call")) {
+    NOPS(1);
+    if (is_reg(a, 8))
+      op1(as, 0, false, 0xff, 2, false, a);
+    else
+      branch(as, "\xe8", 1, FIX_PLT32, a);
+    return;
+  }
+
+  if (name[0] == 'j' && cond_code(name + 1) >= 0) {
+    NOPS(1);
+    char c[] = {0x0f, 0x80 + cond_code(name + 1)};
+    branch(as, c, 2, FIX_PC32, a);
+    return;
+  }
+
+  // SSE2
+  if (!strcmp(name, "movq")) {
+    NOPS(2);
+    if (a->kind == OP_XMM && is_reg(b, 8))
+      op2(as, 0x66, true, 0x6e, a->reg, false, b);
+    else if (is_reg(a, 8) && b->kind == OP_XMM)
+      op2(as, 0x66, true, 0x7e, b->reg, false, a);
+    else
+      asm_error(as, "bad operand");
+    return;
+  }
+
+  if (!strcmp(name, "movdqu")) {
+    NOPS(2);
+    if (a->kind == OP_XMM && (b->kind == OP_XMM || b->kind == OP_MEM))
+      op2(as, 0xf3, false, 0x6f, a->reg, false, b);
+    else if (a->kind == OP_MEM && b->kind == OP_XMM)
+      op2(as, 0xf3, false, 0x7f, b->reg, false, a);
+    else
+      asm_error(as, "bad operand");
+    return;
+  }
+
+  static struct {
+    char *name;
+    int opcode;
+  } sse[] = {
+      {"punpcklqdq", 0x6c}, {"paddb", 0xfc}, {"paddw", 0xfd},
+      {"paddd", 0xfe},      {"paddq", 0xd4}, {"psubb", 0xf8},
+      {"psubw", 0xf9},      {"psubd", 0xfa}, {"psubq", 0xfb},
+  };
+  for (int i = 0; i < sizeof(sse) / sizeof(*sse); i++) {
+    if (!strcmp(name, sse[i].name)) {
+      NOPS(2);
+      if (a->kind != OP_XMM || (b->kind != OP_XMM && b->kind != OP_MEM))
+        asm_error(as, "bad operand");
+      op2(as, 0x66, false, sse[i].opcode, a->reg, false, b);
+      return;
+    }
+  }
+
+#undef NOPS
+  asm_error(as, "unknown instruction: %s", name);
+}
+
+//
+// ディレクティブ
+//
+
+// "..." を読んで中身を b に足す
+static void string_literal(Asm *as, char **rest, Buf *b) {
+  char *p = *rest;
+  if (*p++ != '"') asm_error(as, "expected string");
+  while (*p != '"') {
+    if (!*p) asm_error(as, "unterminated string");
+    if (*p != '\\') {
+      buf_byte(b, *p++);
+      continue;
+    }
+    p++;
+    if ('0' <= *p && *p <= '7') {
+      int c = 0;
+      for (int i = 0; i < 3 && '0' <= *p && *p <= '7'; i++)
+        c = c * 8 + *p++ - '0';
+      buf_byte(b, c);
+      continue;
+    }
+    switch (*p) {
+      case 'n':
+        buf_byte(b, '\n');
+        break;
+      case 't':
+        buf_byte(b, '\t');
+        break;
+      default:
+        buf_byte(b, *p);
+    }
+    p++;
+  }
+  *rest = skip(p + 1);
+}
+
+static Symbol *symbol_operand(Asm *as, char **rest) {
+  int len = ident_len(*rest);
+  if (!len) asm_error(as, "expected symbol: %s", *rest);
+  Symbol *sym = find_symbol(as, *rest, len);
+  *rest = skip(*rest + len);
+  return sym;
+}
+
+// .section name[,"flags",@type[,entsize]]
+static void section_directive(Asm *as, char *p) {
+  int len = 0;
+  while (p[len] && p[len] != ',' && p[len] != ' ') len++;
+  char *name = strndup(p, len);
+  p = skip(p + len);
+
+  int type = SHT_PROGBITS;
+  long flags = 0;
+  int entsize = 0;
+  if (*p == ',') {
+    p = skip(p + 1);
+    Buf b = {0};
+    string_literal(as, &p, &b);
+    for (size_t i = 0; i < b.len; i++) {
+      switch (b.data[i]) {
+        case 'a':
+          flags |= SHF_ALLOC;
+          break;
+        case 'w':
+          flags |= SHF_WRITE;
+          break;
+        case 'x':
+          flags |= SHF_EXECINSTR;
+          break;
+        case 'M':
+          flags |= SHF_MERGE;
+          break;
+        case 'S':
+          flags |= SHF_STRINGS;
+          break;
+        default:
+          asm_error(as, "unknown section flag: %c", b.data[i]);
+      }
+    }
+    free(b.data);
+
+    if (*p == ',') {
+      p = skip(p + 1);
+      if (word(p, "@nobits")) type = SHT_NOBITS;
+      p = skip(p + ident_len(p + 1) + 1);
+    }
+    if (*p == ',') {
+      p = skip(p + 1);
+      entsize = number(as, &p);
+    }
+  } else if (starts_with(name, ".rodata")) {
+    flags = SHF_ALLOC;
+  } else if (starts_with(name, ".text")) {
+    flags = SHF_ALLOC | SHF_EXECINSTR;
+  } else if (starts_with(name, ".data")) {
+    flags = SHF_ALLOC | SHF_WRITE;
+  } else if (starts_with(name, ".bss")) {
+    type = SHT_NOBITS;
+    flags = SHF_ALLOC | SHF_WRITE;
+  }
+
+  as->cur = find_section(as, name, type, flags, entsize);
+  free(name);
+}
+
+static void directive(Asm *as, char *p) {
+  char *q;
+
+  if (word(p, ".intel_syntax")) return;
+
+  if (word(p, ".text")) {
+    as->cur = NULL;
+    cur_section(as);
+    return;
+  }
+
+  if (word(p, ".bss")) {
+    as->cur = find_section(as, ".bss", SHT_NOBITS, SHF_ALLOC | SHF_WRITE, 0);
+    return;
+  }
+
+  if ((q = word(p, ".section"))) {
+    section_directive(as, q);
+    return;
+  }
+
+  if ((q = word(p, ".global")) || (q = word(p, ".globl"))) {
+    symbol_operand(as, &q)->global = true;
+    return;
+  }
+
+  if ((q = word(p, ".align"))) {
+    Section *s = cur_section(as);
+    long align = number(as, &q);
+    if (align <= 0 || (align & (align - 1))) asm_error(as, "bad alignment");
+    if (s->align < align) s->align = align;
+    size_t size = align_to(section_size(s), align);
+    if (s->type == SHT_NOBITS)
+      s->size = size;
+    else
+      while (s->buf.len < size) buf_byte(&s->buf, 0);
+    return;
+  }
+
+  if ((q = word(p, ".zero"))) {
+    Section *s = cur_section(as);
+    long n = number(as, &q);
+    if (s->type == SHT_NOBITS)
+      s->size += n;
+    else
+      while (n--) buf_byte(&s->buf, 0);
+    return;
+  }
+
+  if ((q = word(p, ".string")) || (q = word(p, ".ascii"))) {
+    Buf *b = code(as);
+    string_literal(as, &q, b);
+    if (p[1] == 's') buf_byte(b, 0);
+    return;
+  }
+
+  if ((q = word(p, ".long"))) {
+    // .long 数 または .long sym-sym
+    if (!is_ident1(*q)) {
+      buf_int(code(as), number(as, &q), 4);
+      return;
+    }
+    Symbol *sym = symbol_operand(as, &q);
+    if (*q != '-') asm_error(as, "expected sym-sym");
+    q = skip(q + 1);
+    code(as);
+    add_fixup(as, FIX_DIFF, sym, 0);
+    as->fixups_last->minus = symbol_operand(as, &q);
+    buf_int(code(as), 0, 4);
+    return;
+  }
+
+  if ((q = word(p, ".set"))) {
+    Symbol *sym = symbol_operand(as, &q);
+    if (*q != ',') asm_error(as, "expected ','");
+    q = skip(q + 1);
+    sym->alias = symbol_operand(as, &q);
+    if (*q == '+' || *q == '-') sym->alias_offset = number(as, &q);
+    return;
+  }
+
+  asm_error(as, "unknown directive: %s", p);
+}
+
+static void label(Asm *as, char *name, int len) {
+  Symbol *sym = find_symbol(as, name, len);
+  if (sym->sec || sym->alias) asm_error(as, "%s redefined", sym->name);
+  sym->sec = cur_section(as);
+  sym->value = section_size(sym->sec);
+}
+
+static void assemble_line(Asm *as, char *p) {
+  p = skip(p);
+  if (!*p) return;
+
+  int len = ident_len(p);
+  if (len && p[len] == ':') {
+    label(as, p, len);
+    p = skip(p + len + 1);
+    if (!*p) return;
+  }
+
+  if (*p == '.')
+    directive(as, p);
+  else
+    instruction(as, p);
+}
+
+//
+// 参照の解決
+//
+
+// .set で定義したシンボルを定義元のセクションとオフセットに置き換える
+static void resolve_alias(Asm *as, Symbol *sym, int depth) {
+  if (!sym->alias || sym->sec) return;
+  if (depth > 100) asm_error(as, "%s: circular .set", sym->name);
+  resolve_alias(as, sym->alias, depth + 1);
+  if (!sym->alias->sec) asm_error(as, "%s: undefined in .set", sym->name);
+  sym->sec = sym->alias->sec;
+  sym->value = sym->alias->value + sym->alias_offset;
+}
+
+static void add_reloc(Section *sec, size_t offset, int type, Symbol *sym,
+                      long addend) {
+  Reloc *r = calloc(1, sizeof(Reloc));
+  r->offset = offset;
+  r->type = type;
+  // このファイルの中で閉じたシンボルはセクションからのオフセットで表す。
+  // ただしマージされるセクションでは、リンカが文字列ごとに置き場所を
+  // 決めるのでシンボルそのものを参照する。GOT の項目もシンボルごとにある
+  bool got = type == R_X86_64_GOTPCREL || type == R_X86_64_REX_GOTPCRELX;
+  if (sym->sec && !sym->global && !(sym->sec->flags & SHF_MERGE) && !got) {
+    r->sec = sym->sec;
+    r->addend = addend + sym->value;
+  } else {
+    r->sym = sym;
+    r->addend = addend;
+    sym->referenced = true;
+  }
+  if (sec->relocs_last)
+    sec->relocs_last->next = r;
+  else
+    sec->relocs = r;
+  sec->relocs_last = r;
+}
+
+static void resolve(Asm *as, Fixup *f) {
+  as->line = f->line;
+  char *loc = f->sec->buf.data + f->offset;
+  Symbol *sym = f->sym;
+
+  if (f->kind == FIX_DIFF) {
+    // .long sym-minus。minus はこのセクションになければならない
+    Symbol *minus = f->minus;
+    if (minus->sec != f->sec) asm_error(as, "bad expression");
+    if (sym->sec == f->sec) {
+      put_int(loc, sym->value - minus->value, 4);
+      return;
+    }
+    if (!sym->sec && is_local_label(sym))
+      asm_error(as, "undefined label: %s", sym->name);
+    add_reloc(f->sec, f->offset, R_X86_64_PC32, sym,
+              f->offset - minus->value);
+    return;
+  }
+
+  if (!sym->sec && is_local_label(sym))
+    asm_error(as, "undefined label: %s", sym->name);
+
+  if (f->kind == FIX_GOTPCREL || f->kind == FIX_REX_GOTPCRELX) {
+    add_reloc(f->sec, f->offset,
+              f->kind == FIX_GOTPCREL ? R_X86_64_GOTPCREL
+                                      : R_X86_64_REX_GOTPCRELX,
+              sym, f->addend);
+    return;
+  }
+
+  // 同じセクションのローカルなシンボルならここで距離が決まる
+  if (sym->sec == f->sec && !sym->global) {
+    long v = sym->value + f->addend - (long)f->offset;
+    if (!is_imm32(v)) asm_error(as, "branch too far");
+    put_int(loc, v, 4);
+    return;
+  }
+  add_reloc(f->sec, f->offset,
+            f->kind == FIX_PLT32 ? R_X86_64_PLT32 : R_X86_64_PC32, sym,
+            f->addend);
+}
+
+//
+// ELF の出力
+//
+
+static int add_str(Buf *strtab, char *s) {
+  int off = strtab->len;
+  buf_add(strtab, s, strlen(s) + 1);
+  return off;
+}
+
+static void pad(Buf *b, int align) {
+  while (b->len % align) buf_byte(b, 0);
+}
+
+static void symbol_entry(Buf *symtab, int name, int bind, int type, int shndx,
+                         long value) {
+  buf_int(symtab, name, 4);
+  buf_byte(symtab, bind << 4 | type);
+  buf_byte(symtab, 0);
+  buf_int(symtab, shndx, 2);
+  buf_int(symtab, value, 8);
+  buf_int(symtab, 0, 8);
+}
+
+static void section_header(Buf *b, int name, int type, long flags,
+                           size_t offset, size_t size, int link, int info,
+                           int align, int entsize) {
+  buf_int(b, name, 4);
+  buf_int(b, type, 4);
+  buf_int(b, flags, 8);
+  buf_int(b, 0, 8);  // addr
+  buf_int(b, offset, 8);
+  buf_int(b, size, 8);
+  buf_int(b, link, 4);
+  buf_int(b, info, 4);
+  buf_int(b, align, 8);
+  buf_int(b, entsize, 8);
+}
+
+static int cmp_symbol(const void *a, const void *b) {
+  return strcmp((*(Symbol **)a)->name, (*(Symbol **)b)->name);
+}
+
+static void write_elf(Asm *as, Buf *out) {
+  // セクションの番号: 0 は空、続いて中身のあるセクション、
+  // .rela.*、.symtab、.strtab、.shstrtab の順
+  int nsecs = 0;
+  for (Section *s = as->sections; s; s = s->next) s->index = ++nsecs;
+  int nrela = 0;
+  for (Section *s = as->sections; s; s = s->next)
+    if (s->relocs) nrela++;
+  int symtab_idx = nsecs + nrela + 1;
+  int strtab_idx = symtab_idx + 1;
+  int shstrtab_idx = strtab_idx + 1;
+  int shnum = shstrtab_idx + 1;
+
+  // 出力するシンボルを集めて名前順に並べる。ローカルなものが先
+  int nsyms = 0;
+  Symbol **syms = NULL;
+  for (int i = 0; i < SYM_HASH_SIZE; i++) {
+    for (Symbol *sym = as->syms[i]; sym; sym = sym->next) {
+      if (!sym->referenced && (is_local_label(sym) || !sym->sec)) continue;
+      syms = realloc(syms, sizeof(Symbol *) * (nsyms + 1));
+      syms[nsyms++] = sym;
+    }
+  }
+  qsort(syms, nsyms, sizeof(Symbol *), cmp_symbol);
+
+  Buf strtab = {0};
+  Buf symtab = {0};
+  buf_byte(&strtab, 0);
+  symbol_entry(&symtab, 0, 0, 0, 0, 0);
+  int idx = 1;
+  for (Section *s = as->sections; s; s = s->next) {
+    s->sym = idx++;
+    symbol_entry(&symtab, 0, STB_LOCAL, STT_SECTION, s->index, 0);
+  }
+  for (int pass = 0; pass < 2; pass++) {
+    for (int i = 0; i < nsyms; i++) {
+      Symbol *sym = syms[i];
+      bool global = sym->global || !sym->sec;
+      if (global != pass) continue;
+      sym->index = idx++;
+      symbol_entry(&symtab, add_str(&strtab, sym->name),
+                   global ? STB_GLOBAL : STB_LOCAL, STT_NOTYPE,
+                   sym->sec ? sym->sec->index : 0, sym->value);
+    }
+  }
+  int first_global = idx;
+  for (int i = 0; i < nsyms; i++)
+    if (syms[i]->global || !syms[i]->sec) {
+      first_global = syms[i]->index;
+      break;
+    }
+  free(syms);
+
+  Buf shstrtab = {0};
+  Buf shdrs = {0};
+  buf_byte(&shstrtab, 0);
+  section_header(&shdrs, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+
+  // ELF ヘッダはあとで書く
+  char zero[64] = {0};
+  buf_add(out, zero, 64);
+
+  for (Section *s = as->sections; s; s = s->next) {
+    size_t off = out->len;
+    if (s->type != SHT_NOBITS) {
+      pad(out, s->align);
+      off = out->len;
+      buf_add(out, s->buf.data, s->buf.len);
+    }
+    section_header(&shdrs, add_str(&shstrtab, s->name), s->type, s->flags,
+                   off, section_size(s), 0, 0, s->align, s->entsize);
+  }
+
+  for (Section *s = as->sections; s; s = s->next) {
+    if (!s->relocs) continue;
+    pad(out, 8);
+    size_t off = out->len;
+    for (Reloc *r = s->relocs; r; r = r->next) {
+      long sym = r->sym ? r->sym->index : r->sec->sym;
+      buf_int(out, r->offset, 8);
+      buf_int(out, (uint64_t)sym << 32 | r->type, 8);
+      buf_int(out, r->addend, 8);
+    }
+
+    char *name = malloc(strlen(s->name) + 6);
+    sprintf(name, ".rela%s", s->name);
+    section_header(&shdrs, add_str(&shstrtab, name), SHT_RELA, SHF_INFO_LINK,
+                   off, out->len - off, symtab_idx, s->index, 8, 24);
+    free(name);
+  }
+
+  pad(out, 8);
+  section_header(&shdrs, add_str(&shstrtab, ".symtab"), SHT_SYMTAB, 0,
+                 out->len, symtab.len, strtab_idx, first_global, 8, 24);
+  buf_add(out, symtab.data, symtab.len);
+
+  section_header(&shdrs, add_str(&shstrtab, ".strtab"), SHT_STRTAB, 0,
+                 out->len, strtab.len, 0, 0, 1, 0);
+  buf_add(out, strtab.data, strtab.len);
+
+  int shstrtab_name = add_str(&shstrtab, ".shstrtab");
+  section_header(&shdrs, shstrtab_name, SHT_STRTAB, 0, out->len,
+                 shstrtab.len, 0, 0, 1, 0);
+  buf_add(out, shstrtab.data, shstrtab.len);
+
+  pad(out, 8);
+  size_t shoff = out->len;
+  buf_add(out, shdrs.data, shdrs.len);
+
+  // ELF ヘッダ
+  Buf eh = {0};
+  buf_add(&eh, "\x7f" "ELF", 4);
+  buf_byte(&eh, 2);  // 64ビット
+  buf_byte(&eh, 1);  // リトルエンディアン
+  buf_byte(&eh, 1);  // バージョン
+  buf_add(&eh, zero, 9);  // OS ABI とパディング
+  buf_int(&eh, 1, 2);   // ET_REL
+  buf_int(&eh, 62, 2);  // EM_X86_64
+  buf_int(&eh, 1, 4);
+  buf_int(&eh, 0, 8);  // entry
+  buf_int(&eh, 0, 8);  // phoff
+  buf_int(&eh, shoff, 8);
+  buf_int(&eh, 0, 4);   // flags
+  buf_int(&eh, 64, 2);  // ehsize
+  buf_int(&eh, 0, 2);   // phentsize
+  buf_int(&eh, 0, 2);   // phnum
+  buf_int(&eh, 64, 2);  // shentsize
+  buf_int(&eh, shnum, 2);
+  buf_int(&eh, shstrtab_idx, 2);
+  memcpy(out->data, eh.data, 64);
+
+  free(eh.data);
+  free(strtab.data);
+  free(symtab.data);
+  free(shstrtab.data);
+  free(shdrs.data);
+}
+
+static void free_asm(Asm *as) {
+  for (Section *s = as->sections, *next; s; s = next) {
+    next = s->next;
+    for (Reloc *r = s->relocs, *rn; r; r = rn) {
+      rn = r->next;
+      free(r);
+    }
+    free(s->name);
+    free(s->buf.data);
+    free(s);
+  }
+  for (int i = 0; i < SYM_HASH_SIZE; i++) {
+    for (Symbol *sym = as->syms[i], *next; sym; sym = next) {
+      next = sym->next;
+      free(sym->name);
+      free(sym);
+    }
+  }
+  for (Fixup *f = as->fixups, *next; f; f = next) {
+    next = f->next;
+    free(f);
+  }
+}
+
+// アセンブリ text をオブジェクトファイルにして *obj に返す。
+// 失敗したら *err にメッセージを入れて false を返す
+bool assemble(char *text, size_t len, char **obj, size_t *obj_len,
+              char **err) {
+  Asm *as = calloc(1, sizeof(Asm));
+  *obj = NULL;
+  *obj_len = 0;
+  *err = NULL;
+
+  bool ok = false;
+  Buf out = {0};
+  if (!setjmp(as->bail)) {
+    char *line = NULL;
+    size_t cap = 0;
+    for (char *p = text, *end = text + len; p < end;) {
+      char *nl = memchr(p, '\n', end - p);
+      size_t n = nl ? nl - p : end - p;
+      if (n + 1 > cap) {
+        cap = n + 1;
+        line = realloc(line, cap);
+      }
+      memcpy(line, p, n);
+      line[n] = '\0';
+      as->line++;
+      assemble_line(as, line);
+      p += n + 1;
+    }
+    free(line);
+
+    for (int i = 0; i < SYM_HASH_SIZE; i++)
+      for (Symbol *sym = as->syms[i]; sym; sym = sym->next)
+        resolve_alias(as, sym, 0);
+    for (Fixup *f = as->fixups; f; f = f->next) resolve(as, f);
+
+    write_elf(as, &out);
+    *obj = out.data;
+    *obj_len = out.len;
+    ok = true;
+  } else {
+    free(out.data);
+    *err = as->err;
+  }
+
+  free_asm(as);
+  free(as);
+  return ok;
+}
@@ -0,0 +1,393 @@
+#include "9cc.h"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+//
+// --cache DIR: コンパイル結果のキャッシュ
+//
+// 入力のバイト列、コンパイラ自身、出力に影響するオプションの SHA-256 を
+// キーにして、生成したアセンブリを DIR に保存する。
+//
+//   DIR/<キー>.s  アセンブリ
+//   DIR/<キー>.d  警告などの診断メッセージ (あるときだけ)
+//   DIR/<キー>.f  関数1つ分のアセンブリ (parse.c の load_cached を参照)
+//   DIR/stats     ヒット数、ミス数、エントリの合計サイズ
+//   DIR/lock      stats を更新するときのロック
+//
+// ヒットしたエントリは更新時刻を新しくしておき、合計サイズが上限を
+// 超えたら更新時刻の古いものから消す (LRU)。
+// 関数ごとに stats を書き換えると遅いので、数はプロセスの中で足しておき
+// cache_close でまとめて書く。
+//
+
+static char *cache_dir;
+static long long cache_max;
+
+// 同じプロセスのスレッド同士は fcntl のロックでは排他されないので、
+// ミューテックスも合わせて使う
+static pthread_mutex_t cache_mu = PTHREAD_MUTEX_INITIALIZER;
+
+typedef struct {
+  long long hits;
+  long long misses;
+  long long size;
+  long long fn_hits;
+  long long fn_misses;
+} Stats;
+
+// まだ stats に書いていない分
+static atomic_llong new_hits, new_misses, new_size, new_fn_hits,
+    new_fn_misses;
+
+static char *cache_path(char *name, char *ext) {
+  char *buf = malloc(strlen(cache_dir) + strlen(name) + strlen(ext) + 2);
+  sprintf(buf, "%s/%s%s", cache_dir, name, ext);
+  return buf;
+}
+
+static char *slurp(char *path, size_t *len) {
+  FILE *fp = fopen(path, "r");
+  if (!fp) return NULL;
+
+  char *buf;
+  FILE *out = open_memstream(&buf, len);
+  char tmp[4096];
+  for (size_t n; (n = fread(tmp, 1, sizeof(tmp), fp)) > 0;)
+    fwrite(tmp, 1, n, out);
+  fclose(fp);
+  fclose(out);
+  return buf;
+}
+
+// 一時ファイルに書いてから名前を変えるので、読む側が途中の内容を見ることはない
+static bool write_atomic(char *path, char *buf, size_t len) {
+  char *tmp = cache_path("tmp.XXXXXX", "");
+  int fd = mkstemp(tmp);
+  bool ok = fd >= 0;
+  for (size_t off = 0; ok && off < len;) {
+    ssize_t n = write(fd, buf + off, len - off);
+    if (n < 0 && errno == EINTR) continue;
+    ok = n > 0;
+    off += ok ? n : 0;
+  }
+  if (fd >= 0 && close(fd)) ok = false;
+  if (ok && rename(tmp, path)) ok = false;
+  if (!ok && fd >= 0) unlink(tmp);
+  free(tmp);
+  return ok;
+}
+
+static int lock_cache(void) {
+  pthread_mutex_lock(&cache_mu);
+  char *path = cache_path("lock", "");
+  int fd = open(path, O_RDWR | O_CREAT, 0666);
+  free(path);
+  if (fd >= 0) {
+    struct flock fl = {.l_type = F_WRLCK, .l_whence = SEEK_SET};
+    while (fcntl(fd, F_SETLKW, &fl) && errno == EINTR)
+      ;
+  }
+  return fd;
+}
+
+// close するとロックも外れる
+static void unlock_cache(int fd) {
+  if (fd >= 0) close(fd);
+  pthread_mutex_unlock(&cache_mu);
+}
+
+static Stats read_stats(void) {
+  Stats st = {0};
+  char *path = cache_path("stats", "");
+  FILE *fp = fopen(path, "r");
+  if (fp) {
+    if (fscanf(fp, "%lld %lld %lld %lld %lld", &st.hits, &st.misses,
+               &st.size, &st.fn_hits, &st.fn_misses) != 5)
+      st = (Stats){0};
+    fclose(fp);
+  }
+  free(path);
+  return st;
+}
+
+static void write_stats(Stats *st) {
+  char *path = cache_path("stats", "");
+  FILE *fp = fopen(path, "w");
+  if (fp) {
+    fprintf(fp, "%lld %lld %lld %lld %lld\n", st->hits, st->misses,
+            st->size, st->fn_hits, st->fn_misses);
+    fclose(fp);
+  }
+  free(path);
+}
+
+void cache_open(char *dir, long long max_size) {
+  if (mkdir(dir, 0777) && errno != EEXIST)
+    error("cannot create %s: %s", dir, strerror(errno));
+  cache_dir = dir;
+  cache_max = max_size;
+}
+
+//
+// キー
+//
+
+static unsigned char compiler_id[32];
+static pthread_once_t compiler_id_once = PTHREAD_ONCE_INIT;
+
+// コンパイラのバージョンとして実行ファイルそのもののハッシュを使う。
+// 9cc を作り直せば古いエントリには当たらなくなる
+static void init_compiler_id(void) {
+  Sha256 s;
+  sha256_init(&s);
+  size_t len;
+  char *exe = slurp("/proc/self/exe", &len);
+  if (exe) {
+    sha256_update(&s, exe, len);
+    free(exe);
+  } else {
+    char *stamp = __DATE__ " " __TIME__;
+    sha256_update(&s, stamp, strlen(stamp));
+  }
+  sha256_final(&s, compiler_id);
+}
+
+// -j と --cache は出力を変えないのでキーに含めない。
+// CcOptions に出力を変える項目を足したときはここにも足すこと
+void cache_hash_options(Sha256 *s, const CcOptions *opts) {
+  pthread_once(&compiler_id_once, init_compiler_id);
+
+  char buf[64];
+  int n = snprintf(buf, sizeof(buf), "%d %d %d %d %d", opts->report,
+                   opts->vectorize, opts->pic, opts->unroll_factor,
+                   opts->pipeline);
+  sha256_update(s, compiler_id, sizeof(compiler_id));
+  sha256_update(s, buf, n + 1);
+}
+
+void cache_key(const char *filename, const char *src, const CcOptions *opts,
+               char key[65]) {
+  // 診断メッセージにファイル名が入るので、ファイル名もキーに含める
+  Sha256 s;
+  sha256_init(&s);
+  cache_hash_options(&s, opts);
+  sha256_update(&s, filename, strlen(filename) + 1);
+  sha256_update(&s, src, strlen(src));
+  sha256_hex(&s, key);
+}
+
+//
+// 読み書き
+//
+
+// 診断メッセージは1件ごとに "種類 行 列\n" のあとに
+// 本文と整形済みの文字列を '\0' で終えて並べる
+static char *encode_diags(CcDiag *diags, size_t *len) {
+  char *buf;
+  FILE *fp = open_memstream(&buf, len);
+  for (CcDiag *d = diags; d; d = d->next) {
+    fprintf(fp, "%d %d %d\n", d->kind, d->line, d->column);
+    fwrite(d->message, 1, strlen(d->message) + 1, fp);
+    fwrite(d->text, 1, strlen(d->text) + 1, fp);
+  }
+  fclose(fp);
+  return buf;
+}
+
+static bool decode_diags(char *p, char *end, const char *filename,
+                         CcDiag **diags) {
+  CcDiag **cur = diags;
+  while (p < end) {
+    int kind, line, column, n;
+    if (sscanf(p, "%d %d %d\n%n", &kind, &line, &column, &n) != 3)
+      return false;
+    p += n;
+    char *msg = p;
+    char *text = memchr(msg, '\0', end - msg);
+    char *next = text ? memchr(text + 1, '\0', end - text - 1) : NULL;
+    if (!next) return false;
+
+    CcDiag *d = calloc(1, sizeof(CcDiag));
+    d->kind = kind;
+    d->filename = strdup(filename);
+    d->line = line;
+    d->column = column;
+    d->message = strdup(msg);
+    d->text = strdup(text + 1);
+    *cur = d;
+    cur = &d->next;
+    p = next + 1;
+  }
+  return true;
+}
+
+// ヒットすれば cc_compile と同じ形で結果を res に返す
+bool cache_get(char *key, const char *filename, CcResult *res) {
+  *res = (CcResult){0};
+  char *asm_path = cache_path(key, ".s");
+  char *diag_path = cache_path(key, ".d");
+  size_t len;
+
+  // .d を書いてから .s を書くので、.s があれば .d もそろっている
+  res->asm_text = slurp(asm_path, &res->asm_len);
+  char *diags = res->asm_text ? slurp(diag_path, &len) : NULL;
+  if (diags && !decode_diags(diags, diags + len, filename, &res->diags))
+    cc_free_result(res);
+  free(diags);
+
+  res->ok = res->asm_text != NULL;
+  if (res->ok) utimensat(AT_FDCWD, asm_path, NULL, 0);
+  free(asm_path);
+  free(diag_path);
+  atomic_fetch_add(res->ok ? &new_hits : &new_misses, 1);
+  return res->ok;
+}
+
+// 関数1つ分のエントリの中身を返す。なければ NULL
+char *cache_get_function(char *key, size_t *len) {
+  char *path = cache_path(key, ".f");
+  char *buf = slurp(path, len);
+  if (buf) utimensat(AT_FDCWD, path, NULL, 0);
+  free(path);
+  atomic_fetch_add(buf ? &new_fn_hits : &new_fn_misses, 1);
+  return buf;
+}
+
+void cache_put_function(char *key, char *buf, size_t len) {
+  char *path = cache_path(key, ".f");
+  if (write_atomic(path, buf, len)) atomic_fetch_add(&new_size, len);
+  free(path);
+}
+
+typedef struct {
+  char *name;
+  time_t mtime;
+  long long size;
+} Entry;
+
+static int cmp_entry(const void *a, const void *b) {
+  const Entry *x = a, *y = b;
+  return (x->mtime > y->mtime) - (x->mtime < y->mtime);
+}
+
+static long long file_size(char *name, char *ext, time_t *mtime) {
+  char *path = cache_path(name, ext);
+  struct stat st;
+  long long size = stat(path, &st) ? 0 : st.st_size;
+  if (mtime && size) *mtime = st.st_mtime;
+  free(path);
+  return size;
+}
+
+// ディレクトリを見てエントリを集める。stats のサイズもここで正しい値に直る
+static Entry *scan(int *n, long long *total) {
+  Entry *ents = NULL;
+  *n = 0;
+  *total = 0;
+  DIR *dir = opendir(cache_dir);
+  if (!dir) return NULL;
+
+  for (struct dirent *de; (de = readdir(dir));) {
+    size_t len = strlen(de->d_name);
+    if (len != 66 || (strcmp(de->d_name + 64, ".s") &&
+                      strcmp(de->d_name + 64, ".f")))
+      continue;
+
+    Entry e = {strdup(de->d_name)};
+    e.size = file_size(e.name, "", &e.mtime);
+    if (e.name[65] == 's') {
+      e.name[64] = '\0';
+      e.size += file_size(e.name, ".d", NULL);
+      e.name[64] = '.';
+    }
+    ents = realloc(ents, sizeof(Entry) * (*n + 1));
+    ents[(*n)++] = e;
+    *total += e.size;
+  }
+  closedir(dir);
+  return ents;
+}
+
+// 上限を超えたら、上限の 9 割になるまで古いものから消す。
+// 毎回消さなくて済むように少し余裕を持たせる
+static void evict(Stats *st) {
+  int n;
+  Entry *ents = scan(&n, &st->size);
+  qsort(ents, n, sizeof(Entry), cmp_entry);
+
+  for (int i = 0; i < n; i++) {
+    if (st->size > cache_max / 10 * 9) {
+      char *path = cache_path(ents[i].name, "");
+      unlink(path);
+      if (ents[i].name[65] == 's') {
+        strcpy(path + strlen(path) - 1, "d");
+        unlink(path);
+      }
+      free(path);
+      st->size -= ents[i].size;
+    }
+    free(ents[i].name);
+  }
+  free(ents);
+}
+
+void cache_put(char *key, CcResult *res) {
+  size_t len;
+  char *diags = encode_diags(res->diags, &len);
+  char *asm_path = cache_path(key, ".s");
+  char *diag_path = cache_path(key, ".d");
+
+  bool ok = true;
+  if (len)
+    ok = write_atomic(diag_path, diags, len);
+  else
+    unlink(diag_path);
+  ok = ok && write_atomic(asm_path, res->asm_text, res->asm_len);
+  free(diags);
+  free(asm_path);
+  free(diag_path);
+  if (ok) atomic_fetch_add(&new_size, res->asm_len + len);
+}
+
+// 足しておいた数を stats に書き、上限を超えていれば古いエントリを消す
+void cache_close(void) {
+  int fd = lock_cache();
+  Stats st = read_stats();
+  st.hits += atomic_exchange(&new_hits, 0);
+  st.misses += atomic_exchange(&new_misses, 0);
+  st.size += atomic_exchange(&new_size, 0);
+  st.fn_hits += atomic_exchange(&new_fn_hits, 0);
+  st.fn_misses += atomic_exchange(&new_fn_misses, 0);
+  if (st.size > cache_max) evict(&st);
+  write_stats(&st);
+  unlock_cache(fd);
+}
+
+// --cache-stats
+void cache_print_stats(FILE *fp) {
+  int fd = lock_cache();
+  Stats st = read_stats();
+  int n;
+  Entry *ents = scan(&n, &st.size);
+  unlock_cache(fd);
+  for (int i = 0; i < n; i++) free(ents[i].name);
+  free(ents);
+
+  long long total = st.hits + st.misses;
+  long long fn_total = st.fn_hits + st.fn_misses;
+  fprintf(fp, "cache directory: %s\n", cache_dir);
+  fprintf(fp, "hits:            %lld (%.1f%%)\n", st.hits,
+          total ? st.hits * 100.0 / total : 0.0);
+  fprintf(fp, "misses:          %lld\n", st.misses);
+  fprintf(fp, "function hits:   %lld (%.1f%%)\n", st.fn_hits,
+          fn_total ? st.fn_hits * 100.0 / fn_total : 0.0);
+  fprintf(fp, "function misses: %lld\n", st.fn_misses);
+  fprintf(fp, "entries:         %d\n", n);
+  fprintf(fp, "size:            %lld KB (max %lld KB)\n", st.size / 1024,
+          cache_max / 1024);
+}
@@ -1,8 +1,11 @@
 #include "9cc.h"
 
-// ラベル用のカウンタ
-static int label_counter = 0;
-static char *funcname;
+// アセンブリを出力する。printf と同じ引数を取る
+static void emit(char *fmt, ...) {
+  va_list ap;
+  va_start(ap, fmt);
+  vfprintf(ctx->out, fmt, ap);
+}
 
 // レジスタ
 // https://www.sigbus.info/compilerbook#%E6%95%B4%E6%95%B0%E3%83%AC%E3%82%B8%E3%82%B9%E3%82%BF%E3%81%AE%E4%B8%80%E8%A6%A7
@@ -11,6 +14,13 @@ static char *argreg2[] = {"di", "si", "dx", "cx", "r8w", "r9w"};
 static char *argreg4[] = {"edi", "esi", "edx", "ecx", "r8d", "r9d"};
 static char *argreg8[] = {"rdi", "rsi", "rdx", "rcx", "r8", "r9"};
 
+// 式の計算に使うレジスタ
+enum { RAX, RDI, RCX };
+static char *reg8[] = {"al", "dil", "cl"};
+static char *reg16[] = {"ax", "di", "cx"};
+static char *reg32[] = {"eax", "edi", "ecx"};
+static char *reg64[] = {"rax", "rdi", "rcx"};
+
 static void gen(Node *node);
 
 // 変数のアドレスをスタックにプッシュする
@@ -18,11 +28,15 @@ void gen_addr(Node *node) {
   switch (node->kind) {
     case ND_VAR:
       if (node->var->is_local) {
-        printf("  mov rax, rbp\n");
-        printf("  sub rax, %d\n", node->var->offset);
-        printf("  push rax\n");
+        emit("  mov rax, rbp\n");
+        emit("  sub rax, %d\n", node->var->offset);
+        emit("  push rax\n");
+      } else if (ctx->opts.pic && !node->var->is_static) {
+        emit("  mov rax, qword ptr %s@GOTPCREL[rip]\n", node->var->name);
+        emit("  push rax\n");
       } else {
-        printf("  push offset %s\n", node->var->name);
+        emit("  lea rax, [rip+%s]\n", node->var->name);
+        emit("  push rax\n");
       }
       return;
     case ND_DEREF:
@@ -30,10 +44,10 @@ void gen_addr(Node *node) {
       return;
     case ND_MEMBER:
       gen_addr(node->lhs);  // x.y の x の offset を計算
-      printf("  pop rax\n");
-      printf("  add rax, %d\n",
+      emit("  pop rax\n");
+      emit("  add rax, %d\n",
              node->member->offset);  // x.y の y の offset を計算
-      printf("  push rax\n");
+      emit("  push rax\n");
       return;
   }
 
@@ -47,168 +61,744 @@ static void gen_lval(Node *node) {
   gen_addr(node);
 }
 
-static void load(Type *ty) {
-  printf("  pop rax\n");
-  if (ty->size == 1)
-    printf("  movsx rax, byte ptr [rax]\n");  // 64 <- 8 bit
-  else if (ty->size == 2)
-    printf("  movsx rax, word ptr [rax]\n");  // 64 <- 16 bit
-  else if (ty->size == 4)
-    printf("  movsx rax, dword ptr [rax]\n");  // 64 <- 32 bit
+// 4バイト以下の整数はレジスタの下位32ビットだけを使い、32ビット命令で
+// 計算する。下位32ビットには int に拡張した値が入っていて、上位32ビットは
+// 不定 (32ビット命令の結果なら0) なので、64ビットで使うときは符号拡張する
+static bool is_narrow(Type *ty) {
+  return (is_integer(ty) || ty->kind == TY_ENUM) && ty->size <= 4;
+}
+
+static char *reg(Type *ty, int r) {
+  return is_narrow(ty) ? reg32[r] : reg64[r];
+}
+
+static void cmp_zero(Type *ty, int r) { emit("  cmp %s, 0\n", reg(ty, r)); }
+
+// レジスタ r の from 型の値を to 型に変換する。値が変わらない変換は何も出力しない
+static void convert(Type *from, Type *to, int r) {
+  if (to->kind == TY_VOID) return;
+
+  if (to->kind == TY_BOOL) {
+    if (from->kind == TY_BOOL) return;
+    cmp_zero(from, r);
+    emit("  setne %s\n", reg8[r]);
+    emit("  movzx %s, %s\n", reg32[r], reg8[r]);
+    return;
+  }
+
+  if (!is_narrow(to)) {
+    if (is_narrow(from)) emit("  movsxd %s, %s\n", reg64[r], reg32[r]);
+    return;
+  }
+
+  // 切り詰めは下位ビットを使うだけでよい。char と short は int に拡張し直す
+  if (to->size == 4 || to->size >= from->size) return;
+  if (to->size == 1)
+    emit("  movsx %s, %s\n", reg32[r], reg8[r]);
   else
-    printf("  mov rax, [rax]\n");
-  printf("  push rax\n");
+    emit("  movsx %s, %s\n", reg32[r], reg16[r]);
 }
 
-static void store(Type *ty) {
-  printf("  pop rdi\n");
-  printf("  pop rax\n");
-  if (ty->kind == TY_BOOL) {
-    printf("  cmp rdi, 0\n");  // 0かどうか
-    printf("  setne dil\n");  // 0 でない場合は dil レジスタに1をセットする
-    printf("  movzb rdi, dil\n");  // ゼロ拡張でストア
+static char *sized_reg(int r, int size) {
+  switch (size) {
+    case 1:
+      return reg8[r];
+    case 2:
+      return reg16[r];
+    case 4:
+      return reg32[r];
   }
+  return reg64[r];
+}
 
-  if (ty->size == 1)
-    printf("  mov [rax], dil\n");  // rdi の 下位8ビット
+static char *ptr_size(Type *ty) {
+  switch (ty->size) {
+    case 1:
+      return "byte";
+    case 2:
+      return "word";
+    case 4:
+      return "dword";
+  }
+  return "qword";
+}
+
+// ローカル変数とグローバル変数はアドレスを計算せずに
+// メモリオペランドで直接読み書きする。それ以外は NULL
+static char *var_operand(Node *node) {
+  if (node->kind != ND_VAR) return NULL;
+  Var *var = node->var;
+  if (!var->is_local && ctx->opts.pic && !var->is_static) return NULL;
+  char *buf = arena_calloc(1, strlen(var->name) + 20);
+  if (var->is_local)
+    sprintf(buf, "[rbp-%d]", var->offset);
+  else
+    sprintf(buf, "[rip+%s]", var->name);
+  return buf;
+}
+
+// mem にある ty の値を rax に読む
+static void load_mem(Type *ty, char *mem) {
+  if (ty->kind == TY_BOOL)
+    emit("  movzx eax, byte ptr %s\n", mem);
+  else if (ty->size == 1)
+    emit("  movsx eax, byte ptr %s\n", mem);  // 32 <- 8 bit
   else if (ty->size == 2)
-    printf("  mov [rax], di\n");  // rdi の 下位16ビット
+    emit("  movsx eax, word ptr %s\n", mem);  // 32 <- 16 bit
   else if (ty->size == 4)
-    printf("  mov [rax], edi\n");  // rdi の 下位32ビット
+    emit("  mov eax, dword ptr %s\n", mem);
   else
-    printf("  mov [rax], rdi\n");  // 左辺値に右辺値をストア
+    emit("  mov rax, qword ptr %s\n", mem);
+}
 
-  printf("  push rdi\n");
+static void load(Type *ty) {
+  // 配列と構造体はアドレスをそのまま値として扱う
+  if (ty->kind == TY_ARRAY || ty->kind == TY_STRUCT) return;
+
+  emit("  pop rax\n");
+  load_mem(ty, "[rax]");
+  emit("  push rax\n");
+}
+
+// rdi の値を ty の左辺値 mem に書き込む
+static void store_mem(Type *from, Type *ty, char *mem) {
+  convert(from, ty, RDI);
+  emit("  mov %s ptr %s, %s\n", ptr_size(ty), mem,
+         sized_reg(RDI, ty->size));
 }
 
-static void truncate(Type *ty) {
-  printf("  pop rax\n");
+static void store(Type *from, Type *ty) {
+  emit("  pop rdi\n");
+  emit("  pop rax\n");
+  store_mem(from, ty, "[rax]");
+  emit("  push rdi\n");
+}
 
-  if (ty->kind == TY_BOOL) {
-    printf("  cmp rax, 0\n");
-    printf("  setne al\n");
+static bool is_rmw(Node *node) {
+  switch (node->kind) {
+    case ND_ADD_ASSIGN:
+    case ND_SUB_ASSIGN:
+    case ND_MUL_ASSIGN:
+    case ND_DIV_ASSIGN:
+    case ND_POST_INC:
+    case ND_POST_DEC:
+      return true;
   }
+  return false;
+}
+
+// 複合代入と後置の ++/-- は左辺のアドレスを一度だけ求めて読み書きする。
+// + と - はメモリオペランドに直接加減算する。value が偽なら結果を積まない
+static void gen_rmw(Node *node, bool value) {
+  Type *ty = node->lhs->ty;
+  bool post = node->kind == ND_POST_INC || node->kind == ND_POST_DEC;
+  bool add = node->kind == ND_ADD_ASSIGN || node->kind == ND_POST_INC;
+  bool sub = node->kind == ND_SUB_ASSIGN || node->kind == ND_POST_DEC;
+  Type *rty = post ? int_type : node->rhs->ty;
+  long scale = ty->kind == TY_PTR ? ty->ptr_to->size : 1;
 
-  if (ty->size == 1) {
-    printf("  movsx rax, al\n");
-  } else if (ty->size == 2) {
-    printf("  movsx rax, ax\n");
-  } else if (ty->size == 4) {
-    printf("  movsxd rax, eax\n");
+  // 右辺が定数なら即値にする
+  bool imm = post || node->rhs->kind == ND_NUM;
+  long val = post ? 1 : imm ? node->rhs->val : 0;
+  if (imm && val * scale != (int)(val * scale)) imm = false;
+
+  char *mem = var_operand(node->lhs);
+  if (!mem) gen_lval(node->lhs);
+  if (!imm) gen(node->rhs);
+  if (!imm) emit("  pop rdi\n");
+  if (!mem) {
+    emit("  pop rcx\n");
+    mem = "[rcx]";
+  }
+
+  if ((add || sub) && ty->kind != TY_BOOL) {
+    char *op = add ? "add" : "sub";
+    if (post && value) load_mem(ty, mem);  // 古い値が結果になる
+
+    if (imm) {
+      // 即値はオペランドの幅に符号拡張する。加減算の結果は切り詰めても同じ
+      long v = val * scale;
+      if (ty->size == 1) v = (signed char)v;
+      if (ty->size == 2) v = (short)v;
+      emit("  %s %s ptr %s, %ld\n", op, ptr_size(ty), mem, v);
+    } else {
+      if (ty->size == 8) convert(rty, long_type, RDI);
+      if (scale > 1) emit("  imul rdi, %ld\n", scale);
+      emit("  %s %s ptr %s, %s\n", op, ptr_size(ty), mem,
+             sized_reg(RDI, ty->size));
+    }
+
+    if (!value) return;
+    if (!post) load_mem(ty, mem);
+    emit("  push rax\n");
+    return;
+  }
+
+  // それ以外は値を読んでレジスタで計算する
+  if (imm) emit("  mov rdi, %ld\n", val);
+  load_mem(ty, mem);
+  if (post) emit("  mov rsi, rax\n");
+
+  Type *opty = ty->size == 8 || rty->size == 8 ? long_type : int_type;
+  char *ax = reg(opty, RAX);
+  char *di = reg(opty, RDI);
+  convert(ty, opty, RAX);
+  convert(rty, opty, RDI);
+  if (add) {
+    emit("  add %s, %s\n", ax, di);
+  } else if (sub) {
+    emit("  sub %s, %s\n", ax, di);
+  } else if (node->kind == ND_MUL_ASSIGN) {
+    emit("  imul %s, %s\n", ax, di);
+  } else {
+    emit(opty == long_type ? "  cqo\n" : "  cdq\n");
+    emit("  idiv %s\n", di);
+  }
+  convert(opty, ty, RAX);
+  emit("  mov %s ptr %s, %s\n", ptr_size(ty), mem, sized_reg(RAX, ty->size));
+
+  if (!value) return;
+  if (post) emit("  mov rax, rsi\n");
+  emit("  push rax\n");
+}
+
+// これより大きいブロックは展開せず rep movsb/stosb で処理する
+#define INLINE_COPY_MAX 256
+
+// rsi から rdi へ size バイトをコピーする
+static void copy_bytes(int size) {
+  if (size > INLINE_COPY_MAX) {
+    emit("  mov rcx, %d\n", size);
+    emit("  rep movsb\n");
+    return;
+  }
+
+  int off = 0;
+  for (; size - off >= 16; off += 16) {
+    emit("  movdqu xmm0, [rsi+%d]\n", off);
+    emit("  movdqu [rdi+%d], xmm0\n", off);
+  }
+  for (int sz = 8; sz > 0; sz /= 2)
+    for (; size - off >= sz; off += sz) {
+      char *r = sz == 8 ? "rax" : sz == 4 ? "eax" : sz == 2 ? "ax" : "al";
+      emit("  mov %s, [rsi+%d]\n", r, off);
+      emit("  mov [rdi+%d], %s\n", off, r);
+    }
+}
+
+// rdi から size バイトを al の値で埋める
+static void fill_bytes(int size) {
+  if (size > INLINE_COPY_MAX) {
+    emit("  mov rcx, %d\n", size);
+    emit("  rep stosb\n");
+    return;
+  }
+
+  // al の値を rax と xmm0 の全バイトに並べる
+  emit("  movzx eax, al\n");
+  emit("  movabs rcx, 0x0101010101010101\n");
+  emit("  imul rax, rcx\n");
+  if (size >= 16) {
+    emit("  movq xmm0, rax\n");
+    emit("  punpcklqdq xmm0, xmm0\n");
   }
-  printf("  push rax\n");
+
+  int off = 0;
+  for (; size - off >= 16; off += 16)
+    emit("  movdqu [rdi+%d], xmm0\n", off);
+  for (int sz = 8; sz > 0; sz /= 2)
+    for (; size - off >= sz; off += sz)
+      emit("  mov [rdi+%d], %s\n", off,
+             sz == 8 ? "rax" : sz == 4 ? "eax" : sz == 2 ? "ax" : "al");
+}
+
+// 大きさが定数の memcpy と memset は関数を呼ばずにその場で展開する。
+// 戻り値はコピー先のアドレス
+static bool gen_mem_builtin(Node *node) {
+  bool is_memcpy = !strcmp(node->funcname, "memcpy");
+  if (!is_memcpy && strcmp(node->funcname, "memset")) return false;
+
+  Node *dst = node->args;
+  if (!dst || !dst->next || !dst->next->next || dst->next->next->next)
+    return false;
+  Node *size = dst->next->next;
+  if (size->kind != ND_NUM || size->val < 0 || size->val > INT_MAX)
+    return false;
+
+  gen(dst);
+  gen(dst->next);
+  emit("  pop %s\n", is_memcpy ? "rsi" : "rax");
+  emit("  mov rdi, [rsp]\n");
+  if (is_memcpy)
+    copy_bytes(size->val);
+  else
+    fill_bytes(size->val);
+  return true;
+}
+
+// ベクトルは16バイトずつスタックに積む
+static void push_xmm0(void) {
+  emit("  sub rsp, 16\n");
+  emit("  movdqu [rsp], xmm0\n");
+}
+
+static char *vec_suffix(Type *ty) {
+  switch (ty->size) {
+    case 1:
+      return "b";
+    case 2:
+      return "w";
+    case 4:
+      return "d";
+  }
+  return "q";
+}
+
+static void gen_vec(Node *node) {
+  switch (node->kind) {
+    case ND_VEC_LOAD:
+      gen(node->lhs);
+      emit("  pop rax\n");
+      emit("  movdqu xmm0, [rax]\n");
+      push_xmm0();
+      return;
+    case ND_VEC_SPLAT:
+      emit("  movabs rax, %ld\n", node->val);
+      emit("  movq xmm0, rax\n");
+      emit("  punpcklqdq xmm0, xmm0\n");
+      push_xmm0();
+      return;
+    case ND_VEC_ADD:
+    case ND_VEC_SUB:
+      gen_vec(node->lhs);
+      gen_vec(node->rhs);
+      emit("  movdqu xmm1, [rsp]\n");
+      emit("  add rsp, 16\n");
+      emit("  movdqu xmm0, [rsp]\n");
+      emit("  %s%s xmm0, xmm1\n", node->kind == ND_VEC_ADD ? "padd" : "psub",
+             vec_suffix(node->ty));
+      emit("  movdqu [rsp], xmm0\n");
+      return;
+    case ND_VEC_STORE:
+      gen(node->lhs);
+      gen_vec(node->rhs);
+      emit("  movdqu xmm0, [rsp]\n");
+      emit("  add rsp, 16\n");
+      emit("  pop rax\n");
+      emit("  movdqu [rax], xmm0\n");
+      return;
+  }
+}
+
+// 関数ごとのラベル名 .L.<kind>.<関数名>.<番号> を返す。
+// 番号は関数ごとに0から振るので、関数を別々に生成しても重ならない
+static char *local_label(char *kind, int n) {
+  char *name = ctx->current_fn->name;
+  char *buf = arena_calloc(1, strlen(kind) + strlen(name) + 20);
+  sprintf(buf, ".L.%s.%s.%d", kind, name, n);
+  return buf;
+}
+
+// 関数呼び出しの飛び先。-fPIC ではこのファイルの static 関数以外は PLT を経由する
+static char *call_target(char *name) {
+  if (!ctx->opts.pic) return name;
+  for (Function *fn = ctx->functions; fn; fn = fn->next)
+    if (fn->is_static && !strcmp(fn->name, name)) return name;
+
+  char *buf = arena_calloc(1, strlen(name) + 5);
+  sprintf(buf, "%s@PLT", name);
+  return buf;
+}
+
+// 比較の両辺を計算して cmp を出力する。両辺が32ビット以下なら32ビットで比較する
+static void gen_compare(Node *node) {
+  gen(node->lhs);
+  gen(node->rhs);
+  emit("  pop rdi\n");
+  emit("  pop rax\n");
+
+  Type *ty = long_type;
+  if (is_narrow(node->lhs->ty) && is_narrow(node->rhs->ty)) ty = int_type;
+  convert(node->lhs->ty, ty, RAX);
+  convert(node->rhs->ty, ty, RDI);
+  emit("  cmp %s, %s\n", reg(ty, RAX), reg(ty, RDI));
+}
+
+// 比較 kind の結果が truth になる条件コード
+static char *cond_code(NodeKind kind, bool truth) {
+  switch (kind) {
+    case ND_EQ:
+      return truth ? "e" : "ne";
+    case ND_NE:
+      return truth ? "ne" : "e";
+    case ND_LT:
+      return truth ? "l" : "ge";
+    case ND_LE:
+      return truth ? "le" : "g";
+  }
+  error("invalid comparison");
+}
+
+// 条件 node の真偽が truth なら label に飛び、そうでなければ次に進む。
+// && と || と比較は 0/1 の値を作らずに分岐の連鎖にする
+static void gen_cond_jump(Node *node, bool truth, char *label) {
+  switch (node->kind) {
+    case ND_NUM:
+      if (!node->val == !truth) emit("  jmp %s\n", label);
+      return;
+    case ND_NOT:
+      gen_cond_jump(node->lhs, !truth, label);
+      return;
+    case ND_LOGAND:
+    case ND_LOGOR: {
+      if ((node->kind == ND_LOGAND) != truth) {
+        // && が偽になる、または || が真になるのはどちらかの辺がそうなるとき
+        gen_cond_jump(node->lhs, truth, label);
+        gen_cond_jump(node->rhs, truth, label);
+        return;
+      }
+
+      // 左辺で結果が決まれば右辺を飛ばす
+      char *skip = local_label("cond", ctx->label_counter++);
+      gen_cond_jump(node->lhs, !truth, skip);
+      gen_cond_jump(node->rhs, truth, label);
+      emit("%s:\n", skip);
+      return;
+    }
+    case ND_EQ:
+    case ND_NE:
+    case ND_LT:
+    case ND_LE:
+      gen_compare(node);
+      emit("  j%s %s\n", cond_code(node->kind, truth), label);
+      return;
+  }
+
+  gen(node);
+  emit("  pop rax\n");
+  cmp_zero(node->ty, RAX);
+  emit("  %s %s\n", truth ? "jne" : "je", label);
+}
+
+// 値が rax にあるとして case の値と比較する
+static void cmp_case(Type *ty, long val) {
+  if (is_narrow(ty) || val == (int)val) {
+    emit("  cmp %s, %d\n", reg(ty, RAX), (int)val);
+  } else {
+    emit("  movabs rdi, %ld\n", val);
+    emit("  cmp rax, rdi\n");
+  }
+}
+
+static int cmp_case_val(const void *a, const void *b) {
+  long x = (*(Node **)a)->val;
+  long y = (*(Node **)b)->val;
+  return x < y ? -1 : x > y;
+}
+
+// 値の順に並んだ cases[lo, hi) を二分探索する。少なければ順に比較する
+static void gen_case_tree(Node **cases, int lo, int hi, Type *ty,
+                          char *fallback) {
+  if (hi - lo <= 3) {
+    for (int i = lo; i < hi; i++) {
+      cmp_case(ty, cases[i]->val);
+      emit("  je .L.case.%s.%d\n", ctx->current_fn->name, cases[i]->case_label);
+    }
+    emit("  jmp %s\n", fallback);
+    return;
+  }
+
+  int mid = (lo + hi) / 2;
+  int label = ctx->label_counter++;
+  cmp_case(ty, cases[mid]->val);
+  emit("  je .L.case.%s.%d\n", ctx->current_fn->name, cases[mid]->case_label);
+  emit("  jg .L.switch.%s.%d\n", ctx->current_fn->name, label);
+  gen_case_tree(cases, lo, mid, ty, fallback);
+  emit(".L.switch.%s.%d:\n", ctx->current_fn->name, label);
+  gen_case_tree(cases, mid + 1, hi, ty, fallback);
+}
+
+// 値から最小値を引いた数を添字にして、表から飛び先を読む。
+// 表には表自身からの相対アドレスを置く
+static void gen_jump_table(Node **cases, int n, Type *ty, char *fallback) {
+  char *table = local_label("jt", ctx->label_counter++);
+  long min = cases[0]->val;
+  long range = cases[n - 1]->val - min + 1;
+
+  // 32ビット命令で上位32ビットを0にしてから添字に使う
+  if (is_narrow(ty)) {
+    emit("  sub eax, %d\n", (int)min);
+  } else if (min == (int)min) {
+    emit("  sub rax, %ld\n", min);
+  } else {
+    emit("  movabs rdi, %ld\n", min);
+    emit("  sub rax, rdi\n");
+  }
+  emit("  cmp %s, %ld\n", reg(ty, RAX), range - 1);
+  emit("  ja %s\n", fallback);
+  emit("  lea rdi, [rip+%s]\n", table);
+  emit("  movsxd rax, dword ptr [rdi+rax*4]\n");
+  emit("  add rax, rdi\n");
+  emit("  jmp rax\n");
+
+  emit(".section .rodata\n");
+  emit(".align 4\n");
+  emit("%s:\n", table);
+  int i = 0;
+  for (long v = min; v < min + range; v++) {
+    if (cases[i]->val == v)
+      emit("  .long .L.case.%s.%d-%s\n", ctx->current_fn->name,
+           cases[i++]->case_label, table);
+    else
+      emit("  .long %s-%s\n", fallback, table);
+  }
+  emit(".text\n");
+}
+
+// case がこれ以上あり、値の範囲が case の数の3倍以下なら表を引く
+#define JUMP_TABLE_MIN_CASES 4
+#define JUMP_TABLE_MAX_SPREAD 3
+
+// 値が rax にあるとして、一致する case に飛ぶ
+static void gen_switch_dispatch(Node *node, int label) {
+  int n = 0;
+  for (Node *c = node->case_next; c; c = c->case_next) {
+    c->case_label = ctx->label_counter++;
+    n++;
+  }
+  if (node->default_case) node->default_case->case_label = ctx->label_counter++;
+
+  char *fallback = node->default_case
+                       ? local_label("case", node->default_case->case_label)
+                       : local_label("end", label);
+
+  Node **cases = arena_calloc(n, sizeof(Node *));
+  int i = 0;
+  for (Node *c = node->case_next; c; c = c->case_next) cases[i++] = c;
+  qsort(cases, n, sizeof(Node *), cmp_case_val);
+  for (i = 1; i < n; i++)
+    if (cases[i - 1]->val == cases[i]->val)
+      error_tok(cases[i]->tok, "duplicate case value");
+
+  Type *ty = node->cond->ty;
+  if (n >= JUMP_TABLE_MIN_CASES &&
+      (unsigned long)(cases[n - 1]->val - cases[0]->val) <
+          JUMP_TABLE_MAX_SPREAD * n)
+    gen_jump_table(cases, n, ty, fallback);
+  else
+    gen_case_tree(cases, 0, n, ty, fallback);
 }
 
 static void gen(Node *node) {
   switch (node->kind) {
+    case ND_VEC_STORE:
+      gen_vec(node);
+      return;
     case ND_NULL:
       return;
     case ND_NUM:
       if (node->val == (int)node->val)
-        printf("  push %ld\n", node->val);
+        emit("  push %ld\n", node->val);
       else {
-        printf("  movabs rax, %ld\n", node->val);
-        printf("  push rax\n");
+        emit("  movabs rax, %ld\n", node->val);
+        emit("  push rax\n");
       }
       return;
     case ND_EXPR_STMT:
+      if (is_rmw(node->lhs)) {
+        gen_rmw(node->lhs, false);
+        return;
+      }
       gen(node->lhs);
-      printf("  add rsp, 8\n");
+      emit("  add rsp, 8\n");
       return;
     case ND_VAR:  // 変数の値をスタックにプッシュする
-    case ND_MEMBER:
+    case ND_MEMBER: {
+      char *mem = var_operand(node);
+      if (mem && node->ty->kind != TY_ARRAY && node->ty->kind != TY_STRUCT) {
+        load_mem(node->ty, mem);
+        emit("  push rax\n");
+        return;
+      }
       gen_addr(node);
-      if (node->ty->kind != TY_ARRAY) load(node->ty);
+      load(node->ty);
+      return;
+    }
+    case ND_ADD_ASSIGN:
+    case ND_SUB_ASSIGN:
+    case ND_MUL_ASSIGN:
+    case ND_DIV_ASSIGN:
+    case ND_POST_INC:
+    case ND_POST_DEC:
+      gen_rmw(node, true);
       return;
-    case ND_ASSIGN:
+    case ND_ASSIGN: {
+      char *mem = var_operand(node->lhs);
+      if (mem && node->ty->kind != TY_ARRAY && node->ty->kind != TY_STRUCT) {
+        gen(node->rhs);
+        emit("  pop rdi\n");
+        store_mem(node->rhs->ty, node->ty, mem);
+        emit("  push rdi\n");
+        return;
+      }
+
       gen_lval(node->lhs);  // 左辺値のアドレスをスタックにプッシュ
       gen(node->rhs);       // 右辺値の値をスタックにプッシュ
-      store(node->ty);
+      if (node->ty->kind == TY_STRUCT) {
+        // 構造体は右辺のアドレスから中身をコピーする
+        emit("  pop rsi\n");
+        emit("  mov rdi, [rsp]\n");
+        copy_bytes(node->ty->size);
+        return;
+      }
+      store(node->rhs->ty, node->ty);
       return;
+    }
     case ND_RETURN:  // returnの返り値の式を評価して，スタックトップをRAXに設定して関数から戻る
       gen(node->lhs);
-      printf("  pop rax\n");
-      printf("  jmp .L.return.%s\n", funcname);
+      emit("  pop rax\n");
+      convert(node->lhs->ty, ctx->current_fn->return_ty, RAX);
+      emit("  jmp .L.return.%s\n", ctx->current_fn->name);
       return;
     case ND_IF: {
-      int label = label_counter++;
+      int label = ctx->label_counter++;
       if (node->els) {
-        gen(node->cond);
-        printf("  pop rax\n");
-        printf("  cmp rax, 0\n");
-        printf("  je .Lelse%d\n", label);
+        gen_cond_jump(node->cond, false, local_label("else", label));
         gen(node->then);
-        printf("  jmp .Lend%d\n", label);
-        printf(".Lelse%d:\n", label);
+        emit("  jmp .L.end.%s.%d\n", ctx->current_fn->name, label);
+        emit(".L.else.%s.%d:\n", ctx->current_fn->name, label);
         gen(node->els);
-        printf(".Lend%d:\n", label);
+        emit(".L.end.%s.%d:\n", ctx->current_fn->name, label);
       } else {
-        gen(node->cond);
-        printf("  pop rax\n");
-        printf("  cmp rax, 0\n");
-        printf("  je .Lend%d\n", label);
+        gen_cond_jump(node->cond, false, local_label("end", label));
         gen(node->then);
-        printf(".Lend%d:\n", label);
+        emit(".L.end.%s.%d:\n", ctx->current_fn->name, label);
       }
       return;
     }
     case ND_WHILE: {
-      int label = label_counter++;
-      printf(".Lbegin%d:\n", label);
-      gen(node->cond);
-      printf("  pop rax\n");
-      printf("  cmp rax, 0\n");
-      printf("  je .Lend%d\n", label);
+      int label = ctx->label_counter++;
+      int brk = ctx->brkseq;
+      ctx->brkseq = label;
+      emit(".L.begin.%s.%d:\n", ctx->current_fn->name, label);
+      char *buf = local_label("end", label);
+      gen_cond_jump(node->cond, false, buf);
       gen(node->then);
-      printf("  jmp .Lbegin%d\n", label);
-      printf(".Lend%d:\n", label);
+      emit("  jmp .L.begin.%s.%d\n", ctx->current_fn->name, label);
+      emit(".L.end.%s.%d:\n", ctx->current_fn->name, label);
+      ctx->brkseq = brk;
       return;
     }
     case ND_FOR: {
-      int label = label_counter++;
+      int label = ctx->label_counter++;
+      int brk = ctx->brkseq;
+      ctx->brkseq = label;
       if (node->init) gen(node->init);
-      printf(".Lbegin%d:\n", label);
+      emit(".L.begin.%s.%d:\n", ctx->current_fn->name, label);
       if (node->cond) {
-        gen(node->cond);
-        printf("  pop rax\n");
-        printf("  cmp rax, 0\n");
-        printf("  je .Lend%d\n", label);
+        char *buf = local_label("end", label);
+        gen_cond_jump(node->cond, false, buf);
       }
       gen(node->then);
       if (node->step) gen(node->step);
-      printf("  jmp .Lbegin%d\n", label);
-      printf(".Lend%d:\n", label);
+      emit("  jmp .L.begin.%s.%d\n", ctx->current_fn->name, label);
+      emit(".L.end.%s.%d:\n", ctx->current_fn->name, label);
+      ctx->brkseq = brk;
+      return;
+    }
+    case ND_SWITCH: {
+      int label = ctx->label_counter++;
+      int brk = ctx->brkseq;
+      ctx->brkseq = label;
+      gen(node->cond);
+      emit("  pop rax\n");
+      gen_switch_dispatch(node, label);
+      gen(node->then);
+      emit(".L.end.%s.%d:\n", ctx->current_fn->name, label);
+      ctx->brkseq = brk;
+      return;
+    }
+    case ND_EQ:
+    case ND_NE:
+    case ND_LT:
+    case ND_LE:
+      gen_compare(node);
+      emit("  set%s al\n", cond_code(node->kind, true));
+      emit("  movzx eax, al\n");
+      emit("  push rax\n");
+      return;
+    case ND_NOT:
+      gen(node->lhs);
+      emit("  pop rax\n");
+      cmp_zero(node->lhs->ty, RAX);
+      emit("  sete al\n");
+      emit("  movzx eax, al\n");
+      emit("  push rax\n");
+      return;
+    case ND_LOGAND:
+    case ND_LOGOR: {
+      // 値が必要なときだけ分岐の行き先で 0 か 1 を作る
+      int label = ctx->label_counter++;
+      char *buf = local_label("false", label);
+      gen_cond_jump(node, false, buf);
+      emit("  push 1\n");
+      emit("  jmp .L.done.%s.%d\n", ctx->current_fn->name, label);
+      emit("%s:\n", buf);
+      emit("  push 0\n");
+      emit(".L.done.%s.%d:\n", ctx->current_fn->name, label);
       return;
     }
+    case ND_CASE:
+      emit(".L.case.%s.%d:\n", ctx->current_fn->name, node->case_label);
+      gen(node->lhs);
+      return;
+    case ND_BREAK:
+      if (ctx->brkseq < 0) error_tok(node->tok, "stray break");
+      emit("  jmp .L.end.%s.%d\n", ctx->current_fn->name, ctx->brkseq);
+      return;
     case ND_BLOCK:
     case ND_STMT_EXPR:
       for (Node *n = node->body; n; n = n->next) gen(n);
       return;
     case ND_FUNCALL: {
+      if (gen_mem_builtin(node)) return;
+
       int reg_counter = 0;
       for (Node *arg = node->args; arg; arg = arg->next, reg_counter++)
         gen(arg);
 
       for (int i = reg_counter - 1; i >= 0; i--)
-        printf("  pop %s\n", argreg8[i]);
+        emit("  pop %s\n", argreg8[i]);
+
+      // 引数の型がわからないので、long の引数にも渡せるよう符号拡張する
+      int i = 0;
+      for (Node *arg = node->args; arg; arg = arg->next, i++)
+        if (is_narrow(arg->ty))
+          emit("  movsxd %s, %s\n", argreg8[i], argreg4[i]);
 
       // We need to align RSP to a 16 byte boundary before
       // calling a function because it is an ABI requirement.
       // RAX is set to 0 for variadic function.
-      int seq = label_counter++;
-      printf("  mov rax, rsp\n");
-      printf("  and rax, 15\n");
-      printf("  jnz .L.call.%d\n", seq);
-      printf("  mov rax, 0\n");
-      printf("  call %s\n", node->funcname);
-      printf("  jmp .L.end.%d\n", seq);
-      printf(".L.call.%d:\n", seq);
-      printf("  sub rsp, 8\n");
-      printf("  mov rax, 0\n");
-      printf("  call %s\n", node->funcname);
-      printf("  add rsp, 8\n");
-      printf(".L.end.%d:\n", seq);
-      printf("  push rax\n");
+      int seq = ctx->label_counter++;
+      emit("  mov rax, rsp\n");
+      emit("  and rax, 15\n");
+      emit("  jnz .L.call.%s.%d\n", ctx->current_fn->name, seq);
+      emit("  mov eax, 0\n");
+      emit("  call %s\n", call_target(node->funcname));
+      emit("  jmp .L.end.%s.%d\n", ctx->current_fn->name, seq);
+      emit(".L.call.%s.%d:\n", ctx->current_fn->name, seq);
+      emit("  sub rsp, 8\n");
+      emit("  mov eax, 0\n");
+      emit("  call %s\n", call_target(node->funcname));
+      emit("  add rsp, 8\n");
+      emit(".L.end.%s.%d:\n", ctx->current_fn->name, seq);
+
+      // 8ビットと16ビットの戻り値は上位ビットが不定なので int に拡張する
+      if (node->ty->kind == TY_BOOL)
+        emit("  movzx eax, al\n");
+      else if (is_narrow(node->ty) && node->ty->size < 4)
+        convert(long_type, node->ty, RAX);
+      emit("  push rax\n");
       return;
     }
     case ND_ADDR:
@@ -216,118 +806,324 @@ static void gen(Node *node) {
       return;
     case ND_DEREF:
       gen(node->lhs);
-      if (node->ty->kind != TY_ARRAY) load(node->ty);
+      load(node->ty);
       return;
     case ND_CAST:
       gen(node->lhs);
-      truncate(node->ty);
+      emit("  pop rax\n");
+      convert(node->lhs->ty, node->ty, RAX);
+      emit("  push rax\n");
+      return;
+    case ND_SELECT:
+      gen(node->cond);
+      gen(node->then);
+      gen(node->els);
+      emit("  pop rdi\n");
+      emit("  pop rax\n");
+      emit("  pop rcx\n");
+      convert(node->then->ty, node->ty, RAX);
+      convert(node->els->ty, node->ty, RDI);
+      cmp_zero(node->cond->ty, RCX);
+      emit("  cmove %s, %s\n", reg(node->ty, RAX), reg(node->ty, RDI));
+      emit("  push rax\n");
       return;
   }
 
   gen(node->lhs);
   gen(node->rhs);
 
-  printf("  pop rdi\n");
-  printf("  pop rax\n");
+  emit("  pop rdi\n");
+  emit("  pop rax\n");
 
   switch (node->kind) {
     case ND_ADD:
-      printf("  add rax, rdi\n");
-      break;
     case ND_SUB:
-      printf("  sub rax, rdi\n");
-      break;
     case ND_MUL:
-      printf("  imul rax, rdi\n");
-      break;
-    case ND_DIV:
-      printf("  cqo\n");
-      printf("  idiv rdi\n");
-      break;
-    case ND_EQ:
-      printf("  cmp rax, rdi\n");
-      printf("  sete al\n");
-      printf("  movzb rax, al\n");
-      break;
-    case ND_NE:
-      printf("  cmp rax, rdi\n");
-      printf("  setne al\n");
-      printf("  movzb rax, al\n");
-      break;
-    case ND_LT:
-      printf("  cmp rax, rdi\n");
-      printf("  setl al\n");
-      printf("  movzb rax, al\n");
-      break;
-    case ND_LE:
-      printf("  cmp rax, rdi\n");
-      printf("  setle al\n");
-      printf("  movzb rax, al\n");
+    case ND_DIV: {
+      char *ax = reg(node->ty, RAX);
+      char *di = reg(node->ty, RDI);
+      convert(node->lhs->ty, node->ty, RAX);
+      convert(node->rhs->ty, node->ty, RDI);
+      if (node->kind == ND_ADD)
+        emit("  add %s, %s\n", ax, di);
+      else if (node->kind == ND_SUB)
+        emit("  sub %s, %s\n", ax, di);
+      else if (node->kind == ND_MUL)
+        emit("  imul %s, %s\n", ax, di);
+      else {
+        emit(is_narrow(node->ty) ? "  cdq\n" : "  cqo\n");
+        emit("  idiv %s\n", di);
+      }
       break;
+    }
     case ND_PTR_ADD:
-      printf("  imul rdi, %ld\n", node->ty->ptr_to->size);
-      printf("  add rax, rdi\n");
+      convert(node->rhs->ty, long_type, RDI);
+      emit("  imul rdi, %ld\n", node->ty->ptr_to->size);
+      emit("  add rax, rdi\n");
       break;
     case ND_PTR_SUB:
-      printf("  imul rdi, %ld\n", node->ty->ptr_to->size);
-      printf("  sub rax, rdi\n");
+      convert(node->rhs->ty, long_type, RDI);
+      emit("  imul rdi, %ld\n", node->ty->ptr_to->size);
+      emit("  sub rax, rdi\n");
       break;
     case ND_PTR_DIFF:
-      printf("  sub rax, rdi\n");
-      printf("  cqo\n");
-      printf("  mov rdi, %ld\n",
+      emit("  sub rax, rdi\n");
+      emit("  cqo\n");
+      emit("  mov rdi, %ld\n",
              node->lhs->ty->ptr_to->size);  // node->ty->ptr_to は null
                                             // lhs のサイズに合わせる
-      printf("  idiv rdi\n");
+      emit("  idiv rdi\n");
       break;
   }
 
-  printf("  push rax\n");
+  emit("  push rax\n");
 }
 
-void codegen(Program *prog) {
-  printf(".intel_syntax noprefix\n");
-  printf(".data\n");
+// 途中に '\0' を含む文字列リテラルは、リンカが文字列単位でマージすると
+// 後半部分と離れてしまうため、マージ可能なセクションに置けない
+static bool has_inner_nul(Var *var) {
+  for (int i = 0; i < var->cont_len - 1; i++)
+    if (!var->contents[i]) return true;
+  return false;
+}
+
+static void emit_string(char *directive, char *buf, int len) {
+  emit("  %s \"", directive);
+  for (int i = 0; i < len; i++) {
+    unsigned char c = buf[i];
+    if (c == '"' || c == '\\')
+      emit("\\%c", c);
+    else if (isprint(c))
+      fputc(c, ctx->out);
+    else
+      emit("\\%03o", c);  // 後続の数字と混ざらないよう常に3桁
+  }
+  emit("\"\n");
+}
+
+// バイト列を1バイトずつではなく .ascii/.string と .zero にまとめて出力する
+static void emit_bytes(char *buf, int len) {
+  int i = 0;
+  while (i < len) {
+    int j = i;
+    if (!buf[i]) {
+      while (j < len && !buf[j]) j++;
+      emit("  .zero %d\n", j - i);
+      i = j;
+      continue;
+    }
+
+    while (j < len && buf[j]) j++;
+    if (j == len - 1 || (j < len && buf[j + 1])) {
+      // 直後の '\0' 1つは .string の終端として出力する
+      emit_string(".string", buf + i, j - i);
+      i = j + 1;
+    } else {
+      emit_string(".ascii", buf + i, j - i);
+      i = j;
+    }
+  }
+}
+
+// 文字列を末尾から辞書順に比較する。この順に並べると、ある文字列の接尾辞に
+// なっている文字列はその文字列より前に連続して並ぶ
+static int cmp_reversed(const void *a, const void *b) {
+  Var *x = *(Var **)a;
+  Var *y = *(Var **)b;
+  for (int i = 1; i <= x->cont_len && i <= y->cont_len; i++) {
+    unsigned char c = x->contents[x->cont_len - i];
+    unsigned char d = y->contents[y->cont_len - i];
+    if (c != d) return c - d;
+  }
+  return x->cont_len - y->cont_len;
+}
+
+static bool is_suffix(Var *var, Var *of) {
+  return var->cont_len <= of->cont_len &&
+         !memcmp(of->contents + of->cont_len - var->cont_len, var->contents,
+                 var->cont_len);
+}
+
+// 他のリテラルの末尾と一致する文字列リテラルは実体を出力せず、
+// そのリテラルの途中を指すシンボルにする
+static void emit_strings(Program *prog) {
+  int n = 0;
+  for (VarList *vl = prog->globals; vl; vl = vl->next)
+    if (vl->var->contents) n++;
+  if (!n) return;
+
+  Var **strs = arena_calloc(n, sizeof(Var *));
+  int i = 0;
+  for (VarList *vl = prog->globals; vl; vl = vl->next)
+    if (vl->var->contents) strs[i++] = vl->var;
+  qsort(strs, n, sizeof(Var *), cmp_reversed);
+
+  Var **base = arena_calloc(n, sizeof(Var *));
+  for (i = n - 1; i >= 0; i--)
+    if (i + 1 < n && is_suffix(strs[i], strs[i + 1]))
+      base[i] = base[i + 1];
+    else
+      base[i] = strs[i];
+
+  emit(".section .rodata.str1.1,\"aMS\",@progbits,1\n");
+  for (i = 0; i < n; i++) {
+    if (base[i] != strs[i] || has_inner_nul(strs[i])) continue;
+    emit("%s:\n", strs[i]->name);
+    emit_bytes(strs[i]->contents, strs[i]->cont_len);
+  }
+
+  emit(".section .rodata\n");
+  for (i = 0; i < n; i++) {
+    if (base[i] != strs[i] || !has_inner_nul(strs[i])) continue;
+    emit("%s:\n", strs[i]->name);
+    emit_bytes(strs[i]->contents, strs[i]->cont_len);
+  }
+
+  for (i = 0; i < n; i++)
+    if (base[i] != strs[i])
+      emit(".set %s, %s+%d\n", strs[i]->name, base[i]->name,
+             base[i]->cont_len - strs[i]->cont_len);
+}
+
+static void emit_data(Program *prog) {
+  // ゼロ初期化されるグローバル変数は .bss に置き、実行ファイルには含めない
+  emit(".bss\n");
   for (VarList *vl = prog->globals; vl; vl = vl->next) {
-    printf("%s:\n", vl->var->name);
-    if (!vl->var->contents)
-      printf("  .zero %ld\n", vl->var->ty->size);
+    Var *var = vl->var;
+    if (var->contents) continue;
+    if (!var->is_static) emit(".global %s\n", var->name);
+    emit(".align %d\n", var->ty->align);
+    emit("%s:\n", var->name);
+    emit("  .zero %ld\n", var->ty->size);
+  }
+
+  // 文字列リテラルは読み取り専用
+  emit_strings(prog);
+}
+
+static void gen_function(Function *fn) {
+  ctx->current_fn = fn;
+  ctx->label_counter = 0;
+  ctx->brkseq = -1;
+
+  // アセンブリの前半部分を出力
+  if (!fn->is_static) emit(".global %s\n", fn->name);
+  emit("%s:\n", fn->name);
+
+  // プロローグ
+  emit("  push rbp\n");
+  emit("  mov rbp, rsp\n");
+  emit("  sub rsp, %d\n", fn->stack_size);
+
+  // 引数の値をローカル変数の領域に書き込む
+  int i = 0;
+  for (VarList *vl = fn->args; vl; vl = vl->next)
+    if (vl->var->ty->size == 1)
+      emit("  mov [rbp-%d], %s\n", vl->var->offset, argreg1[i++]);
+    else if (vl->var->ty->size == 2)
+      emit("  mov [rbp-%d], %s\n", vl->var->offset, argreg2[i++]);
+    else if (vl->var->ty->size == 4)
+      emit("  mov [rbp-%d], %s\n", vl->var->offset, argreg4[i++]);
     else
-      for (int i = 0; i < vl->var->cont_len; i++)
-        printf("  .byte %d\n", vl->var->contents[i]);
-  }
-  printf(".text\n");
-  for (Function *fn = prog->fns; fn; fn = fn->next) {
-    // アセンブリの前半部分を出力
-    printf(".global %s\n", fn->name);
-    printf("%s:\n", fn->name);
-    funcname = fn->name;
-
-    // プロローグ
-    printf("  push rbp\n");
-    printf("  mov rbp, rsp\n");
-    printf("  sub rsp, %d\n", fn->stack_size);
-
-    // 引数の値をローカル変数の領域に書き込む
-    int i = 0;
-    for (VarList *vl = fn->args; vl; vl = vl->next)
-      if (vl->var->ty->size == 1)
-        printf("  mov [rbp-%d], %s\n", vl->var->offset, argreg1[i++]);
-      else if (vl->var->ty->size == 2)
-        printf("  mov [rbp-%d], %s\n", vl->var->offset, argreg2[i++]);
-      else if (vl->var->ty->size == 4)
-        printf("  mov [rbp-%d], %s\n", vl->var->offset, argreg4[i++]);
-      else
-        printf("  mov [rbp-%d], %s\n", vl->var->offset, argreg8[i++]);
-
-    // 先頭の式から順にコード生成
-    for (Node *node = fn->node; node; node = node->next) gen(node);
-
-    // エピローグ
-    // 最後の式の結果がRAXに残っているのでそれが返り値になる
-    printf(".L.return.%s:\n", fn->name);
-    printf("  mov rsp, rbp\n");
-    printf("  pop rbp\n");
-    printf("  ret\n");
-  }
-}
\ No newline at end of file
+      emit("  mov [rbp-%d], %s\n", vl->var->offset, argreg8[i++]);
+
+  // 先頭の式から順にコード生成
+  for (Node *node = fn->node; node; node = node->next) gen(node);
+
+  // エピローグ
+  // 最後の式の結果がRAXに残っているのでそれが返り値になる
+  emit(".L.return.%s:\n", fn->name);
+  emit("  mov rsp, rbp\n");
+  emit("  pop rbp\n");
+  emit("  ret\n");
+}
+
+void codegen_function(Function *fn) {
+  if (fn->cached) {
+    fwrite(fn->cached, 1, fn->cached_len, ctx->out);
+    return;
+  }
+  if (!fn->cache_key || fn->has_diag) {
+    gen_function(fn);
+    return;
+  }
+
+  // --cache: 生成したアセンブリを関数ごとのキャッシュにも入れる
+  // (エントリの形式は parse.c を参照)
+  FILE *out = ctx->out;
+  char *text;
+  size_t len;
+  ctx->out = open_memstream(&text, &len);
+  gen_function(fn);
+  fclose(ctx->out);
+  ctx->out = out;
+  fwrite(text, 1, len, out);
+
+  char *buf;
+  size_t size;
+  FILE *fp = open_memstream(&buf, &size);
+  fwrite(fn->cache_strs, 1, fn->cache_strs_len, fp);
+  write_refs(fn, fp);
+  fprintf(fp, "A\n");
+  fwrite(text, 1, len, fp);
+  fclose(fp);
+  cache_put_function(fn->cache_key, buf, size);
+  free(buf);
+  free(text);
+}
+
+// -j N: 関数ごとに別のバッファへ並列に生成し、あとでソース順につなげる
+typedef struct {
+  Function *fn;
+  char *buf;
+  size_t len;
+} FnOutput;
+
+static void gen_function_task(int i, void *arg) {
+  FnOutput *out = (FnOutput *)arg + i;
+  // parallel_for が逐次に実行するときは呼び出し元の ctx で動くので、
+  // 本来の出力先を戻しておく
+  FILE *saved = ctx->out;
+  ctx->out = open_memstream(&out->buf, &out->len);
+  codegen_function(out->fn);
+  fclose(ctx->out);
+  ctx->out = saved;
+}
+
+static void emit_header(void) {
+  emit(".intel_syntax noprefix\n");
+  emit(".section .note.GNU-stack,\"\",@progbits\n");  // スタックは実行不可
+}
+
+// -fpipeline: 関数をパースした順に1つずつ出力し、データは最後に出力する
+void codegen_begin(void) {
+  emit_header();
+  emit(".text\n");
+}
+
+void codegen_end(Program *prog) { emit_data(prog); }
+
+void codegen(Program *prog) {
+  ctx->functions = prog->fns;
+  emit_header();
+  emit_data(prog);
+  emit(".text\n");
+
+  if (ctx->opts.jobs <= 1) {
+    for (Function *fn = prog->fns; fn; fn = fn->next) codegen_function(fn);
+    return;
+  }
+
+  int n = 0;
+  for (Function *fn = prog->fns; fn; fn = fn->next) n++;
+  FnOutput *outs = arena_calloc(n, sizeof(FnOutput));
+  int i = 0;
+  for (Function *fn = prog->fns; fn; fn = fn->next) outs[i++].fn = fn;
+
+  parallel_for(n, gen_function_task, outs);
+
+  for (i = 0; i < n; i++) {
+    fwrite(outs[i].buf, 1, outs[i].len, ctx->out);
+    free(outs[i].buf);
+  }
+}
@@ -0,0 +1,302 @@
+#include "9cc.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+
+_Thread_local Compiler *ctx;
+
+//
+// アリーナ
+//
+// コンパイル中に確保したメモリは個別に解放せず、
+// コンパイルが終わったときにブロックごとまとめて解放する。
+//
+
+#define ARENA_BLOCK_SIZE (1024 * 1024)
+
+struct ArenaBlock {
+  ArenaBlock *next;
+  size_t used;
+  size_t cap;
+  char buf[];
+};
+
+// 解放した標準サイズのブロックは0で埋めてここに取っておき、
+// 次のコンパイルで使い回す (--server などで1プロセスが何度もコンパイルするとき)
+#define ARENA_CACHE_MAX 64
+
+static ArenaBlock *block_cache;
+static int block_cache_len;
+static pthread_mutex_t block_cache_mu = PTHREAD_MUTEX_INITIALIZER;
+
+static ArenaBlock *new_block(size_t sz) {
+  if (sz <= ARENA_BLOCK_SIZE) {
+    pthread_mutex_lock(&block_cache_mu);
+    ArenaBlock *b = block_cache;
+    if (b) {
+      block_cache = b->next;
+      block_cache_len--;
+    }
+    pthread_mutex_unlock(&block_cache_mu);
+    if (b) return b;
+  }
+
+  size_t cap = sz > ARENA_BLOCK_SIZE ? sz : ARENA_BLOCK_SIZE;
+  ArenaBlock *b = calloc(1, sizeof(ArenaBlock) + cap);
+  if (!b) error("out of memory");
+  b->cap = cap;
+  return b;
+}
+
+void *arena_calloc(size_t n, size_t size) {
+  size_t sz = align_to(n * size, 16);
+  ArenaBlock *b = *ctx->alloc;
+  if (!b || b->cap - b->used < sz) {
+    b = new_block(sz);
+    b->next = *ctx->alloc;
+    *ctx->alloc = b;
+  }
+  void *p = b->buf + b->used;
+  b->used += sz;
+  return p;
+}
+
+char *arena_strndup(char *s, size_t n) {
+  char *t = arena_calloc(n + 1, sizeof(char));
+  memcpy(t, s, n);
+  t[n] = '\0';
+  return t;
+}
+
+void free_arena(ArenaBlock *b) {
+  while (b) {
+    ArenaBlock *next = b->next;
+    bool cached = false;
+    if (b->cap == ARENA_BLOCK_SIZE) {
+      pthread_mutex_lock(&block_cache_mu);
+      if (block_cache_len < ARENA_CACHE_MAX) {
+        memset(b->buf, 0, b->used);
+        b->used = 0;
+        b->next = block_cache;
+        block_cache = b;
+        block_cache_len++;
+        cached = true;
+      }
+      pthread_mutex_unlock(&block_cache_mu);
+    }
+    if (!cached) free(b);
+    b = next;
+  }
+}
+
+static void free_diags(CcDiag *d) {
+  while (d) {
+    CcDiag *next = d->next;
+    free(d->filename);
+    free(d->message);
+    free(d->text);
+    free(d);
+    d = next;
+  }
+}
+
+//
+// スレッドプール
+//
+// タスクを実行するスレッドはそれぞれ呼び出し元のコンテキストの複製を持つ。
+// 複製で確保したメモリは終了後に呼び出し元のアリーナへ移すので、
+// タスクが作ったノードなどはそのまま使い続けられる。
+//
+
+typedef struct {
+  int n;
+  void (*fn)(int i, void *arg);
+  void *arg;
+  Compiler *parent;
+  atomic_int next;
+  CcDiag **diags;  // タスクごとの診断メッセージ
+  bool *failed;    // タスクごとにエラーで打ち切られたか
+  pthread_mutex_t mu;
+} Pool;
+
+static void *worker(void *p) {
+  Pool *pool = p;
+  Compiler *w = malloc(sizeof(Compiler));
+  *w = *pool->parent;
+  w->arena = NULL;
+  w->alloc = &w->arena;
+  ctx = w;
+
+  for (;;) {
+    int i = atomic_fetch_add(&pool->next, 1);
+    if (i >= pool->n) break;
+    w->diags = w->diags_last = NULL;
+    if (!setjmp(w->bail))
+      pool->fn(i, pool->arg);
+    else
+      pool->failed[i] = true;
+    pool->diags[i] = w->diags;
+  }
+
+  // 確保したブロックを呼び出し元のアリーナにつなぐ
+  if (w->arena) {
+    ArenaBlock *last = w->arena;
+    while (last->next) last = last->next;
+    pthread_mutex_lock(&pool->mu);
+    last->next = pool->parent->arena;
+    pool->parent->arena = w->arena;
+    pthread_mutex_unlock(&pool->mu);
+  }
+  ctx = NULL;
+  free(w);
+  return NULL;
+}
+
+// fn(0, arg) ... fn(n - 1, arg) を最大 -j 本のスレッドで実行する。
+// 診断メッセージはタスクの順に並べ、最初にエラーになったタスクまでを残す。
+// 逐次に実行した場合と同じ結果になる。
+void parallel_for(int n, void (*fn)(int i, void *arg), void *arg) {
+  int nthreads = ctx->opts.jobs < n ? ctx->opts.jobs : n;
+  if (nthreads <= 1) {
+    for (int i = 0; i < n; i++) fn(i, arg);
+    return;
+  }
+
+  Pool pool = {n, fn, arg, ctx};
+  atomic_init(&pool.next, 0);
+  pool.diags = calloc(n, sizeof(CcDiag *));
+  pool.failed = calloc(n, sizeof(bool));
+  pthread_mutex_init(&pool.mu, NULL);
+
+  // スレッドを作れなかった分は、作れたスレッドがタスクを引き受ける
+  pthread_t *th = calloc(nthreads, sizeof(pthread_t));
+  int started = 0;
+  while (started < nthreads &&
+         !pthread_create(&th[started], NULL, worker, &pool))
+    started++;
+  for (int i = 0; i < started; i++) pthread_join(th[i], NULL);
+  free(th);
+  pthread_mutex_destroy(&pool.mu);
+
+  if (!started) {
+    free(pool.diags);
+    free(pool.failed);
+    for (int i = 0; i < n; i++) fn(i, arg);
+    return;
+  }
+
+  bool failed = false;
+  for (int i = 0; i < n; i++) {
+    for (CcDiag *d = pool.diags[i], *next; d; d = next) {
+      next = d->next;
+      d->next = NULL;
+      if (failed) {
+        free_diags(d);
+        continue;
+      }
+      if (ctx->diags_last)
+        ctx->diags_last->next = d;
+      else
+        ctx->diags = d;
+      ctx->diags_last = d;
+    }
+    failed |= pool.failed[i];
+  }
+  free(pool.diags);
+  free(pool.failed);
+  if (failed) longjmp(ctx->bail, 1);
+}
+
+//
+// コンパイル
+//
+
+void cc_default_options(CcOptions *opts) {
+  *opts = (CcOptions){.unroll_factor = 4};
+}
+
+// ローカル変数にスタック上のオフセットを割り当てる
+static void assign_lvar_offsets(Function *fn) {
+  int offset = 0;
+  for (VarList *vl = fn->locals; vl; vl = vl->next) {
+    offset = align_to(offset, vl->var->ty->align);
+    offset += vl->var->ty->size;
+    vl->var->offset = offset;
+  }
+  fn->stack_size = align_to(offset, 8);
+}
+
+// -fpipeline: パースし終わった関数をすぐに最適化して出力する
+void emit_function(Function *fn) {
+  optimize_function(fn);
+  assign_lvar_offsets(fn);
+  codegen_function(fn);
+}
+
+static void compile(const char *filename, const char *src) {
+  ctx->filename = arena_strndup((char *)filename, strlen(filename));
+
+  // 入力が必ず"\n\0"で終わっているようにする
+  size_t len = strlen(src);
+  ctx->user_input = arena_calloc(1, len + 2);
+  memcpy(ctx->user_input, src, len);
+  if (len == 0 || src[len - 1] != '\n') ctx->user_input[len] = '\n';
+
+  // -fpipeline: トークナイズ、パース、コード生成を関数ごとに交互に進める。
+  // プログラム全体を見る不要な関数の削除は行わない
+  if (ctx->opts.pipeline) {
+    ctx->token = tokenize_lazy();
+    codegen_begin();
+    codegen_end(program());
+    return;
+  }
+
+  // トークナイズしてパースする
+  ctx->token = tokenize();
+  Program *prog = program();
+  optimize(prog);
+  for (Function *fn = prog->fns; fn; fn = fn->next) assign_lvar_offsets(fn);
+  codegen(prog);
+}
+
+bool cc_compile(const char *filename, const char *src, const CcOptions *opts,
+                CcResult *res) {
+  *res = (CcResult){0};
+
+  // longjmp で戻ってきても値が残るように、コンテキストはヒープに置く
+  Compiler *c = calloc(1, sizeof(Compiler));
+  if (opts)
+    c->opts = *opts;
+  else
+    cc_default_options(&c->opts);
+  c->brkseq = -1;
+  c->alloc = &c->arena;
+  c->out = open_memstream(&res->asm_text, &res->asm_len);
+
+  Compiler *saved = ctx;
+  ctx = c;
+  if (!setjmp(c->bail)) {
+    compile(filename, src);
+    res->ok = true;
+  }
+  ctx = saved;
+
+  fclose(c->out);
+  if (!res->ok) {
+    free(res->asm_text);
+    res->asm_text = NULL;
+    res->asm_len = 0;
+  }
+  res->diags = c->diags;
+  free_arena(c->arena);
+  free_arena(c->scratch);
+  free_token_batches(c->batches);
+  free(c);
+  return res->ok;
+}
+
+void cc_free_result(CcResult *res) {
+  free(res->asm_text);
+  free_diags(res->diags);
+  *res = (CcResult){0};
+}
@@ -0,0 +1,55 @@
+#ifndef LIB9CC_H
+#define LIB9CC_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// 9cc をライブラリとして使うための API。
+// コンパイルごとに独立したコンテキストを使うので、
+// 複数のスレッドから同時に cc_compile を呼んでよい。
+
+typedef struct {
+  bool report;        // -fopt-report
+  bool vectorize;     // -fvectorize
+  bool pic;           // -fPIC: 共有ライブラリに入れられる位置独立コード
+  int unroll_factor;  // -funroll-factor=N: 0 または 1 で展開しない
+  int jobs;           // -j N: 並列に処理するスレッド数 (1 以下なら逐次)
+  bool pipeline;      // -fpipeline: 関数ごとにパースしてすぐに出力する
+  bool incremental;   // --cache: 関数ごとの結果をキャッシュから再利用する
+} CcOptions;
+
+typedef enum {
+  CC_ERROR,
+  CC_WARNING,
+  CC_NOTE,
+} CcDiagKind;
+
+// 診断メッセージ1件
+typedef struct CcDiag CcDiag;
+struct CcDiag {
+  CcDiag *next;
+  CcDiagKind kind;
+  char *filename;
+  int line;    // 1始まり。位置を持たないときは0
+  int column;  // 1始まり
+  char *message;
+  char *text;  // ソース行と "^" を含めて整形したもの
+};
+
+typedef struct {
+  bool ok;
+  char *asm_text;  // 失敗したときは NULL
+  size_t asm_len;
+  CcDiag *diags;
+} CcResult;
+
+void cc_default_options(CcOptions *opts);
+
+// src をコンパイルし、アセンブリと診断メッセージを res に返す。
+// opts が NULL ならデフォルトのオプションを使う。
+bool cc_compile(const char *filename, const char *src, const CcOptions *opts,
+                CcResult *res);
+
+void cc_free_result(CcResult *res);
+
+#endif
@@ -0,0 +1,1269 @@
+#include "9cc.h"
+
+static Node *new_null(Token *tok) {
+  Node *node = arena_calloc(1, sizeof(Node));
+  node->kind = ND_NULL;
+  node->tok = tok;
+  return node;
+}
+
+// 代入、複合代入、++ と -- で書き換わる左辺値。それ以外のノードなら NULL
+static Node *store_target(Node *node) {
+  switch (node->kind) {
+    case ND_ASSIGN:
+    case ND_ADD_ASSIGN:
+    case ND_SUB_ASSIGN:
+    case ND_MUL_ASSIGN:
+    case ND_DIV_ASSIGN:
+    case ND_POST_INC:
+    case ND_POST_DEC:
+      return node->lhs;
+  }
+  return NULL;
+}
+
+// node の中に kind のノードがある
+static bool contains(Node *node, NodeKind kind) {
+  if (!node) return false;
+  if (node->kind == kind) return true;
+
+  if (contains(node->lhs, kind) || contains(node->rhs, kind) ||
+      contains(node->cond, kind) || contains(node->then, kind) ||
+      contains(node->els, kind) || contains(node->init, kind) ||
+      contains(node->step, kind))
+    return true;
+  for (Node *n = node->body; n; n = n->next)
+    if (contains(n, kind)) return true;
+  for (Node *n = node->args; n; n = n->next)
+    if (contains(n, kind)) return true;
+  return false;
+}
+
+// この文を実行した後、制御が次の文に進まない
+static bool is_terminator(Node *node) {
+  switch (node->kind) {
+    case ND_RETURN:
+    case ND_BREAK:
+      return true;
+    case ND_BLOCK: {
+      Node *last = node->body;
+      while (last && last->next) last = last->next;
+      return last && is_terminator(last);
+    }
+    case ND_IF:
+      return node->els && is_terminator(node->then) &&
+             is_terminator(node->els);
+  }
+  return false;
+}
+
+static Node *prune(Node *node);
+
+// 文のリストから return の後などの到達しない文を取り除く。
+// 文式の場合は値になる最後の式を残す。case ラベルを含む文には
+// switch から飛んでくるので、そこからまた到達できる
+static Node *prune_list(Node *head, bool keep_last) {
+  Node dummy = {};
+  Node *cur = &dummy;
+  bool dead = false;
+
+  for (Node *n = head, *next; n; n = next) {
+    next = n->next;
+    if (contains(n, ND_CASE))
+      dead = false;
+    else if (dead && !(keep_last && !next))
+      continue;
+
+    cur = cur->next = prune(n);
+    cur->next = NULL;
+    if (is_terminator(cur)) dead = true;
+  }
+  return dummy.next;
+}
+
+// 条件が定数の if/while/for を畳み込み、到達しない文を取り除く。
+// 置き換え後のノードを返す
+static Node *prune(Node *node) {
+  if (!node) return NULL;
+
+  switch (node->kind) {
+    case ND_IF:
+      node->cond = prune(node->cond);
+      if (node->cond->kind == ND_NUM && !contains(node, ND_CASE)) {
+        Node *taken = node->cond->val ? node->then : node->els;
+        return taken ? prune(taken) : new_null(node->tok);
+      }
+      break;
+    case ND_WHILE:
+      if (node->cond->kind == ND_NUM && !node->cond->val &&
+          !contains(node, ND_CASE))
+        return new_null(node->tok);
+      break;
+    case ND_FOR:
+      if (node->cond && node->cond->kind == ND_NUM && !node->cond->val &&
+          !contains(node, ND_CASE))
+        return node->init ? prune(node->init) : new_null(node->tok);
+      break;
+    case ND_BLOCK:
+      node->body = prune_list(node->body, false);
+      return node;
+    case ND_STMT_EXPR:
+      node->body = prune_list(node->body, true);
+      return node;
+  }
+
+  node->lhs = prune(node->lhs);
+  node->rhs = prune(node->rhs);
+  node->cond = prune(node->cond);
+  node->then = prune(node->then);
+  node->els = prune(node->els);
+  node->init = prune(node->init);
+  node->step = prune(node->step);
+  for (Node *n = node->args; n; n = n->next) prune(n);
+  return node;
+}
+
+static Function *find_function(Program *prog, char *name) {
+  for (Function *fn = prog->fns; fn; fn = fn->next)
+    if (!strcmp(fn->name, name)) return fn;
+  return NULL;
+}
+
+static void mark_function(Program *prog, Function *fn);
+
+static void mark_node(Program *prog, Node *node) {
+  if (!node) return;
+
+  if (node->kind == ND_FUNCALL) {
+    Function *fn = find_function(prog, node->funcname);
+    if (fn) mark_function(prog, fn);
+  } else if (node->kind == ND_VAR && !node->var->is_local) {
+    if (node->var->ty->kind == TY_FUNC) {
+      Function *fn = find_function(prog, node->var->name);
+      if (fn) mark_function(prog, fn);
+    }
+    node->var->is_live = true;
+  }
+
+  mark_node(prog, node->lhs);
+  mark_node(prog, node->rhs);
+  mark_node(prog, node->cond);
+  mark_node(prog, node->then);
+  mark_node(prog, node->els);
+  mark_node(prog, node->init);
+  mark_node(prog, node->step);
+  for (Node *n = node->body; n; n = n->next) mark_node(prog, n);
+  for (Node *n = node->args; n; n = n->next) mark_node(prog, n);
+}
+
+// キャッシュから取り出した関数は本体の代わりに名前で参照をたどる
+static void mark_name(Program *prog, char *name) {
+  Function *fn = find_function(prog, name);
+  if (fn) mark_function(prog, fn);
+  for (VarList *vl = prog->globals; vl; vl = vl->next)
+    if (!strcmp(vl->var->name, name)) vl->var->is_live = true;
+}
+
+static void mark_function(Program *prog, Function *fn) {
+  if (fn->is_live) return;
+  fn->is_live = true;
+  for (Node *n = fn->node; n; n = n->next) mark_node(prog, n);
+  for (int i = 0; i < fn->nrefs; i++) mark_name(prog, fn->refs[i]);
+}
+
+static void write_node_refs(Node *node, FILE *fp) {
+  if (!node) return;
+
+  if (node->kind == ND_FUNCALL)
+    fprintf(fp, "R %s\n", node->funcname);
+  else if (node->kind == ND_VAR && !node->var->is_local)
+    fprintf(fp, "R %s\n", node->var->name);
+
+  write_node_refs(node->lhs, fp);
+  write_node_refs(node->rhs, fp);
+  write_node_refs(node->cond, fp);
+  write_node_refs(node->then, fp);
+  write_node_refs(node->els, fp);
+  write_node_refs(node->init, fp);
+  write_node_refs(node->step, fp);
+  for (Node *n = node->body; n; n = n->next) write_node_refs(n, fp);
+  for (Node *n = node->args; n; n = n->next) write_node_refs(n, fp);
+}
+
+// --cache: mark_node がたどるのと同じ名前を関数ごとのキャッシュに書く
+void write_refs(Function *fn, FILE *fp) {
+  for (Node *n = fn->node; n; n = n->next) write_node_refs(n, fp);
+}
+
+// 外部から見える関数から呼ばれない static な関数と、
+// 参照されない static な変数を取り除く
+static void remove_dead_symbols(Program *prog) {
+  for (Function *fn = prog->fns; fn; fn = fn->next)
+    if (!fn->is_static) mark_function(prog, fn);
+
+  Function fn_head = {};
+  Function *fn_cur = &fn_head;
+  for (Function *fn = prog->fns; fn; fn = fn->next)
+    if (fn->is_live) fn_cur = fn_cur->next = fn;
+  fn_cur->next = NULL;
+  prog->fns = fn_head.next;
+
+  VarList vl_head = {};
+  VarList *vl_cur = &vl_head;
+  for (VarList *vl = prog->globals; vl; vl = vl->next)
+    if (!vl->var->is_static || vl->var->is_live) vl_cur = vl_cur->next = vl;
+  vl_cur->next = NULL;
+  prog->globals = vl_head.next;
+}
+
+
+static Node *new_var_ref(Var *var, Token *tok) {
+  Node *node = arena_calloc(1, sizeof(Node));
+  node->kind = ND_VAR;
+  node->tok = tok;
+  node->var = var;
+  node->ty = var->ty;
+  return node;
+}
+
+static Var *new_temp(Type *ty) {
+  Var *var = arena_calloc(1, sizeof(Var));
+  var->name = "";
+  var->ty = ty;
+  var->is_local = true;
+
+  VarList *vl = arena_calloc(1, sizeof(VarList));
+  vl->var = var;
+  vl->next = ctx->current_fn->locals;
+  ctx->current_fn->locals = vl;
+  return var;
+}
+
+//
+// 共通部分式の削除
+//
+// 基本ブロック内 (if の場合はそれを支配する部分まで) で同じ値を計算する
+// 純粋な式が2回目に現れたら、最初の式を一時変数への代入に書き換え、
+// 2回目以降はその一時変数を読むようにする。
+// ストアと関数呼び出しで、書き換わりうる値を読む式は無効にする。
+//
+
+typedef struct Avail Avail;
+struct Avail {
+  Node *expr;  // 最初に現れた場所。共通化すると一時変数への代入になる
+  Node *val;   // 照合に使う式
+  Var *tmp;
+};
+
+typedef struct AvailList AvailList;
+struct AvailList {
+  AvailList *next;
+  Avail *avail;
+};
+
+static AvailList *push_avail(AvailList *list, Node *node) {
+  Avail *a = arena_calloc(1, sizeof(Avail));
+  a->expr = node;
+  a->val = node;
+  AvailList *al = arena_calloc(1, sizeof(AvailList));
+  al->avail = a;
+  al->next = list;
+  return al;
+}
+
+static bool contains_avail(AvailList *list, Avail *a) {
+  for (; list; list = list->next)
+    if (list->avail == a) return true;
+  return false;
+}
+
+static void mark_addr_taken(Node *node) {
+  if (!node) return;
+
+  if (node->kind == ND_ADDR) {
+    Node *n = node->lhs;
+    while (n->kind == ND_MEMBER) n = n->lhs;
+    if (n->kind == ND_VAR) n->var->addr_taken = true;
+  }
+
+  mark_addr_taken(node->lhs);
+  mark_addr_taken(node->rhs);
+  mark_addr_taken(node->cond);
+  mark_addr_taken(node->then);
+  mark_addr_taken(node->els);
+  mark_addr_taken(node->init);
+  mark_addr_taken(node->step);
+  for (Node *n = node->body; n; n = n->next) mark_addr_taken(n);
+  for (Node *n = node->args; n; n = n->next) mark_addr_taken(n);
+}
+
+// ポインタ経由で書き換わりうる変数に印を付ける。
+// 配列と構造体は暗黙にアドレスとして使われるので常に対象にする
+static void find_addr_taken(Function *fn) {
+  for (VarList *vl = fn->locals; vl; vl = vl->next) {
+    TypeKind kind = vl->var->ty->kind;
+    if (kind == TY_ARRAY || kind == TY_STRUCT) vl->var->addr_taken = true;
+  }
+  for (Node *n = fn->node; n; n = n->next) mark_addr_taken(n);
+}
+
+static bool same_type(Type *a, Type *b) {
+  if (a == b) return true;
+  if (a->kind != b->kind || a->size != b->size) return false;
+  if (a->ptr_to) return b->ptr_to && same_type(a->ptr_to, b->ptr_to);
+  return a->kind != TY_STRUCT && a->kind != TY_FUNC;
+}
+
+static bool same_expr(Node *a, Node *b) {
+  if (!a || !b) return a == b;
+  if (a->kind != b->kind) return false;
+
+  switch (a->kind) {
+    case ND_NUM:
+      return a->val == b->val;
+    case ND_VAR:
+      return a->var == b->var;
+    case ND_MEMBER:
+      return a->member == b->member && same_expr(a->lhs, b->lhs);
+    case ND_CAST:
+      return same_type(a->ty, b->ty) && same_expr(a->lhs, b->lhs);
+  }
+  return same_expr(a->lhs, b->lhs) && same_expr(a->rhs, b->rhs);
+}
+
+// 副作用がなく、何度評価しても同じ値になる式
+static bool is_pure(Node *node) {
+  switch (node->kind) {
+    case ND_NUM:
+    case ND_VAR:
+      return true;
+    case ND_ADDR:
+    case ND_DEREF:
+    case ND_MEMBER:
+    case ND_CAST:
+      return is_pure(node->lhs);
+    case ND_ADD:
+    case ND_SUB:
+    case ND_MUL:
+    case ND_DIV:
+    case ND_EQ:
+    case ND_NE:
+    case ND_LT:
+    case ND_LE:
+    case ND_PTR_ADD:
+    case ND_PTR_SUB:
+    case ND_PTR_DIFF:
+      return is_pure(node->lhs) && is_pure(node->rhs);
+  }
+  return false;
+}
+
+static bool is_array(Node *node) { return node->ty->kind == TY_ARRAY; }
+
+static int expr_cost(Node *node);
+
+// 左辺値のアドレスを求めるコスト
+static int addr_cost(Node *node) {
+  switch (node->kind) {
+    case ND_DEREF:
+      return expr_cost(node->lhs);
+    case ND_MEMBER:
+      return addr_cost(node->lhs) + 1;
+  }
+  return 0;
+}
+
+// 式の値を求めるのに必要な命令数のおおまかな見積もり
+static int expr_cost(Node *node) {
+  if (!node) return 0;
+
+  switch (node->kind) {
+    case ND_NUM:
+      return 0;
+    case ND_VAR:
+      return !is_array(node);
+    case ND_ADDR:
+      return addr_cost(node->lhs);
+    case ND_DEREF:
+    case ND_MEMBER:
+      return addr_cost(node) + !is_array(node);
+    case ND_CAST:
+    case ND_NOT:
+      return expr_cost(node->lhs) + 1;
+    case ND_SELECT:
+      return expr_cost(node->cond) + expr_cost(node->then) +
+             expr_cost(node->els) + 2;
+  }
+  return expr_cost(node->lhs) + expr_cost(node->rhs) + 1;
+}
+
+// 一時変数に入れられる値を持つ式。配列はポインタとして保持する
+static bool has_scalar_value(Node *node) {
+  if (!node->ty) return false;
+  return is_integer(node->ty) || node->ty->kind == TY_PTR || is_array(node);
+}
+
+// 一時変数から読み直す方が安い式だけを共通化の対象にする
+static bool is_cse_candidate(Node *node) {
+  return has_scalar_value(node) && is_pure(node) && expr_cost(node) >= 2;
+}
+
+static bool mentions(Node *node, Var *var) {
+  if (!node) return false;
+  if (node->kind == ND_VAR) return node->var == var;
+  return mentions(node->lhs, var) || mentions(node->rhs, var);
+}
+
+// ポインタ経由のストアや関数呼び出しで値が変わりうる読み出しを含む
+static bool reads_memory(Node *node) {
+  if (!node) return false;
+  switch (node->kind) {
+    case ND_VAR:
+      return !is_array(node) && (!node->var->is_local || node->var->addr_taken);
+    case ND_DEREF:
+    case ND_MEMBER:
+      if (!is_array(node)) return true;
+  }
+  return reads_memory(node->lhs) || reads_memory(node->rhs);
+}
+
+// var が NULL のときはメモリ全体が書き換わったものとみなす
+static AvailList *kill(AvailList *list, Var *var) {
+  if (!list) return NULL;
+  AvailList *rest = kill(list->next, var);
+  Node *val = list->avail->val;
+  if (var ? mentions(val, var) : reads_memory(val)) return rest;
+  if (rest == list->next) return list;
+
+  AvailList *al = arena_calloc(1, sizeof(AvailList));
+  al->avail = list->avail;
+  al->next = rest;
+  return al;
+}
+
+static AvailList *kill_store(AvailList *list, Node *lhs) {
+  if (lhs->kind == ND_VAR && lhs->var->is_local && !lhs->var->addr_taken)
+    return kill(list, lhs->var);
+  return kill(list, NULL);
+}
+
+// 両方の分岐を通った後も使える式だけを残す
+static AvailList *intersect(AvailList *list, AvailList *a, AvailList *b) {
+  if (!list) return NULL;
+  AvailList *rest = intersect(list->next, a, b);
+  if (!contains_avail(a, list->avail) || !contains_avail(b, list->avail))
+    return rest;
+  if (rest == list->next) return list;
+
+  AvailList *al = arena_calloc(1, sizeof(AvailList));
+  al->avail = list->avail;
+  al->next = rest;
+  return al;
+}
+
+// node を一時変数の読み出しに置き換える。
+// その式が初めて再利用されるときは、最初の式を一時変数への代入に書き換える
+static void reuse(Avail *a, Node *node) {
+  if (!a->tmp) {
+    Node *expr = a->expr;
+    Type *ty = is_array(expr) ? pointer_to(expr->ty->ptr_to) : expr->ty;
+    a->tmp = new_temp(ty);
+
+    Node *val = arena_calloc(1, sizeof(Node));
+    *val = *expr;
+    val->next = NULL;
+
+    Node *next = expr->next;
+    memset(expr, 0, sizeof(Node));
+    expr->kind = ND_ASSIGN;
+    expr->tok = val->tok;
+    expr->ty = ty;
+    expr->lhs = new_var_ref(a->tmp, val->tok);
+    expr->rhs = val;
+    expr->next = next;
+    a->val = val;
+  }
+
+  Node *next = node->next;
+  Token *tok = node->tok;
+  memset(node, 0, sizeof(Node));
+  *node = *new_var_ref(a->tmp, tok);
+  node->next = next;
+}
+
+static AvailList *cse(Node *node, AvailList *avail, bool value);
+
+static AvailList *cse_list(Node *node, AvailList *avail) {
+  for (Node *n = node; n; n = n->next) avail = cse(n, avail, true);
+  return avail;
+}
+
+// value が偽のときは node のアドレスを求める文脈にある
+static AvailList *cse(Node *node, AvailList *avail, bool value) {
+  if (!node) return avail;
+
+  bool candidate = value && is_cse_candidate(node);
+  if (candidate)
+    for (AvailList *al = avail; al; al = al->next)
+      if (same_expr(al->avail->val, node)) {
+        reuse(al->avail, node);
+        return avail;
+      }
+
+  switch (node->kind) {
+    case ND_IF: {
+      avail = cse(node->cond, avail, true);
+      AvailList *then = cse(node->then, avail, true);
+      AvailList *els = cse(node->els, avail, true);
+      return intersect(avail, then, els);
+    }
+    case ND_WHILE:
+      cse(node->then, cse(node->cond, NULL, true), true);
+      return NULL;
+    case ND_FOR: {
+      cse(node->init, avail, true);
+      AvailList *body = cse(node->then, cse(node->cond, NULL, true), true);
+      cse(node->step, body, true);
+      return NULL;
+    }
+    case ND_LOGAND:
+    case ND_LOGOR:
+      // 右辺は評価されないことがあるので、右辺で求めた式は後で使えない
+      avail = cse(node->lhs, avail, true);
+      return intersect(avail, cse(node->rhs, avail, true), avail);
+    case ND_SWITCH:
+      // 本体へは case から入るので空の集合から始め、break で抜けた後も空にする
+      cse(node->cond, avail, true);
+      cse(node->then, NULL, true);
+      return NULL;
+    case ND_CASE:
+      return cse(node->lhs, NULL, true);
+    case ND_BLOCK:
+    case ND_STMT_EXPR:
+      return cse_list(node->body, avail);
+    case ND_ASSIGN:
+    case ND_ADD_ASSIGN:
+    case ND_SUB_ASSIGN:
+    case ND_MUL_ASSIGN:
+    case ND_DIV_ASSIGN:
+    case ND_POST_INC:
+    case ND_POST_DEC:
+      avail = cse(node->lhs, avail, false);
+      avail = cse(node->rhs, avail, true);
+      return kill_store(avail, node->lhs);
+    case ND_FUNCALL:
+      return kill(cse_list(node->args, avail), NULL);
+    case ND_SELECT:
+      avail = cse(node->cond, avail, true);
+      avail = cse(node->then, avail, true);
+      avail = cse(node->els, avail, true);
+      break;
+    case ND_VEC_STORE:
+      avail = cse(node->lhs, avail, true);
+      avail = cse(node->rhs, avail, true);
+      return kill(avail, NULL);
+    case ND_ADDR:
+    case ND_MEMBER:
+      avail = cse(node->lhs, avail, false);
+      break;
+    default:
+      avail = cse(node->lhs, avail, true);
+      avail = cse(node->rhs, avail, true);
+  }
+
+  if (candidate) avail = push_avail(avail, node);
+  return avail;
+}
+
+static void eliminate_common_subexprs(Function *fn) {
+  cse_list(fn->node, NULL);
+}
+
+//
+// ループ不変式の移動
+//
+// while/for はそれぞれ条件式を入口とする自然ループになる。ループ内で値が
+// 変わらず、評価しても例外を起こさない式をループの直前 (プリヘッダ) で
+// 一時変数に計算しておき、ループ内ではその一時変数を読むようにする。
+// ループが一度も回らない場合にも評価されるので、ポインタ経由の読み出しと
+// 除算は移動しない。
+//
+
+typedef struct {
+  VarList *stored;  // ループ内で直接代入される変数
+  bool clobbers;    // ポインタ経由のストアまたは関数呼び出しがある
+  Node head;        // プリヘッダに置く代入文のリスト
+  Node *cur;
+} Loop;
+
+static bool is_stored(Loop *loop, Var *var) {
+  for (VarList *vl = loop->stored; vl; vl = vl->next)
+    if (vl->var == var) return true;
+  return false;
+}
+
+static void find_stores(Node *node, Loop *loop) {
+  if (!node) return;
+
+  Node *lhs = store_target(node);
+  if (lhs) {
+    if (lhs->kind == ND_VAR) {
+      VarList *vl = arena_calloc(1, sizeof(VarList));
+      vl->var = lhs->var;
+      vl->next = loop->stored;
+      loop->stored = vl;
+    } else {
+      loop->clobbers = true;
+    }
+  } else if (node->kind == ND_FUNCALL || node->kind == ND_VEC_STORE) {
+    loop->clobbers = true;
+  }
+
+  find_stores(node->lhs, loop);
+  find_stores(node->rhs, loop);
+  find_stores(node->cond, loop);
+  find_stores(node->then, loop);
+  find_stores(node->els, loop);
+  find_stores(node->init, loop);
+  find_stores(node->step, loop);
+  for (Node *n = node->body; n; n = n->next) find_stores(n, loop);
+  for (Node *n = node->args; n; n = n->next) find_stores(n, loop);
+}
+
+// ループ内で変数の中身が書き換わらない
+static bool is_unchanged(Var *var, Loop *loop) {
+  if (is_stored(loop, var)) return false;
+  return !loop->clobbers || (var->is_local && !var->addr_taken);
+}
+
+static bool is_invariant(Node *node, Loop *loop);
+
+// 左辺値のアドレスがループ内で変わらない。アドレスを求めるだけなので
+// ポインタの参照先は読まない
+static bool is_invariant_addr(Node *node, Loop *loop) {
+  switch (node->kind) {
+    case ND_VAR:
+      return true;
+    case ND_MEMBER:
+      return is_invariant_addr(node->lhs, loop);
+    case ND_DEREF:
+      return is_invariant(node->lhs, loop);
+  }
+  return false;
+}
+
+// ループ内で値が変わらず、先に評価しても例外を起こさない式
+static bool is_invariant(Node *node, Loop *loop) {
+  switch (node->kind) {
+    case ND_NUM:
+      return true;
+    case ND_VAR:
+      return is_array(node) || is_unchanged(node->var, loop);
+    case ND_ADDR:
+      return is_invariant_addr(node->lhs, loop);
+    case ND_DEREF:
+      return is_array(node) && is_invariant(node->lhs, loop);
+    case ND_MEMBER: {
+      if (is_array(node)) return is_invariant_addr(node, loop);
+      // 名前の付いたオブジェクトのメンバだけを読む
+      Node *n = node->lhs;
+      while (n->kind == ND_MEMBER) n = n->lhs;
+      return n->kind == ND_VAR && is_unchanged(n->var, loop);
+    }
+    case ND_CAST:
+      return is_invariant(node->lhs, loop);
+    case ND_ADD:
+    case ND_SUB:
+    case ND_MUL:
+    case ND_EQ:
+    case ND_NE:
+    case ND_LT:
+    case ND_LE:
+    case ND_PTR_ADD:
+    case ND_PTR_SUB:
+    case ND_PTR_DIFF:
+      return is_invariant(node->lhs, loop) && is_invariant(node->rhs, loop);
+  }
+  return false;
+}
+
+static void hoist_expr(Node *node, Loop *loop) {
+  Avail *a = NULL;
+  for (Node *n = loop->head.next; n; n = n->next)
+    if (same_expr(n->lhs->rhs, node)) {
+      a = arena_calloc(1, sizeof(Avail));
+      a->tmp = n->lhs->lhs->var;
+      break;
+    }
+
+  if (!a) {
+    if (ctx->opts.report)
+      note_tok(node->tok, "loop invariant expression hoisted");
+
+    Node *expr = arena_calloc(1, sizeof(Node));
+    *expr = *node;
+    expr->next = NULL;
+
+    Node *stmt = arena_calloc(1, sizeof(Node));
+    stmt->kind = ND_EXPR_STMT;
+    stmt->tok = node->tok;
+    stmt->lhs = expr;
+    loop->cur = loop->cur->next = stmt;
+
+    // プリヘッダの式を一時変数への代入に書き換える
+    a = arena_calloc(1, sizeof(Avail));
+    a->expr = expr;
+    reuse(a, node);
+    return;
+  }
+  reuse(a, node);
+}
+
+static void hoist(Node *node, Loop *loop, bool value) {
+  if (!node) return;
+
+  if (value && has_scalar_value(node) && expr_cost(node) >= 2 &&
+      is_invariant(node, loop)) {
+    hoist_expr(node, loop);
+    return;
+  }
+
+  if (store_target(node)) {
+    hoist(node->lhs, loop, false);
+    hoist(node->rhs, loop, true);
+    return;
+  }
+
+  switch (node->kind) {
+    case ND_ADDR:
+    case ND_MEMBER:
+      hoist(node->lhs, loop, false);
+      return;
+  }
+
+  hoist(node->lhs, loop, true);
+  hoist(node->rhs, loop, true);
+  hoist(node->cond, loop, true);
+  hoist(node->then, loop, true);
+  hoist(node->els, loop, true);
+  hoist(node->init, loop, true);
+  hoist(node->step, loop, true);
+  for (Node *n = node->body; n; n = n->next) hoist(n, loop, true);
+  for (Node *n = node->args; n; n = n->next) hoist(n, loop, true);
+}
+
+// node のループをプリヘッダとループからなるブロックに置き換える。
+// for の初期化式はプリヘッダより前に実行する
+static void move_invariants(Node *node) {
+  Loop loop = {};
+  loop.cur = &loop.head;
+  find_stores(node->cond, &loop);
+  find_stores(node->then, &loop);
+  find_stores(node->step, &loop);
+
+  hoist(node->cond, &loop, true);
+  hoist(node->then, &loop, true);
+  hoist(node->step, &loop, true);
+  if (!loop.head.next) return;
+
+  Node *body = arena_calloc(1, sizeof(Node));
+  *body = *node;
+  body->next = NULL;
+  body->init = NULL;
+  loop.cur->next = body;
+
+  Node *next = node->next;
+  Node *init = node->init;
+  memset(node, 0, sizeof(Node));
+  node->kind = ND_BLOCK;
+  node->tok = body->tok;
+  node->body = loop.head.next;
+  node->next = next;
+  if (init) {
+    init->next = node->body;
+    node->body = init;
+  }
+}
+
+//
+// ループ展開
+//
+// for (i = 定数; i < 定数; i = i + 1) の形で、本体で i を書き換えない
+// ループは回数が決まっているので、回数が展開係数以下なら完全に展開し、
+// それより多ければ本体を展開係数の数だけ並べたループと残りの回数分に展開する。
+//
+
+// 展開後のループ本体のノード数の上限
+#define UNROLL_MAX_NODES 256
+
+static Node *copy_node(Node *node) {
+  if (!node) return NULL;
+
+  Node *n = arena_calloc(1, sizeof(Node));
+  *n = *node;
+  n->next = NULL;
+  n->lhs = copy_node(node->lhs);
+  n->rhs = copy_node(node->rhs);
+  n->cond = copy_node(node->cond);
+  n->then = copy_node(node->then);
+  n->els = copy_node(node->els);
+  n->init = copy_node(node->init);
+  n->step = copy_node(node->step);
+
+  Node head = {};
+  Node *cur = &head;
+  for (Node *m = node->body; m; m = m->next) cur = cur->next = copy_node(m);
+  n->body = head.next;
+
+  head.next = NULL;
+  cur = &head;
+  for (Node *m = node->args; m; m = m->next) cur = cur->next = copy_node(m);
+  n->args = head.next;
+  return n;
+}
+
+static int count_nodes(Node *node) {
+  if (!node) return 0;
+  int n = 1 + count_nodes(node->lhs) + count_nodes(node->rhs) +
+          count_nodes(node->cond) + count_nodes(node->then) +
+          count_nodes(node->els) + count_nodes(node->init) +
+          count_nodes(node->step);
+  for (Node *m = node->body; m; m = m->next) n += count_nodes(m);
+  for (Node *m = node->args; m; m = m->next) n += count_nodes(m);
+  return n;
+}
+
+static bool is_var(Node *node, Var *var) {
+  return node->kind == ND_VAR && node->var == var;
+}
+
+static bool is_num(Node *node) { return node->kind == ND_NUM; }
+
+// i = i + 1、i = 1 + i、i += 1、++i または i++
+static bool is_increment(Node *node, Var *var) {
+  if (node->kind != ND_EXPR_STMT) return false;
+  Node *assign = node->lhs;
+  Node *lhs = store_target(assign);
+  if (!lhs || !is_var(lhs, var)) return false;
+
+  if (assign->kind == ND_POST_INC) return true;
+  if (assign->kind == ND_ADD_ASSIGN)
+    return is_num(assign->rhs) && assign->rhs->val == 1;
+  if (assign->kind != ND_ASSIGN || assign->rhs->kind != ND_ADD) return false;
+
+  Node *add = assign->rhs;
+  return (is_var(add->lhs, var) && is_num(add->rhs) && add->rhs->val == 1) ||
+         (is_var(add->rhs, var) && is_num(add->lhs) && add->lhs->val == 1);
+}
+
+// 回数が決まっている for ループならループ変数を返す
+static Var *counted_loop(Node *node, long *trip_count) {
+  if (node->kind != ND_FOR || !node->init || !node->cond || !node->step)
+    return NULL;
+
+  Node *init = node->init;
+  if (init->kind != ND_EXPR_STMT || init->lhs->kind != ND_ASSIGN) return NULL;
+  Node *lhs = init->lhs->lhs;
+  if (lhs->kind != ND_VAR || !is_num(init->lhs->rhs)) return NULL;
+
+  Var *var = lhs->var;
+  if (!var->is_local || var->addr_taken) return NULL;
+  if (var->ty->kind != TY_INT && var->ty->kind != TY_LONG) return NULL;
+
+  Node *cond = node->cond;
+  if ((cond->kind != ND_LT && cond->kind != ND_LE) ||
+      !is_var(cond->lhs, var) || !is_num(cond->rhs))
+    return NULL;
+  if (!is_increment(node->step, var)) return NULL;
+
+  Loop loop = {};
+  find_stores(node->then, &loop);
+  if (is_stored(&loop, var)) return NULL;
+
+  long start = init->lhs->rhs->val;
+  long end = cond->rhs->val + (cond->kind == ND_LE);
+  *trip_count = end > start ? end - start : 0;
+  return var;
+}
+
+static Node *new_block(Token *tok) {
+  Node *node = arena_calloc(1, sizeof(Node));
+  node->kind = ND_BLOCK;
+  node->tok = tok;
+  return node;
+}
+
+// body と step の組を count 回 cur の後ろに並べる
+static Node *append_iterations(Node *cur, Node *loop, long count) {
+  for (long i = 0; i < count; i++) {
+    cur = cur->next = copy_node(loop->then);
+    cur = cur->next = copy_node(loop->step);
+  }
+  return cur;
+}
+
+// 展開できたループを置き換え、残ったループがあればそれを返す
+static Node *unroll_loop(Node *node) {
+  long trip_count;
+  Var *var = counted_loop(node, &trip_count);
+  if (!var || ctx->opts.unroll_factor <= 1) return node;
+
+  // 本体を並べると break の飛び先が変わり、case ラベルが重複する
+  if (contains(node->then, ND_BREAK) || contains(node->then, ND_CASE))
+    return node;
+
+  long factor = ctx->opts.unroll_factor;
+  int size = count_nodes(node->then) + count_nodes(node->step);
+  bool full = trip_count <= factor;
+  if ((full ? trip_count : factor) * size > UNROLL_MAX_NODES) return node;
+
+  Node *block = new_block(node->tok);
+  Node *cur = block->body = node->init;
+  Node *loop = NULL;
+
+  if (full) {
+    if (ctx->opts.report)
+      note_tok(node->tok, "loop fully unrolled (%ld iterations)", trip_count);
+    append_iterations(cur, node, trip_count);
+  } else {
+    if (ctx->opts.report)
+      note_tok(node->tok, "loop unrolled by a factor of %ld", factor);
+
+    // 本体を factor 個並べたループ。最後の step はループ自体の step
+    loop = arena_calloc(1, sizeof(Node));
+    *loop = *node;
+    loop->init = NULL;
+    loop->cond = copy_node(node->cond);
+    loop->cond->kind = ND_LT;
+    loop->cond->rhs->val =
+        node->init->lhs->rhs->val + trip_count - trip_count % factor;
+
+    Node *body = new_block(node->tok);
+    Node head = {};
+    Node *last = append_iterations(&head, node, factor - 1);
+    last->next = copy_node(node->then);
+    body->body = head.next;
+    loop->then = body;
+
+    cur = cur->next = loop;
+    append_iterations(cur, node, trip_count % factor);
+  }
+
+  Node *next = node->next;
+  *node = *block;
+  node->next = next;
+  return loop;
+}
+
+//
+// ベクトル化
+//
+// for (i = ...; i < n; i = i + 1) a[i] = b[i] + c[i]; のように、名前の付いた
+// 配列の i 番目の要素だけを読み書きするループを、SSE2 で16バイトずつ処理する
+// ループと、残りの要素を処理する元のループに分ける。配列はそれぞれ別の
+// オブジェクトで、どの要素も同じ添字でしか参照しないので、反復間の依存はない。
+//
+
+// 名前の付いた配列の要素 a[i] なら要素の型を返す
+static Type *array_elem(Node *node, Var *var) {
+  if (node->kind != ND_DEREF || node->lhs->kind != ND_PTR_ADD) return NULL;
+  Node *base = node->lhs->lhs;
+  if (base->kind != ND_VAR || base->ty->kind != TY_ARRAY) return NULL;
+  if (!is_var(node->lhs->rhs, var)) return NULL;
+
+  Type *ty = node->ty;
+  if (ty->kind != TY_CHAR && ty->kind != TY_SHORT && ty->kind != TY_INT &&
+      ty->kind != TY_LONG)
+    return NULL;
+  return ty;
+}
+
+static bool is_vectorizable_expr(Node *node, Var *var, Type *ty) {
+  switch (node->kind) {
+    case ND_NUM:
+      return true;
+    case ND_ADD:
+    case ND_SUB:
+      return is_vectorizable_expr(node->lhs, var, ty) &&
+             is_vectorizable_expr(node->rhs, var, ty);
+  }
+  Type *elem = array_elem(node, var);
+  return elem && elem->size == ty->size;
+}
+
+// 本体が a[i] = 式; の並びだけからなる。ベクトルの要素数はループ全体で
+// 1つなので、要素の大きさはすべての文で *size にそろっていなければならない
+static bool is_vectorizable_body(Node *node, Var *var, int *size) {
+  if (node->kind == ND_BLOCK) {
+    if (!node->body) return false;
+    for (Node *n = node->body; n; n = n->next)
+      if (!is_vectorizable_body(n, var, size)) return false;
+    return true;
+  }
+
+  if (node->kind != ND_EXPR_STMT || node->lhs->kind != ND_ASSIGN) return false;
+  Type *ty = array_elem(node->lhs->lhs, var);
+  if (!ty || (*size && ty->size != *size)) return false;
+  *size = ty->size;
+  return is_vectorizable_expr(node->lhs->rhs, var, ty);
+}
+
+static Node *new_typed_node(NodeKind kind, Type *ty, Token *tok) {
+  Node *node = arena_calloc(1, sizeof(Node));
+  node->kind = kind;
+  node->ty = ty;
+  node->tok = tok;
+  return node;
+}
+
+static Node *new_num_node(long val, Token *tok) {
+  Node *node = new_typed_node(ND_NUM, int_type, tok);
+  node->val = val;
+  return node;
+}
+
+// 要素の値を16バイトのベクトルに置き換えた式を作る
+static Node *vectorize_expr(Node *node, Type *ty) {
+  Node *vec;
+  switch (node->kind) {
+    case ND_NUM: {
+      // 定数を要素の幅に切り詰めて64ビットに並べる
+      unsigned long mask = ty->size == 8 ? -1UL : (1UL << ty->size * 8) - 1;
+      unsigned long pattern = 0;
+      for (int i = 0; i < 8 / ty->size; i++)
+        pattern = (pattern << ty->size * 8) | (node->val & mask);
+      vec = new_typed_node(ND_VEC_SPLAT, ty, node->tok);
+      vec->val = pattern;
+      return vec;
+    }
+    case ND_ADD:
+    case ND_SUB:
+      vec = new_typed_node(node->kind == ND_ADD ? ND_VEC_ADD : ND_VEC_SUB, ty,
+                         node->tok);
+      vec->lhs = vectorize_expr(node->lhs, ty);
+      vec->rhs = vectorize_expr(node->rhs, ty);
+      return vec;
+  }
+  vec = new_typed_node(ND_VEC_LOAD, ty, node->tok);
+  vec->lhs = copy_node(node->lhs);
+  return vec;
+}
+
+static Node *vectorize_body(Node *node) {
+  if (node->kind == ND_BLOCK) {
+    Node *block = new_block(node->tok);
+    Node head = {};
+    Node *cur = &head;
+    for (Node *n = node->body; n; n = n->next)
+      cur = cur->next = vectorize_body(n);
+    block->body = head.next;
+    return block;
+  }
+
+  Node *assign = node->lhs;
+  Node *store = new_typed_node(ND_VEC_STORE, assign->lhs->ty, node->tok);
+  store->lhs = copy_node(assign->lhs->lhs);
+  store->rhs = vectorize_expr(assign->rhs, assign->lhs->ty);
+  return store;
+}
+
+// ベクトル化できたら node をベクトル版と元のループを並べたブロックに置き換える
+static bool vectorize_loop(Node *node) {
+  if (node->kind != ND_FOR || !node->cond || !node->step) return false;
+
+  Node *cond = node->cond;
+  if ((cond->kind != ND_LT && cond->kind != ND_LE) ||
+      cond->lhs->kind != ND_VAR)
+    return false;
+
+  Var *var = cond->lhs->var;
+  if (!var->is_local || var->addr_taken || !is_integer(var->ty)) return false;
+  if (!is_increment(node->step, var)) return false;
+
+  Loop loop = {};
+  find_stores(node->then, &loop);
+  if (is_stored(&loop, var)) return false;
+
+  // ループの回数は途中で変わらない
+  Node *bound = cond->rhs;
+  if (!is_num(bound) &&
+      (bound->kind != ND_VAR || is_array(bound) || is_stored(&loop, bound->var)))
+    return false;
+
+  int size = 0;
+  if (!is_vectorizable_body(node->then, var, &size)) return false;
+
+  int lanes = 16 / size;
+  if (ctx->opts.report)
+    note_tok(node->tok, "loop vectorized (%d lanes)", lanes);
+
+  // for (; i + lanes - 1 < n; i = i + lanes) ベクトル版の本体
+  Node *vloop = new_typed_node(ND_FOR, NULL, node->tok);
+  vloop->cond = copy_node(cond);
+  Node *last = new_typed_node(ND_ADD, var->ty, cond->tok);
+  last->lhs = copy_node(cond->lhs);
+  last->rhs = new_num_node(lanes - 1, cond->tok);
+  vloop->cond->lhs = last;
+
+  Node *inc = new_typed_node(ND_ADD_ASSIGN, var->ty, node->step->tok);
+  inc->lhs = copy_node(cond->lhs);
+  inc->rhs = new_num_node(lanes, node->step->tok);
+  vloop->step = new_typed_node(ND_EXPR_STMT, NULL, node->step->tok);
+  vloop->step->lhs = inc;
+  vloop->then = vectorize_body(node->then);
+
+  // 残りの要素は元のループで処理する
+  Node *rest = arena_calloc(1, sizeof(Node));
+  *rest = *node;
+  rest->init = NULL;
+  rest->next = NULL;
+  vloop->next = rest;
+
+  Node *block = new_block(node->tok);
+  block->body = vloop;
+  if (node->init) {
+    node->init->next = vloop;
+    block->body = node->init;
+  }
+
+  Node *next = node->next;
+  *node = *block;
+  node->next = next;
+  return true;
+}
+
+// 内側のループから順に処理する
+static void optimize_loops(Node *node) {
+  if (!node) return;
+
+  optimize_loops(node->lhs);
+  optimize_loops(node->rhs);
+  optimize_loops(node->cond);
+  optimize_loops(node->then);
+  optimize_loops(node->els);
+  optimize_loops(node->init);
+  optimize_loops(node->step);
+  for (Node *n = node->body; n; n = n->next) optimize_loops(n);
+  for (Node *n = node->args; n; n = n->next) optimize_loops(n);
+
+  if (node->kind != ND_WHILE && node->kind != ND_FOR) return;
+
+  if (ctx->opts.vectorize && vectorize_loop(node)) return;
+
+  Node *loop = unroll_loop(node);
+  if (loop) move_invariants(loop);
+}
+
+//
+// if 変換
+//
+// if (c) x = a; else x = b; や if (c) x = a; のように、同じ変数への
+// 代入だけからなる分岐を、a と b の両方を評価して cmov で選ぶ代入に置き換え、
+// 分岐予測ミスをなくす。a と b は先に評価しても安全で安い式に限る。
+// else のない形は、アドレスを取られていないローカル変数にだけ適用する。
+//
+
+// 両辺を合わせてこれより高い式は分岐のままにする
+#define IFCONV_MAX_COST 6
+
+// x = a; だけからなる文なら代入のノードを返す
+static Node *single_assign(Node *node) {
+  if (node->kind == ND_BLOCK) {
+    if (!node->body || node->body->next) return NULL;
+    node = node->body;
+  }
+  if (node->kind != ND_EXPR_STMT || node->lhs->kind != ND_ASSIGN) return NULL;
+
+  Node *lhs = node->lhs->lhs;
+  if (lhs->kind != ND_VAR) return NULL;
+  if (!is_integer(lhs->ty) && lhs->ty->kind != TY_PTR) return NULL;
+  return node->lhs;
+}
+
+// 副作用がなく、条件によらず評価しても例外を起こさない式
+static bool is_speculatable(Node *node) {
+  Loop none = {};
+  return is_invariant(node, &none);
+}
+
+static void convert_if(Node *node) {
+  Node *then = single_assign(node->then);
+  if (!then) return;
+
+  Node *els;
+  if (node->els) {
+    els = single_assign(node->els);
+    if (!els || els->lhs->var != then->lhs->var) return;
+    els = els->rhs;
+  } else {
+    // if (c) x = a; は x = c ? a : x; にする。c が偽のときにも x に
+    // 書き込むことになるので、他のスレッドから見えない変数に限る
+    Var *var = then->lhs->var;
+    if (!var->is_local || var->addr_taken) return;
+    els = then->lhs;
+  }
+
+  if (!is_speculatable(then->rhs) || !is_speculatable(els)) return;
+  if (expr_cost(then->rhs) + expr_cost(els) > IFCONV_MAX_COST) return;
+
+  if (ctx->opts.report)
+    note_tok(node->tok, "branch converted to conditional move");
+
+  Node *sel;
+  if (is_num(then->rhs) && is_num(els) &&
+      (then->rhs->val == 1 || then->rhs->val == 0) &&
+      els->val == !then->rhs->val) {
+    // x = c != 0 または x = c == 0 として setcc にする
+    sel = new_typed_node(then->rhs->val ? ND_NE : ND_EQ, int_type, node->tok);
+    sel->lhs = node->cond;
+    sel->rhs = new_num_node(0, node->tok);
+  } else {
+    sel = new_typed_node(ND_SELECT, then->ty, node->tok);
+    sel->cond = node->cond;
+    sel->then = then->rhs;
+    sel->els = els;
+  }
+
+  Node *assign = new_typed_node(ND_ASSIGN, then->ty, then->tok);
+  assign->lhs = then->lhs;
+  assign->rhs = sel;
+
+  Node *next = node->next;
+  memset(node, 0, sizeof(Node));
+  node->kind = ND_EXPR_STMT;
+  node->tok = assign->tok;
+  node->lhs = assign;
+  node->next = next;
+}
+
+static void convert_ifs(Node *node) {
+  if (!node) return;
+
+  convert_ifs(node->lhs);
+  convert_ifs(node->rhs);
+  convert_ifs(node->cond);
+  convert_ifs(node->then);
+  convert_ifs(node->els);
+  convert_ifs(node->init);
+  convert_ifs(node->step);
+  for (Node *n = node->body; n; n = n->next) convert_ifs(n);
+  for (Node *n = node->args; n; n = n->next) convert_ifs(n);
+
+  if (node->kind == ND_IF) convert_if(node);
+}
+
+void optimize_function(Function *fn) {
+  ctx->current_fn = fn;
+  ctx->diag_fn = fn;
+  fn->node = prune_list(fn->node, false);
+  find_addr_taken(fn);
+  for (Node *n = fn->node; n; n = n->next) convert_ifs(n);
+  for (Node *n = fn->node; n; n = n->next) optimize_loops(n);
+  eliminate_common_subexprs(fn);
+  ctx->diag_fn = NULL;
+}
+
+void optimize(Program *prog) {
+  for (Function *fn = prog->fns; fn; fn = fn->next) optimize_function(fn);
+  remove_dead_symbols(prog);
+}
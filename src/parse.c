@@ -1,6 +1,5 @@
 #include "9cc.h"
 
-typedef struct VarScope VarScope;
 struct VarScope {
   VarScope *next;
   char *name;
@@ -10,7 +9,6 @@ struct VarScope {
   int enum_val;
 };
 
-typedef struct TagScope TagScope;
 struct TagScope {
   TagScope *next;
   char *name;
@@ -22,26 +20,28 @@ typedef struct {
   TagScope *tag_scope;
 } Scope;
 
-static VarList *locals;
-static VarList *globals;
-VarScope *var_scope;
-static TagScope *tag_scope;
+// 宣言に付く記憶域クラス指定子
+typedef struct {
+  bool is_typedef;
+  bool is_static;
+  bool is_extern;
+} VarAttr;
 
 static Scope *enter_scope(void) {
-  Scope *sc = calloc(1, sizeof(Scope));
-  sc->var_scope = var_scope;
-  sc->tag_scope = tag_scope;
+  Scope *sc = arena_calloc(1, sizeof(Scope));
+  sc->var_scope = ctx->var_scope;
+  sc->tag_scope = ctx->tag_scope;
   return sc;
 }
 
 static void leave_scope(Scope *sc) {
-  var_scope = sc->var_scope;
-  tag_scope = sc->tag_scope;
+  ctx->var_scope = sc->var_scope;
+  ctx->tag_scope = sc->tag_scope;
 }
 
 // 変数を名前で検索する。見つからなかった場合はNULLを返す。
 static VarScope *find_var(Token *tok) {
-  for (VarScope *sc = var_scope; sc; sc = sc->next) {
+  for (VarScope *sc = ctx->var_scope; sc; sc = sc->next) {
     if (strlen(sc->name) == tok->len &&
         memcmp(sc->name, tok->str, tok->len) == 0)
       return sc;
@@ -50,7 +50,7 @@ static VarScope *find_var(Token *tok) {
 }
 
 static TagScope *find_tag(Token *tok) {
-  for (TagScope *sc = tag_scope; sc; sc = sc->next) {
+  for (TagScope *sc = ctx->tag_scope; sc; sc = sc->next) {
     if (strlen(sc->name) == tok->len &&
         memcmp(sc->name, tok->str, tok->len) == 0)
       return sc;
@@ -59,7 +59,7 @@ static TagScope *find_tag(Token *tok) {
 }
 
 static Node *new_node(NodeKind kind, Token *tok) {
-  Node *node = calloc(1, sizeof(Node));
+  Node *node = arena_calloc(1, sizeof(Node));
   node->kind = kind;
   node->tok = tok;
 }
@@ -77,7 +77,7 @@ static Node *new_unary(NodeKind kind, Node *expr, Token *tok) {
   return node;
 }
 
-Node *new_num(int val, Token *tok) {
+Node *new_num(long val, Token *tok) {
   Node *node = new_node(ND_NUM, tok);
   node->val = val;
   return node;
@@ -91,15 +91,15 @@ static Node *new_var_node(Var *var, Token *tok) {
 
 static VarScope *push_scope(char *name) {
   // 先頭に変数追加
-  VarScope *sc = calloc(1, sizeof(VarScope));
-  sc->next = var_scope;
+  VarScope *sc = arena_calloc(1, sizeof(VarScope));
+  sc->next = ctx->var_scope;
   sc->name = name;
-  var_scope = sc;
+  ctx->var_scope = sc;
   return sc;
 }
 
 static Var *new_var(char *name, Type *ty, bool is_local) {
-  Var *var = calloc(1, sizeof(Var));
+  Var *var = arena_calloc(1, sizeof(Var));
   var->name = name;
   var->len = strlen(name);
   var->ty = ty;
@@ -110,10 +110,10 @@ static Var *new_var(char *name, Type *ty, bool is_local) {
 static Var *new_lvar(char *name, Type *ty) {
   Var *var = new_var(name, ty, true);
   push_scope(name)->var = var;  // var は null なので設定
-  VarList *vl = calloc(1, sizeof(VarList));
+  VarList *vl = arena_calloc(1, sizeof(VarList));
   vl->var = var;
-  vl->next = locals;
-  locals = vl;
+  vl->next = ctx->locals;
+  ctx->locals = vl;
   return var;
 }
 
@@ -122,10 +122,10 @@ static Var *new_gvar(char *name, Type *ty, bool emit) {
   push_scope(name)->var = var;
   if (emit) {
     // グローバル変数リストに追加する
-    VarList *vl = calloc(1, sizeof(VarList));
+    VarList *vl = arena_calloc(1, sizeof(VarList));
     vl->var = var;
-    vl->next = globals;
-    globals = vl;
+    vl->next = ctx->globals;
+    ctx->globals = vl;
   }
   return var;
 }
@@ -138,15 +138,110 @@ static Type *find_typedef(Token *tok) {
   return NULL;
 }
 
-static char *new_label(void) {
-  static int cnt = 0;
-  char buf[20];
-  sprintf(buf, ".L.data.%d", cnt++);
-  return strndup(buf, 20);
+// 文字列リテラルのラベルは中身のハッシュから作る。関数ごとのキャッシュに
+// 入れたアセンブリも、ファイルの中の位置によらず同じラベルを指せる
+static char *new_label(char *contents, int len) {
+  Sha256 s;
+  sha256_init(&s);
+  sha256_update(&s, contents, len);
+  char hex[65];
+  sha256_hex(&s, hex);
+
+  char buf[40];
+  sprintf(buf, ".L.str.%.32s", hex);
+  return arena_strndup(buf, strlen(buf));
+}
+
+// 同じ内容の文字列リテラルを1つのグローバル変数で共有するためのハッシュ表
+struct StrEntry {
+  StrEntry *next;
+  Var *var;
+};
+
+
+static unsigned hash_bytes(char *p, int len) {
+  unsigned h = 2166136261;  // FNV-1a
+  for (int i = 0; i < len; i++) h = (h ^ (unsigned char)p[i]) * 16777619;
+  return h;
+}
+
+static Var *string_literal(char *contents, int len) {
+  StrEntry **bucket =
+      &ctx->str_pool[hash_bytes(contents, len) % STR_POOL_SIZE];
+  for (StrEntry *e = *bucket; e; e = e->next)
+    if (e->var->cont_len == len && !memcmp(e->var->contents, contents, len))
+      return e->var;
+
+  Type *ty = array_of(char_type, len);
+  Var *var = new_gvar(new_label(contents, len), ty, true);
+  var->is_static = true;
+  // -fpipeline ではトークンが先に解放されるので中身をコピーしておく
+  var->contents = arena_calloc(1, len);
+  memcpy(var->contents, contents, len);
+  var->cont_len = len;
+
+  StrEntry *e = arena_calloc(1, sizeof(StrEntry));
+  e->var = var;
+  e->next = *bucket;
+  *bucket = e;
+  return var;
 }
 
-static Function *function(void);
-static Type *basetype(bool *is_typedef);
+// 文字列リテラルを参照するノード。ラベルはあとで出現順に付ける
+struct StrRef {
+  StrRef *next;
+  Node *node;
+};
+
+static Node *string_ref(Token *tok, char *contents, int len) {
+  Var *var = new_var("", array_of(char_type, len), false);
+  var->is_static = true;
+  var->contents = contents;
+  var->cont_len = len;
+  Node *node = new_var_node(var, tok);
+
+  StrRef *ref = arena_calloc(1, sizeof(StrRef));
+  ref->node = node;
+  ref->next = ctx->str_refs;
+  ctx->str_refs = ref;
+  return node;
+}
+
+// refs は出現と逆順に並んでいる
+static void intern_strings(StrRef *refs) {
+  StrRef *rev = NULL;
+  while (refs) {
+    StrRef *next = refs->next;
+    refs->next = rev;
+    rev = refs;
+    refs = next;
+  }
+  for (StrRef *r = rev; r; r = r->next)
+    r->node->var =
+        string_literal(r->node->var->contents, r->node->var->cont_len);
+}
+
+// -j N では関数本体を読み飛ばしておき、あとで並列にパースする。
+// 本体は関数の定義の位置で見えていたスコープでパースする。
+// スコープはリストの先頭に足していくだけなので、
+// その時点の先頭を覚えておけばあとの宣言は見えない。
+typedef struct Pending Pending;
+struct Pending {
+  Pending *next;
+  Function *fn;  // NULL なら文字列リテラルだけを持つ
+  Token *body;   // "{" の次のトークン
+  VarScope *var_scope;
+  TagScope *tag_scope;
+  VarList *locals;  // 引数
+  StrRef *strs;
+};
+
+static Function *function(Pending **pending);
+static void function_body(Function *fn);
+static bool use_fn_cache(void);
+static void hash_tokens(Sha256 *s, Token *start, Token *end);
+static void save_strings(Function *fn);
+static Type *basetype(VarAttr *attr);
 static Type *declarator(Type *ty, char **name);
 static Type *abstract_declarator(Type *ty);
 static Type *type_suffix(Type *ty);
@@ -159,6 +254,8 @@ static Node *stmt(void);
 static Node *stmt2(void);
 static Node *expr(void);
 static Node *assign(void);
+static Node *logor(void);
+static Node *logand(void);
 static Node *equality(void);
 static Node *relational(void);
 static Node *add(void);
@@ -169,37 +266,96 @@ static Node *suffix(void);
 static Node *primary(void);
 
 static bool is_function(void) {
-  Token *tok = token;
-  // 関数 or グローバル変数かわからないので，is_typedef を設定する
-  bool is_typedef;
-  Type *ty = basetype(&is_typedef);
+  Token *tok = ctx->token;
+  // 関数 or グローバル変数かわからないので，attr を設定する
+  VarAttr attr = {};
+  Type *ty = basetype(&attr);
   char *name = NULL;
   ty = declarator(ty, &name);  // 左辺の ty は使わない
   bool ret = name && consume("(");
-  token = tok;  // consume したトークンを戻す
+  ctx->token = tok;  // consume したトークンを戻す
   return ret;
 }
 
+static void parse_pending(int i, void *arg) {
+  Pending *p = ((Pending **)arg)[i];
+  if (!p->fn) return;
+  ctx->token = p->body;
+  ctx->var_scope = p->var_scope;
+  ctx->tag_scope = p->tag_scope;
+  ctx->locals = p->locals;
+  ctx->str_refs = p->strs;
+  function_body(p->fn);
+  p->strs = ctx->str_refs;
+}
+
+// -fpipeline: パースし終わった関数をすぐに出力し、
+// 引数から先のために確保したメモリを解放する
+static void flush_function(Function *fn) {
+  ctx->alloc = &ctx->arena;
+  intern_strings(ctx->str_refs);
+  ctx->str_refs = NULL;
+
+  if (fn) {
+    ctx->alloc = &ctx->scratch;
+    emit_function(fn);
+    fn->node = NULL;
+    fn->args = fn->locals = NULL;
+  }
+
+  ctx->alloc = &ctx->arena;
+  free_arena(ctx->scratch);
+  ctx->scratch = NULL;
+}
+
 // program    = (global_var | function)*
 Program *program(void) {
   Function head = {};
   Function *cur = &head;
-  globals = NULL;
+  ctx->globals = NULL;
+
+  bool defer = ctx->opts.jobs > 1 && !ctx->opts.pipeline;
+  Pending pending_head = {};
+  Pending *pending = &pending_head;
+  if (use_fn_cache()) sha256_init(&ctx->decls);
 
   while (!at_eof()) {
+    ctx->str_refs = NULL;
     if (is_function()) {
-      Function *fn = function();
-      if (!fn) continue;
-      cur->next = fn;
-      cur = cur->next;
+      Function *fn = function(defer ? &pending : NULL);
+      if (fn) cur = cur->next = fn;
+      ctx->functions = head.next;
+      if (ctx->opts.pipeline) flush_function(fn);
     } else {
+      Token *start = ctx->token;
       global_var();
+      if (use_fn_cache()) hash_tokens(&ctx->decls, start, ctx->token);
+    }
+    if (ctx->opts.pipeline) release_tokens();
+
+    if (!ctx->str_refs) continue;
+    if (defer) {
+      pending = pending->next = arena_calloc(1, sizeof(Pending));
+      pending->strs = ctx->str_refs;
+    } else {
+      intern_strings(ctx->str_refs);
     }
   }
 
-  Program *prog = calloc(1, sizeof(Program));
+  if (defer) {
+    int npending = 0;
+    for (Pending *p = pending_head.next; p; p = p->next) npending++;
+    Pending **arr = arena_calloc(npending, sizeof(Pending *));
+    int i = 0;
+    for (Pending *p = pending_head.next; p; p = p->next) arr[i++] = p;
+
+    parallel_for(npending, parse_pending, arr);
+    for (i = 0; i < npending; i++) intern_strings(arr[i]->strs);
+  }
+
+  Program *prog = arena_calloc(1, sizeof(Program));
   prog->fns = head.next;
-  prog->globals = globals;
+  prog->globals = ctx->globals;
   return prog;
 }
 
@@ -208,10 +364,10 @@ Program *program(void) {
 // builtin-type = "void" | "_Bool" | "char" | "short" | "int"
 //              | "long" | "long" "long"
 //
-// Note that "typedef" can appear anywhere in a basetype.
+// Note that "typedef" and "static" can appear anywhere in a basetype.
 // "int" can appear anywhere if type is short, long or long long.
-static Type *basetype(bool *is_typedef) {
-  if (!is_typename()) error_tok(token, "typename expected");
+static Type *basetype(VarAttr *attr) {
+  if (!is_typename()) error_tok(ctx->token, "typename expected");
 
   enum {
     VOID = 1 << 0,
@@ -226,15 +382,19 @@ static Type *basetype(bool *is_typedef) {
   Type *ty = int_type;
   int counter = 0;
 
-  if (is_typedef) *is_typedef = false;
 
   while (is_typename()) {
-    Token *tok = token;
+    Token *tok = ctx->token;
 
     // Handle storage class specifiers.
-    if (consume("typedef")) {
-      if (!is_typedef) error_tok(tok, "invalid storage class specifier");
-      *is_typedef = true;
+    if (peek("typedef") || peek("static") || peek("extern")) {
+      if (!attr) error_tok(tok, "invalid storage class specifier");
+      if (consume("typedef"))
+        attr->is_typedef = true;
+      else if (consume("static"))
+        attr->is_static = true;
+      else if (consume("extern"))
+        attr->is_extern = true;
       continue;
     }
 
@@ -248,9 +408,9 @@ static Type *basetype(bool *is_typedef) {
       } else if (peek("enum")) {
         ty = enum_specifier();
       } else {
-        ty = find_typedef(token);
+        ty = find_typedef(ctx->token);
         assert(ty);
-        token = token->next;
+        ctx->token = next_token(ctx->token);
       }
 
       counter |= OTHER;
@@ -307,7 +467,7 @@ static Type *declarator(Type *ty, char **name) {
   while (consume("*")) ty = pointer_to(ty);
 
   if (consume("(")) {
-    Type *placeholder = calloc(1, sizeof(Type));
+    Type *placeholder = arena_calloc(1, sizeof(Type));
     Type *new_ty = declarator(placeholder, name);  // 再帰的に型を処理
     expect(")");
     memcpy(placeholder, type_suffix(ty), sizeof(Type));
@@ -323,7 +483,7 @@ static Type *abstract_declarator(Type *ty) {
   while (consume("*")) ty = pointer_to(ty);
 
   if (consume("(")) {
-    Type *placeholder = calloc(1, sizeof(Type));
+    Type *placeholder = arena_calloc(1, sizeof(Type));
     Type *new_ty = abstract_declarator(placeholder);  // 再帰的に型を処理
     expect(")");
     memcpy(placeholder, type_suffix(ty), sizeof(Type));
@@ -349,11 +509,11 @@ static Type *type_name() {
 }
 
 static void push_tag_scope(Token *tok, Type *ty) {
-  TagScope *sc = calloc(1, sizeof(TagScope));
-  sc->next = tag_scope;
-  sc->name = strndup(tok->str, tok->len);
+  TagScope *sc = arena_calloc(1, sizeof(TagScope));
+  sc->next = ctx->tag_scope;
+  sc->name = arena_strndup(tok->str, tok->len);
   sc->ty = ty;
-  tag_scope = sc;
+  ctx->tag_scope = sc;
 }
 
 // struct-decl = "struct" ident |
@@ -379,7 +539,7 @@ static Type *struct_decl(void) {
     cur->next = struct_member();
     cur = cur->next;
   }
-  Type *ty = calloc(1, sizeof(Type));
+  Type *ty = arena_calloc(1, sizeof(Type));
   ty->kind = TY_STRUCT;
   ty->members = head.next;
 
@@ -403,10 +563,10 @@ static Type *struct_decl(void) {
 // to allow a trailing comma. This function returns true if it looks
 // like we are at the end of such list.
 static bool consume_end(void) {
-  Token *tok = token;
+  Token *tok = ctx->token;
   if (consume("}") || (consume(",") && consume("}")))
     return true;  // "," or ",}"
-  token = tok;
+  ctx->token = tok;
   return false;
 }
 
@@ -455,7 +615,7 @@ static Member *struct_member() {
   ty = declarator(ty, &name);
   ty = type_suffix(ty);
 
-  Member *m = calloc(1, sizeof(Member));
+  Member *m = arena_calloc(1, sizeof(Member));
   m->name = name;
   m->ty = ty;
   expect(";");
@@ -468,7 +628,7 @@ static VarList *read_func_arg(void) {
   ty = declarator(ty, &name);
   ty = type_suffix(ty);
 
-  VarList *vl = calloc(1, sizeof(VarList));
+  VarList *vl = arena_calloc(1, sizeof(VarList));
   vl->var = new_lvar(name, ty);
   return vl;
 }
@@ -491,65 +651,242 @@ static VarList *read_func_args(void) {
 }
 
 static void *global_var(void) {
-  // グローバル変数の宣言は typedef の可能性があるので is_typedef を設定する
-  bool is_typedef;
-  Type *ty = basetype(&is_typedef);
+  // グローバル変数の宣言は typedef の可能性があるので attr を設定する
+  VarAttr attr = {};
+  Type *ty = basetype(&attr);
   char *name = NULL;
   ty = declarator(ty, &name);
   ty = type_suffix(ty);
   expect(";");
 
-  if (is_typedef)
+  if (attr.is_typedef)
     push_scope(name)->type_def =
         ty;  // typedef の場合はスコープに typedef な型を追加する
+  else if (attr.is_extern)
+    new_gvar(name, ty, false);  // 他のファイルで定義されるので出力しない
   else
-    new_gvar(name, ty, true);
+    new_gvar(name, ty, true)->is_static = attr.is_static;
+}
+
+// 関数本体を "}" まで読む。引数はすでにスコープと ctx->locals にある
+static void function_body(Function *fn) {
+  ctx->diag_fn = fn;
+  Node head = {};
+  Node *cur = &head;
+  while (!consume("}")) {
+    cur->next = stmt();
+    cur = cur->next;
+  }
+  fn->node = head.next;
+  fn->locals = ctx->locals;
+  ctx->diag_fn = NULL;
+  if (fn->cache_key) save_strings(fn);
+}
+
+// 対応する "}" の次まで読み飛ばす
+static void skip_body(Token *start) {
+  int depth = 1;
+  while (depth) {
+    if (at_eof()) error_tok(start, "unclosed function body");
+    if (consume("{"))
+      depth++;
+    else if (consume("}"))
+      depth--;
+    else
+      ctx->token = next_token(ctx->token);
+  }
+}
+
+//
+// --cache: 関数ごとのキャッシュ
+//
+// キーはオプションと、それまでのトップレベルの宣言 (関数の本体を除く) と、
+// 関数自身のトークン列のハッシュ。関数のアセンブリはこの3つだけで決まる。
+// ただし -fPIC では static 関数を PLT 経由で呼ぶかどうかがあとの定義に
+// よって変わるので使わない。
+//
+// エントリは次の行の並び。
+//   S 長さ\n中身\n  使う文字列リテラル (出現順)
+//   R 名前\n        参照するグローバルな名前 (不要な関数の削除に使う)
+//   A\n             これより後ろは codegen_function が出力したアセンブリ
+//
+
+static bool use_fn_cache(void) {
+  return ctx->opts.incremental && !ctx->opts.pic;
+}
+
+// トークン列 [start, end) をハッシュに加える。トークンは改行を含まないので
+// 改行で区切る。空白やコメントを変えてもハッシュは変わらない
+static void hash_tokens(Sha256 *s, Token *start, Token *end) {
+  for (Token *t = start; t != end; t = next_token(t)) {
+    sha256_update(s, t->str, t->len);
+    sha256_update(s, "\n", 1);
+  }
+}
+
+static char *function_key(Token *start, Token *end) {
+  Sha256 decls = ctx->decls;
+  unsigned char hash[32];
+  sha256_final(&decls, hash);
+
+  Sha256 s;
+  sha256_init(&s);
+  cache_hash_options(&s, &ctx->opts);
+  sha256_update(&s, hash, sizeof(hash));
+  hash_tokens(&s, start, end);
+  char *key = arena_calloc(1, 65);
+  sha256_hex(&s, key);
+  return key;
+}
+
+// 関数が使う文字列リテラルを出現順に書いておく
+static void save_strings(Function *fn) {
+  int n = 0;
+  for (StrRef *r = ctx->str_refs; r; r = r->next) n++;
+  Var **vars = calloc(n, sizeof(Var *));
+  int i = n;
+  for (StrRef *r = ctx->str_refs; r; r = r->next) vars[--i] = r->node->var;
+
+  char *buf;
+  size_t len;
+  FILE *fp = open_memstream(&buf, &len);
+  for (i = 0; i < n; i++) {
+    fprintf(fp, "S %d\n", vars[i]->cont_len);
+    fwrite(vars[i]->contents, 1, vars[i]->cont_len, fp);
+    fputc('\n', fp);
+  }
+  fclose(fp);
+  free(vars);
+
+  fn->cache_strs = arena_calloc(1, len);
+  memcpy(fn->cache_strs, buf, len);
+  fn->cache_strs_len = len;
+  free(buf);
+}
+
+// エントリを読んで fn の本体の代わりにする。壊れていれば false を返す
+static bool load_cached(Function *fn, Token *tok) {
+  size_t len;
+  char *buf = cache_get_function(fn->cache_key, &len);
+  if (!buf) return false;
+
+  char *p = buf;
+  char *end = buf + len;
+  StrRef *strs = ctx->str_refs;
+  char **refs = NULL;
+  int nrefs = 0;
+  bool ok = false;
+
+  while (p < end) {
+    char *nl = memchr(p, '\n', end - p);
+    if (!nl) break;
+
+    if (p[0] == 'S' && p[1] == ' ') {
+      long n = strtol(p + 2, NULL, 10);
+      if (n < 0 || n > end - nl - 2 || nl[n + 1] != '\n') break;
+      string_ref(tok, arena_strndup(nl + 1, n), n);
+      p = nl + n + 2;
+      continue;
+    }
+    if (p[0] == 'R' && p[1] == ' ') {
+      refs = realloc(refs, sizeof(char *) * (nrefs + 1));
+      refs[nrefs++] = arena_strndup(p + 2, nl - p - 2);
+      p = nl + 1;
+      continue;
+    }
+    if (p[0] == 'A' && nl == p + 1) {
+      p = nl + 1;
+      fn->cached = arena_strndup(p, end - p);
+      fn->cached_len = end - p;
+      ok = true;
+    }
+    break;
+  }
+
+  if (ok) {
+    fn->refs = arena_calloc(nrefs, sizeof(char *));
+    for (int i = 0; i < nrefs; i++) fn->refs[i] = refs[i];
+    fn->nrefs = nrefs;
+  } else {
+    ctx->str_refs = strs;
+  }
+  free(refs);
+  free(buf);
+  return ok;
 }
 
 // function = basetype decalarator "(" read-func-args? ")" ("{" stmt* "}" |
 // ";")
-static Function *function(void) {
-  locals = NULL;
+//
+// pending が NULL でなければ本体は読み飛ばし、*pending の後ろにつなぐ
+static Function *function(Pending **pending) {
+  ctx->locals = NULL;
+  Token *start = ctx->token;
 
-  Type *ty = basetype(NULL);
+  VarAttr attr = {};
+  Type *ty = basetype(&attr);
   char *name = NULL;
   ty = declarator(ty, &name);
-  new_gvar(name, func_type(ty),
-           false);  // スコープに関数の戻り値の型を持つ変数を追加する
+  new_gvar(name, func_type(ty), false)->is_static =
+      attr.is_static;  // スコープに関数の戻り値の型を持つ変数を追加する
 
-  Function *fn = calloc(1, sizeof(Function));
+  Function *fn = arena_calloc(1, sizeof(Function));
   fn->name = name;
+  fn->return_ty = ty;
+  fn->is_static = attr.is_static;
   expect("(");
 
+  // -fpipeline: 引数から先は関数を出力したら捨てる
+  if (ctx->opts.pipeline) ctx->alloc = &ctx->scratch;
+
   Scope *sc = enter_scope();
   fn->args = read_func_args();  // 引数のリスト
 
   if (consume(";")) {
     // 本体がない場合
     leave_scope(sc);
+    if (use_fn_cache()) hash_tokens(&ctx->decls, start, ctx->token);
     return NULL;
   }
 
-  Node head = {};
-  Node *cur = &head;
+  Token *tok = ctx->token;
   expect("{");
-  while (!consume("}")) {
-    cur->next = stmt();
-    cur = cur->next;
+  if (use_fn_cache()) {
+    Token *body = ctx->token;
+    skip_body(tok);
+    fn->cache_key = function_key(start, ctx->token);
+    hash_tokens(&ctx->decls, start, body);
+    if (load_cached(fn, tok)) {
+      leave_scope(sc);
+      return fn;
+    }
+    ctx->token = body;
   }
-  leave_scope(sc);  // 関数を抜けたら scope の参照先を関数呼び出し前に戻す
 
-  fn->node = head.next;
-  fn->locals = locals;
+  if (pending) {
+    Pending *p = arena_calloc(1, sizeof(Pending));
+    p->fn = fn;
+    p->body = ctx->token;
+    p->var_scope = ctx->var_scope;
+    p->tag_scope = ctx->tag_scope;
+    p->locals = ctx->locals;
+    p->strs = ctx->str_refs;  // 引数の型に現れたもの
+    ctx->str_refs = NULL;
+    *pending = (*pending)->next = p;
+    skip_body(tok);
+  } else {
+    function_body(fn);
+  }
+  leave_scope(sc);  // 関数を抜けたら scope の参照先を関数呼び出し前に戻す
   return fn;
 }
 
 // declartion = basetype declarator (type_suffix)* ("=" expr) ";"
 static Node *declaration(void) {
-  Token *tok = token;
-  // 変数の宣言は typedef の可能性があるので is_typedef を設定する
-  bool is_typedef;
-  Type *ty = basetype(&is_typedef);
+  Token *tok = ctx->token;
+  // 変数の宣言は typedef の可能性があるので attr を設定する
+  VarAttr attr = {};
+  Type *ty = basetype(&attr);
   if (consume(";"))
     return new_node(
         ND_NULL,
@@ -559,7 +896,12 @@ static Node *declaration(void) {
   ty = declarator(ty, &name);
   ty = type_suffix(ty);
 
-  if (is_typedef) {
+  if (attr.is_static)
+    error_tok(tok, "static local variables are not supported");
+  if (attr.is_extern)
+    error_tok(tok, "extern local variables are not supported");
+
+  if (attr.is_typedef) {
     // typedef の場合はスコープに typedef の型を追加する
     expect(";");
     push_scope(name)->type_def = ty;
@@ -583,7 +925,7 @@ static Node *declaration(void) {
 }
 
 static Node *read_expr_stmt(void) {
-  Token *tok = token;
+  Token *tok = ctx->token;
   return new_unary(ND_EXPR_STMT, expr(), tok);
 }
 
@@ -596,13 +938,65 @@ static Node *stmt(void) {
 static bool is_typename(void) {
   return peek("void") || peek("_Bool") || peek("char") || peek("short") ||
          peek("int") || peek("long") || peek("enum") || peek("struct") ||
-         peek("typedef") || find_typedef(token);
+         peek("typedef") || peek("static") || peek("extern") ||
+         find_typedef(ctx->token);
+}
+
+// 定数式の値を求める
+static long eval(Node *node) {
+  switch (node->kind) {
+    case ND_NUM:
+      return node->val;
+    case ND_ADD:
+      return eval(node->lhs) + eval(node->rhs);
+    case ND_SUB:
+      return eval(node->lhs) - eval(node->rhs);
+    case ND_MUL:
+      return eval(node->lhs) * eval(node->rhs);
+    case ND_DIV: {
+      long rhs = eval(node->rhs);
+      if (!rhs) error_tok(node->tok, "division by zero");
+      return eval(node->lhs) / rhs;
+    }
+    case ND_EQ:
+      return eval(node->lhs) == eval(node->rhs);
+    case ND_NE:
+      return eval(node->lhs) != eval(node->rhs);
+    case ND_LT:
+      return eval(node->lhs) < eval(node->rhs);
+    case ND_LE:
+      return eval(node->lhs) <= eval(node->rhs);
+    case ND_LOGAND:
+      return eval(node->lhs) && eval(node->rhs);
+    case ND_LOGOR:
+      return eval(node->lhs) || eval(node->rhs);
+    case ND_NOT:
+      return !eval(node->lhs);
+    case ND_CAST: {
+      long val = eval(node->lhs);
+      if (node->ty->kind == TY_BOOL) return !!val;
+      if (node->ty->size == 1) return (char)val;
+      if (node->ty->size == 2) return (short)val;
+      if (node->ty->size == 4) return (int)val;
+      return val;
+    }
+  }
+  error_tok(node->tok, "not a constant expression");
+  return 0;
 }
 
+static long const_expr(void) { return eval(expr()); }
+
+// case と default を登録する switch
+
 // stmt    = "return" expr
 //         | "if" "(" expr ")" stmt ("else" stmt)?
 //         | "while" "(" expr ")" stmt
 //         | "for" "(" expr? ";" expr? ";" expr? ")" stmt
+//         | "switch" "(" expr ")" stmt
+//         | "case" const_expr ":" stmt
+//         | "default" ":" stmt
+//         | "break" ";"
 //         | "{" stmt* "}"
 //         | declaration
 //         | expr ";"
@@ -648,6 +1042,39 @@ static Node *stmt2(void) {
     }
     node->then = stmt();
     return node;
+  } else if (tok = consume("switch")) {
+    node = new_node(ND_SWITCH, tok);
+    expect("(");
+    node->cond = expr();
+    expect(")");
+
+    Node *sw = ctx->current_switch;
+    ctx->current_switch = node;
+    node->then = stmt();
+    ctx->current_switch = sw;
+    return node;
+  } else if (tok = consume("case")) {
+    if (!ctx->current_switch) error_tok(tok, "stray case");
+    long val = const_expr();
+    expect(":");
+
+    node = new_unary(ND_CASE, stmt(), tok);
+    node->val = val;
+    node->case_next = ctx->current_switch->case_next;
+    ctx->current_switch->case_next = node;
+    return node;
+  } else if (tok = consume("default")) {
+    if (!ctx->current_switch) error_tok(tok, "stray default");
+    if (ctx->current_switch->default_case)
+      error_tok(tok, "duplicate default");
+    expect(":");
+
+    node = new_unary(ND_CASE, stmt(), tok);
+    ctx->current_switch->default_case = node;
+    return node;
+  } else if (tok = consume("break")) {
+    expect(";");
+    return new_node(ND_BREAK, tok);
   } else if (tok = consume("{")) {
     Node head = {};
     Node *cur = &head;
@@ -666,7 +1093,7 @@ static Node *stmt2(void) {
     node = declaration();
     return node;
   }
-  tok = token;
+  tok = ctx->token;
   node = read_expr_stmt();
   expect(";");
   return node;
@@ -675,12 +1102,41 @@ static Node *stmt2(void) {
 // expr       = assign
 static Node *expr(void) { return assign(); }
 
-// assign     = equality ("=" assign)?
+// assign     = logor (assign-op assign)?
+// assign-op  = "=" | "+=" | "-=" | "*=" | "/="
 static Node *assign(void) {
+  Node *node = logor();
+  Token *tok;
+
+  if (tok = consume("="))
+    node = new_binary(ND_ASSIGN, node, assign(), tok);
+  else if (tok = consume("+="))
+    node = new_binary(ND_ADD_ASSIGN, node, assign(), tok);
+  else if (tok = consume("-="))
+    node = new_binary(ND_SUB_ASSIGN, node, assign(), tok);
+  else if (tok = consume("*="))
+    node = new_binary(ND_MUL_ASSIGN, node, assign(), tok);
+  else if (tok = consume("/="))
+    node = new_binary(ND_DIV_ASSIGN, node, assign(), tok);
+  return node;
+}
+
+// logor      = logand ("||" logand)*
+static Node *logor(void) {
+  Node *node = logand();
+  Token *tok;
+
+  while (tok = consume("||")) node = new_binary(ND_LOGOR, node, logand(), tok);
+  return node;
+}
+
+// logand     = equality ("&&" equality)*
+static Node *logand(void) {
   Node *node = equality();
   Token *tok;
 
-  if (tok = consume("=")) node = new_binary(ND_ASSIGN, node, assign(), tok);
+  while (tok = consume("&&"))
+    node = new_binary(ND_LOGAND, node, equality(), tok);
   return node;
 }
 
@@ -775,7 +1231,7 @@ static Node *mul(void) {
 
 // cast = "(" type-name ")" cast | unary
 static Node *cast(void) {
-  Token *tok = token;
+  Token *tok = ctx->token;
 
   if (consume("(")) {
     if (is_typename()) {
@@ -786,12 +1242,13 @@ static Node *cast(void) {
       node->ty = ty;
       return node;
     }
-    token = tok;  // 括弧のあとに typename が続かない場合は戻す
+    ctx->token = tok;  // 括弧のあとに typename が続かない場合は戻す
   }
   return unary();
 }
 
-// unary   = ("+" | "-" | "&" | "*")? cast
+// unary   = ("+" | "-" | "&" | "*" | "!")? cast
+//         | ("++" | "--") unary
 //         | "sizeof" "(" type-name ")"
 //         | suffix
 static Node *unary(void) {
@@ -804,6 +1261,12 @@ static Node *unary(void) {
     return new_unary(ND_ADDR, cast(), tok);
   else if (tok = consume("*"))
     return new_unary(ND_DEREF, cast(), tok);
+  else if (tok = consume("!"))
+    return new_unary(ND_NOT, cast(), tok);
+  else if (tok = consume("++"))  // ++x は x += 1
+    return new_binary(ND_ADD_ASSIGN, unary(), new_num(1, tok), tok);
+  else if (tok = consume("--"))
+    return new_binary(ND_SUB_ASSIGN, unary(), new_num(1, tok), tok);
   else if (tok = consume("sizeof")) {
     if (consume("(")) {
       if (is_typename()) {
@@ -811,7 +1274,7 @@ static Node *unary(void) {
         expect(")");
         return new_num(ty->size, tok);
       }
-      token = tok->next;  // consume("(") で読んだ分を戻す
+      ctx->token = tok->next;  // consume("(") で読んだ分を戻す
     }
     Node *node = unary();
     add_type(node);
@@ -830,7 +1293,7 @@ static Node *struct_ref(Node *lhs) {
   add_type(lhs);
   if (lhs->ty->kind != TY_STRUCT) error_tok(lhs->tok, "not a struct");
 
-  Token *tok = token;
+  Token *tok = ctx->token;
   Member *mem = find_member(lhs->ty, expect_ident());
   if (!mem) error_tok(tok, "no such member");
 
@@ -842,7 +1305,7 @@ static Node *struct_ref(Node *lhs) {
   return node;
 }
 
-// suffix = primary ("[" expr "]" | "." ident | "->" ident)*
+// suffix = primary ("[" expr "]" | "." ident | "->" ident | "++" | "--")*
 static Node *suffix(void) {
   Node *node = primary();
   Token *tok;
@@ -858,7 +1321,11 @@ static Node *suffix(void) {
       // x->y = (*x).y
       node = new_unary(ND_DEREF, node, tok);
       node = struct_ref(node);
-    } else
+    } else if (tok = consume("++"))
+      node = new_unary(ND_POST_INC, node, tok);
+    else if (tok = consume("--"))
+      node = new_unary(ND_POST_DEC, node, tok);
+    else
       return node;
   }
 }
@@ -918,7 +1385,7 @@ static Node *primary(void) {
     if (consume("(")) {
       // 関数の場合
       node = new_node(ND_FUNCALL, tok);
-      node->funcname = strndup(tok->str, tok->len);
+      node->funcname = arena_strndup(tok->str, tok->len);
       node->args = func_args();
       add_type(node);
 
@@ -948,14 +1415,10 @@ static Node *primary(void) {
     return node;
   }
 
-  tok = token;
+  tok = ctx->token;
   if (tok->kind == TK_STR) {
-    token = token->next;
-    Type *ty = array_of(char_type, tok->cont_len);
-    Var *var = new_gvar(new_label(), ty, true);
-    var->contents = tok->contents;
-    var->cont_len = tok->cont_len;
-    return new_var_node(var, tok);
+    ctx->token = next_token(ctx->token);
+    return string_ref(tok, tok->contents, tok->cont_len);
   }
 
   if (tok->kind != TK_NUM) error_tok(tok, "expected expression");
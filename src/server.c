@@ -0,0 +1,311 @@
+#include "9cc.h"
+
+#include <pthread.h>
+#include <signal.h>
+#include <stdint.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+//
+// --server と --client の通信
+//
+// メッセージは4バイトの長さ (リトルエンディアン) と本体からなる。
+// 本体の中の文字列も同じく長さを先に置いて並べる。1つの接続で
+// 要求と応答を何回繰り返してもよい。
+//
+// 要求: フラグ(1) 展開係数(4) スレッド数(4) ファイル名 ソース
+// 応答: 成否(1) アセンブリ 診断の数(4) (種類(1) 行(4) 列(4) 本文 整形済み)*
+//
+
+// これより大きなメッセージは壊れているとみなす
+#define MSG_MAX (1u << 30)
+
+enum {
+  FLAG_REPORT = 1,
+  FLAG_VECTORIZE = 2,
+  FLAG_PIC = 4,
+  FLAG_PIPELINE = 8,
+};
+
+static void put_u8(FILE *fp, int v) { fputc(v, fp); }
+
+static void put_u32(FILE *fp, uint32_t v) {
+  for (int i = 0; i < 4; i++) fputc(v >> (i * 8), fp);
+}
+
+static void put_str(FILE *fp, const char *s, size_t len) {
+  put_u32(fp, len);
+  fwrite(s, 1, len, fp);
+}
+
+typedef struct {
+  char *p;
+  char *end;
+  bool err;  // 途中で本体が尽きた
+} Reader;
+
+static bool has(Reader *r, size_t n) {
+  if (r->err || r->end - r->p < n) r->err = true;
+  return !r->err;
+}
+
+static int get_u8(Reader *r) {
+  return has(r, 1) ? (unsigned char)*r->p++ : 0;
+}
+
+static uint32_t get_u32(Reader *r) {
+  if (!has(r, 4)) return 0;
+  uint32_t v = 0;
+  for (int i = 0; i < 4; i++)
+    v |= (uint32_t)(unsigned char)*r->p++ << (i * 8);
+  return v;
+}
+
+// '\0' を付けて複製した文字列を返す
+static char *get_str(Reader *r, size_t *len) {
+  size_t n = get_u32(r);
+  if (!has(r, n)) return NULL;
+  char *s = malloc(n + 1);
+  memcpy(s, r->p, n);
+  s[n] = '\0';
+  r->p += n;
+  if (len) *len = n;
+  return s;
+}
+
+static bool write_all(int fd, char *buf, size_t len) {
+  while (len) {
+    ssize_t n = write(fd, buf, len);
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) return false;
+    buf += n;
+    len -= n;
+  }
+  return true;
+}
+
+static bool read_all(int fd, char *buf, size_t len) {
+  while (len) {
+    ssize_t n = read(fd, buf, len);
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) return false;
+    buf += n;
+    len -= n;
+  }
+  return true;
+}
+
+static bool send_msg(int fd, char *buf, size_t len) {
+  unsigned char hdr[4];
+  for (int i = 0; i < 4; i++) hdr[i] = len >> (i * 8);
+  return write_all(fd, (char *)hdr, 4) && write_all(fd, buf, len);
+}
+
+// 相手が接続を閉じたか、壊れたメッセージなら NULL を返す
+static char *recv_msg(int fd, size_t *len) {
+  unsigned char hdr[4];
+  if (!read_all(fd, (char *)hdr, 4)) return NULL;
+  uint32_t n = hdr[0] | hdr[1] << 8 | hdr[2] << 16 | (uint32_t)hdr[3] << 24;
+  if (n > MSG_MAX) return NULL;
+
+  char *buf = malloc(n ? n : 1);
+  if (!read_all(fd, buf, n)) {
+    free(buf);
+    return NULL;
+  }
+  *len = n;
+  return buf;
+}
+
+static struct sockaddr_un socket_addr(char *path) {
+  struct sockaddr_un addr = {.sun_family = AF_UNIX};
+  if (strlen(path) >= sizeof(addr.sun_path))
+    error("socket path too long: %s", path);
+  strcpy(addr.sun_path, path);
+  return addr;
+}
+
+//
+// サーバ
+//
+
+// 1つの接続の要求を、相手が閉じるまで順に処理する
+static void *serve(void *arg) {
+  int fd = (intptr_t)arg;
+
+  for (;;) {
+    size_t len;
+    char *msg = recv_msg(fd, &len);
+    if (!msg) break;
+
+    Reader r = {msg, msg + len};
+    CcOptions opts;
+    cc_default_options(&opts);
+    int flags = get_u8(&r);
+    opts.report = flags & FLAG_REPORT;
+    opts.vectorize = flags & FLAG_VECTORIZE;
+    opts.pic = flags & FLAG_PIC;
+    opts.pipeline = flags & FLAG_PIPELINE;
+    opts.unroll_factor = (int32_t)get_u32(&r);
+    opts.jobs = (int32_t)get_u32(&r);
+    char *filename = get_str(&r, NULL);
+    char *src = get_str(&r, NULL);
+    free(msg);
+    if (r.err) {
+      free(filename);
+      free(src);
+      break;
+    }
+
+    CcResult res;
+    cc_compile(filename, src, &opts, &res);
+    free(filename);
+    free(src);
+
+    char *buf;
+    size_t size;
+    FILE *fp = open_memstream(&buf, &size);
+    put_u8(fp, res.ok);
+    put_str(fp, res.asm_text ? res.asm_text : "", res.asm_len);
+    int ndiags = 0;
+    for (CcDiag *d = res.diags; d; d = d->next) ndiags++;
+    put_u32(fp, ndiags);
+    for (CcDiag *d = res.diags; d; d = d->next) {
+      put_u8(fp, d->kind);
+      put_u32(fp, d->line);
+      put_u32(fp, d->column);
+      put_str(fp, d->message, strlen(d->message));
+      put_str(fp, d->text, strlen(d->text));
+    }
+    fclose(fp);
+    cc_free_result(&res);
+
+    bool sent = send_msg(fd, buf, size);
+    free(buf);
+    if (!sent) break;
+  }
+
+  close(fd);
+  return NULL;
+}
+
+// --server: path で待ち受け、接続ごとにスレッドを立てて処理する。
+// アリーナのブロックはコンパイルをまたいで使い回される
+void run_server(char *path) {
+  // 別名で listen してから置き換えるので、path が現れた時点で接続できる
+  char *tmp = malloc(strlen(path) + 5);
+  sprintf(tmp, "%s.tmp", path);
+  struct sockaddr_un addr = socket_addr(tmp);
+  int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0) error("socket: %s", strerror(errno));
+
+  unlink(tmp);
+  if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) || listen(fd, 64) ||
+      rename(tmp, path))
+    error("cannot listen on %s: %s", path, strerror(errno));
+  free(tmp);
+
+  // クライアントが先に切断しても落ちないようにする
+  signal(SIGPIPE, SIG_IGN);
+
+  for (;;) {
+    int conn = accept(fd, NULL, NULL);
+    if (conn < 0) {
+      if (errno == EINTR || errno == ECONNABORTED) continue;
+      error("accept: %s", strerror(errno));
+    }
+
+    pthread_t th;
+    if (pthread_create(&th, NULL, serve, (void *)(intptr_t)conn)) {
+      close(conn);
+      continue;
+    }
+    pthread_detach(th);
+  }
+}
+
+//
+// クライアント
+//
+
+static bool remote_error(CcResult *res, const char *filename, char *fmt,
+                         ...) {
+  CcDiag *d = calloc(1, sizeof(CcDiag));
+  d->kind = CC_ERROR;
+  d->filename = strdup(filename);
+
+  va_list ap;
+  va_start(ap, fmt);
+  size_t size;
+  FILE *fp = open_memstream(&d->message, &size);
+  vfprintf(fp, fmt, ap);
+  fclose(fp);
+
+  d->text = malloc(strlen(d->message) + 2);
+  sprintf(d->text, "%s\n", d->message);
+  res->diags = d;
+  return false;
+}
+
+// --client: コンパイルをサーバに頼み、結果を cc_compile と同じ形で返す
+bool remote_compile(char *sock, const char *filename, const char *src,
+                    const CcOptions *opts, CcResult *res) {
+  *res = (CcResult){0};
+
+  struct sockaddr_un addr = socket_addr(sock);
+  int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0 || connect(fd, (struct sockaddr *)&addr, sizeof(addr))) {
+    if (fd >= 0) close(fd);
+    return remote_error(res, filename, "cannot connect to %s: %s", sock,
+                        strerror(errno));
+  }
+
+  char *buf;
+  size_t size;
+  FILE *fp = open_memstream(&buf, &size);
+  put_u8(fp, (opts->report ? FLAG_REPORT : 0) |
+                 (opts->vectorize ? FLAG_VECTORIZE : 0) |
+                 (opts->pic ? FLAG_PIC : 0) |
+                 (opts->pipeline ? FLAG_PIPELINE : 0));
+  put_u32(fp, opts->unroll_factor);
+  put_u32(fp, opts->jobs);
+  put_str(fp, filename, strlen(filename));
+  put_str(fp, src, strlen(src));
+  fclose(fp);
+
+  bool sent = send_msg(fd, buf, size);
+  free(buf);
+  size_t len;
+  char *msg = sent ? recv_msg(fd, &len) : NULL;
+  close(fd);
+  if (!msg) return remote_error(res, filename, "%s: no response", sock);
+
+  Reader r = {msg, msg + len};
+  res->ok = get_u8(&r);
+  res->asm_text = get_str(&r, &res->asm_len);
+  CcDiag **cur = &res->diags;
+  for (int n = get_u32(&r); n > 0 && !r.err; n--) {
+    CcDiag *d = calloc(1, sizeof(CcDiag));
+    d->kind = get_u8(&r);
+    d->line = get_u32(&r);
+    d->column = get_u32(&r);
+    d->message = get_str(&r, NULL);
+    d->text = get_str(&r, NULL);
+    d->filename = strdup(filename);
+    *cur = d;
+    cur = &d->next;
+  }
+  free(msg);
+
+  if (r.err) {
+    cc_free_result(res);
+    return remote_error(res, filename, "%s: broken response", sock);
+  }
+  if (!res->ok) {
+    free(res->asm_text);
+    res->asm_text = NULL;
+    res->asm_len = 0;
+  }
+  return res->ok;
+}
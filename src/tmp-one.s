@@ -0,0 +1,16 @@
+.intel_syntax noprefix
+.section .note.GNU-stack,"",@progbits
+.bss
+.text
+.global main
+main:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 0
+  push 0
+  pop rax
+  jmp .L.return.main
+.L.return.main:
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,24000 @@
+/* 1 "*/ int f1() { // "/* 1
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2 "*/ int f2() { // "/* 2
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3 "*/ int f3() { // "/* 3
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4 "*/ int f4() { // "/* 4
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5 "*/ int f5() { // "/* 5
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 6 "*/ int f6() { // "/* 6
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 7 "*/ int f7() { // "/* 7
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 8 "*/ int f8() { // "/* 8
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 9 "*/ int f9() { // "/* 9
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 10 "*/ int f10() { // "/* 10
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 11 "*/ int f11() { // "/* 11
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 12 "*/ int f12() { // "/* 12
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 13 "*/ int f13() { // "/* 13
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 14 "*/ int f14() { // "/* 14
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 15 "*/ int f15() { // "/* 15
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 16 "*/ int f16() { // "/* 16
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 17 "*/ int f17() { // "/* 17
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 18 "*/ int f18() { // "/* 18
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 19 "*/ int f19() { // "/* 19
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 20 "*/ int f20() { // "/* 20
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 21 "*/ int f21() { // "/* 21
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 22 "*/ int f22() { // "/* 22
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 23 "*/ int f23() { // "/* 23
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 24 "*/ int f24() { // "/* 24
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 25 "*/ int f25() { // "/* 25
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 26 "*/ int f26() { // "/* 26
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 27 "*/ int f27() { // "/* 27
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 28 "*/ int f28() { // "/* 28
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 29 "*/ int f29() { // "/* 29
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 30 "*/ int f30() { // "/* 30
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 31 "*/ int f31() { // "/* 31
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 32 "*/ int f32() { // "/* 32
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 33 "*/ int f33() { // "/* 33
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 34 "*/ int f34() { // "/* 34
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 35 "*/ int f35() { // "/* 35
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 36 "*/ int f36() { // "/* 36
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 37 "*/ int f37() { // "/* 37
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 38 "*/ int f38() { // "/* 38
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 39 "*/ int f39() { // "/* 39
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 40 "*/ int f40() { // "/* 40
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 41 "*/ int f41() { // "/* 41
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 42 "*/ int f42() { // "/* 42
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 43 "*/ int f43() { // "/* 43
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 44 "*/ int f44() { // "/* 44
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 45 "*/ int f45() { // "/* 45
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 46 "*/ int f46() { // "/* 46
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 47 "*/ int f47() { // "/* 47
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 48 "*/ int f48() { // "/* 48
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 49 "*/ int f49() { // "/* 49
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 50 "*/ int f50() { // "/* 50
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 51 "*/ int f51() { // "/* 51
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 52 "*/ int f52() { // "/* 52
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 53 "*/ int f53() { // "/* 53
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 54 "*/ int f54() { // "/* 54
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 55 "*/ int f55() { // "/* 55
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 56 "*/ int f56() { // "/* 56
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 57 "*/ int f57() { // "/* 57
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 58 "*/ int f58() { // "/* 58
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 59 "*/ int f59() { // "/* 59
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 60 "*/ int f60() { // "/* 60
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 61 "*/ int f61() { // "/* 61
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 62 "*/ int f62() { // "/* 62
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 63 "*/ int f63() { // "/* 63
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 64 "*/ int f64() { // "/* 64
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 65 "*/ int f65() { // "/* 65
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 66 "*/ int f66() { // "/* 66
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 67 "*/ int f67() { // "/* 67
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 68 "*/ int f68() { // "/* 68
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 69 "*/ int f69() { // "/* 69
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 70 "*/ int f70() { // "/* 70
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 71 "*/ int f71() { // "/* 71
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 72 "*/ int f72() { // "/* 72
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 73 "*/ int f73() { // "/* 73
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 74 "*/ int f74() { // "/* 74
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 75 "*/ int f75() { // "/* 75
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 76 "*/ int f76() { // "/* 76
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 77 "*/ int f77() { // "/* 77
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 78 "*/ int f78() { // "/* 78
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 79 "*/ int f79() { // "/* 79
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 80 "*/ int f80() { // "/* 80
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 81 "*/ int f81() { // "/* 81
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 82 "*/ int f82() { // "/* 82
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 83 "*/ int f83() { // "/* 83
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 84 "*/ int f84() { // "/* 84
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 85 "*/ int f85() { // "/* 85
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 86 "*/ int f86() { // "/* 86
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 87 "*/ int f87() { // "/* 87
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 88 "*/ int f88() { // "/* 88
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 89 "*/ int f89() { // "/* 89
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 90 "*/ int f90() { // "/* 90
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 91 "*/ int f91() { // "/* 91
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 92 "*/ int f92() { // "/* 92
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 93 "*/ int f93() { // "/* 93
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 94 "*/ int f94() { // "/* 94
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 95 "*/ int f95() { // "/* 95
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 96 "*/ int f96() { // "/* 96
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 97 "*/ int f97() { // "/* 97
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 98 "*/ int f98() { // "/* 98
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 99 "*/ int f99() { // "/* 99
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 100 "*/ int f100() { // "/* 100
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 101 "*/ int f101() { // "/* 101
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 102 "*/ int f102() { // "/* 102
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 103 "*/ int f103() { // "/* 103
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 104 "*/ int f104() { // "/* 104
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 105 "*/ int f105() { // "/* 105
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 106 "*/ int f106() { // "/* 106
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 107 "*/ int f107() { // "/* 107
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 108 "*/ int f108() { // "/* 108
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 109 "*/ int f109() { // "/* 109
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 110 "*/ int f110() { // "/* 110
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 111 "*/ int f111() { // "/* 111
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 112 "*/ int f112() { // "/* 112
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 113 "*/ int f113() { // "/* 113
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 114 "*/ int f114() { // "/* 114
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 115 "*/ int f115() { // "/* 115
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 116 "*/ int f116() { // "/* 116
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 117 "*/ int f117() { // "/* 117
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 118 "*/ int f118() { // "/* 118
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 119 "*/ int f119() { // "/* 119
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 120 "*/ int f120() { // "/* 120
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 121 "*/ int f121() { // "/* 121
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 122 "*/ int f122() { // "/* 122
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 123 "*/ int f123() { // "/* 123
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 124 "*/ int f124() { // "/* 124
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 125 "*/ int f125() { // "/* 125
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 126 "*/ int f126() { // "/* 126
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 127 "*/ int f127() { // "/* 127
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 128 "*/ int f128() { // "/* 128
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 129 "*/ int f129() { // "/* 129
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 130 "*/ int f130() { // "/* 130
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 131 "*/ int f131() { // "/* 131
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 132 "*/ int f132() { // "/* 132
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 133 "*/ int f133() { // "/* 133
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 134 "*/ int f134() { // "/* 134
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 135 "*/ int f135() { // "/* 135
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 136 "*/ int f136() { // "/* 136
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 137 "*/ int f137() { // "/* 137
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 138 "*/ int f138() { // "/* 138
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 139 "*/ int f139() { // "/* 139
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 140 "*/ int f140() { // "/* 140
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 141 "*/ int f141() { // "/* 141
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 142 "*/ int f142() { // "/* 142
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 143 "*/ int f143() { // "/* 143
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 144 "*/ int f144() { // "/* 144
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 145 "*/ int f145() { // "/* 145
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 146 "*/ int f146() { // "/* 146
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 147 "*/ int f147() { // "/* 147
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 148 "*/ int f148() { // "/* 148
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 149 "*/ int f149() { // "/* 149
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 150 "*/ int f150() { // "/* 150
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 151 "*/ int f151() { // "/* 151
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 152 "*/ int f152() { // "/* 152
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 153 "*/ int f153() { // "/* 153
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 154 "*/ int f154() { // "/* 154
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 155 "*/ int f155() { // "/* 155
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 156 "*/ int f156() { // "/* 156
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 157 "*/ int f157() { // "/* 157
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 158 "*/ int f158() { // "/* 158
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 159 "*/ int f159() { // "/* 159
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 160 "*/ int f160() { // "/* 160
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 161 "*/ int f161() { // "/* 161
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 162 "*/ int f162() { // "/* 162
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 163 "*/ int f163() { // "/* 163
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 164 "*/ int f164() { // "/* 164
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 165 "*/ int f165() { // "/* 165
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 166 "*/ int f166() { // "/* 166
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 167 "*/ int f167() { // "/* 167
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 168 "*/ int f168() { // "/* 168
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 169 "*/ int f169() { // "/* 169
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 170 "*/ int f170() { // "/* 170
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 171 "*/ int f171() { // "/* 171
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 172 "*/ int f172() { // "/* 172
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 173 "*/ int f173() { // "/* 173
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 174 "*/ int f174() { // "/* 174
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 175 "*/ int f175() { // "/* 175
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 176 "*/ int f176() { // "/* 176
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 177 "*/ int f177() { // "/* 177
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 178 "*/ int f178() { // "/* 178
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 179 "*/ int f179() { // "/* 179
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 180 "*/ int f180() { // "/* 180
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 181 "*/ int f181() { // "/* 181
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 182 "*/ int f182() { // "/* 182
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 183 "*/ int f183() { // "/* 183
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 184 "*/ int f184() { // "/* 184
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 185 "*/ int f185() { // "/* 185
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 186 "*/ int f186() { // "/* 186
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 187 "*/ int f187() { // "/* 187
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 188 "*/ int f188() { // "/* 188
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 189 "*/ int f189() { // "/* 189
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 190 "*/ int f190() { // "/* 190
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 191 "*/ int f191() { // "/* 191
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 192 "*/ int f192() { // "/* 192
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 193 "*/ int f193() { // "/* 193
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 194 "*/ int f194() { // "/* 194
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 195 "*/ int f195() { // "/* 195
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 196 "*/ int f196() { // "/* 196
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 197 "*/ int f197() { // "/* 197
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 198 "*/ int f198() { // "/* 198
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 199 "*/ int f199() { // "/* 199
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 200 "*/ int f200() { // "/* 200
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 201 "*/ int f201() { // "/* 201
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 202 "*/ int f202() { // "/* 202
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 203 "*/ int f203() { // "/* 203
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 204 "*/ int f204() { // "/* 204
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 205 "*/ int f205() { // "/* 205
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 206 "*/ int f206() { // "/* 206
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 207 "*/ int f207() { // "/* 207
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 208 "*/ int f208() { // "/* 208
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 209 "*/ int f209() { // "/* 209
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 210 "*/ int f210() { // "/* 210
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 211 "*/ int f211() { // "/* 211
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 212 "*/ int f212() { // "/* 212
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 213 "*/ int f213() { // "/* 213
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 214 "*/ int f214() { // "/* 214
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 215 "*/ int f215() { // "/* 215
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 216 "*/ int f216() { // "/* 216
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 217 "*/ int f217() { // "/* 217
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 218 "*/ int f218() { // "/* 218
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 219 "*/ int f219() { // "/* 219
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 220 "*/ int f220() { // "/* 220
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 221 "*/ int f221() { // "/* 221
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 222 "*/ int f222() { // "/* 222
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 223 "*/ int f223() { // "/* 223
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 224 "*/ int f224() { // "/* 224
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 225 "*/ int f225() { // "/* 225
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 226 "*/ int f226() { // "/* 226
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 227 "*/ int f227() { // "/* 227
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 228 "*/ int f228() { // "/* 228
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 229 "*/ int f229() { // "/* 229
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 230 "*/ int f230() { // "/* 230
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 231 "*/ int f231() { // "/* 231
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 232 "*/ int f232() { // "/* 232
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 233 "*/ int f233() { // "/* 233
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 234 "*/ int f234() { // "/* 234
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 235 "*/ int f235() { // "/* 235
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 236 "*/ int f236() { // "/* 236
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 237 "*/ int f237() { // "/* 237
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 238 "*/ int f238() { // "/* 238
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 239 "*/ int f239() { // "/* 239
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 240 "*/ int f240() { // "/* 240
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 241 "*/ int f241() { // "/* 241
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 242 "*/ int f242() { // "/* 242
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 243 "*/ int f243() { // "/* 243
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 244 "*/ int f244() { // "/* 244
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 245 "*/ int f245() { // "/* 245
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 246 "*/ int f246() { // "/* 246
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 247 "*/ int f247() { // "/* 247
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 248 "*/ int f248() { // "/* 248
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 249 "*/ int f249() { // "/* 249
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 250 "*/ int f250() { // "/* 250
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 251 "*/ int f251() { // "/* 251
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 252 "*/ int f252() { // "/* 252
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 253 "*/ int f253() { // "/* 253
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 254 "*/ int f254() { // "/* 254
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 255 "*/ int f255() { // "/* 255
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 256 "*/ int f256() { // "/* 256
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 257 "*/ int f257() { // "/* 257
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 258 "*/ int f258() { // "/* 258
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 259 "*/ int f259() { // "/* 259
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 260 "*/ int f260() { // "/* 260
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 261 "*/ int f261() { // "/* 261
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 262 "*/ int f262() { // "/* 262
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 263 "*/ int f263() { // "/* 263
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 264 "*/ int f264() { // "/* 264
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 265 "*/ int f265() { // "/* 265
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 266 "*/ int f266() { // "/* 266
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 267 "*/ int f267() { // "/* 267
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 268 "*/ int f268() { // "/* 268
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 269 "*/ int f269() { // "/* 269
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 270 "*/ int f270() { // "/* 270
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 271 "*/ int f271() { // "/* 271
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 272 "*/ int f272() { // "/* 272
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 273 "*/ int f273() { // "/* 273
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 274 "*/ int f274() { // "/* 274
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 275 "*/ int f275() { // "/* 275
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 276 "*/ int f276() { // "/* 276
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 277 "*/ int f277() { // "/* 277
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 278 "*/ int f278() { // "/* 278
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 279 "*/ int f279() { // "/* 279
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 280 "*/ int f280() { // "/* 280
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 281 "*/ int f281() { // "/* 281
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 282 "*/ int f282() { // "/* 282
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 283 "*/ int f283() { // "/* 283
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 284 "*/ int f284() { // "/* 284
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 285 "*/ int f285() { // "/* 285
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 286 "*/ int f286() { // "/* 286
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 287 "*/ int f287() { // "/* 287
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 288 "*/ int f288() { // "/* 288
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 289 "*/ int f289() { // "/* 289
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 290 "*/ int f290() { // "/* 290
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 291 "*/ int f291() { // "/* 291
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 292 "*/ int f292() { // "/* 292
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 293 "*/ int f293() { // "/* 293
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 294 "*/ int f294() { // "/* 294
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 295 "*/ int f295() { // "/* 295
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 296 "*/ int f296() { // "/* 296
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 297 "*/ int f297() { // "/* 297
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 298 "*/ int f298() { // "/* 298
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 299 "*/ int f299() { // "/* 299
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 300 "*/ int f300() { // "/* 300
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 301 "*/ int f301() { // "/* 301
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 302 "*/ int f302() { // "/* 302
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 303 "*/ int f303() { // "/* 303
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 304 "*/ int f304() { // "/* 304
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 305 "*/ int f305() { // "/* 305
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 306 "*/ int f306() { // "/* 306
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 307 "*/ int f307() { // "/* 307
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 308 "*/ int f308() { // "/* 308
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 309 "*/ int f309() { // "/* 309
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 310 "*/ int f310() { // "/* 310
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 311 "*/ int f311() { // "/* 311
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 312 "*/ int f312() { // "/* 312
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 313 "*/ int f313() { // "/* 313
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 314 "*/ int f314() { // "/* 314
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 315 "*/ int f315() { // "/* 315
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 316 "*/ int f316() { // "/* 316
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 317 "*/ int f317() { // "/* 317
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 318 "*/ int f318() { // "/* 318
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 319 "*/ int f319() { // "/* 319
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 320 "*/ int f320() { // "/* 320
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 321 "*/ int f321() { // "/* 321
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 322 "*/ int f322() { // "/* 322
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 323 "*/ int f323() { // "/* 323
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 324 "*/ int f324() { // "/* 324
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 325 "*/ int f325() { // "/* 325
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 326 "*/ int f326() { // "/* 326
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 327 "*/ int f327() { // "/* 327
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 328 "*/ int f328() { // "/* 328
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 329 "*/ int f329() { // "/* 329
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 330 "*/ int f330() { // "/* 330
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 331 "*/ int f331() { // "/* 331
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 332 "*/ int f332() { // "/* 332
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 333 "*/ int f333() { // "/* 333
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 334 "*/ int f334() { // "/* 334
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 335 "*/ int f335() { // "/* 335
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 336 "*/ int f336() { // "/* 336
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 337 "*/ int f337() { // "/* 337
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 338 "*/ int f338() { // "/* 338
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 339 "*/ int f339() { // "/* 339
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 340 "*/ int f340() { // "/* 340
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 341 "*/ int f341() { // "/* 341
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 342 "*/ int f342() { // "/* 342
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 343 "*/ int f343() { // "/* 343
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 344 "*/ int f344() { // "/* 344
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 345 "*/ int f345() { // "/* 345
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 346 "*/ int f346() { // "/* 346
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 347 "*/ int f347() { // "/* 347
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 348 "*/ int f348() { // "/* 348
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 349 "*/ int f349() { // "/* 349
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 350 "*/ int f350() { // "/* 350
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 351 "*/ int f351() { // "/* 351
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 352 "*/ int f352() { // "/* 352
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 353 "*/ int f353() { // "/* 353
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 354 "*/ int f354() { // "/* 354
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 355 "*/ int f355() { // "/* 355
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 356 "*/ int f356() { // "/* 356
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 357 "*/ int f357() { // "/* 357
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 358 "*/ int f358() { // "/* 358
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 359 "*/ int f359() { // "/* 359
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 360 "*/ int f360() { // "/* 360
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 361 "*/ int f361() { // "/* 361
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 362 "*/ int f362() { // "/* 362
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 363 "*/ int f363() { // "/* 363
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 364 "*/ int f364() { // "/* 364
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 365 "*/ int f365() { // "/* 365
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 366 "*/ int f366() { // "/* 366
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 367 "*/ int f367() { // "/* 367
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 368 "*/ int f368() { // "/* 368
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 369 "*/ int f369() { // "/* 369
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 370 "*/ int f370() { // "/* 370
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 371 "*/ int f371() { // "/* 371
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 372 "*/ int f372() { // "/* 372
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 373 "*/ int f373() { // "/* 373
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 374 "*/ int f374() { // "/* 374
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 375 "*/ int f375() { // "/* 375
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 376 "*/ int f376() { // "/* 376
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 377 "*/ int f377() { // "/* 377
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 378 "*/ int f378() { // "/* 378
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 379 "*/ int f379() { // "/* 379
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 380 "*/ int f380() { // "/* 380
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 381 "*/ int f381() { // "/* 381
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 382 "*/ int f382() { // "/* 382
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 383 "*/ int f383() { // "/* 383
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 384 "*/ int f384() { // "/* 384
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 385 "*/ int f385() { // "/* 385
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 386 "*/ int f386() { // "/* 386
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 387 "*/ int f387() { // "/* 387
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 388 "*/ int f388() { // "/* 388
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 389 "*/ int f389() { // "/* 389
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 390 "*/ int f390() { // "/* 390
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 391 "*/ int f391() { // "/* 391
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 392 "*/ int f392() { // "/* 392
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 393 "*/ int f393() { // "/* 393
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 394 "*/ int f394() { // "/* 394
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 395 "*/ int f395() { // "/* 395
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 396 "*/ int f396() { // "/* 396
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 397 "*/ int f397() { // "/* 397
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 398 "*/ int f398() { // "/* 398
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 399 "*/ int f399() { // "/* 399
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 400 "*/ int f400() { // "/* 400
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 401 "*/ int f401() { // "/* 401
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 402 "*/ int f402() { // "/* 402
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 403 "*/ int f403() { // "/* 403
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 404 "*/ int f404() { // "/* 404
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 405 "*/ int f405() { // "/* 405
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 406 "*/ int f406() { // "/* 406
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 407 "*/ int f407() { // "/* 407
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 408 "*/ int f408() { // "/* 408
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 409 "*/ int f409() { // "/* 409
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 410 "*/ int f410() { // "/* 410
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 411 "*/ int f411() { // "/* 411
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 412 "*/ int f412() { // "/* 412
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 413 "*/ int f413() { // "/* 413
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 414 "*/ int f414() { // "/* 414
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 415 "*/ int f415() { // "/* 415
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 416 "*/ int f416() { // "/* 416
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 417 "*/ int f417() { // "/* 417
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 418 "*/ int f418() { // "/* 418
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 419 "*/ int f419() { // "/* 419
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 420 "*/ int f420() { // "/* 420
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 421 "*/ int f421() { // "/* 421
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 422 "*/ int f422() { // "/* 422
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 423 "*/ int f423() { // "/* 423
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 424 "*/ int f424() { // "/* 424
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 425 "*/ int f425() { // "/* 425
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 426 "*/ int f426() { // "/* 426
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 427 "*/ int f427() { // "/* 427
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 428 "*/ int f428() { // "/* 428
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 429 "*/ int f429() { // "/* 429
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 430 "*/ int f430() { // "/* 430
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 431 "*/ int f431() { // "/* 431
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 432 "*/ int f432() { // "/* 432
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 433 "*/ int f433() { // "/* 433
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 434 "*/ int f434() { // "/* 434
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 435 "*/ int f435() { // "/* 435
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 436 "*/ int f436() { // "/* 436
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 437 "*/ int f437() { // "/* 437
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 438 "*/ int f438() { // "/* 438
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 439 "*/ int f439() { // "/* 439
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 440 "*/ int f440() { // "/* 440
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 441 "*/ int f441() { // "/* 441
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 442 "*/ int f442() { // "/* 442
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 443 "*/ int f443() { // "/* 443
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 444 "*/ int f444() { // "/* 444
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 445 "*/ int f445() { // "/* 445
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 446 "*/ int f446() { // "/* 446
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 447 "*/ int f447() { // "/* 447
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 448 "*/ int f448() { // "/* 448
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 449 "*/ int f449() { // "/* 449
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 450 "*/ int f450() { // "/* 450
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 451 "*/ int f451() { // "/* 451
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 452 "*/ int f452() { // "/* 452
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 453 "*/ int f453() { // "/* 453
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 454 "*/ int f454() { // "/* 454
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 455 "*/ int f455() { // "/* 455
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 456 "*/ int f456() { // "/* 456
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 457 "*/ int f457() { // "/* 457
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 458 "*/ int f458() { // "/* 458
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 459 "*/ int f459() { // "/* 459
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 460 "*/ int f460() { // "/* 460
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 461 "*/ int f461() { // "/* 461
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 462 "*/ int f462() { // "/* 462
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 463 "*/ int f463() { // "/* 463
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 464 "*/ int f464() { // "/* 464
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 465 "*/ int f465() { // "/* 465
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 466 "*/ int f466() { // "/* 466
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 467 "*/ int f467() { // "/* 467
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 468 "*/ int f468() { // "/* 468
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 469 "*/ int f469() { // "/* 469
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 470 "*/ int f470() { // "/* 470
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 471 "*/ int f471() { // "/* 471
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 472 "*/ int f472() { // "/* 472
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 473 "*/ int f473() { // "/* 473
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 474 "*/ int f474() { // "/* 474
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 475 "*/ int f475() { // "/* 475
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 476 "*/ int f476() { // "/* 476
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 477 "*/ int f477() { // "/* 477
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 478 "*/ int f478() { // "/* 478
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 479 "*/ int f479() { // "/* 479
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 480 "*/ int f480() { // "/* 480
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 481 "*/ int f481() { // "/* 481
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 482 "*/ int f482() { // "/* 482
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 483 "*/ int f483() { // "/* 483
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 484 "*/ int f484() { // "/* 484
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 485 "*/ int f485() { // "/* 485
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 486 "*/ int f486() { // "/* 486
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 487 "*/ int f487() { // "/* 487
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 488 "*/ int f488() { // "/* 488
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 489 "*/ int f489() { // "/* 489
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 490 "*/ int f490() { // "/* 490
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 491 "*/ int f491() { // "/* 491
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 492 "*/ int f492() { // "/* 492
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 493 "*/ int f493() { // "/* 493
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 494 "*/ int f494() { // "/* 494
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 495 "*/ int f495() { // "/* 495
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 496 "*/ int f496() { // "/* 496
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 497 "*/ int f497() { // "/* 497
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 498 "*/ int f498() { // "/* 498
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 499 "*/ int f499() { // "/* 499
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 500 "*/ int f500() { // "/* 500
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 501 "*/ int f501() { // "/* 501
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 502 "*/ int f502() { // "/* 502
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 503 "*/ int f503() { // "/* 503
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 504 "*/ int f504() { // "/* 504
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 505 "*/ int f505() { // "/* 505
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 506 "*/ int f506() { // "/* 506
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 507 "*/ int f507() { // "/* 507
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 508 "*/ int f508() { // "/* 508
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 509 "*/ int f509() { // "/* 509
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 510 "*/ int f510() { // "/* 510
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 511 "*/ int f511() { // "/* 511
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 512 "*/ int f512() { // "/* 512
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 513 "*/ int f513() { // "/* 513
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 514 "*/ int f514() { // "/* 514
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 515 "*/ int f515() { // "/* 515
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 516 "*/ int f516() { // "/* 516
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 517 "*/ int f517() { // "/* 517
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 518 "*/ int f518() { // "/* 518
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 519 "*/ int f519() { // "/* 519
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 520 "*/ int f520() { // "/* 520
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 521 "*/ int f521() { // "/* 521
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 522 "*/ int f522() { // "/* 522
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 523 "*/ int f523() { // "/* 523
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 524 "*/ int f524() { // "/* 524
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 525 "*/ int f525() { // "/* 525
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 526 "*/ int f526() { // "/* 526
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 527 "*/ int f527() { // "/* 527
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 528 "*/ int f528() { // "/* 528
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 529 "*/ int f529() { // "/* 529
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 530 "*/ int f530() { // "/* 530
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 531 "*/ int f531() { // "/* 531
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 532 "*/ int f532() { // "/* 532
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 533 "*/ int f533() { // "/* 533
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 534 "*/ int f534() { // "/* 534
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 535 "*/ int f535() { // "/* 535
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 536 "*/ int f536() { // "/* 536
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 537 "*/ int f537() { // "/* 537
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 538 "*/ int f538() { // "/* 538
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 539 "*/ int f539() { // "/* 539
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 540 "*/ int f540() { // "/* 540
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 541 "*/ int f541() { // "/* 541
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 542 "*/ int f542() { // "/* 542
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 543 "*/ int f543() { // "/* 543
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 544 "*/ int f544() { // "/* 544
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 545 "*/ int f545() { // "/* 545
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 546 "*/ int f546() { // "/* 546
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 547 "*/ int f547() { // "/* 547
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 548 "*/ int f548() { // "/* 548
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 549 "*/ int f549() { // "/* 549
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 550 "*/ int f550() { // "/* 550
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 551 "*/ int f551() { // "/* 551
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 552 "*/ int f552() { // "/* 552
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 553 "*/ int f553() { // "/* 553
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 554 "*/ int f554() { // "/* 554
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 555 "*/ int f555() { // "/* 555
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 556 "*/ int f556() { // "/* 556
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 557 "*/ int f557() { // "/* 557
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 558 "*/ int f558() { // "/* 558
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 559 "*/ int f559() { // "/* 559
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 560 "*/ int f560() { // "/* 560
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 561 "*/ int f561() { // "/* 561
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 562 "*/ int f562() { // "/* 562
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 563 "*/ int f563() { // "/* 563
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 564 "*/ int f564() { // "/* 564
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 565 "*/ int f565() { // "/* 565
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 566 "*/ int f566() { // "/* 566
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 567 "*/ int f567() { // "/* 567
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 568 "*/ int f568() { // "/* 568
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 569 "*/ int f569() { // "/* 569
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 570 "*/ int f570() { // "/* 570
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 571 "*/ int f571() { // "/* 571
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 572 "*/ int f572() { // "/* 572
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 573 "*/ int f573() { // "/* 573
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 574 "*/ int f574() { // "/* 574
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 575 "*/ int f575() { // "/* 575
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 576 "*/ int f576() { // "/* 576
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 577 "*/ int f577() { // "/* 577
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 578 "*/ int f578() { // "/* 578
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 579 "*/ int f579() { // "/* 579
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 580 "*/ int f580() { // "/* 580
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 581 "*/ int f581() { // "/* 581
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 582 "*/ int f582() { // "/* 582
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 583 "*/ int f583() { // "/* 583
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 584 "*/ int f584() { // "/* 584
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 585 "*/ int f585() { // "/* 585
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 586 "*/ int f586() { // "/* 586
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 587 "*/ int f587() { // "/* 587
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 588 "*/ int f588() { // "/* 588
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 589 "*/ int f589() { // "/* 589
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 590 "*/ int f590() { // "/* 590
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 591 "*/ int f591() { // "/* 591
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 592 "*/ int f592() { // "/* 592
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 593 "*/ int f593() { // "/* 593
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 594 "*/ int f594() { // "/* 594
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 595 "*/ int f595() { // "/* 595
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 596 "*/ int f596() { // "/* 596
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 597 "*/ int f597() { // "/* 597
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 598 "*/ int f598() { // "/* 598
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 599 "*/ int f599() { // "/* 599
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 600 "*/ int f600() { // "/* 600
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 601 "*/ int f601() { // "/* 601
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 602 "*/ int f602() { // "/* 602
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 603 "*/ int f603() { // "/* 603
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 604 "*/ int f604() { // "/* 604
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 605 "*/ int f605() { // "/* 605
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 606 "*/ int f606() { // "/* 606
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 607 "*/ int f607() { // "/* 607
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 608 "*/ int f608() { // "/* 608
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 609 "*/ int f609() { // "/* 609
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 610 "*/ int f610() { // "/* 610
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 611 "*/ int f611() { // "/* 611
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 612 "*/ int f612() { // "/* 612
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 613 "*/ int f613() { // "/* 613
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 614 "*/ int f614() { // "/* 614
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 615 "*/ int f615() { // "/* 615
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 616 "*/ int f616() { // "/* 616
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 617 "*/ int f617() { // "/* 617
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 618 "*/ int f618() { // "/* 618
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 619 "*/ int f619() { // "/* 619
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 620 "*/ int f620() { // "/* 620
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 621 "*/ int f621() { // "/* 621
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 622 "*/ int f622() { // "/* 622
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 623 "*/ int f623() { // "/* 623
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 624 "*/ int f624() { // "/* 624
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 625 "*/ int f625() { // "/* 625
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 626 "*/ int f626() { // "/* 626
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 627 "*/ int f627() { // "/* 627
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 628 "*/ int f628() { // "/* 628
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 629 "*/ int f629() { // "/* 629
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 630 "*/ int f630() { // "/* 630
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 631 "*/ int f631() { // "/* 631
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 632 "*/ int f632() { // "/* 632
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 633 "*/ int f633() { // "/* 633
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 634 "*/ int f634() { // "/* 634
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 635 "*/ int f635() { // "/* 635
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 636 "*/ int f636() { // "/* 636
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 637 "*/ int f637() { // "/* 637
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 638 "*/ int f638() { // "/* 638
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 639 "*/ int f639() { // "/* 639
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 640 "*/ int f640() { // "/* 640
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 641 "*/ int f641() { // "/* 641
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 642 "*/ int f642() { // "/* 642
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 643 "*/ int f643() { // "/* 643
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 644 "*/ int f644() { // "/* 644
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 645 "*/ int f645() { // "/* 645
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 646 "*/ int f646() { // "/* 646
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 647 "*/ int f647() { // "/* 647
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 648 "*/ int f648() { // "/* 648
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 649 "*/ int f649() { // "/* 649
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 650 "*/ int f650() { // "/* 650
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 651 "*/ int f651() { // "/* 651
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 652 "*/ int f652() { // "/* 652
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 653 "*/ int f653() { // "/* 653
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 654 "*/ int f654() { // "/* 654
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 655 "*/ int f655() { // "/* 655
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 656 "*/ int f656() { // "/* 656
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 657 "*/ int f657() { // "/* 657
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 658 "*/ int f658() { // "/* 658
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 659 "*/ int f659() { // "/* 659
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 660 "*/ int f660() { // "/* 660
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 661 "*/ int f661() { // "/* 661
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 662 "*/ int f662() { // "/* 662
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 663 "*/ int f663() { // "/* 663
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 664 "*/ int f664() { // "/* 664
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 665 "*/ int f665() { // "/* 665
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 666 "*/ int f666() { // "/* 666
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 667 "*/ int f667() { // "/* 667
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 668 "*/ int f668() { // "/* 668
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 669 "*/ int f669() { // "/* 669
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 670 "*/ int f670() { // "/* 670
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 671 "*/ int f671() { // "/* 671
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 672 "*/ int f672() { // "/* 672
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 673 "*/ int f673() { // "/* 673
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 674 "*/ int f674() { // "/* 674
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 675 "*/ int f675() { // "/* 675
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 676 "*/ int f676() { // "/* 676
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 677 "*/ int f677() { // "/* 677
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 678 "*/ int f678() { // "/* 678
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 679 "*/ int f679() { // "/* 679
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 680 "*/ int f680() { // "/* 680
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 681 "*/ int f681() { // "/* 681
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 682 "*/ int f682() { // "/* 682
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 683 "*/ int f683() { // "/* 683
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 684 "*/ int f684() { // "/* 684
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 685 "*/ int f685() { // "/* 685
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 686 "*/ int f686() { // "/* 686
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 687 "*/ int f687() { // "/* 687
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 688 "*/ int f688() { // "/* 688
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 689 "*/ int f689() { // "/* 689
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 690 "*/ int f690() { // "/* 690
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 691 "*/ int f691() { // "/* 691
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 692 "*/ int f692() { // "/* 692
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 693 "*/ int f693() { // "/* 693
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 694 "*/ int f694() { // "/* 694
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 695 "*/ int f695() { // "/* 695
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 696 "*/ int f696() { // "/* 696
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 697 "*/ int f697() { // "/* 697
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 698 "*/ int f698() { // "/* 698
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 699 "*/ int f699() { // "/* 699
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 700 "*/ int f700() { // "/* 700
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 701 "*/ int f701() { // "/* 701
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 702 "*/ int f702() { // "/* 702
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 703 "*/ int f703() { // "/* 703
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 704 "*/ int f704() { // "/* 704
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 705 "*/ int f705() { // "/* 705
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 706 "*/ int f706() { // "/* 706
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 707 "*/ int f707() { // "/* 707
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 708 "*/ int f708() { // "/* 708
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 709 "*/ int f709() { // "/* 709
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 710 "*/ int f710() { // "/* 710
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 711 "*/ int f711() { // "/* 711
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 712 "*/ int f712() { // "/* 712
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 713 "*/ int f713() { // "/* 713
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 714 "*/ int f714() { // "/* 714
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 715 "*/ int f715() { // "/* 715
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 716 "*/ int f716() { // "/* 716
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 717 "*/ int f717() { // "/* 717
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 718 "*/ int f718() { // "/* 718
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 719 "*/ int f719() { // "/* 719
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 720 "*/ int f720() { // "/* 720
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 721 "*/ int f721() { // "/* 721
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 722 "*/ int f722() { // "/* 722
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 723 "*/ int f723() { // "/* 723
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 724 "*/ int f724() { // "/* 724
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 725 "*/ int f725() { // "/* 725
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 726 "*/ int f726() { // "/* 726
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 727 "*/ int f727() { // "/* 727
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 728 "*/ int f728() { // "/* 728
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 729 "*/ int f729() { // "/* 729
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 730 "*/ int f730() { // "/* 730
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 731 "*/ int f731() { // "/* 731
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 732 "*/ int f732() { // "/* 732
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 733 "*/ int f733() { // "/* 733
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 734 "*/ int f734() { // "/* 734
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 735 "*/ int f735() { // "/* 735
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 736 "*/ int f736() { // "/* 736
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 737 "*/ int f737() { // "/* 737
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 738 "*/ int f738() { // "/* 738
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 739 "*/ int f739() { // "/* 739
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 740 "*/ int f740() { // "/* 740
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 741 "*/ int f741() { // "/* 741
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 742 "*/ int f742() { // "/* 742
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 743 "*/ int f743() { // "/* 743
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 744 "*/ int f744() { // "/* 744
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 745 "*/ int f745() { // "/* 745
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 746 "*/ int f746() { // "/* 746
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 747 "*/ int f747() { // "/* 747
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 748 "*/ int f748() { // "/* 748
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 749 "*/ int f749() { // "/* 749
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 750 "*/ int f750() { // "/* 750
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 751 "*/ int f751() { // "/* 751
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 752 "*/ int f752() { // "/* 752
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 753 "*/ int f753() { // "/* 753
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 754 "*/ int f754() { // "/* 754
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 755 "*/ int f755() { // "/* 755
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 756 "*/ int f756() { // "/* 756
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 757 "*/ int f757() { // "/* 757
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 758 "*/ int f758() { // "/* 758
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 759 "*/ int f759() { // "/* 759
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 760 "*/ int f760() { // "/* 760
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 761 "*/ int f761() { // "/* 761
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 762 "*/ int f762() { // "/* 762
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 763 "*/ int f763() { // "/* 763
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 764 "*/ int f764() { // "/* 764
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 765 "*/ int f765() { // "/* 765
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 766 "*/ int f766() { // "/* 766
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 767 "*/ int f767() { // "/* 767
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 768 "*/ int f768() { // "/* 768
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 769 "*/ int f769() { // "/* 769
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 770 "*/ int f770() { // "/* 770
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 771 "*/ int f771() { // "/* 771
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 772 "*/ int f772() { // "/* 772
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 773 "*/ int f773() { // "/* 773
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 774 "*/ int f774() { // "/* 774
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 775 "*/ int f775() { // "/* 775
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 776 "*/ int f776() { // "/* 776
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 777 "*/ int f777() { // "/* 777
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 778 "*/ int f778() { // "/* 778
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 779 "*/ int f779() { // "/* 779
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 780 "*/ int f780() { // "/* 780
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 781 "*/ int f781() { // "/* 781
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 782 "*/ int f782() { // "/* 782
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 783 "*/ int f783() { // "/* 783
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 784 "*/ int f784() { // "/* 784
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 785 "*/ int f785() { // "/* 785
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 786 "*/ int f786() { // "/* 786
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 787 "*/ int f787() { // "/* 787
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 788 "*/ int f788() { // "/* 788
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 789 "*/ int f789() { // "/* 789
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 790 "*/ int f790() { // "/* 790
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 791 "*/ int f791() { // "/* 791
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 792 "*/ int f792() { // "/* 792
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 793 "*/ int f793() { // "/* 793
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 794 "*/ int f794() { // "/* 794
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 795 "*/ int f795() { // "/* 795
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 796 "*/ int f796() { // "/* 796
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 797 "*/ int f797() { // "/* 797
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 798 "*/ int f798() { // "/* 798
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 799 "*/ int f799() { // "/* 799
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 800 "*/ int f800() { // "/* 800
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 801 "*/ int f801() { // "/* 801
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 802 "*/ int f802() { // "/* 802
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 803 "*/ int f803() { // "/* 803
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 804 "*/ int f804() { // "/* 804
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 805 "*/ int f805() { // "/* 805
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 806 "*/ int f806() { // "/* 806
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 807 "*/ int f807() { // "/* 807
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 808 "*/ int f808() { // "/* 808
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 809 "*/ int f809() { // "/* 809
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 810 "*/ int f810() { // "/* 810
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 811 "*/ int f811() { // "/* 811
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 812 "*/ int f812() { // "/* 812
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 813 "*/ int f813() { // "/* 813
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 814 "*/ int f814() { // "/* 814
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 815 "*/ int f815() { // "/* 815
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 816 "*/ int f816() { // "/* 816
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 817 "*/ int f817() { // "/* 817
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 818 "*/ int f818() { // "/* 818
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 819 "*/ int f819() { // "/* 819
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 820 "*/ int f820() { // "/* 820
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 821 "*/ int f821() { // "/* 821
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 822 "*/ int f822() { // "/* 822
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 823 "*/ int f823() { // "/* 823
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 824 "*/ int f824() { // "/* 824
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 825 "*/ int f825() { // "/* 825
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 826 "*/ int f826() { // "/* 826
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 827 "*/ int f827() { // "/* 827
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 828 "*/ int f828() { // "/* 828
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 829 "*/ int f829() { // "/* 829
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 830 "*/ int f830() { // "/* 830
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 831 "*/ int f831() { // "/* 831
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 832 "*/ int f832() { // "/* 832
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 833 "*/ int f833() { // "/* 833
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 834 "*/ int f834() { // "/* 834
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 835 "*/ int f835() { // "/* 835
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 836 "*/ int f836() { // "/* 836
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 837 "*/ int f837() { // "/* 837
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 838 "*/ int f838() { // "/* 838
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 839 "*/ int f839() { // "/* 839
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 840 "*/ int f840() { // "/* 840
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 841 "*/ int f841() { // "/* 841
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 842 "*/ int f842() { // "/* 842
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 843 "*/ int f843() { // "/* 843
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 844 "*/ int f844() { // "/* 844
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 845 "*/ int f845() { // "/* 845
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 846 "*/ int f846() { // "/* 846
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 847 "*/ int f847() { // "/* 847
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 848 "*/ int f848() { // "/* 848
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 849 "*/ int f849() { // "/* 849
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 850 "*/ int f850() { // "/* 850
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 851 "*/ int f851() { // "/* 851
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 852 "*/ int f852() { // "/* 852
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 853 "*/ int f853() { // "/* 853
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 854 "*/ int f854() { // "/* 854
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 855 "*/ int f855() { // "/* 855
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 856 "*/ int f856() { // "/* 856
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 857 "*/ int f857() { // "/* 857
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 858 "*/ int f858() { // "/* 858
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 859 "*/ int f859() { // "/* 859
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 860 "*/ int f860() { // "/* 860
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 861 "*/ int f861() { // "/* 861
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 862 "*/ int f862() { // "/* 862
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 863 "*/ int f863() { // "/* 863
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 864 "*/ int f864() { // "/* 864
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 865 "*/ int f865() { // "/* 865
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 866 "*/ int f866() { // "/* 866
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 867 "*/ int f867() { // "/* 867
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 868 "*/ int f868() { // "/* 868
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 869 "*/ int f869() { // "/* 869
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 870 "*/ int f870() { // "/* 870
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 871 "*/ int f871() { // "/* 871
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 872 "*/ int f872() { // "/* 872
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 873 "*/ int f873() { // "/* 873
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 874 "*/ int f874() { // "/* 874
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 875 "*/ int f875() { // "/* 875
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 876 "*/ int f876() { // "/* 876
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 877 "*/ int f877() { // "/* 877
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 878 "*/ int f878() { // "/* 878
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 879 "*/ int f879() { // "/* 879
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 880 "*/ int f880() { // "/* 880
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 881 "*/ int f881() { // "/* 881
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 882 "*/ int f882() { // "/* 882
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 883 "*/ int f883() { // "/* 883
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 884 "*/ int f884() { // "/* 884
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 885 "*/ int f885() { // "/* 885
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 886 "*/ int f886() { // "/* 886
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 887 "*/ int f887() { // "/* 887
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 888 "*/ int f888() { // "/* 888
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 889 "*/ int f889() { // "/* 889
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 890 "*/ int f890() { // "/* 890
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 891 "*/ int f891() { // "/* 891
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 892 "*/ int f892() { // "/* 892
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 893 "*/ int f893() { // "/* 893
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 894 "*/ int f894() { // "/* 894
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 895 "*/ int f895() { // "/* 895
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 896 "*/ int f896() { // "/* 896
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 897 "*/ int f897() { // "/* 897
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 898 "*/ int f898() { // "/* 898
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 899 "*/ int f899() { // "/* 899
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 900 "*/ int f900() { // "/* 900
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 901 "*/ int f901() { // "/* 901
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 902 "*/ int f902() { // "/* 902
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 903 "*/ int f903() { // "/* 903
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 904 "*/ int f904() { // "/* 904
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 905 "*/ int f905() { // "/* 905
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 906 "*/ int f906() { // "/* 906
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 907 "*/ int f907() { // "/* 907
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 908 "*/ int f908() { // "/* 908
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 909 "*/ int f909() { // "/* 909
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 910 "*/ int f910() { // "/* 910
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 911 "*/ int f911() { // "/* 911
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 912 "*/ int f912() { // "/* 912
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 913 "*/ int f913() { // "/* 913
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 914 "*/ int f914() { // "/* 914
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 915 "*/ int f915() { // "/* 915
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 916 "*/ int f916() { // "/* 916
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 917 "*/ int f917() { // "/* 917
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 918 "*/ int f918() { // "/* 918
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 919 "*/ int f919() { // "/* 919
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 920 "*/ int f920() { // "/* 920
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 921 "*/ int f921() { // "/* 921
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 922 "*/ int f922() { // "/* 922
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 923 "*/ int f923() { // "/* 923
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 924 "*/ int f924() { // "/* 924
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 925 "*/ int f925() { // "/* 925
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 926 "*/ int f926() { // "/* 926
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 927 "*/ int f927() { // "/* 927
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 928 "*/ int f928() { // "/* 928
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 929 "*/ int f929() { // "/* 929
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 930 "*/ int f930() { // "/* 930
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 931 "*/ int f931() { // "/* 931
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 932 "*/ int f932() { // "/* 932
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 933 "*/ int f933() { // "/* 933
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 934 "*/ int f934() { // "/* 934
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 935 "*/ int f935() { // "/* 935
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 936 "*/ int f936() { // "/* 936
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 937 "*/ int f937() { // "/* 937
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 938 "*/ int f938() { // "/* 938
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 939 "*/ int f939() { // "/* 939
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 940 "*/ int f940() { // "/* 940
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 941 "*/ int f941() { // "/* 941
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 942 "*/ int f942() { // "/* 942
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 943 "*/ int f943() { // "/* 943
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 944 "*/ int f944() { // "/* 944
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 945 "*/ int f945() { // "/* 945
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 946 "*/ int f946() { // "/* 946
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 947 "*/ int f947() { // "/* 947
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 948 "*/ int f948() { // "/* 948
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 949 "*/ int f949() { // "/* 949
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 950 "*/ int f950() { // "/* 950
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 951 "*/ int f951() { // "/* 951
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 952 "*/ int f952() { // "/* 952
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 953 "*/ int f953() { // "/* 953
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 954 "*/ int f954() { // "/* 954
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 955 "*/ int f955() { // "/* 955
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 956 "*/ int f956() { // "/* 956
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 957 "*/ int f957() { // "/* 957
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 958 "*/ int f958() { // "/* 958
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 959 "*/ int f959() { // "/* 959
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 960 "*/ int f960() { // "/* 960
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 961 "*/ int f961() { // "/* 961
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 962 "*/ int f962() { // "/* 962
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 963 "*/ int f963() { // "/* 963
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 964 "*/ int f964() { // "/* 964
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 965 "*/ int f965() { // "/* 965
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 966 "*/ int f966() { // "/* 966
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 967 "*/ int f967() { // "/* 967
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 968 "*/ int f968() { // "/* 968
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 969 "*/ int f969() { // "/* 969
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 970 "*/ int f970() { // "/* 970
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 971 "*/ int f971() { // "/* 971
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 972 "*/ int f972() { // "/* 972
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 973 "*/ int f973() { // "/* 973
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 974 "*/ int f974() { // "/* 974
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 975 "*/ int f975() { // "/* 975
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 976 "*/ int f976() { // "/* 976
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 977 "*/ int f977() { // "/* 977
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 978 "*/ int f978() { // "/* 978
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 979 "*/ int f979() { // "/* 979
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 980 "*/ int f980() { // "/* 980
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 981 "*/ int f981() { // "/* 981
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 982 "*/ int f982() { // "/* 982
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 983 "*/ int f983() { // "/* 983
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 984 "*/ int f984() { // "/* 984
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 985 "*/ int f985() { // "/* 985
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 986 "*/ int f986() { // "/* 986
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 987 "*/ int f987() { // "/* 987
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 988 "*/ int f988() { // "/* 988
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 989 "*/ int f989() { // "/* 989
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 990 "*/ int f990() { // "/* 990
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 991 "*/ int f991() { // "/* 991
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 992 "*/ int f992() { // "/* 992
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 993 "*/ int f993() { // "/* 993
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 994 "*/ int f994() { // "/* 994
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 995 "*/ int f995() { // "/* 995
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 996 "*/ int f996() { // "/* 996
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 997 "*/ int f997() { // "/* 997
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 998 "*/ int f998() { // "/* 998
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 999 "*/ int f999() { // "/* 999
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1000 "*/ int f1000() { // "/* 1000
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1001 "*/ int f1001() { // "/* 1001
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1002 "*/ int f1002() { // "/* 1002
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1003 "*/ int f1003() { // "/* 1003
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1004 "*/ int f1004() { // "/* 1004
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1005 "*/ int f1005() { // "/* 1005
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1006 "*/ int f1006() { // "/* 1006
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1007 "*/ int f1007() { // "/* 1007
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1008 "*/ int f1008() { // "/* 1008
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1009 "*/ int f1009() { // "/* 1009
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1010 "*/ int f1010() { // "/* 1010
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1011 "*/ int f1011() { // "/* 1011
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1012 "*/ int f1012() { // "/* 1012
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1013 "*/ int f1013() { // "/* 1013
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1014 "*/ int f1014() { // "/* 1014
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1015 "*/ int f1015() { // "/* 1015
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1016 "*/ int f1016() { // "/* 1016
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1017 "*/ int f1017() { // "/* 1017
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1018 "*/ int f1018() { // "/* 1018
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1019 "*/ int f1019() { // "/* 1019
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1020 "*/ int f1020() { // "/* 1020
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1021 "*/ int f1021() { // "/* 1021
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1022 "*/ int f1022() { // "/* 1022
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1023 "*/ int f1023() { // "/* 1023
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1024 "*/ int f1024() { // "/* 1024
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1025 "*/ int f1025() { // "/* 1025
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1026 "*/ int f1026() { // "/* 1026
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1027 "*/ int f1027() { // "/* 1027
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1028 "*/ int f1028() { // "/* 1028
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1029 "*/ int f1029() { // "/* 1029
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1030 "*/ int f1030() { // "/* 1030
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1031 "*/ int f1031() { // "/* 1031
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1032 "*/ int f1032() { // "/* 1032
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1033 "*/ int f1033() { // "/* 1033
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1034 "*/ int f1034() { // "/* 1034
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1035 "*/ int f1035() { // "/* 1035
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1036 "*/ int f1036() { // "/* 1036
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1037 "*/ int f1037() { // "/* 1037
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1038 "*/ int f1038() { // "/* 1038
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1039 "*/ int f1039() { // "/* 1039
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1040 "*/ int f1040() { // "/* 1040
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1041 "*/ int f1041() { // "/* 1041
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1042 "*/ int f1042() { // "/* 1042
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1043 "*/ int f1043() { // "/* 1043
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1044 "*/ int f1044() { // "/* 1044
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1045 "*/ int f1045() { // "/* 1045
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1046 "*/ int f1046() { // "/* 1046
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1047 "*/ int f1047() { // "/* 1047
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1048 "*/ int f1048() { // "/* 1048
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1049 "*/ int f1049() { // "/* 1049
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1050 "*/ int f1050() { // "/* 1050
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1051 "*/ int f1051() { // "/* 1051
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1052 "*/ int f1052() { // "/* 1052
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1053 "*/ int f1053() { // "/* 1053
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1054 "*/ int f1054() { // "/* 1054
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1055 "*/ int f1055() { // "/* 1055
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1056 "*/ int f1056() { // "/* 1056
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1057 "*/ int f1057() { // "/* 1057
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1058 "*/ int f1058() { // "/* 1058
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1059 "*/ int f1059() { // "/* 1059
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1060 "*/ int f1060() { // "/* 1060
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1061 "*/ int f1061() { // "/* 1061
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1062 "*/ int f1062() { // "/* 1062
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1063 "*/ int f1063() { // "/* 1063
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1064 "*/ int f1064() { // "/* 1064
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1065 "*/ int f1065() { // "/* 1065
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1066 "*/ int f1066() { // "/* 1066
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1067 "*/ int f1067() { // "/* 1067
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1068 "*/ int f1068() { // "/* 1068
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1069 "*/ int f1069() { // "/* 1069
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1070 "*/ int f1070() { // "/* 1070
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1071 "*/ int f1071() { // "/* 1071
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1072 "*/ int f1072() { // "/* 1072
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1073 "*/ int f1073() { // "/* 1073
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1074 "*/ int f1074() { // "/* 1074
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1075 "*/ int f1075() { // "/* 1075
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1076 "*/ int f1076() { // "/* 1076
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1077 "*/ int f1077() { // "/* 1077
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1078 "*/ int f1078() { // "/* 1078
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1079 "*/ int f1079() { // "/* 1079
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1080 "*/ int f1080() { // "/* 1080
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1081 "*/ int f1081() { // "/* 1081
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1082 "*/ int f1082() { // "/* 1082
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1083 "*/ int f1083() { // "/* 1083
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1084 "*/ int f1084() { // "/* 1084
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1085 "*/ int f1085() { // "/* 1085
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1086 "*/ int f1086() { // "/* 1086
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1087 "*/ int f1087() { // "/* 1087
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1088 "*/ int f1088() { // "/* 1088
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1089 "*/ int f1089() { // "/* 1089
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1090 "*/ int f1090() { // "/* 1090
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1091 "*/ int f1091() { // "/* 1091
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1092 "*/ int f1092() { // "/* 1092
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1093 "*/ int f1093() { // "/* 1093
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1094 "*/ int f1094() { // "/* 1094
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1095 "*/ int f1095() { // "/* 1095
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1096 "*/ int f1096() { // "/* 1096
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1097 "*/ int f1097() { // "/* 1097
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1098 "*/ int f1098() { // "/* 1098
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1099 "*/ int f1099() { // "/* 1099
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1100 "*/ int f1100() { // "/* 1100
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1101 "*/ int f1101() { // "/* 1101
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1102 "*/ int f1102() { // "/* 1102
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1103 "*/ int f1103() { // "/* 1103
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1104 "*/ int f1104() { // "/* 1104
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1105 "*/ int f1105() { // "/* 1105
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1106 "*/ int f1106() { // "/* 1106
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1107 "*/ int f1107() { // "/* 1107
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1108 "*/ int f1108() { // "/* 1108
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1109 "*/ int f1109() { // "/* 1109
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1110 "*/ int f1110() { // "/* 1110
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1111 "*/ int f1111() { // "/* 1111
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1112 "*/ int f1112() { // "/* 1112
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1113 "*/ int f1113() { // "/* 1113
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1114 "*/ int f1114() { // "/* 1114
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1115 "*/ int f1115() { // "/* 1115
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1116 "*/ int f1116() { // "/* 1116
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1117 "*/ int f1117() { // "/* 1117
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1118 "*/ int f1118() { // "/* 1118
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1119 "*/ int f1119() { // "/* 1119
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1120 "*/ int f1120() { // "/* 1120
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1121 "*/ int f1121() { // "/* 1121
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1122 "*/ int f1122() { // "/* 1122
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1123 "*/ int f1123() { // "/* 1123
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1124 "*/ int f1124() { // "/* 1124
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1125 "*/ int f1125() { // "/* 1125
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1126 "*/ int f1126() { // "/* 1126
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1127 "*/ int f1127() { // "/* 1127
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1128 "*/ int f1128() { // "/* 1128
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1129 "*/ int f1129() { // "/* 1129
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1130 "*/ int f1130() { // "/* 1130
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1131 "*/ int f1131() { // "/* 1131
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1132 "*/ int f1132() { // "/* 1132
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1133 "*/ int f1133() { // "/* 1133
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1134 "*/ int f1134() { // "/* 1134
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1135 "*/ int f1135() { // "/* 1135
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1136 "*/ int f1136() { // "/* 1136
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1137 "*/ int f1137() { // "/* 1137
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1138 "*/ int f1138() { // "/* 1138
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1139 "*/ int f1139() { // "/* 1139
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1140 "*/ int f1140() { // "/* 1140
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1141 "*/ int f1141() { // "/* 1141
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1142 "*/ int f1142() { // "/* 1142
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1143 "*/ int f1143() { // "/* 1143
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1144 "*/ int f1144() { // "/* 1144
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1145 "*/ int f1145() { // "/* 1145
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1146 "*/ int f1146() { // "/* 1146
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1147 "*/ int f1147() { // "/* 1147
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1148 "*/ int f1148() { // "/* 1148
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1149 "*/ int f1149() { // "/* 1149
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1150 "*/ int f1150() { // "/* 1150
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1151 "*/ int f1151() { // "/* 1151
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1152 "*/ int f1152() { // "/* 1152
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1153 "*/ int f1153() { // "/* 1153
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1154 "*/ int f1154() { // "/* 1154
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1155 "*/ int f1155() { // "/* 1155
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1156 "*/ int f1156() { // "/* 1156
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1157 "*/ int f1157() { // "/* 1157
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1158 "*/ int f1158() { // "/* 1158
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1159 "*/ int f1159() { // "/* 1159
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1160 "*/ int f1160() { // "/* 1160
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1161 "*/ int f1161() { // "/* 1161
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1162 "*/ int f1162() { // "/* 1162
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1163 "*/ int f1163() { // "/* 1163
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1164 "*/ int f1164() { // "/* 1164
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1165 "*/ int f1165() { // "/* 1165
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1166 "*/ int f1166() { // "/* 1166
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1167 "*/ int f1167() { // "/* 1167
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1168 "*/ int f1168() { // "/* 1168
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1169 "*/ int f1169() { // "/* 1169
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1170 "*/ int f1170() { // "/* 1170
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1171 "*/ int f1171() { // "/* 1171
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1172 "*/ int f1172() { // "/* 1172
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1173 "*/ int f1173() { // "/* 1173
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1174 "*/ int f1174() { // "/* 1174
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1175 "*/ int f1175() { // "/* 1175
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1176 "*/ int f1176() { // "/* 1176
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1177 "*/ int f1177() { // "/* 1177
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1178 "*/ int f1178() { // "/* 1178
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1179 "*/ int f1179() { // "/* 1179
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1180 "*/ int f1180() { // "/* 1180
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1181 "*/ int f1181() { // "/* 1181
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1182 "*/ int f1182() { // "/* 1182
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1183 "*/ int f1183() { // "/* 1183
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1184 "*/ int f1184() { // "/* 1184
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1185 "*/ int f1185() { // "/* 1185
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1186 "*/ int f1186() { // "/* 1186
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1187 "*/ int f1187() { // "/* 1187
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1188 "*/ int f1188() { // "/* 1188
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1189 "*/ int f1189() { // "/* 1189
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1190 "*/ int f1190() { // "/* 1190
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1191 "*/ int f1191() { // "/* 1191
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1192 "*/ int f1192() { // "/* 1192
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1193 "*/ int f1193() { // "/* 1193
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1194 "*/ int f1194() { // "/* 1194
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1195 "*/ int f1195() { // "/* 1195
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1196 "*/ int f1196() { // "/* 1196
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1197 "*/ int f1197() { // "/* 1197
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1198 "*/ int f1198() { // "/* 1198
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1199 "*/ int f1199() { // "/* 1199
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1200 "*/ int f1200() { // "/* 1200
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1201 "*/ int f1201() { // "/* 1201
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1202 "*/ int f1202() { // "/* 1202
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1203 "*/ int f1203() { // "/* 1203
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1204 "*/ int f1204() { // "/* 1204
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1205 "*/ int f1205() { // "/* 1205
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1206 "*/ int f1206() { // "/* 1206
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1207 "*/ int f1207() { // "/* 1207
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1208 "*/ int f1208() { // "/* 1208
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1209 "*/ int f1209() { // "/* 1209
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1210 "*/ int f1210() { // "/* 1210
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1211 "*/ int f1211() { // "/* 1211
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1212 "*/ int f1212() { // "/* 1212
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1213 "*/ int f1213() { // "/* 1213
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1214 "*/ int f1214() { // "/* 1214
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1215 "*/ int f1215() { // "/* 1215
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1216 "*/ int f1216() { // "/* 1216
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1217 "*/ int f1217() { // "/* 1217
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1218 "*/ int f1218() { // "/* 1218
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1219 "*/ int f1219() { // "/* 1219
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1220 "*/ int f1220() { // "/* 1220
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1221 "*/ int f1221() { // "/* 1221
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1222 "*/ int f1222() { // "/* 1222
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1223 "*/ int f1223() { // "/* 1223
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1224 "*/ int f1224() { // "/* 1224
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1225 "*/ int f1225() { // "/* 1225
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1226 "*/ int f1226() { // "/* 1226
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1227 "*/ int f1227() { // "/* 1227
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1228 "*/ int f1228() { // "/* 1228
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1229 "*/ int f1229() { // "/* 1229
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1230 "*/ int f1230() { // "/* 1230
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1231 "*/ int f1231() { // "/* 1231
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1232 "*/ int f1232() { // "/* 1232
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1233 "*/ int f1233() { // "/* 1233
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1234 "*/ int f1234() { // "/* 1234
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1235 "*/ int f1235() { // "/* 1235
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1236 "*/ int f1236() { // "/* 1236
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1237 "*/ int f1237() { // "/* 1237
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1238 "*/ int f1238() { // "/* 1238
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1239 "*/ int f1239() { // "/* 1239
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1240 "*/ int f1240() { // "/* 1240
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1241 "*/ int f1241() { // "/* 1241
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1242 "*/ int f1242() { // "/* 1242
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1243 "*/ int f1243() { // "/* 1243
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1244 "*/ int f1244() { // "/* 1244
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1245 "*/ int f1245() { // "/* 1245
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1246 "*/ int f1246() { // "/* 1246
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1247 "*/ int f1247() { // "/* 1247
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1248 "*/ int f1248() { // "/* 1248
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1249 "*/ int f1249() { // "/* 1249
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1250 "*/ int f1250() { // "/* 1250
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1251 "*/ int f1251() { // "/* 1251
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1252 "*/ int f1252() { // "/* 1252
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1253 "*/ int f1253() { // "/* 1253
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1254 "*/ int f1254() { // "/* 1254
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1255 "*/ int f1255() { // "/* 1255
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1256 "*/ int f1256() { // "/* 1256
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1257 "*/ int f1257() { // "/* 1257
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1258 "*/ int f1258() { // "/* 1258
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1259 "*/ int f1259() { // "/* 1259
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1260 "*/ int f1260() { // "/* 1260
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1261 "*/ int f1261() { // "/* 1261
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1262 "*/ int f1262() { // "/* 1262
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1263 "*/ int f1263() { // "/* 1263
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1264 "*/ int f1264() { // "/* 1264
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1265 "*/ int f1265() { // "/* 1265
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1266 "*/ int f1266() { // "/* 1266
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1267 "*/ int f1267() { // "/* 1267
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1268 "*/ int f1268() { // "/* 1268
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1269 "*/ int f1269() { // "/* 1269
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1270 "*/ int f1270() { // "/* 1270
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1271 "*/ int f1271() { // "/* 1271
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1272 "*/ int f1272() { // "/* 1272
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1273 "*/ int f1273() { // "/* 1273
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1274 "*/ int f1274() { // "/* 1274
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1275 "*/ int f1275() { // "/* 1275
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1276 "*/ int f1276() { // "/* 1276
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1277 "*/ int f1277() { // "/* 1277
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1278 "*/ int f1278() { // "/* 1278
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1279 "*/ int f1279() { // "/* 1279
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1280 "*/ int f1280() { // "/* 1280
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1281 "*/ int f1281() { // "/* 1281
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1282 "*/ int f1282() { // "/* 1282
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1283 "*/ int f1283() { // "/* 1283
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1284 "*/ int f1284() { // "/* 1284
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1285 "*/ int f1285() { // "/* 1285
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1286 "*/ int f1286() { // "/* 1286
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1287 "*/ int f1287() { // "/* 1287
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1288 "*/ int f1288() { // "/* 1288
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1289 "*/ int f1289() { // "/* 1289
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1290 "*/ int f1290() { // "/* 1290
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1291 "*/ int f1291() { // "/* 1291
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1292 "*/ int f1292() { // "/* 1292
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1293 "*/ int f1293() { // "/* 1293
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1294 "*/ int f1294() { // "/* 1294
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1295 "*/ int f1295() { // "/* 1295
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1296 "*/ int f1296() { // "/* 1296
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1297 "*/ int f1297() { // "/* 1297
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1298 "*/ int f1298() { // "/* 1298
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1299 "*/ int f1299() { // "/* 1299
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1300 "*/ int f1300() { // "/* 1300
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1301 "*/ int f1301() { // "/* 1301
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1302 "*/ int f1302() { // "/* 1302
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1303 "*/ int f1303() { // "/* 1303
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1304 "*/ int f1304() { // "/* 1304
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1305 "*/ int f1305() { // "/* 1305
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1306 "*/ int f1306() { // "/* 1306
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1307 "*/ int f1307() { // "/* 1307
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1308 "*/ int f1308() { // "/* 1308
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1309 "*/ int f1309() { // "/* 1309
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1310 "*/ int f1310() { // "/* 1310
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1311 "*/ int f1311() { // "/* 1311
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1312 "*/ int f1312() { // "/* 1312
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1313 "*/ int f1313() { // "/* 1313
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1314 "*/ int f1314() { // "/* 1314
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1315 "*/ int f1315() { // "/* 1315
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1316 "*/ int f1316() { // "/* 1316
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1317 "*/ int f1317() { // "/* 1317
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1318 "*/ int f1318() { // "/* 1318
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1319 "*/ int f1319() { // "/* 1319
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1320 "*/ int f1320() { // "/* 1320
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1321 "*/ int f1321() { // "/* 1321
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1322 "*/ int f1322() { // "/* 1322
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1323 "*/ int f1323() { // "/* 1323
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1324 "*/ int f1324() { // "/* 1324
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1325 "*/ int f1325() { // "/* 1325
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1326 "*/ int f1326() { // "/* 1326
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1327 "*/ int f1327() { // "/* 1327
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1328 "*/ int f1328() { // "/* 1328
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1329 "*/ int f1329() { // "/* 1329
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1330 "*/ int f1330() { // "/* 1330
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1331 "*/ int f1331() { // "/* 1331
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1332 "*/ int f1332() { // "/* 1332
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1333 "*/ int f1333() { // "/* 1333
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1334 "*/ int f1334() { // "/* 1334
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1335 "*/ int f1335() { // "/* 1335
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1336 "*/ int f1336() { // "/* 1336
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1337 "*/ int f1337() { // "/* 1337
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1338 "*/ int f1338() { // "/* 1338
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1339 "*/ int f1339() { // "/* 1339
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1340 "*/ int f1340() { // "/* 1340
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1341 "*/ int f1341() { // "/* 1341
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1342 "*/ int f1342() { // "/* 1342
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1343 "*/ int f1343() { // "/* 1343
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1344 "*/ int f1344() { // "/* 1344
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1345 "*/ int f1345() { // "/* 1345
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1346 "*/ int f1346() { // "/* 1346
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1347 "*/ int f1347() { // "/* 1347
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1348 "*/ int f1348() { // "/* 1348
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1349 "*/ int f1349() { // "/* 1349
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1350 "*/ int f1350() { // "/* 1350
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1351 "*/ int f1351() { // "/* 1351
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1352 "*/ int f1352() { // "/* 1352
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1353 "*/ int f1353() { // "/* 1353
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1354 "*/ int f1354() { // "/* 1354
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1355 "*/ int f1355() { // "/* 1355
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1356 "*/ int f1356() { // "/* 1356
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1357 "*/ int f1357() { // "/* 1357
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1358 "*/ int f1358() { // "/* 1358
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1359 "*/ int f1359() { // "/* 1359
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1360 "*/ int f1360() { // "/* 1360
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1361 "*/ int f1361() { // "/* 1361
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1362 "*/ int f1362() { // "/* 1362
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1363 "*/ int f1363() { // "/* 1363
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1364 "*/ int f1364() { // "/* 1364
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1365 "*/ int f1365() { // "/* 1365
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1366 "*/ int f1366() { // "/* 1366
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1367 "*/ int f1367() { // "/* 1367
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1368 "*/ int f1368() { // "/* 1368
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1369 "*/ int f1369() { // "/* 1369
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1370 "*/ int f1370() { // "/* 1370
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1371 "*/ int f1371() { // "/* 1371
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1372 "*/ int f1372() { // "/* 1372
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1373 "*/ int f1373() { // "/* 1373
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1374 "*/ int f1374() { // "/* 1374
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1375 "*/ int f1375() { // "/* 1375
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1376 "*/ int f1376() { // "/* 1376
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1377 "*/ int f1377() { // "/* 1377
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1378 "*/ int f1378() { // "/* 1378
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1379 "*/ int f1379() { // "/* 1379
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1380 "*/ int f1380() { // "/* 1380
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1381 "*/ int f1381() { // "/* 1381
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1382 "*/ int f1382() { // "/* 1382
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1383 "*/ int f1383() { // "/* 1383
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1384 "*/ int f1384() { // "/* 1384
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1385 "*/ int f1385() { // "/* 1385
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1386 "*/ int f1386() { // "/* 1386
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1387 "*/ int f1387() { // "/* 1387
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1388 "*/ int f1388() { // "/* 1388
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1389 "*/ int f1389() { // "/* 1389
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1390 "*/ int f1390() { // "/* 1390
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1391 "*/ int f1391() { // "/* 1391
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1392 "*/ int f1392() { // "/* 1392
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1393 "*/ int f1393() { // "/* 1393
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1394 "*/ int f1394() { // "/* 1394
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1395 "*/ int f1395() { // "/* 1395
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1396 "*/ int f1396() { // "/* 1396
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1397 "*/ int f1397() { // "/* 1397
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1398 "*/ int f1398() { // "/* 1398
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1399 "*/ int f1399() { // "/* 1399
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1400 "*/ int f1400() { // "/* 1400
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1401 "*/ int f1401() { // "/* 1401
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1402 "*/ int f1402() { // "/* 1402
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1403 "*/ int f1403() { // "/* 1403
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1404 "*/ int f1404() { // "/* 1404
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1405 "*/ int f1405() { // "/* 1405
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1406 "*/ int f1406() { // "/* 1406
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1407 "*/ int f1407() { // "/* 1407
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1408 "*/ int f1408() { // "/* 1408
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1409 "*/ int f1409() { // "/* 1409
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1410 "*/ int f1410() { // "/* 1410
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1411 "*/ int f1411() { // "/* 1411
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1412 "*/ int f1412() { // "/* 1412
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1413 "*/ int f1413() { // "/* 1413
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1414 "*/ int f1414() { // "/* 1414
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1415 "*/ int f1415() { // "/* 1415
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1416 "*/ int f1416() { // "/* 1416
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1417 "*/ int f1417() { // "/* 1417
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1418 "*/ int f1418() { // "/* 1418
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1419 "*/ int f1419() { // "/* 1419
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1420 "*/ int f1420() { // "/* 1420
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1421 "*/ int f1421() { // "/* 1421
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1422 "*/ int f1422() { // "/* 1422
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1423 "*/ int f1423() { // "/* 1423
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1424 "*/ int f1424() { // "/* 1424
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1425 "*/ int f1425() { // "/* 1425
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1426 "*/ int f1426() { // "/* 1426
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1427 "*/ int f1427() { // "/* 1427
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1428 "*/ int f1428() { // "/* 1428
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1429 "*/ int f1429() { // "/* 1429
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1430 "*/ int f1430() { // "/* 1430
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1431 "*/ int f1431() { // "/* 1431
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1432 "*/ int f1432() { // "/* 1432
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1433 "*/ int f1433() { // "/* 1433
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1434 "*/ int f1434() { // "/* 1434
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1435 "*/ int f1435() { // "/* 1435
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1436 "*/ int f1436() { // "/* 1436
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1437 "*/ int f1437() { // "/* 1437
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1438 "*/ int f1438() { // "/* 1438
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1439 "*/ int f1439() { // "/* 1439
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1440 "*/ int f1440() { // "/* 1440
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1441 "*/ int f1441() { // "/* 1441
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1442 "*/ int f1442() { // "/* 1442
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1443 "*/ int f1443() { // "/* 1443
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1444 "*/ int f1444() { // "/* 1444
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1445 "*/ int f1445() { // "/* 1445
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1446 "*/ int f1446() { // "/* 1446
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1447 "*/ int f1447() { // "/* 1447
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1448 "*/ int f1448() { // "/* 1448
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1449 "*/ int f1449() { // "/* 1449
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1450 "*/ int f1450() { // "/* 1450
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1451 "*/ int f1451() { // "/* 1451
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1452 "*/ int f1452() { // "/* 1452
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1453 "*/ int f1453() { // "/* 1453
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1454 "*/ int f1454() { // "/* 1454
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1455 "*/ int f1455() { // "/* 1455
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1456 "*/ int f1456() { // "/* 1456
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1457 "*/ int f1457() { // "/* 1457
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1458 "*/ int f1458() { // "/* 1458
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1459 "*/ int f1459() { // "/* 1459
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1460 "*/ int f1460() { // "/* 1460
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1461 "*/ int f1461() { // "/* 1461
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1462 "*/ int f1462() { // "/* 1462
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1463 "*/ int f1463() { // "/* 1463
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1464 "*/ int f1464() { // "/* 1464
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1465 "*/ int f1465() { // "/* 1465
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1466 "*/ int f1466() { // "/* 1466
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1467 "*/ int f1467() { // "/* 1467
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1468 "*/ int f1468() { // "/* 1468
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1469 "*/ int f1469() { // "/* 1469
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1470 "*/ int f1470() { // "/* 1470
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1471 "*/ int f1471() { // "/* 1471
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1472 "*/ int f1472() { // "/* 1472
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1473 "*/ int f1473() { // "/* 1473
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1474 "*/ int f1474() { // "/* 1474
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1475 "*/ int f1475() { // "/* 1475
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1476 "*/ int f1476() { // "/* 1476
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1477 "*/ int f1477() { // "/* 1477
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1478 "*/ int f1478() { // "/* 1478
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1479 "*/ int f1479() { // "/* 1479
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1480 "*/ int f1480() { // "/* 1480
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1481 "*/ int f1481() { // "/* 1481
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1482 "*/ int f1482() { // "/* 1482
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1483 "*/ int f1483() { // "/* 1483
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1484 "*/ int f1484() { // "/* 1484
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1485 "*/ int f1485() { // "/* 1485
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1486 "*/ int f1486() { // "/* 1486
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1487 "*/ int f1487() { // "/* 1487
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1488 "*/ int f1488() { // "/* 1488
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1489 "*/ int f1489() { // "/* 1489
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1490 "*/ int f1490() { // "/* 1490
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1491 "*/ int f1491() { // "/* 1491
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1492 "*/ int f1492() { // "/* 1492
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1493 "*/ int f1493() { // "/* 1493
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1494 "*/ int f1494() { // "/* 1494
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1495 "*/ int f1495() { // "/* 1495
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1496 "*/ int f1496() { // "/* 1496
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1497 "*/ int f1497() { // "/* 1497
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1498 "*/ int f1498() { // "/* 1498
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1499 "*/ int f1499() { // "/* 1499
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1500 "*/ int f1500() { // "/* 1500
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1501 "*/ int f1501() { // "/* 1501
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1502 "*/ int f1502() { // "/* 1502
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1503 "*/ int f1503() { // "/* 1503
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1504 "*/ int f1504() { // "/* 1504
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1505 "*/ int f1505() { // "/* 1505
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1506 "*/ int f1506() { // "/* 1506
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1507 "*/ int f1507() { // "/* 1507
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1508 "*/ int f1508() { // "/* 1508
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1509 "*/ int f1509() { // "/* 1509
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1510 "*/ int f1510() { // "/* 1510
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1511 "*/ int f1511() { // "/* 1511
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1512 "*/ int f1512() { // "/* 1512
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1513 "*/ int f1513() { // "/* 1513
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1514 "*/ int f1514() { // "/* 1514
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1515 "*/ int f1515() { // "/* 1515
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1516 "*/ int f1516() { // "/* 1516
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1517 "*/ int f1517() { // "/* 1517
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1518 "*/ int f1518() { // "/* 1518
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1519 "*/ int f1519() { // "/* 1519
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1520 "*/ int f1520() { // "/* 1520
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1521 "*/ int f1521() { // "/* 1521
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1522 "*/ int f1522() { // "/* 1522
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1523 "*/ int f1523() { // "/* 1523
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1524 "*/ int f1524() { // "/* 1524
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1525 "*/ int f1525() { // "/* 1525
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1526 "*/ int f1526() { // "/* 1526
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1527 "*/ int f1527() { // "/* 1527
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1528 "*/ int f1528() { // "/* 1528
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1529 "*/ int f1529() { // "/* 1529
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1530 "*/ int f1530() { // "/* 1530
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1531 "*/ int f1531() { // "/* 1531
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1532 "*/ int f1532() { // "/* 1532
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1533 "*/ int f1533() { // "/* 1533
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1534 "*/ int f1534() { // "/* 1534
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1535 "*/ int f1535() { // "/* 1535
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1536 "*/ int f1536() { // "/* 1536
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1537 "*/ int f1537() { // "/* 1537
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1538 "*/ int f1538() { // "/* 1538
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1539 "*/ int f1539() { // "/* 1539
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1540 "*/ int f1540() { // "/* 1540
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1541 "*/ int f1541() { // "/* 1541
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1542 "*/ int f1542() { // "/* 1542
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1543 "*/ int f1543() { // "/* 1543
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1544 "*/ int f1544() { // "/* 1544
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1545 "*/ int f1545() { // "/* 1545
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1546 "*/ int f1546() { // "/* 1546
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1547 "*/ int f1547() { // "/* 1547
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1548 "*/ int f1548() { // "/* 1548
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1549 "*/ int f1549() { // "/* 1549
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1550 "*/ int f1550() { // "/* 1550
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1551 "*/ int f1551() { // "/* 1551
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1552 "*/ int f1552() { // "/* 1552
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1553 "*/ int f1553() { // "/* 1553
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1554 "*/ int f1554() { // "/* 1554
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1555 "*/ int f1555() { // "/* 1555
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1556 "*/ int f1556() { // "/* 1556
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1557 "*/ int f1557() { // "/* 1557
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1558 "*/ int f1558() { // "/* 1558
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1559 "*/ int f1559() { // "/* 1559
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1560 "*/ int f1560() { // "/* 1560
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1561 "*/ int f1561() { // "/* 1561
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1562 "*/ int f1562() { // "/* 1562
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1563 "*/ int f1563() { // "/* 1563
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1564 "*/ int f1564() { // "/* 1564
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1565 "*/ int f1565() { // "/* 1565
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1566 "*/ int f1566() { // "/* 1566
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1567 "*/ int f1567() { // "/* 1567
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1568 "*/ int f1568() { // "/* 1568
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1569 "*/ int f1569() { // "/* 1569
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1570 "*/ int f1570() { // "/* 1570
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1571 "*/ int f1571() { // "/* 1571
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1572 "*/ int f1572() { // "/* 1572
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1573 "*/ int f1573() { // "/* 1573
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1574 "*/ int f1574() { // "/* 1574
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1575 "*/ int f1575() { // "/* 1575
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1576 "*/ int f1576() { // "/* 1576
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1577 "*/ int f1577() { // "/* 1577
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1578 "*/ int f1578() { // "/* 1578
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1579 "*/ int f1579() { // "/* 1579
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1580 "*/ int f1580() { // "/* 1580
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1581 "*/ int f1581() { // "/* 1581
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1582 "*/ int f1582() { // "/* 1582
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1583 "*/ int f1583() { // "/* 1583
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1584 "*/ int f1584() { // "/* 1584
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1585 "*/ int f1585() { // "/* 1585
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1586 "*/ int f1586() { // "/* 1586
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1587 "*/ int f1587() { // "/* 1587
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1588 "*/ int f1588() { // "/* 1588
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1589 "*/ int f1589() { // "/* 1589
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1590 "*/ int f1590() { // "/* 1590
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1591 "*/ int f1591() { // "/* 1591
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1592 "*/ int f1592() { // "/* 1592
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1593 "*/ int f1593() { // "/* 1593
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1594 "*/ int f1594() { // "/* 1594
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1595 "*/ int f1595() { // "/* 1595
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1596 "*/ int f1596() { // "/* 1596
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1597 "*/ int f1597() { // "/* 1597
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1598 "*/ int f1598() { // "/* 1598
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1599 "*/ int f1599() { // "/* 1599
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1600 "*/ int f1600() { // "/* 1600
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1601 "*/ int f1601() { // "/* 1601
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1602 "*/ int f1602() { // "/* 1602
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1603 "*/ int f1603() { // "/* 1603
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1604 "*/ int f1604() { // "/* 1604
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1605 "*/ int f1605() { // "/* 1605
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1606 "*/ int f1606() { // "/* 1606
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1607 "*/ int f1607() { // "/* 1607
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1608 "*/ int f1608() { // "/* 1608
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1609 "*/ int f1609() { // "/* 1609
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1610 "*/ int f1610() { // "/* 1610
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1611 "*/ int f1611() { // "/* 1611
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1612 "*/ int f1612() { // "/* 1612
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1613 "*/ int f1613() { // "/* 1613
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1614 "*/ int f1614() { // "/* 1614
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1615 "*/ int f1615() { // "/* 1615
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1616 "*/ int f1616() { // "/* 1616
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1617 "*/ int f1617() { // "/* 1617
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1618 "*/ int f1618() { // "/* 1618
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1619 "*/ int f1619() { // "/* 1619
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1620 "*/ int f1620() { // "/* 1620
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1621 "*/ int f1621() { // "/* 1621
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1622 "*/ int f1622() { // "/* 1622
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1623 "*/ int f1623() { // "/* 1623
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1624 "*/ int f1624() { // "/* 1624
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1625 "*/ int f1625() { // "/* 1625
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1626 "*/ int f1626() { // "/* 1626
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1627 "*/ int f1627() { // "/* 1627
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1628 "*/ int f1628() { // "/* 1628
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1629 "*/ int f1629() { // "/* 1629
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1630 "*/ int f1630() { // "/* 1630
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1631 "*/ int f1631() { // "/* 1631
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1632 "*/ int f1632() { // "/* 1632
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1633 "*/ int f1633() { // "/* 1633
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1634 "*/ int f1634() { // "/* 1634
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1635 "*/ int f1635() { // "/* 1635
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1636 "*/ int f1636() { // "/* 1636
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1637 "*/ int f1637() { // "/* 1637
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1638 "*/ int f1638() { // "/* 1638
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1639 "*/ int f1639() { // "/* 1639
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1640 "*/ int f1640() { // "/* 1640
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1641 "*/ int f1641() { // "/* 1641
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1642 "*/ int f1642() { // "/* 1642
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1643 "*/ int f1643() { // "/* 1643
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1644 "*/ int f1644() { // "/* 1644
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1645 "*/ int f1645() { // "/* 1645
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1646 "*/ int f1646() { // "/* 1646
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1647 "*/ int f1647() { // "/* 1647
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1648 "*/ int f1648() { // "/* 1648
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1649 "*/ int f1649() { // "/* 1649
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1650 "*/ int f1650() { // "/* 1650
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1651 "*/ int f1651() { // "/* 1651
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1652 "*/ int f1652() { // "/* 1652
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1653 "*/ int f1653() { // "/* 1653
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1654 "*/ int f1654() { // "/* 1654
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1655 "*/ int f1655() { // "/* 1655
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1656 "*/ int f1656() { // "/* 1656
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1657 "*/ int f1657() { // "/* 1657
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1658 "*/ int f1658() { // "/* 1658
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1659 "*/ int f1659() { // "/* 1659
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1660 "*/ int f1660() { // "/* 1660
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1661 "*/ int f1661() { // "/* 1661
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1662 "*/ int f1662() { // "/* 1662
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1663 "*/ int f1663() { // "/* 1663
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1664 "*/ int f1664() { // "/* 1664
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1665 "*/ int f1665() { // "/* 1665
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1666 "*/ int f1666() { // "/* 1666
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1667 "*/ int f1667() { // "/* 1667
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1668 "*/ int f1668() { // "/* 1668
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1669 "*/ int f1669() { // "/* 1669
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1670 "*/ int f1670() { // "/* 1670
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1671 "*/ int f1671() { // "/* 1671
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1672 "*/ int f1672() { // "/* 1672
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1673 "*/ int f1673() { // "/* 1673
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1674 "*/ int f1674() { // "/* 1674
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1675 "*/ int f1675() { // "/* 1675
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1676 "*/ int f1676() { // "/* 1676
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1677 "*/ int f1677() { // "/* 1677
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1678 "*/ int f1678() { // "/* 1678
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1679 "*/ int f1679() { // "/* 1679
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1680 "*/ int f1680() { // "/* 1680
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1681 "*/ int f1681() { // "/* 1681
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1682 "*/ int f1682() { // "/* 1682
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1683 "*/ int f1683() { // "/* 1683
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1684 "*/ int f1684() { // "/* 1684
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1685 "*/ int f1685() { // "/* 1685
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1686 "*/ int f1686() { // "/* 1686
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1687 "*/ int f1687() { // "/* 1687
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1688 "*/ int f1688() { // "/* 1688
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1689 "*/ int f1689() { // "/* 1689
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1690 "*/ int f1690() { // "/* 1690
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1691 "*/ int f1691() { // "/* 1691
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1692 "*/ int f1692() { // "/* 1692
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1693 "*/ int f1693() { // "/* 1693
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1694 "*/ int f1694() { // "/* 1694
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1695 "*/ int f1695() { // "/* 1695
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1696 "*/ int f1696() { // "/* 1696
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1697 "*/ int f1697() { // "/* 1697
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1698 "*/ int f1698() { // "/* 1698
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1699 "*/ int f1699() { // "/* 1699
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1700 "*/ int f1700() { // "/* 1700
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1701 "*/ int f1701() { // "/* 1701
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1702 "*/ int f1702() { // "/* 1702
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1703 "*/ int f1703() { // "/* 1703
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1704 "*/ int f1704() { // "/* 1704
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1705 "*/ int f1705() { // "/* 1705
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1706 "*/ int f1706() { // "/* 1706
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1707 "*/ int f1707() { // "/* 1707
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1708 "*/ int f1708() { // "/* 1708
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1709 "*/ int f1709() { // "/* 1709
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1710 "*/ int f1710() { // "/* 1710
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1711 "*/ int f1711() { // "/* 1711
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1712 "*/ int f1712() { // "/* 1712
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1713 "*/ int f1713() { // "/* 1713
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1714 "*/ int f1714() { // "/* 1714
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1715 "*/ int f1715() { // "/* 1715
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1716 "*/ int f1716() { // "/* 1716
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1717 "*/ int f1717() { // "/* 1717
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1718 "*/ int f1718() { // "/* 1718
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1719 "*/ int f1719() { // "/* 1719
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1720 "*/ int f1720() { // "/* 1720
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1721 "*/ int f1721() { // "/* 1721
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1722 "*/ int f1722() { // "/* 1722
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1723 "*/ int f1723() { // "/* 1723
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1724 "*/ int f1724() { // "/* 1724
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1725 "*/ int f1725() { // "/* 1725
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1726 "*/ int f1726() { // "/* 1726
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1727 "*/ int f1727() { // "/* 1727
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1728 "*/ int f1728() { // "/* 1728
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1729 "*/ int f1729() { // "/* 1729
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1730 "*/ int f1730() { // "/* 1730
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1731 "*/ int f1731() { // "/* 1731
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1732 "*/ int f1732() { // "/* 1732
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1733 "*/ int f1733() { // "/* 1733
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1734 "*/ int f1734() { // "/* 1734
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1735 "*/ int f1735() { // "/* 1735
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1736 "*/ int f1736() { // "/* 1736
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1737 "*/ int f1737() { // "/* 1737
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1738 "*/ int f1738() { // "/* 1738
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1739 "*/ int f1739() { // "/* 1739
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1740 "*/ int f1740() { // "/* 1740
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1741 "*/ int f1741() { // "/* 1741
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1742 "*/ int f1742() { // "/* 1742
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1743 "*/ int f1743() { // "/* 1743
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1744 "*/ int f1744() { // "/* 1744
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1745 "*/ int f1745() { // "/* 1745
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1746 "*/ int f1746() { // "/* 1746
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1747 "*/ int f1747() { // "/* 1747
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1748 "*/ int f1748() { // "/* 1748
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1749 "*/ int f1749() { // "/* 1749
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1750 "*/ int f1750() { // "/* 1750
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1751 "*/ int f1751() { // "/* 1751
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1752 "*/ int f1752() { // "/* 1752
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1753 "*/ int f1753() { // "/* 1753
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1754 "*/ int f1754() { // "/* 1754
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1755 "*/ int f1755() { // "/* 1755
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1756 "*/ int f1756() { // "/* 1756
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1757 "*/ int f1757() { // "/* 1757
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1758 "*/ int f1758() { // "/* 1758
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1759 "*/ int f1759() { // "/* 1759
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1760 "*/ int f1760() { // "/* 1760
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1761 "*/ int f1761() { // "/* 1761
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1762 "*/ int f1762() { // "/* 1762
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1763 "*/ int f1763() { // "/* 1763
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1764 "*/ int f1764() { // "/* 1764
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1765 "*/ int f1765() { // "/* 1765
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1766 "*/ int f1766() { // "/* 1766
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1767 "*/ int f1767() { // "/* 1767
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1768 "*/ int f1768() { // "/* 1768
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1769 "*/ int f1769() { // "/* 1769
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1770 "*/ int f1770() { // "/* 1770
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1771 "*/ int f1771() { // "/* 1771
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1772 "*/ int f1772() { // "/* 1772
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1773 "*/ int f1773() { // "/* 1773
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1774 "*/ int f1774() { // "/* 1774
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1775 "*/ int f1775() { // "/* 1775
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1776 "*/ int f1776() { // "/* 1776
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1777 "*/ int f1777() { // "/* 1777
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1778 "*/ int f1778() { // "/* 1778
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1779 "*/ int f1779() { // "/* 1779
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1780 "*/ int f1780() { // "/* 1780
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1781 "*/ int f1781() { // "/* 1781
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1782 "*/ int f1782() { // "/* 1782
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1783 "*/ int f1783() { // "/* 1783
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1784 "*/ int f1784() { // "/* 1784
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1785 "*/ int f1785() { // "/* 1785
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1786 "*/ int f1786() { // "/* 1786
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1787 "*/ int f1787() { // "/* 1787
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1788 "*/ int f1788() { // "/* 1788
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1789 "*/ int f1789() { // "/* 1789
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1790 "*/ int f1790() { // "/* 1790
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1791 "*/ int f1791() { // "/* 1791
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1792 "*/ int f1792() { // "/* 1792
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1793 "*/ int f1793() { // "/* 1793
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1794 "*/ int f1794() { // "/* 1794
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1795 "*/ int f1795() { // "/* 1795
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1796 "*/ int f1796() { // "/* 1796
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1797 "*/ int f1797() { // "/* 1797
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1798 "*/ int f1798() { // "/* 1798
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1799 "*/ int f1799() { // "/* 1799
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1800 "*/ int f1800() { // "/* 1800
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1801 "*/ int f1801() { // "/* 1801
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1802 "*/ int f1802() { // "/* 1802
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1803 "*/ int f1803() { // "/* 1803
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1804 "*/ int f1804() { // "/* 1804
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1805 "*/ int f1805() { // "/* 1805
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1806 "*/ int f1806() { // "/* 1806
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1807 "*/ int f1807() { // "/* 1807
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1808 "*/ int f1808() { // "/* 1808
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1809 "*/ int f1809() { // "/* 1809
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1810 "*/ int f1810() { // "/* 1810
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1811 "*/ int f1811() { // "/* 1811
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1812 "*/ int f1812() { // "/* 1812
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1813 "*/ int f1813() { // "/* 1813
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1814 "*/ int f1814() { // "/* 1814
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1815 "*/ int f1815() { // "/* 1815
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1816 "*/ int f1816() { // "/* 1816
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1817 "*/ int f1817() { // "/* 1817
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1818 "*/ int f1818() { // "/* 1818
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1819 "*/ int f1819() { // "/* 1819
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1820 "*/ int f1820() { // "/* 1820
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1821 "*/ int f1821() { // "/* 1821
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1822 "*/ int f1822() { // "/* 1822
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1823 "*/ int f1823() { // "/* 1823
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1824 "*/ int f1824() { // "/* 1824
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1825 "*/ int f1825() { // "/* 1825
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1826 "*/ int f1826() { // "/* 1826
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1827 "*/ int f1827() { // "/* 1827
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1828 "*/ int f1828() { // "/* 1828
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1829 "*/ int f1829() { // "/* 1829
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1830 "*/ int f1830() { // "/* 1830
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1831 "*/ int f1831() { // "/* 1831
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1832 "*/ int f1832() { // "/* 1832
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1833 "*/ int f1833() { // "/* 1833
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1834 "*/ int f1834() { // "/* 1834
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1835 "*/ int f1835() { // "/* 1835
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1836 "*/ int f1836() { // "/* 1836
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1837 "*/ int f1837() { // "/* 1837
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1838 "*/ int f1838() { // "/* 1838
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1839 "*/ int f1839() { // "/* 1839
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1840 "*/ int f1840() { // "/* 1840
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1841 "*/ int f1841() { // "/* 1841
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1842 "*/ int f1842() { // "/* 1842
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1843 "*/ int f1843() { // "/* 1843
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1844 "*/ int f1844() { // "/* 1844
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1845 "*/ int f1845() { // "/* 1845
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1846 "*/ int f1846() { // "/* 1846
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1847 "*/ int f1847() { // "/* 1847
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1848 "*/ int f1848() { // "/* 1848
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1849 "*/ int f1849() { // "/* 1849
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1850 "*/ int f1850() { // "/* 1850
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1851 "*/ int f1851() { // "/* 1851
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1852 "*/ int f1852() { // "/* 1852
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1853 "*/ int f1853() { // "/* 1853
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1854 "*/ int f1854() { // "/* 1854
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1855 "*/ int f1855() { // "/* 1855
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1856 "*/ int f1856() { // "/* 1856
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1857 "*/ int f1857() { // "/* 1857
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1858 "*/ int f1858() { // "/* 1858
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1859 "*/ int f1859() { // "/* 1859
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1860 "*/ int f1860() { // "/* 1860
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1861 "*/ int f1861() { // "/* 1861
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1862 "*/ int f1862() { // "/* 1862
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1863 "*/ int f1863() { // "/* 1863
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1864 "*/ int f1864() { // "/* 1864
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1865 "*/ int f1865() { // "/* 1865
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1866 "*/ int f1866() { // "/* 1866
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1867 "*/ int f1867() { // "/* 1867
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1868 "*/ int f1868() { // "/* 1868
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1869 "*/ int f1869() { // "/* 1869
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1870 "*/ int f1870() { // "/* 1870
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1871 "*/ int f1871() { // "/* 1871
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1872 "*/ int f1872() { // "/* 1872
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1873 "*/ int f1873() { // "/* 1873
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1874 "*/ int f1874() { // "/* 1874
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1875 "*/ int f1875() { // "/* 1875
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1876 "*/ int f1876() { // "/* 1876
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1877 "*/ int f1877() { // "/* 1877
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1878 "*/ int f1878() { // "/* 1878
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1879 "*/ int f1879() { // "/* 1879
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1880 "*/ int f1880() { // "/* 1880
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1881 "*/ int f1881() { // "/* 1881
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1882 "*/ int f1882() { // "/* 1882
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1883 "*/ int f1883() { // "/* 1883
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1884 "*/ int f1884() { // "/* 1884
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1885 "*/ int f1885() { // "/* 1885
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1886 "*/ int f1886() { // "/* 1886
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1887 "*/ int f1887() { // "/* 1887
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1888 "*/ int f1888() { // "/* 1888
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1889 "*/ int f1889() { // "/* 1889
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1890 "*/ int f1890() { // "/* 1890
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1891 "*/ int f1891() { // "/* 1891
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1892 "*/ int f1892() { // "/* 1892
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1893 "*/ int f1893() { // "/* 1893
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1894 "*/ int f1894() { // "/* 1894
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1895 "*/ int f1895() { // "/* 1895
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1896 "*/ int f1896() { // "/* 1896
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1897 "*/ int f1897() { // "/* 1897
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1898 "*/ int f1898() { // "/* 1898
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1899 "*/ int f1899() { // "/* 1899
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1900 "*/ int f1900() { // "/* 1900
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1901 "*/ int f1901() { // "/* 1901
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1902 "*/ int f1902() { // "/* 1902
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1903 "*/ int f1903() { // "/* 1903
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1904 "*/ int f1904() { // "/* 1904
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1905 "*/ int f1905() { // "/* 1905
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1906 "*/ int f1906() { // "/* 1906
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1907 "*/ int f1907() { // "/* 1907
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1908 "*/ int f1908() { // "/* 1908
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1909 "*/ int f1909() { // "/* 1909
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1910 "*/ int f1910() { // "/* 1910
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1911 "*/ int f1911() { // "/* 1911
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1912 "*/ int f1912() { // "/* 1912
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1913 "*/ int f1913() { // "/* 1913
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1914 "*/ int f1914() { // "/* 1914
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1915 "*/ int f1915() { // "/* 1915
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1916 "*/ int f1916() { // "/* 1916
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1917 "*/ int f1917() { // "/* 1917
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1918 "*/ int f1918() { // "/* 1918
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1919 "*/ int f1919() { // "/* 1919
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1920 "*/ int f1920() { // "/* 1920
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1921 "*/ int f1921() { // "/* 1921
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1922 "*/ int f1922() { // "/* 1922
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1923 "*/ int f1923() { // "/* 1923
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1924 "*/ int f1924() { // "/* 1924
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1925 "*/ int f1925() { // "/* 1925
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1926 "*/ int f1926() { // "/* 1926
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1927 "*/ int f1927() { // "/* 1927
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1928 "*/ int f1928() { // "/* 1928
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1929 "*/ int f1929() { // "/* 1929
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1930 "*/ int f1930() { // "/* 1930
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1931 "*/ int f1931() { // "/* 1931
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1932 "*/ int f1932() { // "/* 1932
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1933 "*/ int f1933() { // "/* 1933
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1934 "*/ int f1934() { // "/* 1934
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1935 "*/ int f1935() { // "/* 1935
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1936 "*/ int f1936() { // "/* 1936
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1937 "*/ int f1937() { // "/* 1937
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1938 "*/ int f1938() { // "/* 1938
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1939 "*/ int f1939() { // "/* 1939
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1940 "*/ int f1940() { // "/* 1940
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1941 "*/ int f1941() { // "/* 1941
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1942 "*/ int f1942() { // "/* 1942
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1943 "*/ int f1943() { // "/* 1943
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1944 "*/ int f1944() { // "/* 1944
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1945 "*/ int f1945() { // "/* 1945
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1946 "*/ int f1946() { // "/* 1946
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1947 "*/ int f1947() { // "/* 1947
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1948 "*/ int f1948() { // "/* 1948
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1949 "*/ int f1949() { // "/* 1949
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1950 "*/ int f1950() { // "/* 1950
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1951 "*/ int f1951() { // "/* 1951
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1952 "*/ int f1952() { // "/* 1952
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1953 "*/ int f1953() { // "/* 1953
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1954 "*/ int f1954() { // "/* 1954
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1955 "*/ int f1955() { // "/* 1955
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1956 "*/ int f1956() { // "/* 1956
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1957 "*/ int f1957() { // "/* 1957
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1958 "*/ int f1958() { // "/* 1958
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1959 "*/ int f1959() { // "/* 1959
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1960 "*/ int f1960() { // "/* 1960
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1961 "*/ int f1961() { // "/* 1961
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1962 "*/ int f1962() { // "/* 1962
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1963 "*/ int f1963() { // "/* 1963
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1964 "*/ int f1964() { // "/* 1964
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1965 "*/ int f1965() { // "/* 1965
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1966 "*/ int f1966() { // "/* 1966
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1967 "*/ int f1967() { // "/* 1967
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1968 "*/ int f1968() { // "/* 1968
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1969 "*/ int f1969() { // "/* 1969
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1970 "*/ int f1970() { // "/* 1970
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1971 "*/ int f1971() { // "/* 1971
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1972 "*/ int f1972() { // "/* 1972
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1973 "*/ int f1973() { // "/* 1973
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1974 "*/ int f1974() { // "/* 1974
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1975 "*/ int f1975() { // "/* 1975
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1976 "*/ int f1976() { // "/* 1976
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1977 "*/ int f1977() { // "/* 1977
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1978 "*/ int f1978() { // "/* 1978
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1979 "*/ int f1979() { // "/* 1979
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1980 "*/ int f1980() { // "/* 1980
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1981 "*/ int f1981() { // "/* 1981
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1982 "*/ int f1982() { // "/* 1982
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1983 "*/ int f1983() { // "/* 1983
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1984 "*/ int f1984() { // "/* 1984
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1985 "*/ int f1985() { // "/* 1985
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1986 "*/ int f1986() { // "/* 1986
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1987 "*/ int f1987() { // "/* 1987
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1988 "*/ int f1988() { // "/* 1988
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1989 "*/ int f1989() { // "/* 1989
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1990 "*/ int f1990() { // "/* 1990
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1991 "*/ int f1991() { // "/* 1991
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1992 "*/ int f1992() { // "/* 1992
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1993 "*/ int f1993() { // "/* 1993
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1994 "*/ int f1994() { // "/* 1994
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1995 "*/ int f1995() { // "/* 1995
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1996 "*/ int f1996() { // "/* 1996
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1997 "*/ int f1997() { // "/* 1997
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1998 "*/ int f1998() { // "/* 1998
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 1999 "*/ int f1999() { // "/* 1999
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2000 "*/ int f2000() { // "/* 2000
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2001 "*/ int f2001() { // "/* 2001
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2002 "*/ int f2002() { // "/* 2002
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2003 "*/ int f2003() { // "/* 2003
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2004 "*/ int f2004() { // "/* 2004
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2005 "*/ int f2005() { // "/* 2005
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2006 "*/ int f2006() { // "/* 2006
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2007 "*/ int f2007() { // "/* 2007
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2008 "*/ int f2008() { // "/* 2008
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2009 "*/ int f2009() { // "/* 2009
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2010 "*/ int f2010() { // "/* 2010
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2011 "*/ int f2011() { // "/* 2011
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2012 "*/ int f2012() { // "/* 2012
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2013 "*/ int f2013() { // "/* 2013
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2014 "*/ int f2014() { // "/* 2014
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2015 "*/ int f2015() { // "/* 2015
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2016 "*/ int f2016() { // "/* 2016
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2017 "*/ int f2017() { // "/* 2017
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2018 "*/ int f2018() { // "/* 2018
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2019 "*/ int f2019() { // "/* 2019
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2020 "*/ int f2020() { // "/* 2020
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2021 "*/ int f2021() { // "/* 2021
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2022 "*/ int f2022() { // "/* 2022
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2023 "*/ int f2023() { // "/* 2023
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2024 "*/ int f2024() { // "/* 2024
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2025 "*/ int f2025() { // "/* 2025
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2026 "*/ int f2026() { // "/* 2026
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2027 "*/ int f2027() { // "/* 2027
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2028 "*/ int f2028() { // "/* 2028
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2029 "*/ int f2029() { // "/* 2029
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2030 "*/ int f2030() { // "/* 2030
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2031 "*/ int f2031() { // "/* 2031
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2032 "*/ int f2032() { // "/* 2032
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2033 "*/ int f2033() { // "/* 2033
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2034 "*/ int f2034() { // "/* 2034
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2035 "*/ int f2035() { // "/* 2035
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2036 "*/ int f2036() { // "/* 2036
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2037 "*/ int f2037() { // "/* 2037
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2038 "*/ int f2038() { // "/* 2038
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2039 "*/ int f2039() { // "/* 2039
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2040 "*/ int f2040() { // "/* 2040
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2041 "*/ int f2041() { // "/* 2041
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2042 "*/ int f2042() { // "/* 2042
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2043 "*/ int f2043() { // "/* 2043
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2044 "*/ int f2044() { // "/* 2044
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2045 "*/ int f2045() { // "/* 2045
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2046 "*/ int f2046() { // "/* 2046
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2047 "*/ int f2047() { // "/* 2047
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2048 "*/ int f2048() { // "/* 2048
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2049 "*/ int f2049() { // "/* 2049
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2050 "*/ int f2050() { // "/* 2050
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2051 "*/ int f2051() { // "/* 2051
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2052 "*/ int f2052() { // "/* 2052
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2053 "*/ int f2053() { // "/* 2053
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2054 "*/ int f2054() { // "/* 2054
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2055 "*/ int f2055() { // "/* 2055
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2056 "*/ int f2056() { // "/* 2056
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2057 "*/ int f2057() { // "/* 2057
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2058 "*/ int f2058() { // "/* 2058
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2059 "*/ int f2059() { // "/* 2059
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2060 "*/ int f2060() { // "/* 2060
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2061 "*/ int f2061() { // "/* 2061
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2062 "*/ int f2062() { // "/* 2062
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2063 "*/ int f2063() { // "/* 2063
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2064 "*/ int f2064() { // "/* 2064
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2065 "*/ int f2065() { // "/* 2065
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2066 "*/ int f2066() { // "/* 2066
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2067 "*/ int f2067() { // "/* 2067
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2068 "*/ int f2068() { // "/* 2068
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2069 "*/ int f2069() { // "/* 2069
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2070 "*/ int f2070() { // "/* 2070
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2071 "*/ int f2071() { // "/* 2071
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2072 "*/ int f2072() { // "/* 2072
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2073 "*/ int f2073() { // "/* 2073
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2074 "*/ int f2074() { // "/* 2074
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2075 "*/ int f2075() { // "/* 2075
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2076 "*/ int f2076() { // "/* 2076
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2077 "*/ int f2077() { // "/* 2077
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2078 "*/ int f2078() { // "/* 2078
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2079 "*/ int f2079() { // "/* 2079
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2080 "*/ int f2080() { // "/* 2080
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2081 "*/ int f2081() { // "/* 2081
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2082 "*/ int f2082() { // "/* 2082
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2083 "*/ int f2083() { // "/* 2083
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2084 "*/ int f2084() { // "/* 2084
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2085 "*/ int f2085() { // "/* 2085
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2086 "*/ int f2086() { // "/* 2086
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2087 "*/ int f2087() { // "/* 2087
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2088 "*/ int f2088() { // "/* 2088
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2089 "*/ int f2089() { // "/* 2089
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2090 "*/ int f2090() { // "/* 2090
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2091 "*/ int f2091() { // "/* 2091
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2092 "*/ int f2092() { // "/* 2092
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2093 "*/ int f2093() { // "/* 2093
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2094 "*/ int f2094() { // "/* 2094
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2095 "*/ int f2095() { // "/* 2095
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2096 "*/ int f2096() { // "/* 2096
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2097 "*/ int f2097() { // "/* 2097
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2098 "*/ int f2098() { // "/* 2098
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2099 "*/ int f2099() { // "/* 2099
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2100 "*/ int f2100() { // "/* 2100
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2101 "*/ int f2101() { // "/* 2101
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2102 "*/ int f2102() { // "/* 2102
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2103 "*/ int f2103() { // "/* 2103
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2104 "*/ int f2104() { // "/* 2104
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2105 "*/ int f2105() { // "/* 2105
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2106 "*/ int f2106() { // "/* 2106
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2107 "*/ int f2107() { // "/* 2107
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2108 "*/ int f2108() { // "/* 2108
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2109 "*/ int f2109() { // "/* 2109
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2110 "*/ int f2110() { // "/* 2110
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2111 "*/ int f2111() { // "/* 2111
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2112 "*/ int f2112() { // "/* 2112
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2113 "*/ int f2113() { // "/* 2113
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2114 "*/ int f2114() { // "/* 2114
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2115 "*/ int f2115() { // "/* 2115
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2116 "*/ int f2116() { // "/* 2116
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2117 "*/ int f2117() { // "/* 2117
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2118 "*/ int f2118() { // "/* 2118
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2119 "*/ int f2119() { // "/* 2119
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2120 "*/ int f2120() { // "/* 2120
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2121 "*/ int f2121() { // "/* 2121
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2122 "*/ int f2122() { // "/* 2122
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2123 "*/ int f2123() { // "/* 2123
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2124 "*/ int f2124() { // "/* 2124
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2125 "*/ int f2125() { // "/* 2125
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2126 "*/ int f2126() { // "/* 2126
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2127 "*/ int f2127() { // "/* 2127
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2128 "*/ int f2128() { // "/* 2128
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2129 "*/ int f2129() { // "/* 2129
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2130 "*/ int f2130() { // "/* 2130
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2131 "*/ int f2131() { // "/* 2131
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2132 "*/ int f2132() { // "/* 2132
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2133 "*/ int f2133() { // "/* 2133
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2134 "*/ int f2134() { // "/* 2134
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2135 "*/ int f2135() { // "/* 2135
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2136 "*/ int f2136() { // "/* 2136
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2137 "*/ int f2137() { // "/* 2137
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2138 "*/ int f2138() { // "/* 2138
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2139 "*/ int f2139() { // "/* 2139
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2140 "*/ int f2140() { // "/* 2140
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2141 "*/ int f2141() { // "/* 2141
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2142 "*/ int f2142() { // "/* 2142
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2143 "*/ int f2143() { // "/* 2143
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2144 "*/ int f2144() { // "/* 2144
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2145 "*/ int f2145() { // "/* 2145
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2146 "*/ int f2146() { // "/* 2146
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2147 "*/ int f2147() { // "/* 2147
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2148 "*/ int f2148() { // "/* 2148
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2149 "*/ int f2149() { // "/* 2149
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2150 "*/ int f2150() { // "/* 2150
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2151 "*/ int f2151() { // "/* 2151
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2152 "*/ int f2152() { // "/* 2152
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2153 "*/ int f2153() { // "/* 2153
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2154 "*/ int f2154() { // "/* 2154
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2155 "*/ int f2155() { // "/* 2155
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2156 "*/ int f2156() { // "/* 2156
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2157 "*/ int f2157() { // "/* 2157
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2158 "*/ int f2158() { // "/* 2158
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2159 "*/ int f2159() { // "/* 2159
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2160 "*/ int f2160() { // "/* 2160
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2161 "*/ int f2161() { // "/* 2161
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2162 "*/ int f2162() { // "/* 2162
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2163 "*/ int f2163() { // "/* 2163
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2164 "*/ int f2164() { // "/* 2164
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2165 "*/ int f2165() { // "/* 2165
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2166 "*/ int f2166() { // "/* 2166
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2167 "*/ int f2167() { // "/* 2167
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2168 "*/ int f2168() { // "/* 2168
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2169 "*/ int f2169() { // "/* 2169
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2170 "*/ int f2170() { // "/* 2170
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2171 "*/ int f2171() { // "/* 2171
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2172 "*/ int f2172() { // "/* 2172
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2173 "*/ int f2173() { // "/* 2173
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2174 "*/ int f2174() { // "/* 2174
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2175 "*/ int f2175() { // "/* 2175
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2176 "*/ int f2176() { // "/* 2176
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2177 "*/ int f2177() { // "/* 2177
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2178 "*/ int f2178() { // "/* 2178
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2179 "*/ int f2179() { // "/* 2179
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2180 "*/ int f2180() { // "/* 2180
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2181 "*/ int f2181() { // "/* 2181
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2182 "*/ int f2182() { // "/* 2182
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2183 "*/ int f2183() { // "/* 2183
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2184 "*/ int f2184() { // "/* 2184
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2185 "*/ int f2185() { // "/* 2185
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2186 "*/ int f2186() { // "/* 2186
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2187 "*/ int f2187() { // "/* 2187
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2188 "*/ int f2188() { // "/* 2188
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2189 "*/ int f2189() { // "/* 2189
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2190 "*/ int f2190() { // "/* 2190
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2191 "*/ int f2191() { // "/* 2191
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2192 "*/ int f2192() { // "/* 2192
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2193 "*/ int f2193() { // "/* 2193
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2194 "*/ int f2194() { // "/* 2194
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2195 "*/ int f2195() { // "/* 2195
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2196 "*/ int f2196() { // "/* 2196
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2197 "*/ int f2197() { // "/* 2197
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2198 "*/ int f2198() { // "/* 2198
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2199 "*/ int f2199() { // "/* 2199
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2200 "*/ int f2200() { // "/* 2200
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2201 "*/ int f2201() { // "/* 2201
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2202 "*/ int f2202() { // "/* 2202
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2203 "*/ int f2203() { // "/* 2203
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2204 "*/ int f2204() { // "/* 2204
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2205 "*/ int f2205() { // "/* 2205
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2206 "*/ int f2206() { // "/* 2206
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2207 "*/ int f2207() { // "/* 2207
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2208 "*/ int f2208() { // "/* 2208
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2209 "*/ int f2209() { // "/* 2209
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2210 "*/ int f2210() { // "/* 2210
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2211 "*/ int f2211() { // "/* 2211
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2212 "*/ int f2212() { // "/* 2212
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2213 "*/ int f2213() { // "/* 2213
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2214 "*/ int f2214() { // "/* 2214
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2215 "*/ int f2215() { // "/* 2215
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2216 "*/ int f2216() { // "/* 2216
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2217 "*/ int f2217() { // "/* 2217
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2218 "*/ int f2218() { // "/* 2218
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2219 "*/ int f2219() { // "/* 2219
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2220 "*/ int f2220() { // "/* 2220
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2221 "*/ int f2221() { // "/* 2221
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2222 "*/ int f2222() { // "/* 2222
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2223 "*/ int f2223() { // "/* 2223
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2224 "*/ int f2224() { // "/* 2224
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2225 "*/ int f2225() { // "/* 2225
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2226 "*/ int f2226() { // "/* 2226
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2227 "*/ int f2227() { // "/* 2227
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2228 "*/ int f2228() { // "/* 2228
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2229 "*/ int f2229() { // "/* 2229
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2230 "*/ int f2230() { // "/* 2230
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2231 "*/ int f2231() { // "/* 2231
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2232 "*/ int f2232() { // "/* 2232
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2233 "*/ int f2233() { // "/* 2233
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2234 "*/ int f2234() { // "/* 2234
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2235 "*/ int f2235() { // "/* 2235
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2236 "*/ int f2236() { // "/* 2236
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2237 "*/ int f2237() { // "/* 2237
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2238 "*/ int f2238() { // "/* 2238
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2239 "*/ int f2239() { // "/* 2239
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2240 "*/ int f2240() { // "/* 2240
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2241 "*/ int f2241() { // "/* 2241
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2242 "*/ int f2242() { // "/* 2242
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2243 "*/ int f2243() { // "/* 2243
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2244 "*/ int f2244() { // "/* 2244
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2245 "*/ int f2245() { // "/* 2245
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2246 "*/ int f2246() { // "/* 2246
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2247 "*/ int f2247() { // "/* 2247
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2248 "*/ int f2248() { // "/* 2248
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2249 "*/ int f2249() { // "/* 2249
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2250 "*/ int f2250() { // "/* 2250
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2251 "*/ int f2251() { // "/* 2251
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2252 "*/ int f2252() { // "/* 2252
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2253 "*/ int f2253() { // "/* 2253
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2254 "*/ int f2254() { // "/* 2254
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2255 "*/ int f2255() { // "/* 2255
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2256 "*/ int f2256() { // "/* 2256
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2257 "*/ int f2257() { // "/* 2257
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2258 "*/ int f2258() { // "/* 2258
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2259 "*/ int f2259() { // "/* 2259
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2260 "*/ int f2260() { // "/* 2260
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2261 "*/ int f2261() { // "/* 2261
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2262 "*/ int f2262() { // "/* 2262
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2263 "*/ int f2263() { // "/* 2263
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2264 "*/ int f2264() { // "/* 2264
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2265 "*/ int f2265() { // "/* 2265
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2266 "*/ int f2266() { // "/* 2266
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2267 "*/ int f2267() { // "/* 2267
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2268 "*/ int f2268() { // "/* 2268
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2269 "*/ int f2269() { // "/* 2269
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2270 "*/ int f2270() { // "/* 2270
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2271 "*/ int f2271() { // "/* 2271
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2272 "*/ int f2272() { // "/* 2272
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2273 "*/ int f2273() { // "/* 2273
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2274 "*/ int f2274() { // "/* 2274
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2275 "*/ int f2275() { // "/* 2275
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2276 "*/ int f2276() { // "/* 2276
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2277 "*/ int f2277() { // "/* 2277
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2278 "*/ int f2278() { // "/* 2278
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2279 "*/ int f2279() { // "/* 2279
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2280 "*/ int f2280() { // "/* 2280
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2281 "*/ int f2281() { // "/* 2281
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2282 "*/ int f2282() { // "/* 2282
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2283 "*/ int f2283() { // "/* 2283
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2284 "*/ int f2284() { // "/* 2284
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2285 "*/ int f2285() { // "/* 2285
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2286 "*/ int f2286() { // "/* 2286
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2287 "*/ int f2287() { // "/* 2287
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2288 "*/ int f2288() { // "/* 2288
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2289 "*/ int f2289() { // "/* 2289
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2290 "*/ int f2290() { // "/* 2290
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2291 "*/ int f2291() { // "/* 2291
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2292 "*/ int f2292() { // "/* 2292
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2293 "*/ int f2293() { // "/* 2293
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2294 "*/ int f2294() { // "/* 2294
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2295 "*/ int f2295() { // "/* 2295
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2296 "*/ int f2296() { // "/* 2296
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2297 "*/ int f2297() { // "/* 2297
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2298 "*/ int f2298() { // "/* 2298
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2299 "*/ int f2299() { // "/* 2299
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2300 "*/ int f2300() { // "/* 2300
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2301 "*/ int f2301() { // "/* 2301
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2302 "*/ int f2302() { // "/* 2302
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2303 "*/ int f2303() { // "/* 2303
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2304 "*/ int f2304() { // "/* 2304
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2305 "*/ int f2305() { // "/* 2305
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2306 "*/ int f2306() { // "/* 2306
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2307 "*/ int f2307() { // "/* 2307
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2308 "*/ int f2308() { // "/* 2308
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2309 "*/ int f2309() { // "/* 2309
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2310 "*/ int f2310() { // "/* 2310
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2311 "*/ int f2311() { // "/* 2311
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2312 "*/ int f2312() { // "/* 2312
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2313 "*/ int f2313() { // "/* 2313
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2314 "*/ int f2314() { // "/* 2314
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2315 "*/ int f2315() { // "/* 2315
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2316 "*/ int f2316() { // "/* 2316
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2317 "*/ int f2317() { // "/* 2317
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2318 "*/ int f2318() { // "/* 2318
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2319 "*/ int f2319() { // "/* 2319
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2320 "*/ int f2320() { // "/* 2320
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2321 "*/ int f2321() { // "/* 2321
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2322 "*/ int f2322() { // "/* 2322
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2323 "*/ int f2323() { // "/* 2323
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2324 "*/ int f2324() { // "/* 2324
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2325 "*/ int f2325() { // "/* 2325
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2326 "*/ int f2326() { // "/* 2326
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2327 "*/ int f2327() { // "/* 2327
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2328 "*/ int f2328() { // "/* 2328
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2329 "*/ int f2329() { // "/* 2329
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2330 "*/ int f2330() { // "/* 2330
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2331 "*/ int f2331() { // "/* 2331
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2332 "*/ int f2332() { // "/* 2332
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2333 "*/ int f2333() { // "/* 2333
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2334 "*/ int f2334() { // "/* 2334
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2335 "*/ int f2335() { // "/* 2335
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2336 "*/ int f2336() { // "/* 2336
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2337 "*/ int f2337() { // "/* 2337
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2338 "*/ int f2338() { // "/* 2338
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2339 "*/ int f2339() { // "/* 2339
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2340 "*/ int f2340() { // "/* 2340
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2341 "*/ int f2341() { // "/* 2341
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2342 "*/ int f2342() { // "/* 2342
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2343 "*/ int f2343() { // "/* 2343
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2344 "*/ int f2344() { // "/* 2344
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2345 "*/ int f2345() { // "/* 2345
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2346 "*/ int f2346() { // "/* 2346
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2347 "*/ int f2347() { // "/* 2347
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2348 "*/ int f2348() { // "/* 2348
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2349 "*/ int f2349() { // "/* 2349
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2350 "*/ int f2350() { // "/* 2350
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2351 "*/ int f2351() { // "/* 2351
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2352 "*/ int f2352() { // "/* 2352
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2353 "*/ int f2353() { // "/* 2353
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2354 "*/ int f2354() { // "/* 2354
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2355 "*/ int f2355() { // "/* 2355
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2356 "*/ int f2356() { // "/* 2356
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2357 "*/ int f2357() { // "/* 2357
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2358 "*/ int f2358() { // "/* 2358
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2359 "*/ int f2359() { // "/* 2359
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2360 "*/ int f2360() { // "/* 2360
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2361 "*/ int f2361() { // "/* 2361
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2362 "*/ int f2362() { // "/* 2362
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2363 "*/ int f2363() { // "/* 2363
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2364 "*/ int f2364() { // "/* 2364
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2365 "*/ int f2365() { // "/* 2365
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2366 "*/ int f2366() { // "/* 2366
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2367 "*/ int f2367() { // "/* 2367
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2368 "*/ int f2368() { // "/* 2368
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2369 "*/ int f2369() { // "/* 2369
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2370 "*/ int f2370() { // "/* 2370
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2371 "*/ int f2371() { // "/* 2371
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2372 "*/ int f2372() { // "/* 2372
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2373 "*/ int f2373() { // "/* 2373
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2374 "*/ int f2374() { // "/* 2374
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2375 "*/ int f2375() { // "/* 2375
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2376 "*/ int f2376() { // "/* 2376
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2377 "*/ int f2377() { // "/* 2377
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2378 "*/ int f2378() { // "/* 2378
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2379 "*/ int f2379() { // "/* 2379
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2380 "*/ int f2380() { // "/* 2380
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2381 "*/ int f2381() { // "/* 2381
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2382 "*/ int f2382() { // "/* 2382
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2383 "*/ int f2383() { // "/* 2383
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2384 "*/ int f2384() { // "/* 2384
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2385 "*/ int f2385() { // "/* 2385
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2386 "*/ int f2386() { // "/* 2386
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2387 "*/ int f2387() { // "/* 2387
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2388 "*/ int f2388() { // "/* 2388
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2389 "*/ int f2389() { // "/* 2389
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2390 "*/ int f2390() { // "/* 2390
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2391 "*/ int f2391() { // "/* 2391
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2392 "*/ int f2392() { // "/* 2392
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2393 "*/ int f2393() { // "/* 2393
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2394 "*/ int f2394() { // "/* 2394
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2395 "*/ int f2395() { // "/* 2395
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2396 "*/ int f2396() { // "/* 2396
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2397 "*/ int f2397() { // "/* 2397
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2398 "*/ int f2398() { // "/* 2398
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2399 "*/ int f2399() { // "/* 2399
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2400 "*/ int f2400() { // "/* 2400
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2401 "*/ int f2401() { // "/* 2401
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2402 "*/ int f2402() { // "/* 2402
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2403 "*/ int f2403() { // "/* 2403
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2404 "*/ int f2404() { // "/* 2404
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2405 "*/ int f2405() { // "/* 2405
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2406 "*/ int f2406() { // "/* 2406
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2407 "*/ int f2407() { // "/* 2407
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2408 "*/ int f2408() { // "/* 2408
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2409 "*/ int f2409() { // "/* 2409
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2410 "*/ int f2410() { // "/* 2410
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2411 "*/ int f2411() { // "/* 2411
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2412 "*/ int f2412() { // "/* 2412
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2413 "*/ int f2413() { // "/* 2413
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2414 "*/ int f2414() { // "/* 2414
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2415 "*/ int f2415() { // "/* 2415
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2416 "*/ int f2416() { // "/* 2416
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2417 "*/ int f2417() { // "/* 2417
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2418 "*/ int f2418() { // "/* 2418
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2419 "*/ int f2419() { // "/* 2419
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2420 "*/ int f2420() { // "/* 2420
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2421 "*/ int f2421() { // "/* 2421
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2422 "*/ int f2422() { // "/* 2422
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2423 "*/ int f2423() { // "/* 2423
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2424 "*/ int f2424() { // "/* 2424
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2425 "*/ int f2425() { // "/* 2425
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2426 "*/ int f2426() { // "/* 2426
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2427 "*/ int f2427() { // "/* 2427
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2428 "*/ int f2428() { // "/* 2428
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2429 "*/ int f2429() { // "/* 2429
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2430 "*/ int f2430() { // "/* 2430
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2431 "*/ int f2431() { // "/* 2431
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2432 "*/ int f2432() { // "/* 2432
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2433 "*/ int f2433() { // "/* 2433
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2434 "*/ int f2434() { // "/* 2434
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2435 "*/ int f2435() { // "/* 2435
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2436 "*/ int f2436() { // "/* 2436
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2437 "*/ int f2437() { // "/* 2437
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2438 "*/ int f2438() { // "/* 2438
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2439 "*/ int f2439() { // "/* 2439
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2440 "*/ int f2440() { // "/* 2440
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2441 "*/ int f2441() { // "/* 2441
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2442 "*/ int f2442() { // "/* 2442
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2443 "*/ int f2443() { // "/* 2443
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2444 "*/ int f2444() { // "/* 2444
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2445 "*/ int f2445() { // "/* 2445
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2446 "*/ int f2446() { // "/* 2446
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2447 "*/ int f2447() { // "/* 2447
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2448 "*/ int f2448() { // "/* 2448
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2449 "*/ int f2449() { // "/* 2449
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2450 "*/ int f2450() { // "/* 2450
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2451 "*/ int f2451() { // "/* 2451
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2452 "*/ int f2452() { // "/* 2452
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2453 "*/ int f2453() { // "/* 2453
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2454 "*/ int f2454() { // "/* 2454
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2455 "*/ int f2455() { // "/* 2455
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2456 "*/ int f2456() { // "/* 2456
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2457 "*/ int f2457() { // "/* 2457
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2458 "*/ int f2458() { // "/* 2458
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2459 "*/ int f2459() { // "/* 2459
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2460 "*/ int f2460() { // "/* 2460
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2461 "*/ int f2461() { // "/* 2461
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2462 "*/ int f2462() { // "/* 2462
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2463 "*/ int f2463() { // "/* 2463
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2464 "*/ int f2464() { // "/* 2464
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2465 "*/ int f2465() { // "/* 2465
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2466 "*/ int f2466() { // "/* 2466
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2467 "*/ int f2467() { // "/* 2467
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2468 "*/ int f2468() { // "/* 2468
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2469 "*/ int f2469() { // "/* 2469
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2470 "*/ int f2470() { // "/* 2470
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2471 "*/ int f2471() { // "/* 2471
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2472 "*/ int f2472() { // "/* 2472
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2473 "*/ int f2473() { // "/* 2473
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2474 "*/ int f2474() { // "/* 2474
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2475 "*/ int f2475() { // "/* 2475
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2476 "*/ int f2476() { // "/* 2476
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2477 "*/ int f2477() { // "/* 2477
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2478 "*/ int f2478() { // "/* 2478
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2479 "*/ int f2479() { // "/* 2479
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2480 "*/ int f2480() { // "/* 2480
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2481 "*/ int f2481() { // "/* 2481
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2482 "*/ int f2482() { // "/* 2482
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2483 "*/ int f2483() { // "/* 2483
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2484 "*/ int f2484() { // "/* 2484
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2485 "*/ int f2485() { // "/* 2485
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2486 "*/ int f2486() { // "/* 2486
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2487 "*/ int f2487() { // "/* 2487
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2488 "*/ int f2488() { // "/* 2488
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2489 "*/ int f2489() { // "/* 2489
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2490 "*/ int f2490() { // "/* 2490
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2491 "*/ int f2491() { // "/* 2491
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2492 "*/ int f2492() { // "/* 2492
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2493 "*/ int f2493() { // "/* 2493
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2494 "*/ int f2494() { // "/* 2494
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2495 "*/ int f2495() { // "/* 2495
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2496 "*/ int f2496() { // "/* 2496
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2497 "*/ int f2497() { // "/* 2497
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2498 "*/ int f2498() { // "/* 2498
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2499 "*/ int f2499() { // "/* 2499
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2500 "*/ int f2500() { // "/* 2500
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2501 "*/ int f2501() { // "/* 2501
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2502 "*/ int f2502() { // "/* 2502
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2503 "*/ int f2503() { // "/* 2503
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2504 "*/ int f2504() { // "/* 2504
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2505 "*/ int f2505() { // "/* 2505
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2506 "*/ int f2506() { // "/* 2506
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2507 "*/ int f2507() { // "/* 2507
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2508 "*/ int f2508() { // "/* 2508
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2509 "*/ int f2509() { // "/* 2509
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2510 "*/ int f2510() { // "/* 2510
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2511 "*/ int f2511() { // "/* 2511
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2512 "*/ int f2512() { // "/* 2512
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2513 "*/ int f2513() { // "/* 2513
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2514 "*/ int f2514() { // "/* 2514
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2515 "*/ int f2515() { // "/* 2515
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2516 "*/ int f2516() { // "/* 2516
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2517 "*/ int f2517() { // "/* 2517
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2518 "*/ int f2518() { // "/* 2518
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2519 "*/ int f2519() { // "/* 2519
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2520 "*/ int f2520() { // "/* 2520
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2521 "*/ int f2521() { // "/* 2521
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2522 "*/ int f2522() { // "/* 2522
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2523 "*/ int f2523() { // "/* 2523
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2524 "*/ int f2524() { // "/* 2524
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2525 "*/ int f2525() { // "/* 2525
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2526 "*/ int f2526() { // "/* 2526
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2527 "*/ int f2527() { // "/* 2527
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2528 "*/ int f2528() { // "/* 2528
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2529 "*/ int f2529() { // "/* 2529
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2530 "*/ int f2530() { // "/* 2530
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2531 "*/ int f2531() { // "/* 2531
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2532 "*/ int f2532() { // "/* 2532
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2533 "*/ int f2533() { // "/* 2533
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2534 "*/ int f2534() { // "/* 2534
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2535 "*/ int f2535() { // "/* 2535
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2536 "*/ int f2536() { // "/* 2536
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2537 "*/ int f2537() { // "/* 2537
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2538 "*/ int f2538() { // "/* 2538
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2539 "*/ int f2539() { // "/* 2539
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2540 "*/ int f2540() { // "/* 2540
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2541 "*/ int f2541() { // "/* 2541
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2542 "*/ int f2542() { // "/* 2542
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2543 "*/ int f2543() { // "/* 2543
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2544 "*/ int f2544() { // "/* 2544
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2545 "*/ int f2545() { // "/* 2545
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2546 "*/ int f2546() { // "/* 2546
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2547 "*/ int f2547() { // "/* 2547
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2548 "*/ int f2548() { // "/* 2548
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2549 "*/ int f2549() { // "/* 2549
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2550 "*/ int f2550() { // "/* 2550
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2551 "*/ int f2551() { // "/* 2551
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2552 "*/ int f2552() { // "/* 2552
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2553 "*/ int f2553() { // "/* 2553
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2554 "*/ int f2554() { // "/* 2554
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2555 "*/ int f2555() { // "/* 2555
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2556 "*/ int f2556() { // "/* 2556
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2557 "*/ int f2557() { // "/* 2557
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2558 "*/ int f2558() { // "/* 2558
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2559 "*/ int f2559() { // "/* 2559
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2560 "*/ int f2560() { // "/* 2560
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2561 "*/ int f2561() { // "/* 2561
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2562 "*/ int f2562() { // "/* 2562
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2563 "*/ int f2563() { // "/* 2563
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2564 "*/ int f2564() { // "/* 2564
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2565 "*/ int f2565() { // "/* 2565
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2566 "*/ int f2566() { // "/* 2566
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2567 "*/ int f2567() { // "/* 2567
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2568 "*/ int f2568() { // "/* 2568
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2569 "*/ int f2569() { // "/* 2569
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2570 "*/ int f2570() { // "/* 2570
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2571 "*/ int f2571() { // "/* 2571
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2572 "*/ int f2572() { // "/* 2572
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2573 "*/ int f2573() { // "/* 2573
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2574 "*/ int f2574() { // "/* 2574
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2575 "*/ int f2575() { // "/* 2575
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2576 "*/ int f2576() { // "/* 2576
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2577 "*/ int f2577() { // "/* 2577
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2578 "*/ int f2578() { // "/* 2578
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2579 "*/ int f2579() { // "/* 2579
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2580 "*/ int f2580() { // "/* 2580
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2581 "*/ int f2581() { // "/* 2581
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2582 "*/ int f2582() { // "/* 2582
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2583 "*/ int f2583() { // "/* 2583
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2584 "*/ int f2584() { // "/* 2584
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2585 "*/ int f2585() { // "/* 2585
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2586 "*/ int f2586() { // "/* 2586
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2587 "*/ int f2587() { // "/* 2587
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2588 "*/ int f2588() { // "/* 2588
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2589 "*/ int f2589() { // "/* 2589
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2590 "*/ int f2590() { // "/* 2590
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2591 "*/ int f2591() { // "/* 2591
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2592 "*/ int f2592() { // "/* 2592
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2593 "*/ int f2593() { // "/* 2593
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2594 "*/ int f2594() { // "/* 2594
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2595 "*/ int f2595() { // "/* 2595
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2596 "*/ int f2596() { // "/* 2596
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2597 "*/ int f2597() { // "/* 2597
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2598 "*/ int f2598() { // "/* 2598
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2599 "*/ int f2599() { // "/* 2599
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2600 "*/ int f2600() { // "/* 2600
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2601 "*/ int f2601() { // "/* 2601
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2602 "*/ int f2602() { // "/* 2602
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2603 "*/ int f2603() { // "/* 2603
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2604 "*/ int f2604() { // "/* 2604
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2605 "*/ int f2605() { // "/* 2605
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2606 "*/ int f2606() { // "/* 2606
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2607 "*/ int f2607() { // "/* 2607
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2608 "*/ int f2608() { // "/* 2608
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2609 "*/ int f2609() { // "/* 2609
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2610 "*/ int f2610() { // "/* 2610
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2611 "*/ int f2611() { // "/* 2611
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2612 "*/ int f2612() { // "/* 2612
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2613 "*/ int f2613() { // "/* 2613
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2614 "*/ int f2614() { // "/* 2614
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2615 "*/ int f2615() { // "/* 2615
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2616 "*/ int f2616() { // "/* 2616
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2617 "*/ int f2617() { // "/* 2617
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2618 "*/ int f2618() { // "/* 2618
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2619 "*/ int f2619() { // "/* 2619
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2620 "*/ int f2620() { // "/* 2620
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2621 "*/ int f2621() { // "/* 2621
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2622 "*/ int f2622() { // "/* 2622
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2623 "*/ int f2623() { // "/* 2623
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2624 "*/ int f2624() { // "/* 2624
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2625 "*/ int f2625() { // "/* 2625
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2626 "*/ int f2626() { // "/* 2626
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2627 "*/ int f2627() { // "/* 2627
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2628 "*/ int f2628() { // "/* 2628
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2629 "*/ int f2629() { // "/* 2629
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2630 "*/ int f2630() { // "/* 2630
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2631 "*/ int f2631() { // "/* 2631
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2632 "*/ int f2632() { // "/* 2632
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2633 "*/ int f2633() { // "/* 2633
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2634 "*/ int f2634() { // "/* 2634
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2635 "*/ int f2635() { // "/* 2635
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2636 "*/ int f2636() { // "/* 2636
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2637 "*/ int f2637() { // "/* 2637
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2638 "*/ int f2638() { // "/* 2638
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2639 "*/ int f2639() { // "/* 2639
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2640 "*/ int f2640() { // "/* 2640
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2641 "*/ int f2641() { // "/* 2641
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2642 "*/ int f2642() { // "/* 2642
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2643 "*/ int f2643() { // "/* 2643
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2644 "*/ int f2644() { // "/* 2644
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2645 "*/ int f2645() { // "/* 2645
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2646 "*/ int f2646() { // "/* 2646
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2647 "*/ int f2647() { // "/* 2647
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2648 "*/ int f2648() { // "/* 2648
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2649 "*/ int f2649() { // "/* 2649
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2650 "*/ int f2650() { // "/* 2650
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2651 "*/ int f2651() { // "/* 2651
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2652 "*/ int f2652() { // "/* 2652
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2653 "*/ int f2653() { // "/* 2653
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2654 "*/ int f2654() { // "/* 2654
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2655 "*/ int f2655() { // "/* 2655
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2656 "*/ int f2656() { // "/* 2656
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2657 "*/ int f2657() { // "/* 2657
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2658 "*/ int f2658() { // "/* 2658
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2659 "*/ int f2659() { // "/* 2659
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2660 "*/ int f2660() { // "/* 2660
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2661 "*/ int f2661() { // "/* 2661
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2662 "*/ int f2662() { // "/* 2662
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2663 "*/ int f2663() { // "/* 2663
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2664 "*/ int f2664() { // "/* 2664
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2665 "*/ int f2665() { // "/* 2665
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2666 "*/ int f2666() { // "/* 2666
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2667 "*/ int f2667() { // "/* 2667
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2668 "*/ int f2668() { // "/* 2668
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2669 "*/ int f2669() { // "/* 2669
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2670 "*/ int f2670() { // "/* 2670
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2671 "*/ int f2671() { // "/* 2671
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2672 "*/ int f2672() { // "/* 2672
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2673 "*/ int f2673() { // "/* 2673
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2674 "*/ int f2674() { // "/* 2674
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2675 "*/ int f2675() { // "/* 2675
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2676 "*/ int f2676() { // "/* 2676
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2677 "*/ int f2677() { // "/* 2677
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2678 "*/ int f2678() { // "/* 2678
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2679 "*/ int f2679() { // "/* 2679
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2680 "*/ int f2680() { // "/* 2680
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2681 "*/ int f2681() { // "/* 2681
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2682 "*/ int f2682() { // "/* 2682
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2683 "*/ int f2683() { // "/* 2683
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2684 "*/ int f2684() { // "/* 2684
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2685 "*/ int f2685() { // "/* 2685
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2686 "*/ int f2686() { // "/* 2686
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2687 "*/ int f2687() { // "/* 2687
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2688 "*/ int f2688() { // "/* 2688
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2689 "*/ int f2689() { // "/* 2689
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2690 "*/ int f2690() { // "/* 2690
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2691 "*/ int f2691() { // "/* 2691
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2692 "*/ int f2692() { // "/* 2692
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2693 "*/ int f2693() { // "/* 2693
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2694 "*/ int f2694() { // "/* 2694
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2695 "*/ int f2695() { // "/* 2695
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2696 "*/ int f2696() { // "/* 2696
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2697 "*/ int f2697() { // "/* 2697
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2698 "*/ int f2698() { // "/* 2698
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2699 "*/ int f2699() { // "/* 2699
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2700 "*/ int f2700() { // "/* 2700
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2701 "*/ int f2701() { // "/* 2701
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2702 "*/ int f2702() { // "/* 2702
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2703 "*/ int f2703() { // "/* 2703
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2704 "*/ int f2704() { // "/* 2704
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2705 "*/ int f2705() { // "/* 2705
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2706 "*/ int f2706() { // "/* 2706
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2707 "*/ int f2707() { // "/* 2707
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2708 "*/ int f2708() { // "/* 2708
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2709 "*/ int f2709() { // "/* 2709
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2710 "*/ int f2710() { // "/* 2710
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2711 "*/ int f2711() { // "/* 2711
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2712 "*/ int f2712() { // "/* 2712
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2713 "*/ int f2713() { // "/* 2713
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2714 "*/ int f2714() { // "/* 2714
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2715 "*/ int f2715() { // "/* 2715
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2716 "*/ int f2716() { // "/* 2716
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2717 "*/ int f2717() { // "/* 2717
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2718 "*/ int f2718() { // "/* 2718
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2719 "*/ int f2719() { // "/* 2719
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2720 "*/ int f2720() { // "/* 2720
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2721 "*/ int f2721() { // "/* 2721
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2722 "*/ int f2722() { // "/* 2722
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2723 "*/ int f2723() { // "/* 2723
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2724 "*/ int f2724() { // "/* 2724
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2725 "*/ int f2725() { // "/* 2725
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2726 "*/ int f2726() { // "/* 2726
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2727 "*/ int f2727() { // "/* 2727
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2728 "*/ int f2728() { // "/* 2728
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2729 "*/ int f2729() { // "/* 2729
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2730 "*/ int f2730() { // "/* 2730
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2731 "*/ int f2731() { // "/* 2731
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2732 "*/ int f2732() { // "/* 2732
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2733 "*/ int f2733() { // "/* 2733
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2734 "*/ int f2734() { // "/* 2734
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2735 "*/ int f2735() { // "/* 2735
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2736 "*/ int f2736() { // "/* 2736
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2737 "*/ int f2737() { // "/* 2737
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2738 "*/ int f2738() { // "/* 2738
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2739 "*/ int f2739() { // "/* 2739
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2740 "*/ int f2740() { // "/* 2740
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2741 "*/ int f2741() { // "/* 2741
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2742 "*/ int f2742() { // "/* 2742
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2743 "*/ int f2743() { // "/* 2743
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2744 "*/ int f2744() { // "/* 2744
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2745 "*/ int f2745() { // "/* 2745
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2746 "*/ int f2746() { // "/* 2746
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2747 "*/ int f2747() { // "/* 2747
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2748 "*/ int f2748() { // "/* 2748
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2749 "*/ int f2749() { // "/* 2749
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2750 "*/ int f2750() { // "/* 2750
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2751 "*/ int f2751() { // "/* 2751
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2752 "*/ int f2752() { // "/* 2752
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2753 "*/ int f2753() { // "/* 2753
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2754 "*/ int f2754() { // "/* 2754
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2755 "*/ int f2755() { // "/* 2755
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2756 "*/ int f2756() { // "/* 2756
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2757 "*/ int f2757() { // "/* 2757
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2758 "*/ int f2758() { // "/* 2758
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2759 "*/ int f2759() { // "/* 2759
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2760 "*/ int f2760() { // "/* 2760
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2761 "*/ int f2761() { // "/* 2761
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2762 "*/ int f2762() { // "/* 2762
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2763 "*/ int f2763() { // "/* 2763
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2764 "*/ int f2764() { // "/* 2764
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2765 "*/ int f2765() { // "/* 2765
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2766 "*/ int f2766() { // "/* 2766
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2767 "*/ int f2767() { // "/* 2767
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2768 "*/ int f2768() { // "/* 2768
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2769 "*/ int f2769() { // "/* 2769
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2770 "*/ int f2770() { // "/* 2770
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2771 "*/ int f2771() { // "/* 2771
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2772 "*/ int f2772() { // "/* 2772
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2773 "*/ int f2773() { // "/* 2773
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2774 "*/ int f2774() { // "/* 2774
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2775 "*/ int f2775() { // "/* 2775
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2776 "*/ int f2776() { // "/* 2776
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2777 "*/ int f2777() { // "/* 2777
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2778 "*/ int f2778() { // "/* 2778
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2779 "*/ int f2779() { // "/* 2779
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2780 "*/ int f2780() { // "/* 2780
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2781 "*/ int f2781() { // "/* 2781
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2782 "*/ int f2782() { // "/* 2782
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2783 "*/ int f2783() { // "/* 2783
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2784 "*/ int f2784() { // "/* 2784
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2785 "*/ int f2785() { // "/* 2785
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2786 "*/ int f2786() { // "/* 2786
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2787 "*/ int f2787() { // "/* 2787
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2788 "*/ int f2788() { // "/* 2788
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2789 "*/ int f2789() { // "/* 2789
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2790 "*/ int f2790() { // "/* 2790
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2791 "*/ int f2791() { // "/* 2791
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2792 "*/ int f2792() { // "/* 2792
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2793 "*/ int f2793() { // "/* 2793
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2794 "*/ int f2794() { // "/* 2794
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2795 "*/ int f2795() { // "/* 2795
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2796 "*/ int f2796() { // "/* 2796
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2797 "*/ int f2797() { // "/* 2797
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2798 "*/ int f2798() { // "/* 2798
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2799 "*/ int f2799() { // "/* 2799
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2800 "*/ int f2800() { // "/* 2800
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2801 "*/ int f2801() { // "/* 2801
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2802 "*/ int f2802() { // "/* 2802
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2803 "*/ int f2803() { // "/* 2803
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2804 "*/ int f2804() { // "/* 2804
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2805 "*/ int f2805() { // "/* 2805
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2806 "*/ int f2806() { // "/* 2806
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2807 "*/ int f2807() { // "/* 2807
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2808 "*/ int f2808() { // "/* 2808
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2809 "*/ int f2809() { // "/* 2809
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2810 "*/ int f2810() { // "/* 2810
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2811 "*/ int f2811() { // "/* 2811
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2812 "*/ int f2812() { // "/* 2812
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2813 "*/ int f2813() { // "/* 2813
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2814 "*/ int f2814() { // "/* 2814
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2815 "*/ int f2815() { // "/* 2815
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2816 "*/ int f2816() { // "/* 2816
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2817 "*/ int f2817() { // "/* 2817
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2818 "*/ int f2818() { // "/* 2818
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2819 "*/ int f2819() { // "/* 2819
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2820 "*/ int f2820() { // "/* 2820
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2821 "*/ int f2821() { // "/* 2821
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2822 "*/ int f2822() { // "/* 2822
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2823 "*/ int f2823() { // "/* 2823
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2824 "*/ int f2824() { // "/* 2824
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2825 "*/ int f2825() { // "/* 2825
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2826 "*/ int f2826() { // "/* 2826
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2827 "*/ int f2827() { // "/* 2827
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2828 "*/ int f2828() { // "/* 2828
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2829 "*/ int f2829() { // "/* 2829
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2830 "*/ int f2830() { // "/* 2830
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2831 "*/ int f2831() { // "/* 2831
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2832 "*/ int f2832() { // "/* 2832
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2833 "*/ int f2833() { // "/* 2833
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2834 "*/ int f2834() { // "/* 2834
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2835 "*/ int f2835() { // "/* 2835
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2836 "*/ int f2836() { // "/* 2836
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2837 "*/ int f2837() { // "/* 2837
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2838 "*/ int f2838() { // "/* 2838
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2839 "*/ int f2839() { // "/* 2839
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2840 "*/ int f2840() { // "/* 2840
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2841 "*/ int f2841() { // "/* 2841
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2842 "*/ int f2842() { // "/* 2842
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2843 "*/ int f2843() { // "/* 2843
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2844 "*/ int f2844() { // "/* 2844
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2845 "*/ int f2845() { // "/* 2845
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2846 "*/ int f2846() { // "/* 2846
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2847 "*/ int f2847() { // "/* 2847
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2848 "*/ int f2848() { // "/* 2848
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2849 "*/ int f2849() { // "/* 2849
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2850 "*/ int f2850() { // "/* 2850
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2851 "*/ int f2851() { // "/* 2851
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2852 "*/ int f2852() { // "/* 2852
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2853 "*/ int f2853() { // "/* 2853
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2854 "*/ int f2854() { // "/* 2854
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2855 "*/ int f2855() { // "/* 2855
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2856 "*/ int f2856() { // "/* 2856
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2857 "*/ int f2857() { // "/* 2857
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2858 "*/ int f2858() { // "/* 2858
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2859 "*/ int f2859() { // "/* 2859
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2860 "*/ int f2860() { // "/* 2860
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2861 "*/ int f2861() { // "/* 2861
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2862 "*/ int f2862() { // "/* 2862
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2863 "*/ int f2863() { // "/* 2863
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2864 "*/ int f2864() { // "/* 2864
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2865 "*/ int f2865() { // "/* 2865
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2866 "*/ int f2866() { // "/* 2866
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2867 "*/ int f2867() { // "/* 2867
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2868 "*/ int f2868() { // "/* 2868
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2869 "*/ int f2869() { // "/* 2869
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2870 "*/ int f2870() { // "/* 2870
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2871 "*/ int f2871() { // "/* 2871
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2872 "*/ int f2872() { // "/* 2872
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2873 "*/ int f2873() { // "/* 2873
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2874 "*/ int f2874() { // "/* 2874
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2875 "*/ int f2875() { // "/* 2875
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2876 "*/ int f2876() { // "/* 2876
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2877 "*/ int f2877() { // "/* 2877
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2878 "*/ int f2878() { // "/* 2878
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2879 "*/ int f2879() { // "/* 2879
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2880 "*/ int f2880() { // "/* 2880
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2881 "*/ int f2881() { // "/* 2881
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2882 "*/ int f2882() { // "/* 2882
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2883 "*/ int f2883() { // "/* 2883
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2884 "*/ int f2884() { // "/* 2884
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2885 "*/ int f2885() { // "/* 2885
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2886 "*/ int f2886() { // "/* 2886
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2887 "*/ int f2887() { // "/* 2887
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2888 "*/ int f2888() { // "/* 2888
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2889 "*/ int f2889() { // "/* 2889
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2890 "*/ int f2890() { // "/* 2890
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2891 "*/ int f2891() { // "/* 2891
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2892 "*/ int f2892() { // "/* 2892
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2893 "*/ int f2893() { // "/* 2893
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2894 "*/ int f2894() { // "/* 2894
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2895 "*/ int f2895() { // "/* 2895
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2896 "*/ int f2896() { // "/* 2896
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2897 "*/ int f2897() { // "/* 2897
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2898 "*/ int f2898() { // "/* 2898
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2899 "*/ int f2899() { // "/* 2899
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2900 "*/ int f2900() { // "/* 2900
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2901 "*/ int f2901() { // "/* 2901
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2902 "*/ int f2902() { // "/* 2902
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2903 "*/ int f2903() { // "/* 2903
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2904 "*/ int f2904() { // "/* 2904
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2905 "*/ int f2905() { // "/* 2905
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2906 "*/ int f2906() { // "/* 2906
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2907 "*/ int f2907() { // "/* 2907
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2908 "*/ int f2908() { // "/* 2908
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2909 "*/ int f2909() { // "/* 2909
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2910 "*/ int f2910() { // "/* 2910
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2911 "*/ int f2911() { // "/* 2911
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2912 "*/ int f2912() { // "/* 2912
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2913 "*/ int f2913() { // "/* 2913
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2914 "*/ int f2914() { // "/* 2914
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2915 "*/ int f2915() { // "/* 2915
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2916 "*/ int f2916() { // "/* 2916
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2917 "*/ int f2917() { // "/* 2917
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2918 "*/ int f2918() { // "/* 2918
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2919 "*/ int f2919() { // "/* 2919
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2920 "*/ int f2920() { // "/* 2920
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2921 "*/ int f2921() { // "/* 2921
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2922 "*/ int f2922() { // "/* 2922
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2923 "*/ int f2923() { // "/* 2923
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2924 "*/ int f2924() { // "/* 2924
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2925 "*/ int f2925() { // "/* 2925
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2926 "*/ int f2926() { // "/* 2926
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2927 "*/ int f2927() { // "/* 2927
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2928 "*/ int f2928() { // "/* 2928
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2929 "*/ int f2929() { // "/* 2929
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2930 "*/ int f2930() { // "/* 2930
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2931 "*/ int f2931() { // "/* 2931
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2932 "*/ int f2932() { // "/* 2932
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2933 "*/ int f2933() { // "/* 2933
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2934 "*/ int f2934() { // "/* 2934
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2935 "*/ int f2935() { // "/* 2935
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2936 "*/ int f2936() { // "/* 2936
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2937 "*/ int f2937() { // "/* 2937
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2938 "*/ int f2938() { // "/* 2938
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2939 "*/ int f2939() { // "/* 2939
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2940 "*/ int f2940() { // "/* 2940
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2941 "*/ int f2941() { // "/* 2941
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2942 "*/ int f2942() { // "/* 2942
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2943 "*/ int f2943() { // "/* 2943
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2944 "*/ int f2944() { // "/* 2944
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2945 "*/ int f2945() { // "/* 2945
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2946 "*/ int f2946() { // "/* 2946
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2947 "*/ int f2947() { // "/* 2947
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2948 "*/ int f2948() { // "/* 2948
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2949 "*/ int f2949() { // "/* 2949
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2950 "*/ int f2950() { // "/* 2950
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2951 "*/ int f2951() { // "/* 2951
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2952 "*/ int f2952() { // "/* 2952
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2953 "*/ int f2953() { // "/* 2953
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2954 "*/ int f2954() { // "/* 2954
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2955 "*/ int f2955() { // "/* 2955
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2956 "*/ int f2956() { // "/* 2956
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2957 "*/ int f2957() { // "/* 2957
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2958 "*/ int f2958() { // "/* 2958
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2959 "*/ int f2959() { // "/* 2959
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2960 "*/ int f2960() { // "/* 2960
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2961 "*/ int f2961() { // "/* 2961
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2962 "*/ int f2962() { // "/* 2962
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2963 "*/ int f2963() { // "/* 2963
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2964 "*/ int f2964() { // "/* 2964
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2965 "*/ int f2965() { // "/* 2965
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2966 "*/ int f2966() { // "/* 2966
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2967 "*/ int f2967() { // "/* 2967
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2968 "*/ int f2968() { // "/* 2968
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2969 "*/ int f2969() { // "/* 2969
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2970 "*/ int f2970() { // "/* 2970
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2971 "*/ int f2971() { // "/* 2971
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2972 "*/ int f2972() { // "/* 2972
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2973 "*/ int f2973() { // "/* 2973
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2974 "*/ int f2974() { // "/* 2974
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2975 "*/ int f2975() { // "/* 2975
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2976 "*/ int f2976() { // "/* 2976
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2977 "*/ int f2977() { // "/* 2977
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2978 "*/ int f2978() { // "/* 2978
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2979 "*/ int f2979() { // "/* 2979
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2980 "*/ int f2980() { // "/* 2980
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2981 "*/ int f2981() { // "/* 2981
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2982 "*/ int f2982() { // "/* 2982
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2983 "*/ int f2983() { // "/* 2983
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2984 "*/ int f2984() { // "/* 2984
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2985 "*/ int f2985() { // "/* 2985
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2986 "*/ int f2986() { // "/* 2986
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2987 "*/ int f2987() { // "/* 2987
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2988 "*/ int f2988() { // "/* 2988
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2989 "*/ int f2989() { // "/* 2989
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2990 "*/ int f2990() { // "/* 2990
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2991 "*/ int f2991() { // "/* 2991
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2992 "*/ int f2992() { // "/* 2992
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2993 "*/ int f2993() { // "/* 2993
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2994 "*/ int f2994() { // "/* 2994
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2995 "*/ int f2995() { // "/* 2995
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2996 "*/ int f2996() { // "/* 2996
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2997 "*/ int f2997() { // "/* 2997
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2998 "*/ int f2998() { // "/* 2998
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 2999 "*/ int f2999() { // "/* 2999
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3000 "*/ int f3000() { // "/* 3000
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3001 "*/ int f3001() { // "/* 3001
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3002 "*/ int f3002() { // "/* 3002
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3003 "*/ int f3003() { // "/* 3003
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3004 "*/ int f3004() { // "/* 3004
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3005 "*/ int f3005() { // "/* 3005
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3006 "*/ int f3006() { // "/* 3006
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3007 "*/ int f3007() { // "/* 3007
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3008 "*/ int f3008() { // "/* 3008
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3009 "*/ int f3009() { // "/* 3009
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3010 "*/ int f3010() { // "/* 3010
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3011 "*/ int f3011() { // "/* 3011
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3012 "*/ int f3012() { // "/* 3012
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3013 "*/ int f3013() { // "/* 3013
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3014 "*/ int f3014() { // "/* 3014
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3015 "*/ int f3015() { // "/* 3015
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3016 "*/ int f3016() { // "/* 3016
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3017 "*/ int f3017() { // "/* 3017
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3018 "*/ int f3018() { // "/* 3018
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3019 "*/ int f3019() { // "/* 3019
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3020 "*/ int f3020() { // "/* 3020
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3021 "*/ int f3021() { // "/* 3021
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3022 "*/ int f3022() { // "/* 3022
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3023 "*/ int f3023() { // "/* 3023
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3024 "*/ int f3024() { // "/* 3024
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3025 "*/ int f3025() { // "/* 3025
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3026 "*/ int f3026() { // "/* 3026
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3027 "*/ int f3027() { // "/* 3027
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3028 "*/ int f3028() { // "/* 3028
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3029 "*/ int f3029() { // "/* 3029
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3030 "*/ int f3030() { // "/* 3030
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3031 "*/ int f3031() { // "/* 3031
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3032 "*/ int f3032() { // "/* 3032
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3033 "*/ int f3033() { // "/* 3033
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3034 "*/ int f3034() { // "/* 3034
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3035 "*/ int f3035() { // "/* 3035
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3036 "*/ int f3036() { // "/* 3036
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3037 "*/ int f3037() { // "/* 3037
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3038 "*/ int f3038() { // "/* 3038
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3039 "*/ int f3039() { // "/* 3039
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3040 "*/ int f3040() { // "/* 3040
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3041 "*/ int f3041() { // "/* 3041
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3042 "*/ int f3042() { // "/* 3042
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3043 "*/ int f3043() { // "/* 3043
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3044 "*/ int f3044() { // "/* 3044
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3045 "*/ int f3045() { // "/* 3045
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3046 "*/ int f3046() { // "/* 3046
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3047 "*/ int f3047() { // "/* 3047
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3048 "*/ int f3048() { // "/* 3048
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3049 "*/ int f3049() { // "/* 3049
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3050 "*/ int f3050() { // "/* 3050
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3051 "*/ int f3051() { // "/* 3051
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3052 "*/ int f3052() { // "/* 3052
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3053 "*/ int f3053() { // "/* 3053
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3054 "*/ int f3054() { // "/* 3054
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3055 "*/ int f3055() { // "/* 3055
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3056 "*/ int f3056() { // "/* 3056
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3057 "*/ int f3057() { // "/* 3057
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3058 "*/ int f3058() { // "/* 3058
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3059 "*/ int f3059() { // "/* 3059
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3060 "*/ int f3060() { // "/* 3060
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3061 "*/ int f3061() { // "/* 3061
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3062 "*/ int f3062() { // "/* 3062
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3063 "*/ int f3063() { // "/* 3063
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3064 "*/ int f3064() { // "/* 3064
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3065 "*/ int f3065() { // "/* 3065
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3066 "*/ int f3066() { // "/* 3066
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3067 "*/ int f3067() { // "/* 3067
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3068 "*/ int f3068() { // "/* 3068
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3069 "*/ int f3069() { // "/* 3069
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3070 "*/ int f3070() { // "/* 3070
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3071 "*/ int f3071() { // "/* 3071
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3072 "*/ int f3072() { // "/* 3072
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3073 "*/ int f3073() { // "/* 3073
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3074 "*/ int f3074() { // "/* 3074
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3075 "*/ int f3075() { // "/* 3075
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3076 "*/ int f3076() { // "/* 3076
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3077 "*/ int f3077() { // "/* 3077
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3078 "*/ int f3078() { // "/* 3078
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3079 "*/ int f3079() { // "/* 3079
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3080 "*/ int f3080() { // "/* 3080
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3081 "*/ int f3081() { // "/* 3081
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3082 "*/ int f3082() { // "/* 3082
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3083 "*/ int f3083() { // "/* 3083
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3084 "*/ int f3084() { // "/* 3084
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3085 "*/ int f3085() { // "/* 3085
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3086 "*/ int f3086() { // "/* 3086
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3087 "*/ int f3087() { // "/* 3087
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3088 "*/ int f3088() { // "/* 3088
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3089 "*/ int f3089() { // "/* 3089
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3090 "*/ int f3090() { // "/* 3090
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3091 "*/ int f3091() { // "/* 3091
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3092 "*/ int f3092() { // "/* 3092
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3093 "*/ int f3093() { // "/* 3093
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3094 "*/ int f3094() { // "/* 3094
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3095 "*/ int f3095() { // "/* 3095
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3096 "*/ int f3096() { // "/* 3096
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3097 "*/ int f3097() { // "/* 3097
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3098 "*/ int f3098() { // "/* 3098
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3099 "*/ int f3099() { // "/* 3099
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3100 "*/ int f3100() { // "/* 3100
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3101 "*/ int f3101() { // "/* 3101
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3102 "*/ int f3102() { // "/* 3102
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3103 "*/ int f3103() { // "/* 3103
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3104 "*/ int f3104() { // "/* 3104
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3105 "*/ int f3105() { // "/* 3105
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3106 "*/ int f3106() { // "/* 3106
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3107 "*/ int f3107() { // "/* 3107
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3108 "*/ int f3108() { // "/* 3108
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3109 "*/ int f3109() { // "/* 3109
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3110 "*/ int f3110() { // "/* 3110
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3111 "*/ int f3111() { // "/* 3111
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3112 "*/ int f3112() { // "/* 3112
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3113 "*/ int f3113() { // "/* 3113
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3114 "*/ int f3114() { // "/* 3114
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3115 "*/ int f3115() { // "/* 3115
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3116 "*/ int f3116() { // "/* 3116
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3117 "*/ int f3117() { // "/* 3117
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3118 "*/ int f3118() { // "/* 3118
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3119 "*/ int f3119() { // "/* 3119
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3120 "*/ int f3120() { // "/* 3120
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3121 "*/ int f3121() { // "/* 3121
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3122 "*/ int f3122() { // "/* 3122
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3123 "*/ int f3123() { // "/* 3123
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3124 "*/ int f3124() { // "/* 3124
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3125 "*/ int f3125() { // "/* 3125
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3126 "*/ int f3126() { // "/* 3126
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3127 "*/ int f3127() { // "/* 3127
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3128 "*/ int f3128() { // "/* 3128
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3129 "*/ int f3129() { // "/* 3129
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3130 "*/ int f3130() { // "/* 3130
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3131 "*/ int f3131() { // "/* 3131
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3132 "*/ int f3132() { // "/* 3132
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3133 "*/ int f3133() { // "/* 3133
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3134 "*/ int f3134() { // "/* 3134
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3135 "*/ int f3135() { // "/* 3135
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3136 "*/ int f3136() { // "/* 3136
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3137 "*/ int f3137() { // "/* 3137
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3138 "*/ int f3138() { // "/* 3138
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3139 "*/ int f3139() { // "/* 3139
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3140 "*/ int f3140() { // "/* 3140
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3141 "*/ int f3141() { // "/* 3141
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3142 "*/ int f3142() { // "/* 3142
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3143 "*/ int f3143() { // "/* 3143
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3144 "*/ int f3144() { // "/* 3144
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3145 "*/ int f3145() { // "/* 3145
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3146 "*/ int f3146() { // "/* 3146
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3147 "*/ int f3147() { // "/* 3147
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3148 "*/ int f3148() { // "/* 3148
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3149 "*/ int f3149() { // "/* 3149
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3150 "*/ int f3150() { // "/* 3150
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3151 "*/ int f3151() { // "/* 3151
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3152 "*/ int f3152() { // "/* 3152
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3153 "*/ int f3153() { // "/* 3153
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3154 "*/ int f3154() { // "/* 3154
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3155 "*/ int f3155() { // "/* 3155
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3156 "*/ int f3156() { // "/* 3156
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3157 "*/ int f3157() { // "/* 3157
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3158 "*/ int f3158() { // "/* 3158
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3159 "*/ int f3159() { // "/* 3159
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3160 "*/ int f3160() { // "/* 3160
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3161 "*/ int f3161() { // "/* 3161
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3162 "*/ int f3162() { // "/* 3162
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3163 "*/ int f3163() { // "/* 3163
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3164 "*/ int f3164() { // "/* 3164
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3165 "*/ int f3165() { // "/* 3165
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3166 "*/ int f3166() { // "/* 3166
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3167 "*/ int f3167() { // "/* 3167
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3168 "*/ int f3168() { // "/* 3168
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3169 "*/ int f3169() { // "/* 3169
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3170 "*/ int f3170() { // "/* 3170
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3171 "*/ int f3171() { // "/* 3171
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3172 "*/ int f3172() { // "/* 3172
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3173 "*/ int f3173() { // "/* 3173
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3174 "*/ int f3174() { // "/* 3174
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3175 "*/ int f3175() { // "/* 3175
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3176 "*/ int f3176() { // "/* 3176
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3177 "*/ int f3177() { // "/* 3177
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3178 "*/ int f3178() { // "/* 3178
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3179 "*/ int f3179() { // "/* 3179
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3180 "*/ int f3180() { // "/* 3180
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3181 "*/ int f3181() { // "/* 3181
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3182 "*/ int f3182() { // "/* 3182
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3183 "*/ int f3183() { // "/* 3183
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3184 "*/ int f3184() { // "/* 3184
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3185 "*/ int f3185() { // "/* 3185
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3186 "*/ int f3186() { // "/* 3186
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3187 "*/ int f3187() { // "/* 3187
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3188 "*/ int f3188() { // "/* 3188
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3189 "*/ int f3189() { // "/* 3189
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3190 "*/ int f3190() { // "/* 3190
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3191 "*/ int f3191() { // "/* 3191
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3192 "*/ int f3192() { // "/* 3192
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3193 "*/ int f3193() { // "/* 3193
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3194 "*/ int f3194() { // "/* 3194
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3195 "*/ int f3195() { // "/* 3195
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3196 "*/ int f3196() { // "/* 3196
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3197 "*/ int f3197() { // "/* 3197
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3198 "*/ int f3198() { // "/* 3198
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3199 "*/ int f3199() { // "/* 3199
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3200 "*/ int f3200() { // "/* 3200
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3201 "*/ int f3201() { // "/* 3201
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3202 "*/ int f3202() { // "/* 3202
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3203 "*/ int f3203() { // "/* 3203
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3204 "*/ int f3204() { // "/* 3204
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3205 "*/ int f3205() { // "/* 3205
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3206 "*/ int f3206() { // "/* 3206
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3207 "*/ int f3207() { // "/* 3207
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3208 "*/ int f3208() { // "/* 3208
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3209 "*/ int f3209() { // "/* 3209
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3210 "*/ int f3210() { // "/* 3210
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3211 "*/ int f3211() { // "/* 3211
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3212 "*/ int f3212() { // "/* 3212
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3213 "*/ int f3213() { // "/* 3213
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3214 "*/ int f3214() { // "/* 3214
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3215 "*/ int f3215() { // "/* 3215
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3216 "*/ int f3216() { // "/* 3216
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3217 "*/ int f3217() { // "/* 3217
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3218 "*/ int f3218() { // "/* 3218
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3219 "*/ int f3219() { // "/* 3219
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3220 "*/ int f3220() { // "/* 3220
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3221 "*/ int f3221() { // "/* 3221
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3222 "*/ int f3222() { // "/* 3222
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3223 "*/ int f3223() { // "/* 3223
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3224 "*/ int f3224() { // "/* 3224
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3225 "*/ int f3225() { // "/* 3225
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3226 "*/ int f3226() { // "/* 3226
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3227 "*/ int f3227() { // "/* 3227
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3228 "*/ int f3228() { // "/* 3228
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3229 "*/ int f3229() { // "/* 3229
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3230 "*/ int f3230() { // "/* 3230
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3231 "*/ int f3231() { // "/* 3231
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3232 "*/ int f3232() { // "/* 3232
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3233 "*/ int f3233() { // "/* 3233
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3234 "*/ int f3234() { // "/* 3234
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3235 "*/ int f3235() { // "/* 3235
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3236 "*/ int f3236() { // "/* 3236
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3237 "*/ int f3237() { // "/* 3237
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3238 "*/ int f3238() { // "/* 3238
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3239 "*/ int f3239() { // "/* 3239
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3240 "*/ int f3240() { // "/* 3240
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3241 "*/ int f3241() { // "/* 3241
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3242 "*/ int f3242() { // "/* 3242
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3243 "*/ int f3243() { // "/* 3243
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3244 "*/ int f3244() { // "/* 3244
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3245 "*/ int f3245() { // "/* 3245
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3246 "*/ int f3246() { // "/* 3246
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3247 "*/ int f3247() { // "/* 3247
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3248 "*/ int f3248() { // "/* 3248
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3249 "*/ int f3249() { // "/* 3249
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3250 "*/ int f3250() { // "/* 3250
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3251 "*/ int f3251() { // "/* 3251
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3252 "*/ int f3252() { // "/* 3252
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3253 "*/ int f3253() { // "/* 3253
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3254 "*/ int f3254() { // "/* 3254
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3255 "*/ int f3255() { // "/* 3255
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3256 "*/ int f3256() { // "/* 3256
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3257 "*/ int f3257() { // "/* 3257
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3258 "*/ int f3258() { // "/* 3258
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3259 "*/ int f3259() { // "/* 3259
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3260 "*/ int f3260() { // "/* 3260
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3261 "*/ int f3261() { // "/* 3261
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3262 "*/ int f3262() { // "/* 3262
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3263 "*/ int f3263() { // "/* 3263
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3264 "*/ int f3264() { // "/* 3264
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3265 "*/ int f3265() { // "/* 3265
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3266 "*/ int f3266() { // "/* 3266
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3267 "*/ int f3267() { // "/* 3267
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3268 "*/ int f3268() { // "/* 3268
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3269 "*/ int f3269() { // "/* 3269
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3270 "*/ int f3270() { // "/* 3270
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3271 "*/ int f3271() { // "/* 3271
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3272 "*/ int f3272() { // "/* 3272
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3273 "*/ int f3273() { // "/* 3273
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3274 "*/ int f3274() { // "/* 3274
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3275 "*/ int f3275() { // "/* 3275
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3276 "*/ int f3276() { // "/* 3276
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3277 "*/ int f3277() { // "/* 3277
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3278 "*/ int f3278() { // "/* 3278
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3279 "*/ int f3279() { // "/* 3279
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3280 "*/ int f3280() { // "/* 3280
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3281 "*/ int f3281() { // "/* 3281
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3282 "*/ int f3282() { // "/* 3282
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3283 "*/ int f3283() { // "/* 3283
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3284 "*/ int f3284() { // "/* 3284
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3285 "*/ int f3285() { // "/* 3285
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3286 "*/ int f3286() { // "/* 3286
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3287 "*/ int f3287() { // "/* 3287
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3288 "*/ int f3288() { // "/* 3288
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3289 "*/ int f3289() { // "/* 3289
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3290 "*/ int f3290() { // "/* 3290
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3291 "*/ int f3291() { // "/* 3291
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3292 "*/ int f3292() { // "/* 3292
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3293 "*/ int f3293() { // "/* 3293
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3294 "*/ int f3294() { // "/* 3294
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3295 "*/ int f3295() { // "/* 3295
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3296 "*/ int f3296() { // "/* 3296
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3297 "*/ int f3297() { // "/* 3297
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3298 "*/ int f3298() { // "/* 3298
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3299 "*/ int f3299() { // "/* 3299
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3300 "*/ int f3300() { // "/* 3300
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3301 "*/ int f3301() { // "/* 3301
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3302 "*/ int f3302() { // "/* 3302
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3303 "*/ int f3303() { // "/* 3303
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3304 "*/ int f3304() { // "/* 3304
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3305 "*/ int f3305() { // "/* 3305
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3306 "*/ int f3306() { // "/* 3306
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3307 "*/ int f3307() { // "/* 3307
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3308 "*/ int f3308() { // "/* 3308
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3309 "*/ int f3309() { // "/* 3309
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3310 "*/ int f3310() { // "/* 3310
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3311 "*/ int f3311() { // "/* 3311
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3312 "*/ int f3312() { // "/* 3312
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3313 "*/ int f3313() { // "/* 3313
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3314 "*/ int f3314() { // "/* 3314
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3315 "*/ int f3315() { // "/* 3315
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3316 "*/ int f3316() { // "/* 3316
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3317 "*/ int f3317() { // "/* 3317
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3318 "*/ int f3318() { // "/* 3318
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3319 "*/ int f3319() { // "/* 3319
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3320 "*/ int f3320() { // "/* 3320
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3321 "*/ int f3321() { // "/* 3321
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3322 "*/ int f3322() { // "/* 3322
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3323 "*/ int f3323() { // "/* 3323
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3324 "*/ int f3324() { // "/* 3324
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3325 "*/ int f3325() { // "/* 3325
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3326 "*/ int f3326() { // "/* 3326
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3327 "*/ int f3327() { // "/* 3327
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3328 "*/ int f3328() { // "/* 3328
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3329 "*/ int f3329() { // "/* 3329
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3330 "*/ int f3330() { // "/* 3330
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3331 "*/ int f3331() { // "/* 3331
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3332 "*/ int f3332() { // "/* 3332
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3333 "*/ int f3333() { // "/* 3333
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3334 "*/ int f3334() { // "/* 3334
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3335 "*/ int f3335() { // "/* 3335
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3336 "*/ int f3336() { // "/* 3336
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3337 "*/ int f3337() { // "/* 3337
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3338 "*/ int f3338() { // "/* 3338
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3339 "*/ int f3339() { // "/* 3339
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3340 "*/ int f3340() { // "/* 3340
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3341 "*/ int f3341() { // "/* 3341
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3342 "*/ int f3342() { // "/* 3342
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3343 "*/ int f3343() { // "/* 3343
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3344 "*/ int f3344() { // "/* 3344
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3345 "*/ int f3345() { // "/* 3345
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3346 "*/ int f3346() { // "/* 3346
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3347 "*/ int f3347() { // "/* 3347
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3348 "*/ int f3348() { // "/* 3348
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3349 "*/ int f3349() { // "/* 3349
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3350 "*/ int f3350() { // "/* 3350
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3351 "*/ int f3351() { // "/* 3351
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3352 "*/ int f3352() { // "/* 3352
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3353 "*/ int f3353() { // "/* 3353
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3354 "*/ int f3354() { // "/* 3354
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3355 "*/ int f3355() { // "/* 3355
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3356 "*/ int f3356() { // "/* 3356
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3357 "*/ int f3357() { // "/* 3357
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3358 "*/ int f3358() { // "/* 3358
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3359 "*/ int f3359() { // "/* 3359
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3360 "*/ int f3360() { // "/* 3360
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3361 "*/ int f3361() { // "/* 3361
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3362 "*/ int f3362() { // "/* 3362
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3363 "*/ int f3363() { // "/* 3363
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3364 "*/ int f3364() { // "/* 3364
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3365 "*/ int f3365() { // "/* 3365
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3366 "*/ int f3366() { // "/* 3366
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3367 "*/ int f3367() { // "/* 3367
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3368 "*/ int f3368() { // "/* 3368
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3369 "*/ int f3369() { // "/* 3369
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3370 "*/ int f3370() { // "/* 3370
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3371 "*/ int f3371() { // "/* 3371
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3372 "*/ int f3372() { // "/* 3372
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3373 "*/ int f3373() { // "/* 3373
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3374 "*/ int f3374() { // "/* 3374
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3375 "*/ int f3375() { // "/* 3375
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3376 "*/ int f3376() { // "/* 3376
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3377 "*/ int f3377() { // "/* 3377
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3378 "*/ int f3378() { // "/* 3378
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3379 "*/ int f3379() { // "/* 3379
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3380 "*/ int f3380() { // "/* 3380
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3381 "*/ int f3381() { // "/* 3381
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3382 "*/ int f3382() { // "/* 3382
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3383 "*/ int f3383() { // "/* 3383
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3384 "*/ int f3384() { // "/* 3384
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3385 "*/ int f3385() { // "/* 3385
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3386 "*/ int f3386() { // "/* 3386
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3387 "*/ int f3387() { // "/* 3387
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3388 "*/ int f3388() { // "/* 3388
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3389 "*/ int f3389() { // "/* 3389
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3390 "*/ int f3390() { // "/* 3390
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3391 "*/ int f3391() { // "/* 3391
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3392 "*/ int f3392() { // "/* 3392
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3393 "*/ int f3393() { // "/* 3393
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3394 "*/ int f3394() { // "/* 3394
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3395 "*/ int f3395() { // "/* 3395
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3396 "*/ int f3396() { // "/* 3396
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3397 "*/ int f3397() { // "/* 3397
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3398 "*/ int f3398() { // "/* 3398
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3399 "*/ int f3399() { // "/* 3399
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3400 "*/ int f3400() { // "/* 3400
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3401 "*/ int f3401() { // "/* 3401
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3402 "*/ int f3402() { // "/* 3402
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3403 "*/ int f3403() { // "/* 3403
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3404 "*/ int f3404() { // "/* 3404
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3405 "*/ int f3405() { // "/* 3405
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3406 "*/ int f3406() { // "/* 3406
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3407 "*/ int f3407() { // "/* 3407
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3408 "*/ int f3408() { // "/* 3408
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3409 "*/ int f3409() { // "/* 3409
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3410 "*/ int f3410() { // "/* 3410
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3411 "*/ int f3411() { // "/* 3411
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3412 "*/ int f3412() { // "/* 3412
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3413 "*/ int f3413() { // "/* 3413
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3414 "*/ int f3414() { // "/* 3414
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3415 "*/ int f3415() { // "/* 3415
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3416 "*/ int f3416() { // "/* 3416
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3417 "*/ int f3417() { // "/* 3417
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3418 "*/ int f3418() { // "/* 3418
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3419 "*/ int f3419() { // "/* 3419
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3420 "*/ int f3420() { // "/* 3420
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3421 "*/ int f3421() { // "/* 3421
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3422 "*/ int f3422() { // "/* 3422
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3423 "*/ int f3423() { // "/* 3423
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3424 "*/ int f3424() { // "/* 3424
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3425 "*/ int f3425() { // "/* 3425
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3426 "*/ int f3426() { // "/* 3426
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3427 "*/ int f3427() { // "/* 3427
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3428 "*/ int f3428() { // "/* 3428
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3429 "*/ int f3429() { // "/* 3429
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3430 "*/ int f3430() { // "/* 3430
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3431 "*/ int f3431() { // "/* 3431
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3432 "*/ int f3432() { // "/* 3432
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3433 "*/ int f3433() { // "/* 3433
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3434 "*/ int f3434() { // "/* 3434
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3435 "*/ int f3435() { // "/* 3435
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3436 "*/ int f3436() { // "/* 3436
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3437 "*/ int f3437() { // "/* 3437
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3438 "*/ int f3438() { // "/* 3438
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3439 "*/ int f3439() { // "/* 3439
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3440 "*/ int f3440() { // "/* 3440
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3441 "*/ int f3441() { // "/* 3441
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3442 "*/ int f3442() { // "/* 3442
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3443 "*/ int f3443() { // "/* 3443
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3444 "*/ int f3444() { // "/* 3444
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3445 "*/ int f3445() { // "/* 3445
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3446 "*/ int f3446() { // "/* 3446
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3447 "*/ int f3447() { // "/* 3447
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3448 "*/ int f3448() { // "/* 3448
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3449 "*/ int f3449() { // "/* 3449
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3450 "*/ int f3450() { // "/* 3450
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3451 "*/ int f3451() { // "/* 3451
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3452 "*/ int f3452() { // "/* 3452
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3453 "*/ int f3453() { // "/* 3453
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3454 "*/ int f3454() { // "/* 3454
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3455 "*/ int f3455() { // "/* 3455
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3456 "*/ int f3456() { // "/* 3456
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3457 "*/ int f3457() { // "/* 3457
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3458 "*/ int f3458() { // "/* 3458
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3459 "*/ int f3459() { // "/* 3459
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3460 "*/ int f3460() { // "/* 3460
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3461 "*/ int f3461() { // "/* 3461
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3462 "*/ int f3462() { // "/* 3462
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3463 "*/ int f3463() { // "/* 3463
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3464 "*/ int f3464() { // "/* 3464
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3465 "*/ int f3465() { // "/* 3465
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3466 "*/ int f3466() { // "/* 3466
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3467 "*/ int f3467() { // "/* 3467
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3468 "*/ int f3468() { // "/* 3468
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3469 "*/ int f3469() { // "/* 3469
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3470 "*/ int f3470() { // "/* 3470
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3471 "*/ int f3471() { // "/* 3471
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3472 "*/ int f3472() { // "/* 3472
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3473 "*/ int f3473() { // "/* 3473
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3474 "*/ int f3474() { // "/* 3474
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3475 "*/ int f3475() { // "/* 3475
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3476 "*/ int f3476() { // "/* 3476
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3477 "*/ int f3477() { // "/* 3477
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3478 "*/ int f3478() { // "/* 3478
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3479 "*/ int f3479() { // "/* 3479
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3480 "*/ int f3480() { // "/* 3480
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3481 "*/ int f3481() { // "/* 3481
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3482 "*/ int f3482() { // "/* 3482
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3483 "*/ int f3483() { // "/* 3483
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3484 "*/ int f3484() { // "/* 3484
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3485 "*/ int f3485() { // "/* 3485
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3486 "*/ int f3486() { // "/* 3486
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3487 "*/ int f3487() { // "/* 3487
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3488 "*/ int f3488() { // "/* 3488
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3489 "*/ int f3489() { // "/* 3489
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3490 "*/ int f3490() { // "/* 3490
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3491 "*/ int f3491() { // "/* 3491
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3492 "*/ int f3492() { // "/* 3492
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3493 "*/ int f3493() { // "/* 3493
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3494 "*/ int f3494() { // "/* 3494
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3495 "*/ int f3495() { // "/* 3495
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3496 "*/ int f3496() { // "/* 3496
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3497 "*/ int f3497() { // "/* 3497
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3498 "*/ int f3498() { // "/* 3498
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3499 "*/ int f3499() { // "/* 3499
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3500 "*/ int f3500() { // "/* 3500
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3501 "*/ int f3501() { // "/* 3501
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3502 "*/ int f3502() { // "/* 3502
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3503 "*/ int f3503() { // "/* 3503
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3504 "*/ int f3504() { // "/* 3504
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3505 "*/ int f3505() { // "/* 3505
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3506 "*/ int f3506() { // "/* 3506
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3507 "*/ int f3507() { // "/* 3507
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3508 "*/ int f3508() { // "/* 3508
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3509 "*/ int f3509() { // "/* 3509
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3510 "*/ int f3510() { // "/* 3510
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3511 "*/ int f3511() { // "/* 3511
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3512 "*/ int f3512() { // "/* 3512
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3513 "*/ int f3513() { // "/* 3513
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3514 "*/ int f3514() { // "/* 3514
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3515 "*/ int f3515() { // "/* 3515
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3516 "*/ int f3516() { // "/* 3516
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3517 "*/ int f3517() { // "/* 3517
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3518 "*/ int f3518() { // "/* 3518
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3519 "*/ int f3519() { // "/* 3519
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3520 "*/ int f3520() { // "/* 3520
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3521 "*/ int f3521() { // "/* 3521
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3522 "*/ int f3522() { // "/* 3522
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3523 "*/ int f3523() { // "/* 3523
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3524 "*/ int f3524() { // "/* 3524
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3525 "*/ int f3525() { // "/* 3525
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3526 "*/ int f3526() { // "/* 3526
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3527 "*/ int f3527() { // "/* 3527
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3528 "*/ int f3528() { // "/* 3528
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3529 "*/ int f3529() { // "/* 3529
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3530 "*/ int f3530() { // "/* 3530
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3531 "*/ int f3531() { // "/* 3531
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3532 "*/ int f3532() { // "/* 3532
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3533 "*/ int f3533() { // "/* 3533
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3534 "*/ int f3534() { // "/* 3534
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3535 "*/ int f3535() { // "/* 3535
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3536 "*/ int f3536() { // "/* 3536
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3537 "*/ int f3537() { // "/* 3537
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3538 "*/ int f3538() { // "/* 3538
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3539 "*/ int f3539() { // "/* 3539
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3540 "*/ int f3540() { // "/* 3540
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3541 "*/ int f3541() { // "/* 3541
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3542 "*/ int f3542() { // "/* 3542
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3543 "*/ int f3543() { // "/* 3543
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3544 "*/ int f3544() { // "/* 3544
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3545 "*/ int f3545() { // "/* 3545
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3546 "*/ int f3546() { // "/* 3546
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3547 "*/ int f3547() { // "/* 3547
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3548 "*/ int f3548() { // "/* 3548
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3549 "*/ int f3549() { // "/* 3549
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3550 "*/ int f3550() { // "/* 3550
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3551 "*/ int f3551() { // "/* 3551
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3552 "*/ int f3552() { // "/* 3552
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3553 "*/ int f3553() { // "/* 3553
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3554 "*/ int f3554() { // "/* 3554
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3555 "*/ int f3555() { // "/* 3555
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3556 "*/ int f3556() { // "/* 3556
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3557 "*/ int f3557() { // "/* 3557
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3558 "*/ int f3558() { // "/* 3558
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3559 "*/ int f3559() { // "/* 3559
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3560 "*/ int f3560() { // "/* 3560
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3561 "*/ int f3561() { // "/* 3561
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3562 "*/ int f3562() { // "/* 3562
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3563 "*/ int f3563() { // "/* 3563
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3564 "*/ int f3564() { // "/* 3564
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3565 "*/ int f3565() { // "/* 3565
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3566 "*/ int f3566() { // "/* 3566
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3567 "*/ int f3567() { // "/* 3567
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3568 "*/ int f3568() { // "/* 3568
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3569 "*/ int f3569() { // "/* 3569
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3570 "*/ int f3570() { // "/* 3570
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3571 "*/ int f3571() { // "/* 3571
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3572 "*/ int f3572() { // "/* 3572
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3573 "*/ int f3573() { // "/* 3573
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3574 "*/ int f3574() { // "/* 3574
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3575 "*/ int f3575() { // "/* 3575
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3576 "*/ int f3576() { // "/* 3576
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3577 "*/ int f3577() { // "/* 3577
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3578 "*/ int f3578() { // "/* 3578
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3579 "*/ int f3579() { // "/* 3579
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3580 "*/ int f3580() { // "/* 3580
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3581 "*/ int f3581() { // "/* 3581
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3582 "*/ int f3582() { // "/* 3582
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3583 "*/ int f3583() { // "/* 3583
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3584 "*/ int f3584() { // "/* 3584
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3585 "*/ int f3585() { // "/* 3585
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3586 "*/ int f3586() { // "/* 3586
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3587 "*/ int f3587() { // "/* 3587
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3588 "*/ int f3588() { // "/* 3588
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3589 "*/ int f3589() { // "/* 3589
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3590 "*/ int f3590() { // "/* 3590
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3591 "*/ int f3591() { // "/* 3591
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3592 "*/ int f3592() { // "/* 3592
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3593 "*/ int f3593() { // "/* 3593
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3594 "*/ int f3594() { // "/* 3594
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3595 "*/ int f3595() { // "/* 3595
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3596 "*/ int f3596() { // "/* 3596
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3597 "*/ int f3597() { // "/* 3597
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3598 "*/ int f3598() { // "/* 3598
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3599 "*/ int f3599() { // "/* 3599
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3600 "*/ int f3600() { // "/* 3600
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3601 "*/ int f3601() { // "/* 3601
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3602 "*/ int f3602() { // "/* 3602
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3603 "*/ int f3603() { // "/* 3603
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3604 "*/ int f3604() { // "/* 3604
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3605 "*/ int f3605() { // "/* 3605
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3606 "*/ int f3606() { // "/* 3606
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3607 "*/ int f3607() { // "/* 3607
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3608 "*/ int f3608() { // "/* 3608
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3609 "*/ int f3609() { // "/* 3609
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3610 "*/ int f3610() { // "/* 3610
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3611 "*/ int f3611() { // "/* 3611
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3612 "*/ int f3612() { // "/* 3612
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3613 "*/ int f3613() { // "/* 3613
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3614 "*/ int f3614() { // "/* 3614
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3615 "*/ int f3615() { // "/* 3615
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3616 "*/ int f3616() { // "/* 3616
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3617 "*/ int f3617() { // "/* 3617
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3618 "*/ int f3618() { // "/* 3618
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3619 "*/ int f3619() { // "/* 3619
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3620 "*/ int f3620() { // "/* 3620
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3621 "*/ int f3621() { // "/* 3621
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3622 "*/ int f3622() { // "/* 3622
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3623 "*/ int f3623() { // "/* 3623
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3624 "*/ int f3624() { // "/* 3624
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3625 "*/ int f3625() { // "/* 3625
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3626 "*/ int f3626() { // "/* 3626
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3627 "*/ int f3627() { // "/* 3627
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3628 "*/ int f3628() { // "/* 3628
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3629 "*/ int f3629() { // "/* 3629
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3630 "*/ int f3630() { // "/* 3630
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3631 "*/ int f3631() { // "/* 3631
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3632 "*/ int f3632() { // "/* 3632
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3633 "*/ int f3633() { // "/* 3633
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3634 "*/ int f3634() { // "/* 3634
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3635 "*/ int f3635() { // "/* 3635
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3636 "*/ int f3636() { // "/* 3636
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3637 "*/ int f3637() { // "/* 3637
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3638 "*/ int f3638() { // "/* 3638
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3639 "*/ int f3639() { // "/* 3639
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3640 "*/ int f3640() { // "/* 3640
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3641 "*/ int f3641() { // "/* 3641
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3642 "*/ int f3642() { // "/* 3642
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3643 "*/ int f3643() { // "/* 3643
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3644 "*/ int f3644() { // "/* 3644
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3645 "*/ int f3645() { // "/* 3645
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3646 "*/ int f3646() { // "/* 3646
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3647 "*/ int f3647() { // "/* 3647
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3648 "*/ int f3648() { // "/* 3648
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3649 "*/ int f3649() { // "/* 3649
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3650 "*/ int f3650() { // "/* 3650
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3651 "*/ int f3651() { // "/* 3651
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3652 "*/ int f3652() { // "/* 3652
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3653 "*/ int f3653() { // "/* 3653
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3654 "*/ int f3654() { // "/* 3654
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3655 "*/ int f3655() { // "/* 3655
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3656 "*/ int f3656() { // "/* 3656
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3657 "*/ int f3657() { // "/* 3657
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3658 "*/ int f3658() { // "/* 3658
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3659 "*/ int f3659() { // "/* 3659
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3660 "*/ int f3660() { // "/* 3660
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3661 "*/ int f3661() { // "/* 3661
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3662 "*/ int f3662() { // "/* 3662
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3663 "*/ int f3663() { // "/* 3663
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3664 "*/ int f3664() { // "/* 3664
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3665 "*/ int f3665() { // "/* 3665
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3666 "*/ int f3666() { // "/* 3666
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3667 "*/ int f3667() { // "/* 3667
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3668 "*/ int f3668() { // "/* 3668
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3669 "*/ int f3669() { // "/* 3669
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3670 "*/ int f3670() { // "/* 3670
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3671 "*/ int f3671() { // "/* 3671
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3672 "*/ int f3672() { // "/* 3672
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3673 "*/ int f3673() { // "/* 3673
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3674 "*/ int f3674() { // "/* 3674
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3675 "*/ int f3675() { // "/* 3675
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3676 "*/ int f3676() { // "/* 3676
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3677 "*/ int f3677() { // "/* 3677
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3678 "*/ int f3678() { // "/* 3678
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3679 "*/ int f3679() { // "/* 3679
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3680 "*/ int f3680() { // "/* 3680
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3681 "*/ int f3681() { // "/* 3681
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3682 "*/ int f3682() { // "/* 3682
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3683 "*/ int f3683() { // "/* 3683
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3684 "*/ int f3684() { // "/* 3684
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3685 "*/ int f3685() { // "/* 3685
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3686 "*/ int f3686() { // "/* 3686
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3687 "*/ int f3687() { // "/* 3687
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3688 "*/ int f3688() { // "/* 3688
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3689 "*/ int f3689() { // "/* 3689
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3690 "*/ int f3690() { // "/* 3690
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3691 "*/ int f3691() { // "/* 3691
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3692 "*/ int f3692() { // "/* 3692
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3693 "*/ int f3693() { // "/* 3693
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3694 "*/ int f3694() { // "/* 3694
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3695 "*/ int f3695() { // "/* 3695
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3696 "*/ int f3696() { // "/* 3696
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3697 "*/ int f3697() { // "/* 3697
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3698 "*/ int f3698() { // "/* 3698
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3699 "*/ int f3699() { // "/* 3699
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3700 "*/ int f3700() { // "/* 3700
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3701 "*/ int f3701() { // "/* 3701
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3702 "*/ int f3702() { // "/* 3702
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3703 "*/ int f3703() { // "/* 3703
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3704 "*/ int f3704() { // "/* 3704
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3705 "*/ int f3705() { // "/* 3705
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3706 "*/ int f3706() { // "/* 3706
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3707 "*/ int f3707() { // "/* 3707
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3708 "*/ int f3708() { // "/* 3708
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3709 "*/ int f3709() { // "/* 3709
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3710 "*/ int f3710() { // "/* 3710
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3711 "*/ int f3711() { // "/* 3711
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3712 "*/ int f3712() { // "/* 3712
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3713 "*/ int f3713() { // "/* 3713
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3714 "*/ int f3714() { // "/* 3714
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3715 "*/ int f3715() { // "/* 3715
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3716 "*/ int f3716() { // "/* 3716
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3717 "*/ int f3717() { // "/* 3717
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3718 "*/ int f3718() { // "/* 3718
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3719 "*/ int f3719() { // "/* 3719
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3720 "*/ int f3720() { // "/* 3720
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3721 "*/ int f3721() { // "/* 3721
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3722 "*/ int f3722() { // "/* 3722
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3723 "*/ int f3723() { // "/* 3723
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3724 "*/ int f3724() { // "/* 3724
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3725 "*/ int f3725() { // "/* 3725
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3726 "*/ int f3726() { // "/* 3726
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3727 "*/ int f3727() { // "/* 3727
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3728 "*/ int f3728() { // "/* 3728
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3729 "*/ int f3729() { // "/* 3729
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3730 "*/ int f3730() { // "/* 3730
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3731 "*/ int f3731() { // "/* 3731
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3732 "*/ int f3732() { // "/* 3732
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3733 "*/ int f3733() { // "/* 3733
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3734 "*/ int f3734() { // "/* 3734
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3735 "*/ int f3735() { // "/* 3735
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3736 "*/ int f3736() { // "/* 3736
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3737 "*/ int f3737() { // "/* 3737
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3738 "*/ int f3738() { // "/* 3738
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3739 "*/ int f3739() { // "/* 3739
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3740 "*/ int f3740() { // "/* 3740
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3741 "*/ int f3741() { // "/* 3741
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3742 "*/ int f3742() { // "/* 3742
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3743 "*/ int f3743() { // "/* 3743
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3744 "*/ int f3744() { // "/* 3744
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3745 "*/ int f3745() { // "/* 3745
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3746 "*/ int f3746() { // "/* 3746
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3747 "*/ int f3747() { // "/* 3747
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3748 "*/ int f3748() { // "/* 3748
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3749 "*/ int f3749() { // "/* 3749
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3750 "*/ int f3750() { // "/* 3750
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3751 "*/ int f3751() { // "/* 3751
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3752 "*/ int f3752() { // "/* 3752
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3753 "*/ int f3753() { // "/* 3753
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3754 "*/ int f3754() { // "/* 3754
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3755 "*/ int f3755() { // "/* 3755
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3756 "*/ int f3756() { // "/* 3756
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3757 "*/ int f3757() { // "/* 3757
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3758 "*/ int f3758() { // "/* 3758
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3759 "*/ int f3759() { // "/* 3759
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3760 "*/ int f3760() { // "/* 3760
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3761 "*/ int f3761() { // "/* 3761
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3762 "*/ int f3762() { // "/* 3762
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3763 "*/ int f3763() { // "/* 3763
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3764 "*/ int f3764() { // "/* 3764
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3765 "*/ int f3765() { // "/* 3765
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3766 "*/ int f3766() { // "/* 3766
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3767 "*/ int f3767() { // "/* 3767
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3768 "*/ int f3768() { // "/* 3768
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3769 "*/ int f3769() { // "/* 3769
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3770 "*/ int f3770() { // "/* 3770
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3771 "*/ int f3771() { // "/* 3771
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3772 "*/ int f3772() { // "/* 3772
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3773 "*/ int f3773() { // "/* 3773
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3774 "*/ int f3774() { // "/* 3774
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3775 "*/ int f3775() { // "/* 3775
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3776 "*/ int f3776() { // "/* 3776
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3777 "*/ int f3777() { // "/* 3777
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3778 "*/ int f3778() { // "/* 3778
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3779 "*/ int f3779() { // "/* 3779
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3780 "*/ int f3780() { // "/* 3780
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3781 "*/ int f3781() { // "/* 3781
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3782 "*/ int f3782() { // "/* 3782
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3783 "*/ int f3783() { // "/* 3783
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3784 "*/ int f3784() { // "/* 3784
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3785 "*/ int f3785() { // "/* 3785
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3786 "*/ int f3786() { // "/* 3786
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3787 "*/ int f3787() { // "/* 3787
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3788 "*/ int f3788() { // "/* 3788
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3789 "*/ int f3789() { // "/* 3789
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3790 "*/ int f3790() { // "/* 3790
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3791 "*/ int f3791() { // "/* 3791
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3792 "*/ int f3792() { // "/* 3792
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3793 "*/ int f3793() { // "/* 3793
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3794 "*/ int f3794() { // "/* 3794
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3795 "*/ int f3795() { // "/* 3795
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3796 "*/ int f3796() { // "/* 3796
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3797 "*/ int f3797() { // "/* 3797
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3798 "*/ int f3798() { // "/* 3798
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3799 "*/ int f3799() { // "/* 3799
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3800 "*/ int f3800() { // "/* 3800
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3801 "*/ int f3801() { // "/* 3801
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3802 "*/ int f3802() { // "/* 3802
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3803 "*/ int f3803() { // "/* 3803
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3804 "*/ int f3804() { // "/* 3804
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3805 "*/ int f3805() { // "/* 3805
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3806 "*/ int f3806() { // "/* 3806
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3807 "*/ int f3807() { // "/* 3807
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3808 "*/ int f3808() { // "/* 3808
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3809 "*/ int f3809() { // "/* 3809
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3810 "*/ int f3810() { // "/* 3810
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3811 "*/ int f3811() { // "/* 3811
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3812 "*/ int f3812() { // "/* 3812
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3813 "*/ int f3813() { // "/* 3813
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3814 "*/ int f3814() { // "/* 3814
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3815 "*/ int f3815() { // "/* 3815
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3816 "*/ int f3816() { // "/* 3816
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3817 "*/ int f3817() { // "/* 3817
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3818 "*/ int f3818() { // "/* 3818
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3819 "*/ int f3819() { // "/* 3819
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3820 "*/ int f3820() { // "/* 3820
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3821 "*/ int f3821() { // "/* 3821
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3822 "*/ int f3822() { // "/* 3822
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3823 "*/ int f3823() { // "/* 3823
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3824 "*/ int f3824() { // "/* 3824
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3825 "*/ int f3825() { // "/* 3825
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3826 "*/ int f3826() { // "/* 3826
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3827 "*/ int f3827() { // "/* 3827
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3828 "*/ int f3828() { // "/* 3828
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3829 "*/ int f3829() { // "/* 3829
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3830 "*/ int f3830() { // "/* 3830
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3831 "*/ int f3831() { // "/* 3831
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3832 "*/ int f3832() { // "/* 3832
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3833 "*/ int f3833() { // "/* 3833
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3834 "*/ int f3834() { // "/* 3834
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3835 "*/ int f3835() { // "/* 3835
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3836 "*/ int f3836() { // "/* 3836
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3837 "*/ int f3837() { // "/* 3837
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3838 "*/ int f3838() { // "/* 3838
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3839 "*/ int f3839() { // "/* 3839
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3840 "*/ int f3840() { // "/* 3840
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3841 "*/ int f3841() { // "/* 3841
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3842 "*/ int f3842() { // "/* 3842
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3843 "*/ int f3843() { // "/* 3843
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3844 "*/ int f3844() { // "/* 3844
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3845 "*/ int f3845() { // "/* 3845
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3846 "*/ int f3846() { // "/* 3846
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3847 "*/ int f3847() { // "/* 3847
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3848 "*/ int f3848() { // "/* 3848
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3849 "*/ int f3849() { // "/* 3849
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3850 "*/ int f3850() { // "/* 3850
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3851 "*/ int f3851() { // "/* 3851
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3852 "*/ int f3852() { // "/* 3852
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3853 "*/ int f3853() { // "/* 3853
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3854 "*/ int f3854() { // "/* 3854
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3855 "*/ int f3855() { // "/* 3855
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3856 "*/ int f3856() { // "/* 3856
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3857 "*/ int f3857() { // "/* 3857
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3858 "*/ int f3858() { // "/* 3858
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3859 "*/ int f3859() { // "/* 3859
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3860 "*/ int f3860() { // "/* 3860
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3861 "*/ int f3861() { // "/* 3861
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3862 "*/ int f3862() { // "/* 3862
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3863 "*/ int f3863() { // "/* 3863
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3864 "*/ int f3864() { // "/* 3864
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3865 "*/ int f3865() { // "/* 3865
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3866 "*/ int f3866() { // "/* 3866
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3867 "*/ int f3867() { // "/* 3867
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3868 "*/ int f3868() { // "/* 3868
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3869 "*/ int f3869() { // "/* 3869
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3870 "*/ int f3870() { // "/* 3870
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3871 "*/ int f3871() { // "/* 3871
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3872 "*/ int f3872() { // "/* 3872
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3873 "*/ int f3873() { // "/* 3873
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3874 "*/ int f3874() { // "/* 3874
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3875 "*/ int f3875() { // "/* 3875
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3876 "*/ int f3876() { // "/* 3876
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3877 "*/ int f3877() { // "/* 3877
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3878 "*/ int f3878() { // "/* 3878
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3879 "*/ int f3879() { // "/* 3879
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3880 "*/ int f3880() { // "/* 3880
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3881 "*/ int f3881() { // "/* 3881
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3882 "*/ int f3882() { // "/* 3882
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3883 "*/ int f3883() { // "/* 3883
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3884 "*/ int f3884() { // "/* 3884
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3885 "*/ int f3885() { // "/* 3885
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3886 "*/ int f3886() { // "/* 3886
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3887 "*/ int f3887() { // "/* 3887
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3888 "*/ int f3888() { // "/* 3888
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3889 "*/ int f3889() { // "/* 3889
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3890 "*/ int f3890() { // "/* 3890
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3891 "*/ int f3891() { // "/* 3891
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3892 "*/ int f3892() { // "/* 3892
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3893 "*/ int f3893() { // "/* 3893
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3894 "*/ int f3894() { // "/* 3894
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3895 "*/ int f3895() { // "/* 3895
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3896 "*/ int f3896() { // "/* 3896
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3897 "*/ int f3897() { // "/* 3897
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3898 "*/ int f3898() { // "/* 3898
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3899 "*/ int f3899() { // "/* 3899
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3900 "*/ int f3900() { // "/* 3900
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3901 "*/ int f3901() { // "/* 3901
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3902 "*/ int f3902() { // "/* 3902
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3903 "*/ int f3903() { // "/* 3903
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3904 "*/ int f3904() { // "/* 3904
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3905 "*/ int f3905() { // "/* 3905
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3906 "*/ int f3906() { // "/* 3906
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3907 "*/ int f3907() { // "/* 3907
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3908 "*/ int f3908() { // "/* 3908
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3909 "*/ int f3909() { // "/* 3909
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3910 "*/ int f3910() { // "/* 3910
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3911 "*/ int f3911() { // "/* 3911
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3912 "*/ int f3912() { // "/* 3912
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3913 "*/ int f3913() { // "/* 3913
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3914 "*/ int f3914() { // "/* 3914
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3915 "*/ int f3915() { // "/* 3915
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3916 "*/ int f3916() { // "/* 3916
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3917 "*/ int f3917() { // "/* 3917
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3918 "*/ int f3918() { // "/* 3918
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3919 "*/ int f3919() { // "/* 3919
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3920 "*/ int f3920() { // "/* 3920
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3921 "*/ int f3921() { // "/* 3921
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3922 "*/ int f3922() { // "/* 3922
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3923 "*/ int f3923() { // "/* 3923
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3924 "*/ int f3924() { // "/* 3924
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3925 "*/ int f3925() { // "/* 3925
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3926 "*/ int f3926() { // "/* 3926
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3927 "*/ int f3927() { // "/* 3927
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3928 "*/ int f3928() { // "/* 3928
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3929 "*/ int f3929() { // "/* 3929
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3930 "*/ int f3930() { // "/* 3930
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3931 "*/ int f3931() { // "/* 3931
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3932 "*/ int f3932() { // "/* 3932
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3933 "*/ int f3933() { // "/* 3933
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3934 "*/ int f3934() { // "/* 3934
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3935 "*/ int f3935() { // "/* 3935
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3936 "*/ int f3936() { // "/* 3936
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3937 "*/ int f3937() { // "/* 3937
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3938 "*/ int f3938() { // "/* 3938
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3939 "*/ int f3939() { // "/* 3939
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3940 "*/ int f3940() { // "/* 3940
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3941 "*/ int f3941() { // "/* 3941
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3942 "*/ int f3942() { // "/* 3942
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3943 "*/ int f3943() { // "/* 3943
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3944 "*/ int f3944() { // "/* 3944
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3945 "*/ int f3945() { // "/* 3945
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3946 "*/ int f3946() { // "/* 3946
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3947 "*/ int f3947() { // "/* 3947
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3948 "*/ int f3948() { // "/* 3948
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3949 "*/ int f3949() { // "/* 3949
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3950 "*/ int f3950() { // "/* 3950
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3951 "*/ int f3951() { // "/* 3951
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3952 "*/ int f3952() { // "/* 3952
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3953 "*/ int f3953() { // "/* 3953
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3954 "*/ int f3954() { // "/* 3954
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3955 "*/ int f3955() { // "/* 3955
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3956 "*/ int f3956() { // "/* 3956
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3957 "*/ int f3957() { // "/* 3957
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3958 "*/ int f3958() { // "/* 3958
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3959 "*/ int f3959() { // "/* 3959
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3960 "*/ int f3960() { // "/* 3960
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3961 "*/ int f3961() { // "/* 3961
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3962 "*/ int f3962() { // "/* 3962
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3963 "*/ int f3963() { // "/* 3963
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3964 "*/ int f3964() { // "/* 3964
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3965 "*/ int f3965() { // "/* 3965
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3966 "*/ int f3966() { // "/* 3966
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3967 "*/ int f3967() { // "/* 3967
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3968 "*/ int f3968() { // "/* 3968
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3969 "*/ int f3969() { // "/* 3969
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3970 "*/ int f3970() { // "/* 3970
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3971 "*/ int f3971() { // "/* 3971
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3972 "*/ int f3972() { // "/* 3972
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3973 "*/ int f3973() { // "/* 3973
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3974 "*/ int f3974() { // "/* 3974
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3975 "*/ int f3975() { // "/* 3975
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3976 "*/ int f3976() { // "/* 3976
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3977 "*/ int f3977() { // "/* 3977
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3978 "*/ int f3978() { // "/* 3978
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3979 "*/ int f3979() { // "/* 3979
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3980 "*/ int f3980() { // "/* 3980
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3981 "*/ int f3981() { // "/* 3981
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3982 "*/ int f3982() { // "/* 3982
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3983 "*/ int f3983() { // "/* 3983
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3984 "*/ int f3984() { // "/* 3984
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3985 "*/ int f3985() { // "/* 3985
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3986 "*/ int f3986() { // "/* 3986
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3987 "*/ int f3987() { // "/* 3987
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3988 "*/ int f3988() { // "/* 3988
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3989 "*/ int f3989() { // "/* 3989
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3990 "*/ int f3990() { // "/* 3990
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3991 "*/ int f3991() { // "/* 3991
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3992 "*/ int f3992() { // "/* 3992
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3993 "*/ int f3993() { // "/* 3993
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3994 "*/ int f3994() { // "/* 3994
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3995 "*/ int f3995() { // "/* 3995
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3996 "*/ int f3996() { // "/* 3996
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3997 "*/ int f3997() { // "/* 3997
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3998 "*/ int f3998() { // "/* 3998
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 3999 "*/ int f3999() { // "/* 3999
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4000 "*/ int f4000() { // "/* 4000
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4001 "*/ int f4001() { // "/* 4001
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4002 "*/ int f4002() { // "/* 4002
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4003 "*/ int f4003() { // "/* 4003
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4004 "*/ int f4004() { // "/* 4004
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4005 "*/ int f4005() { // "/* 4005
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4006 "*/ int f4006() { // "/* 4006
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4007 "*/ int f4007() { // "/* 4007
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4008 "*/ int f4008() { // "/* 4008
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4009 "*/ int f4009() { // "/* 4009
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4010 "*/ int f4010() { // "/* 4010
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4011 "*/ int f4011() { // "/* 4011
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4012 "*/ int f4012() { // "/* 4012
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4013 "*/ int f4013() { // "/* 4013
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4014 "*/ int f4014() { // "/* 4014
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4015 "*/ int f4015() { // "/* 4015
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4016 "*/ int f4016() { // "/* 4016
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4017 "*/ int f4017() { // "/* 4017
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4018 "*/ int f4018() { // "/* 4018
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4019 "*/ int f4019() { // "/* 4019
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4020 "*/ int f4020() { // "/* 4020
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4021 "*/ int f4021() { // "/* 4021
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4022 "*/ int f4022() { // "/* 4022
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4023 "*/ int f4023() { // "/* 4023
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4024 "*/ int f4024() { // "/* 4024
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4025 "*/ int f4025() { // "/* 4025
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4026 "*/ int f4026() { // "/* 4026
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4027 "*/ int f4027() { // "/* 4027
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4028 "*/ int f4028() { // "/* 4028
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4029 "*/ int f4029() { // "/* 4029
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4030 "*/ int f4030() { // "/* 4030
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4031 "*/ int f4031() { // "/* 4031
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4032 "*/ int f4032() { // "/* 4032
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4033 "*/ int f4033() { // "/* 4033
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4034 "*/ int f4034() { // "/* 4034
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4035 "*/ int f4035() { // "/* 4035
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4036 "*/ int f4036() { // "/* 4036
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4037 "*/ int f4037() { // "/* 4037
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4038 "*/ int f4038() { // "/* 4038
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4039 "*/ int f4039() { // "/* 4039
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4040 "*/ int f4040() { // "/* 4040
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4041 "*/ int f4041() { // "/* 4041
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4042 "*/ int f4042() { // "/* 4042
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4043 "*/ int f4043() { // "/* 4043
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4044 "*/ int f4044() { // "/* 4044
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4045 "*/ int f4045() { // "/* 4045
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4046 "*/ int f4046() { // "/* 4046
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4047 "*/ int f4047() { // "/* 4047
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4048 "*/ int f4048() { // "/* 4048
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4049 "*/ int f4049() { // "/* 4049
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4050 "*/ int f4050() { // "/* 4050
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4051 "*/ int f4051() { // "/* 4051
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4052 "*/ int f4052() { // "/* 4052
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4053 "*/ int f4053() { // "/* 4053
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4054 "*/ int f4054() { // "/* 4054
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4055 "*/ int f4055() { // "/* 4055
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4056 "*/ int f4056() { // "/* 4056
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4057 "*/ int f4057() { // "/* 4057
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4058 "*/ int f4058() { // "/* 4058
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4059 "*/ int f4059() { // "/* 4059
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4060 "*/ int f4060() { // "/* 4060
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4061 "*/ int f4061() { // "/* 4061
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4062 "*/ int f4062() { // "/* 4062
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4063 "*/ int f4063() { // "/* 4063
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4064 "*/ int f4064() { // "/* 4064
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4065 "*/ int f4065() { // "/* 4065
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4066 "*/ int f4066() { // "/* 4066
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4067 "*/ int f4067() { // "/* 4067
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4068 "*/ int f4068() { // "/* 4068
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4069 "*/ int f4069() { // "/* 4069
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4070 "*/ int f4070() { // "/* 4070
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4071 "*/ int f4071() { // "/* 4071
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4072 "*/ int f4072() { // "/* 4072
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4073 "*/ int f4073() { // "/* 4073
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4074 "*/ int f4074() { // "/* 4074
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4075 "*/ int f4075() { // "/* 4075
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4076 "*/ int f4076() { // "/* 4076
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4077 "*/ int f4077() { // "/* 4077
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4078 "*/ int f4078() { // "/* 4078
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4079 "*/ int f4079() { // "/* 4079
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4080 "*/ int f4080() { // "/* 4080
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4081 "*/ int f4081() { // "/* 4081
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4082 "*/ int f4082() { // "/* 4082
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4083 "*/ int f4083() { // "/* 4083
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4084 "*/ int f4084() { // "/* 4084
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4085 "*/ int f4085() { // "/* 4085
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4086 "*/ int f4086() { // "/* 4086
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4087 "*/ int f4087() { // "/* 4087
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4088 "*/ int f4088() { // "/* 4088
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4089 "*/ int f4089() { // "/* 4089
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4090 "*/ int f4090() { // "/* 4090
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4091 "*/ int f4091() { // "/* 4091
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4092 "*/ int f4092() { // "/* 4092
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4093 "*/ int f4093() { // "/* 4093
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4094 "*/ int f4094() { // "/* 4094
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4095 "*/ int f4095() { // "/* 4095
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4096 "*/ int f4096() { // "/* 4096
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4097 "*/ int f4097() { // "/* 4097
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4098 "*/ int f4098() { // "/* 4098
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4099 "*/ int f4099() { // "/* 4099
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4100 "*/ int f4100() { // "/* 4100
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4101 "*/ int f4101() { // "/* 4101
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4102 "*/ int f4102() { // "/* 4102
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4103 "*/ int f4103() { // "/* 4103
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4104 "*/ int f4104() { // "/* 4104
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4105 "*/ int f4105() { // "/* 4105
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4106 "*/ int f4106() { // "/* 4106
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4107 "*/ int f4107() { // "/* 4107
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4108 "*/ int f4108() { // "/* 4108
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4109 "*/ int f4109() { // "/* 4109
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4110 "*/ int f4110() { // "/* 4110
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4111 "*/ int f4111() { // "/* 4111
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4112 "*/ int f4112() { // "/* 4112
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4113 "*/ int f4113() { // "/* 4113
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4114 "*/ int f4114() { // "/* 4114
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4115 "*/ int f4115() { // "/* 4115
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4116 "*/ int f4116() { // "/* 4116
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4117 "*/ int f4117() { // "/* 4117
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4118 "*/ int f4118() { // "/* 4118
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4119 "*/ int f4119() { // "/* 4119
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4120 "*/ int f4120() { // "/* 4120
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4121 "*/ int f4121() { // "/* 4121
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4122 "*/ int f4122() { // "/* 4122
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4123 "*/ int f4123() { // "/* 4123
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4124 "*/ int f4124() { // "/* 4124
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4125 "*/ int f4125() { // "/* 4125
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4126 "*/ int f4126() { // "/* 4126
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4127 "*/ int f4127() { // "/* 4127
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4128 "*/ int f4128() { // "/* 4128
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4129 "*/ int f4129() { // "/* 4129
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4130 "*/ int f4130() { // "/* 4130
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4131 "*/ int f4131() { // "/* 4131
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4132 "*/ int f4132() { // "/* 4132
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4133 "*/ int f4133() { // "/* 4133
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4134 "*/ int f4134() { // "/* 4134
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4135 "*/ int f4135() { // "/* 4135
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4136 "*/ int f4136() { // "/* 4136
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4137 "*/ int f4137() { // "/* 4137
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4138 "*/ int f4138() { // "/* 4138
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4139 "*/ int f4139() { // "/* 4139
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4140 "*/ int f4140() { // "/* 4140
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4141 "*/ int f4141() { // "/* 4141
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4142 "*/ int f4142() { // "/* 4142
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4143 "*/ int f4143() { // "/* 4143
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4144 "*/ int f4144() { // "/* 4144
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4145 "*/ int f4145() { // "/* 4145
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4146 "*/ int f4146() { // "/* 4146
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4147 "*/ int f4147() { // "/* 4147
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4148 "*/ int f4148() { // "/* 4148
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4149 "*/ int f4149() { // "/* 4149
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4150 "*/ int f4150() { // "/* 4150
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4151 "*/ int f4151() { // "/* 4151
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4152 "*/ int f4152() { // "/* 4152
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4153 "*/ int f4153() { // "/* 4153
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4154 "*/ int f4154() { // "/* 4154
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4155 "*/ int f4155() { // "/* 4155
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4156 "*/ int f4156() { // "/* 4156
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4157 "*/ int f4157() { // "/* 4157
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4158 "*/ int f4158() { // "/* 4158
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4159 "*/ int f4159() { // "/* 4159
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4160 "*/ int f4160() { // "/* 4160
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4161 "*/ int f4161() { // "/* 4161
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4162 "*/ int f4162() { // "/* 4162
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4163 "*/ int f4163() { // "/* 4163
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4164 "*/ int f4164() { // "/* 4164
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4165 "*/ int f4165() { // "/* 4165
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4166 "*/ int f4166() { // "/* 4166
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4167 "*/ int f4167() { // "/* 4167
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4168 "*/ int f4168() { // "/* 4168
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4169 "*/ int f4169() { // "/* 4169
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4170 "*/ int f4170() { // "/* 4170
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4171 "*/ int f4171() { // "/* 4171
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4172 "*/ int f4172() { // "/* 4172
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4173 "*/ int f4173() { // "/* 4173
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4174 "*/ int f4174() { // "/* 4174
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4175 "*/ int f4175() { // "/* 4175
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4176 "*/ int f4176() { // "/* 4176
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4177 "*/ int f4177() { // "/* 4177
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4178 "*/ int f4178() { // "/* 4178
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4179 "*/ int f4179() { // "/* 4179
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4180 "*/ int f4180() { // "/* 4180
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4181 "*/ int f4181() { // "/* 4181
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4182 "*/ int f4182() { // "/* 4182
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4183 "*/ int f4183() { // "/* 4183
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4184 "*/ int f4184() { // "/* 4184
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4185 "*/ int f4185() { // "/* 4185
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4186 "*/ int f4186() { // "/* 4186
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4187 "*/ int f4187() { // "/* 4187
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4188 "*/ int f4188() { // "/* 4188
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4189 "*/ int f4189() { // "/* 4189
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4190 "*/ int f4190() { // "/* 4190
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4191 "*/ int f4191() { // "/* 4191
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4192 "*/ int f4192() { // "/* 4192
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4193 "*/ int f4193() { // "/* 4193
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4194 "*/ int f4194() { // "/* 4194
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4195 "*/ int f4195() { // "/* 4195
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4196 "*/ int f4196() { // "/* 4196
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4197 "*/ int f4197() { // "/* 4197
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4198 "*/ int f4198() { // "/* 4198
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4199 "*/ int f4199() { // "/* 4199
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4200 "*/ int f4200() { // "/* 4200
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4201 "*/ int f4201() { // "/* 4201
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4202 "*/ int f4202() { // "/* 4202
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4203 "*/ int f4203() { // "/* 4203
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4204 "*/ int f4204() { // "/* 4204
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4205 "*/ int f4205() { // "/* 4205
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4206 "*/ int f4206() { // "/* 4206
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4207 "*/ int f4207() { // "/* 4207
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4208 "*/ int f4208() { // "/* 4208
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4209 "*/ int f4209() { // "/* 4209
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4210 "*/ int f4210() { // "/* 4210
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4211 "*/ int f4211() { // "/* 4211
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4212 "*/ int f4212() { // "/* 4212
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4213 "*/ int f4213() { // "/* 4213
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4214 "*/ int f4214() { // "/* 4214
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4215 "*/ int f4215() { // "/* 4215
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4216 "*/ int f4216() { // "/* 4216
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4217 "*/ int f4217() { // "/* 4217
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4218 "*/ int f4218() { // "/* 4218
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4219 "*/ int f4219() { // "/* 4219
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4220 "*/ int f4220() { // "/* 4220
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4221 "*/ int f4221() { // "/* 4221
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4222 "*/ int f4222() { // "/* 4222
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4223 "*/ int f4223() { // "/* 4223
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4224 "*/ int f4224() { // "/* 4224
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4225 "*/ int f4225() { // "/* 4225
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4226 "*/ int f4226() { // "/* 4226
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4227 "*/ int f4227() { // "/* 4227
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4228 "*/ int f4228() { // "/* 4228
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4229 "*/ int f4229() { // "/* 4229
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4230 "*/ int f4230() { // "/* 4230
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4231 "*/ int f4231() { // "/* 4231
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4232 "*/ int f4232() { // "/* 4232
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4233 "*/ int f4233() { // "/* 4233
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4234 "*/ int f4234() { // "/* 4234
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4235 "*/ int f4235() { // "/* 4235
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4236 "*/ int f4236() { // "/* 4236
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4237 "*/ int f4237() { // "/* 4237
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4238 "*/ int f4238() { // "/* 4238
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4239 "*/ int f4239() { // "/* 4239
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4240 "*/ int f4240() { // "/* 4240
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4241 "*/ int f4241() { // "/* 4241
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4242 "*/ int f4242() { // "/* 4242
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4243 "*/ int f4243() { // "/* 4243
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4244 "*/ int f4244() { // "/* 4244
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4245 "*/ int f4245() { // "/* 4245
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4246 "*/ int f4246() { // "/* 4246
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4247 "*/ int f4247() { // "/* 4247
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4248 "*/ int f4248() { // "/* 4248
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4249 "*/ int f4249() { // "/* 4249
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4250 "*/ int f4250() { // "/* 4250
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4251 "*/ int f4251() { // "/* 4251
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4252 "*/ int f4252() { // "/* 4252
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4253 "*/ int f4253() { // "/* 4253
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4254 "*/ int f4254() { // "/* 4254
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4255 "*/ int f4255() { // "/* 4255
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4256 "*/ int f4256() { // "/* 4256
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4257 "*/ int f4257() { // "/* 4257
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4258 "*/ int f4258() { // "/* 4258
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4259 "*/ int f4259() { // "/* 4259
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4260 "*/ int f4260() { // "/* 4260
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4261 "*/ int f4261() { // "/* 4261
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4262 "*/ int f4262() { // "/* 4262
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4263 "*/ int f4263() { // "/* 4263
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4264 "*/ int f4264() { // "/* 4264
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4265 "*/ int f4265() { // "/* 4265
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4266 "*/ int f4266() { // "/* 4266
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4267 "*/ int f4267() { // "/* 4267
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4268 "*/ int f4268() { // "/* 4268
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4269 "*/ int f4269() { // "/* 4269
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4270 "*/ int f4270() { // "/* 4270
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4271 "*/ int f4271() { // "/* 4271
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4272 "*/ int f4272() { // "/* 4272
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4273 "*/ int f4273() { // "/* 4273
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4274 "*/ int f4274() { // "/* 4274
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4275 "*/ int f4275() { // "/* 4275
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4276 "*/ int f4276() { // "/* 4276
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4277 "*/ int f4277() { // "/* 4277
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4278 "*/ int f4278() { // "/* 4278
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4279 "*/ int f4279() { // "/* 4279
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4280 "*/ int f4280() { // "/* 4280
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4281 "*/ int f4281() { // "/* 4281
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4282 "*/ int f4282() { // "/* 4282
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4283 "*/ int f4283() { // "/* 4283
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4284 "*/ int f4284() { // "/* 4284
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4285 "*/ int f4285() { // "/* 4285
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4286 "*/ int f4286() { // "/* 4286
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4287 "*/ int f4287() { // "/* 4287
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4288 "*/ int f4288() { // "/* 4288
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4289 "*/ int f4289() { // "/* 4289
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4290 "*/ int f4290() { // "/* 4290
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4291 "*/ int f4291() { // "/* 4291
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4292 "*/ int f4292() { // "/* 4292
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4293 "*/ int f4293() { // "/* 4293
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4294 "*/ int f4294() { // "/* 4294
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4295 "*/ int f4295() { // "/* 4295
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4296 "*/ int f4296() { // "/* 4296
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4297 "*/ int f4297() { // "/* 4297
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4298 "*/ int f4298() { // "/* 4298
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4299 "*/ int f4299() { // "/* 4299
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4300 "*/ int f4300() { // "/* 4300
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4301 "*/ int f4301() { // "/* 4301
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4302 "*/ int f4302() { // "/* 4302
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4303 "*/ int f4303() { // "/* 4303
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4304 "*/ int f4304() { // "/* 4304
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4305 "*/ int f4305() { // "/* 4305
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4306 "*/ int f4306() { // "/* 4306
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4307 "*/ int f4307() { // "/* 4307
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4308 "*/ int f4308() { // "/* 4308
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4309 "*/ int f4309() { // "/* 4309
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4310 "*/ int f4310() { // "/* 4310
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4311 "*/ int f4311() { // "/* 4311
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4312 "*/ int f4312() { // "/* 4312
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4313 "*/ int f4313() { // "/* 4313
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4314 "*/ int f4314() { // "/* 4314
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4315 "*/ int f4315() { // "/* 4315
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4316 "*/ int f4316() { // "/* 4316
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4317 "*/ int f4317() { // "/* 4317
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4318 "*/ int f4318() { // "/* 4318
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4319 "*/ int f4319() { // "/* 4319
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4320 "*/ int f4320() { // "/* 4320
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4321 "*/ int f4321() { // "/* 4321
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4322 "*/ int f4322() { // "/* 4322
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4323 "*/ int f4323() { // "/* 4323
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4324 "*/ int f4324() { // "/* 4324
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4325 "*/ int f4325() { // "/* 4325
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4326 "*/ int f4326() { // "/* 4326
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4327 "*/ int f4327() { // "/* 4327
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4328 "*/ int f4328() { // "/* 4328
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4329 "*/ int f4329() { // "/* 4329
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4330 "*/ int f4330() { // "/* 4330
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4331 "*/ int f4331() { // "/* 4331
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4332 "*/ int f4332() { // "/* 4332
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4333 "*/ int f4333() { // "/* 4333
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4334 "*/ int f4334() { // "/* 4334
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4335 "*/ int f4335() { // "/* 4335
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4336 "*/ int f4336() { // "/* 4336
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4337 "*/ int f4337() { // "/* 4337
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4338 "*/ int f4338() { // "/* 4338
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4339 "*/ int f4339() { // "/* 4339
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4340 "*/ int f4340() { // "/* 4340
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4341 "*/ int f4341() { // "/* 4341
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4342 "*/ int f4342() { // "/* 4342
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4343 "*/ int f4343() { // "/* 4343
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4344 "*/ int f4344() { // "/* 4344
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4345 "*/ int f4345() { // "/* 4345
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4346 "*/ int f4346() { // "/* 4346
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4347 "*/ int f4347() { // "/* 4347
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4348 "*/ int f4348() { // "/* 4348
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4349 "*/ int f4349() { // "/* 4349
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4350 "*/ int f4350() { // "/* 4350
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4351 "*/ int f4351() { // "/* 4351
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4352 "*/ int f4352() { // "/* 4352
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4353 "*/ int f4353() { // "/* 4353
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4354 "*/ int f4354() { // "/* 4354
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4355 "*/ int f4355() { // "/* 4355
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4356 "*/ int f4356() { // "/* 4356
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4357 "*/ int f4357() { // "/* 4357
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4358 "*/ int f4358() { // "/* 4358
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4359 "*/ int f4359() { // "/* 4359
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4360 "*/ int f4360() { // "/* 4360
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4361 "*/ int f4361() { // "/* 4361
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4362 "*/ int f4362() { // "/* 4362
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4363 "*/ int f4363() { // "/* 4363
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4364 "*/ int f4364() { // "/* 4364
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4365 "*/ int f4365() { // "/* 4365
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4366 "*/ int f4366() { // "/* 4366
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4367 "*/ int f4367() { // "/* 4367
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4368 "*/ int f4368() { // "/* 4368
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4369 "*/ int f4369() { // "/* 4369
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4370 "*/ int f4370() { // "/* 4370
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4371 "*/ int f4371() { // "/* 4371
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4372 "*/ int f4372() { // "/* 4372
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4373 "*/ int f4373() { // "/* 4373
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4374 "*/ int f4374() { // "/* 4374
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4375 "*/ int f4375() { // "/* 4375
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4376 "*/ int f4376() { // "/* 4376
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4377 "*/ int f4377() { // "/* 4377
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4378 "*/ int f4378() { // "/* 4378
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4379 "*/ int f4379() { // "/* 4379
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4380 "*/ int f4380() { // "/* 4380
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4381 "*/ int f4381() { // "/* 4381
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4382 "*/ int f4382() { // "/* 4382
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4383 "*/ int f4383() { // "/* 4383
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4384 "*/ int f4384() { // "/* 4384
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4385 "*/ int f4385() { // "/* 4385
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4386 "*/ int f4386() { // "/* 4386
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4387 "*/ int f4387() { // "/* 4387
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4388 "*/ int f4388() { // "/* 4388
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4389 "*/ int f4389() { // "/* 4389
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4390 "*/ int f4390() { // "/* 4390
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4391 "*/ int f4391() { // "/* 4391
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4392 "*/ int f4392() { // "/* 4392
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4393 "*/ int f4393() { // "/* 4393
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4394 "*/ int f4394() { // "/* 4394
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4395 "*/ int f4395() { // "/* 4395
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4396 "*/ int f4396() { // "/* 4396
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4397 "*/ int f4397() { // "/* 4397
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4398 "*/ int f4398() { // "/* 4398
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4399 "*/ int f4399() { // "/* 4399
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4400 "*/ int f4400() { // "/* 4400
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4401 "*/ int f4401() { // "/* 4401
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4402 "*/ int f4402() { // "/* 4402
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4403 "*/ int f4403() { // "/* 4403
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4404 "*/ int f4404() { // "/* 4404
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4405 "*/ int f4405() { // "/* 4405
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4406 "*/ int f4406() { // "/* 4406
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4407 "*/ int f4407() { // "/* 4407
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4408 "*/ int f4408() { // "/* 4408
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4409 "*/ int f4409() { // "/* 4409
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4410 "*/ int f4410() { // "/* 4410
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4411 "*/ int f4411() { // "/* 4411
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4412 "*/ int f4412() { // "/* 4412
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4413 "*/ int f4413() { // "/* 4413
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4414 "*/ int f4414() { // "/* 4414
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4415 "*/ int f4415() { // "/* 4415
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4416 "*/ int f4416() { // "/* 4416
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4417 "*/ int f4417() { // "/* 4417
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4418 "*/ int f4418() { // "/* 4418
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4419 "*/ int f4419() { // "/* 4419
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4420 "*/ int f4420() { // "/* 4420
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4421 "*/ int f4421() { // "/* 4421
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4422 "*/ int f4422() { // "/* 4422
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4423 "*/ int f4423() { // "/* 4423
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4424 "*/ int f4424() { // "/* 4424
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4425 "*/ int f4425() { // "/* 4425
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4426 "*/ int f4426() { // "/* 4426
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4427 "*/ int f4427() { // "/* 4427
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4428 "*/ int f4428() { // "/* 4428
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4429 "*/ int f4429() { // "/* 4429
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4430 "*/ int f4430() { // "/* 4430
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4431 "*/ int f4431() { // "/* 4431
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4432 "*/ int f4432() { // "/* 4432
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4433 "*/ int f4433() { // "/* 4433
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4434 "*/ int f4434() { // "/* 4434
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4435 "*/ int f4435() { // "/* 4435
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4436 "*/ int f4436() { // "/* 4436
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4437 "*/ int f4437() { // "/* 4437
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4438 "*/ int f4438() { // "/* 4438
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4439 "*/ int f4439() { // "/* 4439
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4440 "*/ int f4440() { // "/* 4440
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4441 "*/ int f4441() { // "/* 4441
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4442 "*/ int f4442() { // "/* 4442
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4443 "*/ int f4443() { // "/* 4443
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4444 "*/ int f4444() { // "/* 4444
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4445 "*/ int f4445() { // "/* 4445
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4446 "*/ int f4446() { // "/* 4446
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4447 "*/ int f4447() { // "/* 4447
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4448 "*/ int f4448() { // "/* 4448
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4449 "*/ int f4449() { // "/* 4449
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4450 "*/ int f4450() { // "/* 4450
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4451 "*/ int f4451() { // "/* 4451
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4452 "*/ int f4452() { // "/* 4452
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4453 "*/ int f4453() { // "/* 4453
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4454 "*/ int f4454() { // "/* 4454
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4455 "*/ int f4455() { // "/* 4455
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4456 "*/ int f4456() { // "/* 4456
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4457 "*/ int f4457() { // "/* 4457
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4458 "*/ int f4458() { // "/* 4458
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4459 "*/ int f4459() { // "/* 4459
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4460 "*/ int f4460() { // "/* 4460
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4461 "*/ int f4461() { // "/* 4461
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4462 "*/ int f4462() { // "/* 4462
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4463 "*/ int f4463() { // "/* 4463
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4464 "*/ int f4464() { // "/* 4464
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4465 "*/ int f4465() { // "/* 4465
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4466 "*/ int f4466() { // "/* 4466
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4467 "*/ int f4467() { // "/* 4467
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4468 "*/ int f4468() { // "/* 4468
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4469 "*/ int f4469() { // "/* 4469
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4470 "*/ int f4470() { // "/* 4470
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4471 "*/ int f4471() { // "/* 4471
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4472 "*/ int f4472() { // "/* 4472
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4473 "*/ int f4473() { // "/* 4473
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4474 "*/ int f4474() { // "/* 4474
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4475 "*/ int f4475() { // "/* 4475
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4476 "*/ int f4476() { // "/* 4476
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4477 "*/ int f4477() { // "/* 4477
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4478 "*/ int f4478() { // "/* 4478
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4479 "*/ int f4479() { // "/* 4479
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4480 "*/ int f4480() { // "/* 4480
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4481 "*/ int f4481() { // "/* 4481
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4482 "*/ int f4482() { // "/* 4482
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4483 "*/ int f4483() { // "/* 4483
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4484 "*/ int f4484() { // "/* 4484
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4485 "*/ int f4485() { // "/* 4485
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4486 "*/ int f4486() { // "/* 4486
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4487 "*/ int f4487() { // "/* 4487
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4488 "*/ int f4488() { // "/* 4488
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4489 "*/ int f4489() { // "/* 4489
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4490 "*/ int f4490() { // "/* 4490
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4491 "*/ int f4491() { // "/* 4491
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4492 "*/ int f4492() { // "/* 4492
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4493 "*/ int f4493() { // "/* 4493
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4494 "*/ int f4494() { // "/* 4494
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4495 "*/ int f4495() { // "/* 4495
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4496 "*/ int f4496() { // "/* 4496
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4497 "*/ int f4497() { // "/* 4497
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4498 "*/ int f4498() { // "/* 4498
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4499 "*/ int f4499() { // "/* 4499
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4500 "*/ int f4500() { // "/* 4500
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4501 "*/ int f4501() { // "/* 4501
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4502 "*/ int f4502() { // "/* 4502
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4503 "*/ int f4503() { // "/* 4503
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4504 "*/ int f4504() { // "/* 4504
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4505 "*/ int f4505() { // "/* 4505
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4506 "*/ int f4506() { // "/* 4506
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4507 "*/ int f4507() { // "/* 4507
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4508 "*/ int f4508() { // "/* 4508
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4509 "*/ int f4509() { // "/* 4509
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4510 "*/ int f4510() { // "/* 4510
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4511 "*/ int f4511() { // "/* 4511
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4512 "*/ int f4512() { // "/* 4512
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4513 "*/ int f4513() { // "/* 4513
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4514 "*/ int f4514() { // "/* 4514
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4515 "*/ int f4515() { // "/* 4515
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4516 "*/ int f4516() { // "/* 4516
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4517 "*/ int f4517() { // "/* 4517
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4518 "*/ int f4518() { // "/* 4518
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4519 "*/ int f4519() { // "/* 4519
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4520 "*/ int f4520() { // "/* 4520
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4521 "*/ int f4521() { // "/* 4521
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4522 "*/ int f4522() { // "/* 4522
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4523 "*/ int f4523() { // "/* 4523
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4524 "*/ int f4524() { // "/* 4524
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4525 "*/ int f4525() { // "/* 4525
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4526 "*/ int f4526() { // "/* 4526
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4527 "*/ int f4527() { // "/* 4527
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4528 "*/ int f4528() { // "/* 4528
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4529 "*/ int f4529() { // "/* 4529
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4530 "*/ int f4530() { // "/* 4530
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4531 "*/ int f4531() { // "/* 4531
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4532 "*/ int f4532() { // "/* 4532
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4533 "*/ int f4533() { // "/* 4533
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4534 "*/ int f4534() { // "/* 4534
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4535 "*/ int f4535() { // "/* 4535
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4536 "*/ int f4536() { // "/* 4536
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4537 "*/ int f4537() { // "/* 4537
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4538 "*/ int f4538() { // "/* 4538
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4539 "*/ int f4539() { // "/* 4539
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4540 "*/ int f4540() { // "/* 4540
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4541 "*/ int f4541() { // "/* 4541
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4542 "*/ int f4542() { // "/* 4542
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4543 "*/ int f4543() { // "/* 4543
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4544 "*/ int f4544() { // "/* 4544
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4545 "*/ int f4545() { // "/* 4545
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4546 "*/ int f4546() { // "/* 4546
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4547 "*/ int f4547() { // "/* 4547
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4548 "*/ int f4548() { // "/* 4548
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4549 "*/ int f4549() { // "/* 4549
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4550 "*/ int f4550() { // "/* 4550
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4551 "*/ int f4551() { // "/* 4551
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4552 "*/ int f4552() { // "/* 4552
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4553 "*/ int f4553() { // "/* 4553
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4554 "*/ int f4554() { // "/* 4554
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4555 "*/ int f4555() { // "/* 4555
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4556 "*/ int f4556() { // "/* 4556
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4557 "*/ int f4557() { // "/* 4557
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4558 "*/ int f4558() { // "/* 4558
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4559 "*/ int f4559() { // "/* 4559
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4560 "*/ int f4560() { // "/* 4560
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4561 "*/ int f4561() { // "/* 4561
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4562 "*/ int f4562() { // "/* 4562
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4563 "*/ int f4563() { // "/* 4563
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4564 "*/ int f4564() { // "/* 4564
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4565 "*/ int f4565() { // "/* 4565
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4566 "*/ int f4566() { // "/* 4566
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4567 "*/ int f4567() { // "/* 4567
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4568 "*/ int f4568() { // "/* 4568
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4569 "*/ int f4569() { // "/* 4569
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4570 "*/ int f4570() { // "/* 4570
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4571 "*/ int f4571() { // "/* 4571
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4572 "*/ int f4572() { // "/* 4572
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4573 "*/ int f4573() { // "/* 4573
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4574 "*/ int f4574() { // "/* 4574
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4575 "*/ int f4575() { // "/* 4575
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4576 "*/ int f4576() { // "/* 4576
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4577 "*/ int f4577() { // "/* 4577
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4578 "*/ int f4578() { // "/* 4578
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4579 "*/ int f4579() { // "/* 4579
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4580 "*/ int f4580() { // "/* 4580
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4581 "*/ int f4581() { // "/* 4581
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4582 "*/ int f4582() { // "/* 4582
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4583 "*/ int f4583() { // "/* 4583
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4584 "*/ int f4584() { // "/* 4584
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4585 "*/ int f4585() { // "/* 4585
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4586 "*/ int f4586() { // "/* 4586
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4587 "*/ int f4587() { // "/* 4587
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4588 "*/ int f4588() { // "/* 4588
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4589 "*/ int f4589() { // "/* 4589
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4590 "*/ int f4590() { // "/* 4590
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4591 "*/ int f4591() { // "/* 4591
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4592 "*/ int f4592() { // "/* 4592
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4593 "*/ int f4593() { // "/* 4593
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4594 "*/ int f4594() { // "/* 4594
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4595 "*/ int f4595() { // "/* 4595
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4596 "*/ int f4596() { // "/* 4596
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4597 "*/ int f4597() { // "/* 4597
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4598 "*/ int f4598() { // "/* 4598
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4599 "*/ int f4599() { // "/* 4599
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4600 "*/ int f4600() { // "/* 4600
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4601 "*/ int f4601() { // "/* 4601
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4602 "*/ int f4602() { // "/* 4602
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4603 "*/ int f4603() { // "/* 4603
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4604 "*/ int f4604() { // "/* 4604
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4605 "*/ int f4605() { // "/* 4605
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4606 "*/ int f4606() { // "/* 4606
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4607 "*/ int f4607() { // "/* 4607
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4608 "*/ int f4608() { // "/* 4608
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4609 "*/ int f4609() { // "/* 4609
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4610 "*/ int f4610() { // "/* 4610
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4611 "*/ int f4611() { // "/* 4611
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4612 "*/ int f4612() { // "/* 4612
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4613 "*/ int f4613() { // "/* 4613
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4614 "*/ int f4614() { // "/* 4614
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4615 "*/ int f4615() { // "/* 4615
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4616 "*/ int f4616() { // "/* 4616
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4617 "*/ int f4617() { // "/* 4617
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4618 "*/ int f4618() { // "/* 4618
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4619 "*/ int f4619() { // "/* 4619
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4620 "*/ int f4620() { // "/* 4620
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4621 "*/ int f4621() { // "/* 4621
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4622 "*/ int f4622() { // "/* 4622
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4623 "*/ int f4623() { // "/* 4623
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4624 "*/ int f4624() { // "/* 4624
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4625 "*/ int f4625() { // "/* 4625
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4626 "*/ int f4626() { // "/* 4626
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4627 "*/ int f4627() { // "/* 4627
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4628 "*/ int f4628() { // "/* 4628
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4629 "*/ int f4629() { // "/* 4629
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4630 "*/ int f4630() { // "/* 4630
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4631 "*/ int f4631() { // "/* 4631
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4632 "*/ int f4632() { // "/* 4632
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4633 "*/ int f4633() { // "/* 4633
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4634 "*/ int f4634() { // "/* 4634
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4635 "*/ int f4635() { // "/* 4635
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4636 "*/ int f4636() { // "/* 4636
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4637 "*/ int f4637() { // "/* 4637
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4638 "*/ int f4638() { // "/* 4638
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4639 "*/ int f4639() { // "/* 4639
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4640 "*/ int f4640() { // "/* 4640
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4641 "*/ int f4641() { // "/* 4641
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4642 "*/ int f4642() { // "/* 4642
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4643 "*/ int f4643() { // "/* 4643
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4644 "*/ int f4644() { // "/* 4644
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4645 "*/ int f4645() { // "/* 4645
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4646 "*/ int f4646() { // "/* 4646
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4647 "*/ int f4647() { // "/* 4647
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4648 "*/ int f4648() { // "/* 4648
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4649 "*/ int f4649() { // "/* 4649
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4650 "*/ int f4650() { // "/* 4650
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4651 "*/ int f4651() { // "/* 4651
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4652 "*/ int f4652() { // "/* 4652
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4653 "*/ int f4653() { // "/* 4653
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4654 "*/ int f4654() { // "/* 4654
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4655 "*/ int f4655() { // "/* 4655
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4656 "*/ int f4656() { // "/* 4656
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4657 "*/ int f4657() { // "/* 4657
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4658 "*/ int f4658() { // "/* 4658
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4659 "*/ int f4659() { // "/* 4659
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4660 "*/ int f4660() { // "/* 4660
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4661 "*/ int f4661() { // "/* 4661
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4662 "*/ int f4662() { // "/* 4662
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4663 "*/ int f4663() { // "/* 4663
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4664 "*/ int f4664() { // "/* 4664
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4665 "*/ int f4665() { // "/* 4665
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4666 "*/ int f4666() { // "/* 4666
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4667 "*/ int f4667() { // "/* 4667
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4668 "*/ int f4668() { // "/* 4668
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4669 "*/ int f4669() { // "/* 4669
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4670 "*/ int f4670() { // "/* 4670
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4671 "*/ int f4671() { // "/* 4671
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4672 "*/ int f4672() { // "/* 4672
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4673 "*/ int f4673() { // "/* 4673
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4674 "*/ int f4674() { // "/* 4674
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4675 "*/ int f4675() { // "/* 4675
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4676 "*/ int f4676() { // "/* 4676
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4677 "*/ int f4677() { // "/* 4677
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4678 "*/ int f4678() { // "/* 4678
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4679 "*/ int f4679() { // "/* 4679
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4680 "*/ int f4680() { // "/* 4680
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4681 "*/ int f4681() { // "/* 4681
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4682 "*/ int f4682() { // "/* 4682
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4683 "*/ int f4683() { // "/* 4683
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4684 "*/ int f4684() { // "/* 4684
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4685 "*/ int f4685() { // "/* 4685
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4686 "*/ int f4686() { // "/* 4686
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4687 "*/ int f4687() { // "/* 4687
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4688 "*/ int f4688() { // "/* 4688
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4689 "*/ int f4689() { // "/* 4689
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4690 "*/ int f4690() { // "/* 4690
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4691 "*/ int f4691() { // "/* 4691
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4692 "*/ int f4692() { // "/* 4692
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4693 "*/ int f4693() { // "/* 4693
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4694 "*/ int f4694() { // "/* 4694
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4695 "*/ int f4695() { // "/* 4695
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4696 "*/ int f4696() { // "/* 4696
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4697 "*/ int f4697() { // "/* 4697
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4698 "*/ int f4698() { // "/* 4698
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4699 "*/ int f4699() { // "/* 4699
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4700 "*/ int f4700() { // "/* 4700
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4701 "*/ int f4701() { // "/* 4701
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4702 "*/ int f4702() { // "/* 4702
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4703 "*/ int f4703() { // "/* 4703
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4704 "*/ int f4704() { // "/* 4704
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4705 "*/ int f4705() { // "/* 4705
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4706 "*/ int f4706() { // "/* 4706
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4707 "*/ int f4707() { // "/* 4707
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4708 "*/ int f4708() { // "/* 4708
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4709 "*/ int f4709() { // "/* 4709
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4710 "*/ int f4710() { // "/* 4710
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4711 "*/ int f4711() { // "/* 4711
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4712 "*/ int f4712() { // "/* 4712
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4713 "*/ int f4713() { // "/* 4713
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4714 "*/ int f4714() { // "/* 4714
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4715 "*/ int f4715() { // "/* 4715
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4716 "*/ int f4716() { // "/* 4716
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4717 "*/ int f4717() { // "/* 4717
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4718 "*/ int f4718() { // "/* 4718
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4719 "*/ int f4719() { // "/* 4719
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4720 "*/ int f4720() { // "/* 4720
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4721 "*/ int f4721() { // "/* 4721
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4722 "*/ int f4722() { // "/* 4722
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4723 "*/ int f4723() { // "/* 4723
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4724 "*/ int f4724() { // "/* 4724
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4725 "*/ int f4725() { // "/* 4725
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4726 "*/ int f4726() { // "/* 4726
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4727 "*/ int f4727() { // "/* 4727
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4728 "*/ int f4728() { // "/* 4728
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4729 "*/ int f4729() { // "/* 4729
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4730 "*/ int f4730() { // "/* 4730
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4731 "*/ int f4731() { // "/* 4731
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4732 "*/ int f4732() { // "/* 4732
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4733 "*/ int f4733() { // "/* 4733
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4734 "*/ int f4734() { // "/* 4734
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4735 "*/ int f4735() { // "/* 4735
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4736 "*/ int f4736() { // "/* 4736
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4737 "*/ int f4737() { // "/* 4737
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4738 "*/ int f4738() { // "/* 4738
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4739 "*/ int f4739() { // "/* 4739
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4740 "*/ int f4740() { // "/* 4740
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4741 "*/ int f4741() { // "/* 4741
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4742 "*/ int f4742() { // "/* 4742
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4743 "*/ int f4743() { // "/* 4743
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4744 "*/ int f4744() { // "/* 4744
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4745 "*/ int f4745() { // "/* 4745
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4746 "*/ int f4746() { // "/* 4746
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4747 "*/ int f4747() { // "/* 4747
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4748 "*/ int f4748() { // "/* 4748
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4749 "*/ int f4749() { // "/* 4749
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4750 "*/ int f4750() { // "/* 4750
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4751 "*/ int f4751() { // "/* 4751
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4752 "*/ int f4752() { // "/* 4752
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4753 "*/ int f4753() { // "/* 4753
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4754 "*/ int f4754() { // "/* 4754
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4755 "*/ int f4755() { // "/* 4755
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4756 "*/ int f4756() { // "/* 4756
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4757 "*/ int f4757() { // "/* 4757
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4758 "*/ int f4758() { // "/* 4758
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4759 "*/ int f4759() { // "/* 4759
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4760 "*/ int f4760() { // "/* 4760
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4761 "*/ int f4761() { // "/* 4761
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4762 "*/ int f4762() { // "/* 4762
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4763 "*/ int f4763() { // "/* 4763
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4764 "*/ int f4764() { // "/* 4764
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4765 "*/ int f4765() { // "/* 4765
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4766 "*/ int f4766() { // "/* 4766
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4767 "*/ int f4767() { // "/* 4767
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4768 "*/ int f4768() { // "/* 4768
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4769 "*/ int f4769() { // "/* 4769
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4770 "*/ int f4770() { // "/* 4770
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4771 "*/ int f4771() { // "/* 4771
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4772 "*/ int f4772() { // "/* 4772
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4773 "*/ int f4773() { // "/* 4773
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4774 "*/ int f4774() { // "/* 4774
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4775 "*/ int f4775() { // "/* 4775
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4776 "*/ int f4776() { // "/* 4776
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4777 "*/ int f4777() { // "/* 4777
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4778 "*/ int f4778() { // "/* 4778
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4779 "*/ int f4779() { // "/* 4779
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4780 "*/ int f4780() { // "/* 4780
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4781 "*/ int f4781() { // "/* 4781
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4782 "*/ int f4782() { // "/* 4782
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4783 "*/ int f4783() { // "/* 4783
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4784 "*/ int f4784() { // "/* 4784
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4785 "*/ int f4785() { // "/* 4785
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4786 "*/ int f4786() { // "/* 4786
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4787 "*/ int f4787() { // "/* 4787
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4788 "*/ int f4788() { // "/* 4788
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4789 "*/ int f4789() { // "/* 4789
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4790 "*/ int f4790() { // "/* 4790
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4791 "*/ int f4791() { // "/* 4791
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4792 "*/ int f4792() { // "/* 4792
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4793 "*/ int f4793() { // "/* 4793
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4794 "*/ int f4794() { // "/* 4794
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4795 "*/ int f4795() { // "/* 4795
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4796 "*/ int f4796() { // "/* 4796
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4797 "*/ int f4797() { // "/* 4797
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4798 "*/ int f4798() { // "/* 4798
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4799 "*/ int f4799() { // "/* 4799
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4800 "*/ int f4800() { // "/* 4800
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4801 "*/ int f4801() { // "/* 4801
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4802 "*/ int f4802() { // "/* 4802
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4803 "*/ int f4803() { // "/* 4803
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4804 "*/ int f4804() { // "/* 4804
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4805 "*/ int f4805() { // "/* 4805
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4806 "*/ int f4806() { // "/* 4806
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4807 "*/ int f4807() { // "/* 4807
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4808 "*/ int f4808() { // "/* 4808
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4809 "*/ int f4809() { // "/* 4809
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4810 "*/ int f4810() { // "/* 4810
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4811 "*/ int f4811() { // "/* 4811
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4812 "*/ int f4812() { // "/* 4812
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4813 "*/ int f4813() { // "/* 4813
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4814 "*/ int f4814() { // "/* 4814
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4815 "*/ int f4815() { // "/* 4815
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4816 "*/ int f4816() { // "/* 4816
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4817 "*/ int f4817() { // "/* 4817
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4818 "*/ int f4818() { // "/* 4818
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4819 "*/ int f4819() { // "/* 4819
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4820 "*/ int f4820() { // "/* 4820
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4821 "*/ int f4821() { // "/* 4821
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4822 "*/ int f4822() { // "/* 4822
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4823 "*/ int f4823() { // "/* 4823
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4824 "*/ int f4824() { // "/* 4824
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4825 "*/ int f4825() { // "/* 4825
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4826 "*/ int f4826() { // "/* 4826
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4827 "*/ int f4827() { // "/* 4827
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4828 "*/ int f4828() { // "/* 4828
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4829 "*/ int f4829() { // "/* 4829
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4830 "*/ int f4830() { // "/* 4830
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4831 "*/ int f4831() { // "/* 4831
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4832 "*/ int f4832() { // "/* 4832
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4833 "*/ int f4833() { // "/* 4833
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4834 "*/ int f4834() { // "/* 4834
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4835 "*/ int f4835() { // "/* 4835
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4836 "*/ int f4836() { // "/* 4836
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4837 "*/ int f4837() { // "/* 4837
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4838 "*/ int f4838() { // "/* 4838
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4839 "*/ int f4839() { // "/* 4839
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4840 "*/ int f4840() { // "/* 4840
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4841 "*/ int f4841() { // "/* 4841
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4842 "*/ int f4842() { // "/* 4842
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4843 "*/ int f4843() { // "/* 4843
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4844 "*/ int f4844() { // "/* 4844
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4845 "*/ int f4845() { // "/* 4845
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4846 "*/ int f4846() { // "/* 4846
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4847 "*/ int f4847() { // "/* 4847
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4848 "*/ int f4848() { // "/* 4848
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4849 "*/ int f4849() { // "/* 4849
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4850 "*/ int f4850() { // "/* 4850
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4851 "*/ int f4851() { // "/* 4851
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4852 "*/ int f4852() { // "/* 4852
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4853 "*/ int f4853() { // "/* 4853
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4854 "*/ int f4854() { // "/* 4854
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4855 "*/ int f4855() { // "/* 4855
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4856 "*/ int f4856() { // "/* 4856
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4857 "*/ int f4857() { // "/* 4857
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4858 "*/ int f4858() { // "/* 4858
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4859 "*/ int f4859() { // "/* 4859
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4860 "*/ int f4860() { // "/* 4860
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4861 "*/ int f4861() { // "/* 4861
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4862 "*/ int f4862() { // "/* 4862
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4863 "*/ int f4863() { // "/* 4863
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4864 "*/ int f4864() { // "/* 4864
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4865 "*/ int f4865() { // "/* 4865
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4866 "*/ int f4866() { // "/* 4866
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4867 "*/ int f4867() { // "/* 4867
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4868 "*/ int f4868() { // "/* 4868
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4869 "*/ int f4869() { // "/* 4869
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4870 "*/ int f4870() { // "/* 4870
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4871 "*/ int f4871() { // "/* 4871
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4872 "*/ int f4872() { // "/* 4872
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4873 "*/ int f4873() { // "/* 4873
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4874 "*/ int f4874() { // "/* 4874
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4875 "*/ int f4875() { // "/* 4875
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4876 "*/ int f4876() { // "/* 4876
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4877 "*/ int f4877() { // "/* 4877
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4878 "*/ int f4878() { // "/* 4878
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4879 "*/ int f4879() { // "/* 4879
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4880 "*/ int f4880() { // "/* 4880
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4881 "*/ int f4881() { // "/* 4881
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4882 "*/ int f4882() { // "/* 4882
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4883 "*/ int f4883() { // "/* 4883
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4884 "*/ int f4884() { // "/* 4884
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4885 "*/ int f4885() { // "/* 4885
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4886 "*/ int f4886() { // "/* 4886
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4887 "*/ int f4887() { // "/* 4887
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4888 "*/ int f4888() { // "/* 4888
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4889 "*/ int f4889() { // "/* 4889
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4890 "*/ int f4890() { // "/* 4890
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4891 "*/ int f4891() { // "/* 4891
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4892 "*/ int f4892() { // "/* 4892
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4893 "*/ int f4893() { // "/* 4893
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4894 "*/ int f4894() { // "/* 4894
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4895 "*/ int f4895() { // "/* 4895
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4896 "*/ int f4896() { // "/* 4896
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4897 "*/ int f4897() { // "/* 4897
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4898 "*/ int f4898() { // "/* 4898
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4899 "*/ int f4899() { // "/* 4899
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4900 "*/ int f4900() { // "/* 4900
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4901 "*/ int f4901() { // "/* 4901
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4902 "*/ int f4902() { // "/* 4902
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4903 "*/ int f4903() { // "/* 4903
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4904 "*/ int f4904() { // "/* 4904
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4905 "*/ int f4905() { // "/* 4905
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4906 "*/ int f4906() { // "/* 4906
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4907 "*/ int f4907() { // "/* 4907
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4908 "*/ int f4908() { // "/* 4908
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4909 "*/ int f4909() { // "/* 4909
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4910 "*/ int f4910() { // "/* 4910
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4911 "*/ int f4911() { // "/* 4911
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4912 "*/ int f4912() { // "/* 4912
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4913 "*/ int f4913() { // "/* 4913
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4914 "*/ int f4914() { // "/* 4914
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4915 "*/ int f4915() { // "/* 4915
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4916 "*/ int f4916() { // "/* 4916
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4917 "*/ int f4917() { // "/* 4917
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4918 "*/ int f4918() { // "/* 4918
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4919 "*/ int f4919() { // "/* 4919
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4920 "*/ int f4920() { // "/* 4920
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4921 "*/ int f4921() { // "/* 4921
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4922 "*/ int f4922() { // "/* 4922
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4923 "*/ int f4923() { // "/* 4923
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4924 "*/ int f4924() { // "/* 4924
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4925 "*/ int f4925() { // "/* 4925
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4926 "*/ int f4926() { // "/* 4926
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4927 "*/ int f4927() { // "/* 4927
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4928 "*/ int f4928() { // "/* 4928
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4929 "*/ int f4929() { // "/* 4929
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4930 "*/ int f4930() { // "/* 4930
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4931 "*/ int f4931() { // "/* 4931
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4932 "*/ int f4932() { // "/* 4932
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4933 "*/ int f4933() { // "/* 4933
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4934 "*/ int f4934() { // "/* 4934
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4935 "*/ int f4935() { // "/* 4935
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4936 "*/ int f4936() { // "/* 4936
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4937 "*/ int f4937() { // "/* 4937
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4938 "*/ int f4938() { // "/* 4938
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4939 "*/ int f4939() { // "/* 4939
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4940 "*/ int f4940() { // "/* 4940
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4941 "*/ int f4941() { // "/* 4941
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4942 "*/ int f4942() { // "/* 4942
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4943 "*/ int f4943() { // "/* 4943
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4944 "*/ int f4944() { // "/* 4944
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4945 "*/ int f4945() { // "/* 4945
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4946 "*/ int f4946() { // "/* 4946
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4947 "*/ int f4947() { // "/* 4947
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4948 "*/ int f4948() { // "/* 4948
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4949 "*/ int f4949() { // "/* 4949
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4950 "*/ int f4950() { // "/* 4950
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4951 "*/ int f4951() { // "/* 4951
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4952 "*/ int f4952() { // "/* 4952
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4953 "*/ int f4953() { // "/* 4953
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4954 "*/ int f4954() { // "/* 4954
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4955 "*/ int f4955() { // "/* 4955
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4956 "*/ int f4956() { // "/* 4956
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4957 "*/ int f4957() { // "/* 4957
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4958 "*/ int f4958() { // "/* 4958
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4959 "*/ int f4959() { // "/* 4959
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4960 "*/ int f4960() { // "/* 4960
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4961 "*/ int f4961() { // "/* 4961
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4962 "*/ int f4962() { // "/* 4962
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4963 "*/ int f4963() { // "/* 4963
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4964 "*/ int f4964() { // "/* 4964
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4965 "*/ int f4965() { // "/* 4965
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4966 "*/ int f4966() { // "/* 4966
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4967 "*/ int f4967() { // "/* 4967
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4968 "*/ int f4968() { // "/* 4968
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4969 "*/ int f4969() { // "/* 4969
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4970 "*/ int f4970() { // "/* 4970
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4971 "*/ int f4971() { // "/* 4971
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4972 "*/ int f4972() { // "/* 4972
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4973 "*/ int f4973() { // "/* 4973
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4974 "*/ int f4974() { // "/* 4974
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4975 "*/ int f4975() { // "/* 4975
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4976 "*/ int f4976() { // "/* 4976
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4977 "*/ int f4977() { // "/* 4977
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4978 "*/ int f4978() { // "/* 4978
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4979 "*/ int f4979() { // "/* 4979
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4980 "*/ int f4980() { // "/* 4980
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4981 "*/ int f4981() { // "/* 4981
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4982 "*/ int f4982() { // "/* 4982
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4983 "*/ int f4983() { // "/* 4983
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4984 "*/ int f4984() { // "/* 4984
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4985 "*/ int f4985() { // "/* 4985
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4986 "*/ int f4986() { // "/* 4986
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4987 "*/ int f4987() { // "/* 4987
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4988 "*/ int f4988() { // "/* 4988
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4989 "*/ int f4989() { // "/* 4989
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4990 "*/ int f4990() { // "/* 4990
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4991 "*/ int f4991() { // "/* 4991
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4992 "*/ int f4992() { // "/* 4992
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4993 "*/ int f4993() { // "/* 4993
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4994 "*/ int f4994() { // "/* 4994
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4995 "*/ int f4995() { // "/* 4995
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4996 "*/ int f4996() { // "/* 4996
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4997 "*/ int f4997() { // "/* 4997
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4998 "*/ int f4998() { // "/* 4998
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 4999 "*/ int f4999() { // "/* 4999
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5000 "*/ int f5000() { // "/* 5000
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5001 "*/ int f5001() { // "/* 5001
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5002 "*/ int f5002() { // "/* 5002
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5003 "*/ int f5003() { // "/* 5003
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5004 "*/ int f5004() { // "/* 5004
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5005 "*/ int f5005() { // "/* 5005
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5006 "*/ int f5006() { // "/* 5006
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5007 "*/ int f5007() { // "/* 5007
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5008 "*/ int f5008() { // "/* 5008
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5009 "*/ int f5009() { // "/* 5009
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5010 "*/ int f5010() { // "/* 5010
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5011 "*/ int f5011() { // "/* 5011
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5012 "*/ int f5012() { // "/* 5012
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5013 "*/ int f5013() { // "/* 5013
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5014 "*/ int f5014() { // "/* 5014
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5015 "*/ int f5015() { // "/* 5015
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5016 "*/ int f5016() { // "/* 5016
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5017 "*/ int f5017() { // "/* 5017
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5018 "*/ int f5018() { // "/* 5018
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5019 "*/ int f5019() { // "/* 5019
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5020 "*/ int f5020() { // "/* 5020
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5021 "*/ int f5021() { // "/* 5021
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5022 "*/ int f5022() { // "/* 5022
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5023 "*/ int f5023() { // "/* 5023
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5024 "*/ int f5024() { // "/* 5024
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5025 "*/ int f5025() { // "/* 5025
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5026 "*/ int f5026() { // "/* 5026
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5027 "*/ int f5027() { // "/* 5027
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5028 "*/ int f5028() { // "/* 5028
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5029 "*/ int f5029() { // "/* 5029
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5030 "*/ int f5030() { // "/* 5030
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5031 "*/ int f5031() { // "/* 5031
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5032 "*/ int f5032() { // "/* 5032
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5033 "*/ int f5033() { // "/* 5033
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5034 "*/ int f5034() { // "/* 5034
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5035 "*/ int f5035() { // "/* 5035
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5036 "*/ int f5036() { // "/* 5036
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5037 "*/ int f5037() { // "/* 5037
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5038 "*/ int f5038() { // "/* 5038
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5039 "*/ int f5039() { // "/* 5039
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5040 "*/ int f5040() { // "/* 5040
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5041 "*/ int f5041() { // "/* 5041
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5042 "*/ int f5042() { // "/* 5042
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5043 "*/ int f5043() { // "/* 5043
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5044 "*/ int f5044() { // "/* 5044
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5045 "*/ int f5045() { // "/* 5045
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5046 "*/ int f5046() { // "/* 5046
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5047 "*/ int f5047() { // "/* 5047
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5048 "*/ int f5048() { // "/* 5048
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5049 "*/ int f5049() { // "/* 5049
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5050 "*/ int f5050() { // "/* 5050
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5051 "*/ int f5051() { // "/* 5051
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5052 "*/ int f5052() { // "/* 5052
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5053 "*/ int f5053() { // "/* 5053
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5054 "*/ int f5054() { // "/* 5054
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5055 "*/ int f5055() { // "/* 5055
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5056 "*/ int f5056() { // "/* 5056
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5057 "*/ int f5057() { // "/* 5057
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5058 "*/ int f5058() { // "/* 5058
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5059 "*/ int f5059() { // "/* 5059
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5060 "*/ int f5060() { // "/* 5060
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5061 "*/ int f5061() { // "/* 5061
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5062 "*/ int f5062() { // "/* 5062
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5063 "*/ int f5063() { // "/* 5063
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5064 "*/ int f5064() { // "/* 5064
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5065 "*/ int f5065() { // "/* 5065
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5066 "*/ int f5066() { // "/* 5066
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5067 "*/ int f5067() { // "/* 5067
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5068 "*/ int f5068() { // "/* 5068
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5069 "*/ int f5069() { // "/* 5069
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5070 "*/ int f5070() { // "/* 5070
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5071 "*/ int f5071() { // "/* 5071
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5072 "*/ int f5072() { // "/* 5072
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5073 "*/ int f5073() { // "/* 5073
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5074 "*/ int f5074() { // "/* 5074
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5075 "*/ int f5075() { // "/* 5075
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5076 "*/ int f5076() { // "/* 5076
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5077 "*/ int f5077() { // "/* 5077
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5078 "*/ int f5078() { // "/* 5078
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5079 "*/ int f5079() { // "/* 5079
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5080 "*/ int f5080() { // "/* 5080
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5081 "*/ int f5081() { // "/* 5081
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5082 "*/ int f5082() { // "/* 5082
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5083 "*/ int f5083() { // "/* 5083
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5084 "*/ int f5084() { // "/* 5084
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5085 "*/ int f5085() { // "/* 5085
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5086 "*/ int f5086() { // "/* 5086
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5087 "*/ int f5087() { // "/* 5087
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5088 "*/ int f5088() { // "/* 5088
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5089 "*/ int f5089() { // "/* 5089
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5090 "*/ int f5090() { // "/* 5090
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5091 "*/ int f5091() { // "/* 5091
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5092 "*/ int f5092() { // "/* 5092
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5093 "*/ int f5093() { // "/* 5093
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5094 "*/ int f5094() { // "/* 5094
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5095 "*/ int f5095() { // "/* 5095
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5096 "*/ int f5096() { // "/* 5096
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5097 "*/ int f5097() { // "/* 5097
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5098 "*/ int f5098() { // "/* 5098
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5099 "*/ int f5099() { // "/* 5099
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5100 "*/ int f5100() { // "/* 5100
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5101 "*/ int f5101() { // "/* 5101
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5102 "*/ int f5102() { // "/* 5102
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5103 "*/ int f5103() { // "/* 5103
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5104 "*/ int f5104() { // "/* 5104
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5105 "*/ int f5105() { // "/* 5105
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5106 "*/ int f5106() { // "/* 5106
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5107 "*/ int f5107() { // "/* 5107
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5108 "*/ int f5108() { // "/* 5108
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5109 "*/ int f5109() { // "/* 5109
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5110 "*/ int f5110() { // "/* 5110
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5111 "*/ int f5111() { // "/* 5111
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5112 "*/ int f5112() { // "/* 5112
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5113 "*/ int f5113() { // "/* 5113
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5114 "*/ int f5114() { // "/* 5114
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5115 "*/ int f5115() { // "/* 5115
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5116 "*/ int f5116() { // "/* 5116
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5117 "*/ int f5117() { // "/* 5117
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5118 "*/ int f5118() { // "/* 5118
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5119 "*/ int f5119() { // "/* 5119
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5120 "*/ int f5120() { // "/* 5120
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5121 "*/ int f5121() { // "/* 5121
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5122 "*/ int f5122() { // "/* 5122
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5123 "*/ int f5123() { // "/* 5123
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5124 "*/ int f5124() { // "/* 5124
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5125 "*/ int f5125() { // "/* 5125
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5126 "*/ int f5126() { // "/* 5126
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5127 "*/ int f5127() { // "/* 5127
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5128 "*/ int f5128() { // "/* 5128
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5129 "*/ int f5129() { // "/* 5129
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5130 "*/ int f5130() { // "/* 5130
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5131 "*/ int f5131() { // "/* 5131
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5132 "*/ int f5132() { // "/* 5132
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5133 "*/ int f5133() { // "/* 5133
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5134 "*/ int f5134() { // "/* 5134
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5135 "*/ int f5135() { // "/* 5135
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5136 "*/ int f5136() { // "/* 5136
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5137 "*/ int f5137() { // "/* 5137
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5138 "*/ int f5138() { // "/* 5138
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5139 "*/ int f5139() { // "/* 5139
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5140 "*/ int f5140() { // "/* 5140
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5141 "*/ int f5141() { // "/* 5141
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5142 "*/ int f5142() { // "/* 5142
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5143 "*/ int f5143() { // "/* 5143
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5144 "*/ int f5144() { // "/* 5144
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5145 "*/ int f5145() { // "/* 5145
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5146 "*/ int f5146() { // "/* 5146
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5147 "*/ int f5147() { // "/* 5147
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5148 "*/ int f5148() { // "/* 5148
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5149 "*/ int f5149() { // "/* 5149
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5150 "*/ int f5150() { // "/* 5150
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5151 "*/ int f5151() { // "/* 5151
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5152 "*/ int f5152() { // "/* 5152
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5153 "*/ int f5153() { // "/* 5153
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5154 "*/ int f5154() { // "/* 5154
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5155 "*/ int f5155() { // "/* 5155
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5156 "*/ int f5156() { // "/* 5156
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5157 "*/ int f5157() { // "/* 5157
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5158 "*/ int f5158() { // "/* 5158
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5159 "*/ int f5159() { // "/* 5159
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5160 "*/ int f5160() { // "/* 5160
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5161 "*/ int f5161() { // "/* 5161
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5162 "*/ int f5162() { // "/* 5162
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5163 "*/ int f5163() { // "/* 5163
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5164 "*/ int f5164() { // "/* 5164
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5165 "*/ int f5165() { // "/* 5165
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5166 "*/ int f5166() { // "/* 5166
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5167 "*/ int f5167() { // "/* 5167
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5168 "*/ int f5168() { // "/* 5168
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5169 "*/ int f5169() { // "/* 5169
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5170 "*/ int f5170() { // "/* 5170
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5171 "*/ int f5171() { // "/* 5171
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5172 "*/ int f5172() { // "/* 5172
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5173 "*/ int f5173() { // "/* 5173
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5174 "*/ int f5174() { // "/* 5174
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5175 "*/ int f5175() { // "/* 5175
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5176 "*/ int f5176() { // "/* 5176
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5177 "*/ int f5177() { // "/* 5177
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5178 "*/ int f5178() { // "/* 5178
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5179 "*/ int f5179() { // "/* 5179
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5180 "*/ int f5180() { // "/* 5180
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5181 "*/ int f5181() { // "/* 5181
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5182 "*/ int f5182() { // "/* 5182
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5183 "*/ int f5183() { // "/* 5183
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5184 "*/ int f5184() { // "/* 5184
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5185 "*/ int f5185() { // "/* 5185
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5186 "*/ int f5186() { // "/* 5186
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5187 "*/ int f5187() { // "/* 5187
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5188 "*/ int f5188() { // "/* 5188
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5189 "*/ int f5189() { // "/* 5189
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5190 "*/ int f5190() { // "/* 5190
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5191 "*/ int f5191() { // "/* 5191
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5192 "*/ int f5192() { // "/* 5192
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5193 "*/ int f5193() { // "/* 5193
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5194 "*/ int f5194() { // "/* 5194
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5195 "*/ int f5195() { // "/* 5195
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5196 "*/ int f5196() { // "/* 5196
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5197 "*/ int f5197() { // "/* 5197
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5198 "*/ int f5198() { // "/* 5198
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5199 "*/ int f5199() { // "/* 5199
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5200 "*/ int f5200() { // "/* 5200
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5201 "*/ int f5201() { // "/* 5201
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5202 "*/ int f5202() { // "/* 5202
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5203 "*/ int f5203() { // "/* 5203
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5204 "*/ int f5204() { // "/* 5204
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5205 "*/ int f5205() { // "/* 5205
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5206 "*/ int f5206() { // "/* 5206
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5207 "*/ int f5207() { // "/* 5207
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5208 "*/ int f5208() { // "/* 5208
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5209 "*/ int f5209() { // "/* 5209
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5210 "*/ int f5210() { // "/* 5210
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5211 "*/ int f5211() { // "/* 5211
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5212 "*/ int f5212() { // "/* 5212
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5213 "*/ int f5213() { // "/* 5213
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5214 "*/ int f5214() { // "/* 5214
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5215 "*/ int f5215() { // "/* 5215
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5216 "*/ int f5216() { // "/* 5216
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5217 "*/ int f5217() { // "/* 5217
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5218 "*/ int f5218() { // "/* 5218
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5219 "*/ int f5219() { // "/* 5219
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5220 "*/ int f5220() { // "/* 5220
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5221 "*/ int f5221() { // "/* 5221
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5222 "*/ int f5222() { // "/* 5222
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5223 "*/ int f5223() { // "/* 5223
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5224 "*/ int f5224() { // "/* 5224
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5225 "*/ int f5225() { // "/* 5225
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5226 "*/ int f5226() { // "/* 5226
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5227 "*/ int f5227() { // "/* 5227
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5228 "*/ int f5228() { // "/* 5228
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5229 "*/ int f5229() { // "/* 5229
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5230 "*/ int f5230() { // "/* 5230
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5231 "*/ int f5231() { // "/* 5231
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5232 "*/ int f5232() { // "/* 5232
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5233 "*/ int f5233() { // "/* 5233
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5234 "*/ int f5234() { // "/* 5234
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5235 "*/ int f5235() { // "/* 5235
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5236 "*/ int f5236() { // "/* 5236
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5237 "*/ int f5237() { // "/* 5237
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5238 "*/ int f5238() { // "/* 5238
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5239 "*/ int f5239() { // "/* 5239
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5240 "*/ int f5240() { // "/* 5240
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5241 "*/ int f5241() { // "/* 5241
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5242 "*/ int f5242() { // "/* 5242
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5243 "*/ int f5243() { // "/* 5243
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5244 "*/ int f5244() { // "/* 5244
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5245 "*/ int f5245() { // "/* 5245
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5246 "*/ int f5246() { // "/* 5246
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5247 "*/ int f5247() { // "/* 5247
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5248 "*/ int f5248() { // "/* 5248
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5249 "*/ int f5249() { // "/* 5249
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5250 "*/ int f5250() { // "/* 5250
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5251 "*/ int f5251() { // "/* 5251
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5252 "*/ int f5252() { // "/* 5252
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5253 "*/ int f5253() { // "/* 5253
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5254 "*/ int f5254() { // "/* 5254
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5255 "*/ int f5255() { // "/* 5255
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5256 "*/ int f5256() { // "/* 5256
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5257 "*/ int f5257() { // "/* 5257
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5258 "*/ int f5258() { // "/* 5258
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5259 "*/ int f5259() { // "/* 5259
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5260 "*/ int f5260() { // "/* 5260
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5261 "*/ int f5261() { // "/* 5261
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5262 "*/ int f5262() { // "/* 5262
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5263 "*/ int f5263() { // "/* 5263
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5264 "*/ int f5264() { // "/* 5264
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5265 "*/ int f5265() { // "/* 5265
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5266 "*/ int f5266() { // "/* 5266
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5267 "*/ int f5267() { // "/* 5267
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5268 "*/ int f5268() { // "/* 5268
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5269 "*/ int f5269() { // "/* 5269
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5270 "*/ int f5270() { // "/* 5270
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5271 "*/ int f5271() { // "/* 5271
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5272 "*/ int f5272() { // "/* 5272
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5273 "*/ int f5273() { // "/* 5273
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5274 "*/ int f5274() { // "/* 5274
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5275 "*/ int f5275() { // "/* 5275
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5276 "*/ int f5276() { // "/* 5276
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5277 "*/ int f5277() { // "/* 5277
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5278 "*/ int f5278() { // "/* 5278
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5279 "*/ int f5279() { // "/* 5279
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5280 "*/ int f5280() { // "/* 5280
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5281 "*/ int f5281() { // "/* 5281
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5282 "*/ int f5282() { // "/* 5282
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5283 "*/ int f5283() { // "/* 5283
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5284 "*/ int f5284() { // "/* 5284
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5285 "*/ int f5285() { // "/* 5285
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5286 "*/ int f5286() { // "/* 5286
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5287 "*/ int f5287() { // "/* 5287
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5288 "*/ int f5288() { // "/* 5288
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5289 "*/ int f5289() { // "/* 5289
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5290 "*/ int f5290() { // "/* 5290
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5291 "*/ int f5291() { // "/* 5291
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5292 "*/ int f5292() { // "/* 5292
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5293 "*/ int f5293() { // "/* 5293
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5294 "*/ int f5294() { // "/* 5294
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5295 "*/ int f5295() { // "/* 5295
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5296 "*/ int f5296() { // "/* 5296
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5297 "*/ int f5297() { // "/* 5297
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5298 "*/ int f5298() { // "/* 5298
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5299 "*/ int f5299() { // "/* 5299
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5300 "*/ int f5300() { // "/* 5300
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5301 "*/ int f5301() { // "/* 5301
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5302 "*/ int f5302() { // "/* 5302
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5303 "*/ int f5303() { // "/* 5303
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5304 "*/ int f5304() { // "/* 5304
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5305 "*/ int f5305() { // "/* 5305
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5306 "*/ int f5306() { // "/* 5306
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5307 "*/ int f5307() { // "/* 5307
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5308 "*/ int f5308() { // "/* 5308
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5309 "*/ int f5309() { // "/* 5309
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5310 "*/ int f5310() { // "/* 5310
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5311 "*/ int f5311() { // "/* 5311
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5312 "*/ int f5312() { // "/* 5312
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5313 "*/ int f5313() { // "/* 5313
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5314 "*/ int f5314() { // "/* 5314
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5315 "*/ int f5315() { // "/* 5315
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5316 "*/ int f5316() { // "/* 5316
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5317 "*/ int f5317() { // "/* 5317
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5318 "*/ int f5318() { // "/* 5318
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5319 "*/ int f5319() { // "/* 5319
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5320 "*/ int f5320() { // "/* 5320
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5321 "*/ int f5321() { // "/* 5321
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5322 "*/ int f5322() { // "/* 5322
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5323 "*/ int f5323() { // "/* 5323
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5324 "*/ int f5324() { // "/* 5324
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5325 "*/ int f5325() { // "/* 5325
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5326 "*/ int f5326() { // "/* 5326
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5327 "*/ int f5327() { // "/* 5327
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5328 "*/ int f5328() { // "/* 5328
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5329 "*/ int f5329() { // "/* 5329
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5330 "*/ int f5330() { // "/* 5330
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5331 "*/ int f5331() { // "/* 5331
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5332 "*/ int f5332() { // "/* 5332
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5333 "*/ int f5333() { // "/* 5333
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5334 "*/ int f5334() { // "/* 5334
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5335 "*/ int f5335() { // "/* 5335
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5336 "*/ int f5336() { // "/* 5336
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5337 "*/ int f5337() { // "/* 5337
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5338 "*/ int f5338() { // "/* 5338
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5339 "*/ int f5339() { // "/* 5339
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5340 "*/ int f5340() { // "/* 5340
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5341 "*/ int f5341() { // "/* 5341
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5342 "*/ int f5342() { // "/* 5342
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5343 "*/ int f5343() { // "/* 5343
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5344 "*/ int f5344() { // "/* 5344
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5345 "*/ int f5345() { // "/* 5345
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5346 "*/ int f5346() { // "/* 5346
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5347 "*/ int f5347() { // "/* 5347
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5348 "*/ int f5348() { // "/* 5348
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5349 "*/ int f5349() { // "/* 5349
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5350 "*/ int f5350() { // "/* 5350
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5351 "*/ int f5351() { // "/* 5351
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5352 "*/ int f5352() { // "/* 5352
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5353 "*/ int f5353() { // "/* 5353
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5354 "*/ int f5354() { // "/* 5354
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5355 "*/ int f5355() { // "/* 5355
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5356 "*/ int f5356() { // "/* 5356
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5357 "*/ int f5357() { // "/* 5357
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5358 "*/ int f5358() { // "/* 5358
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5359 "*/ int f5359() { // "/* 5359
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5360 "*/ int f5360() { // "/* 5360
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5361 "*/ int f5361() { // "/* 5361
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5362 "*/ int f5362() { // "/* 5362
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5363 "*/ int f5363() { // "/* 5363
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5364 "*/ int f5364() { // "/* 5364
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5365 "*/ int f5365() { // "/* 5365
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5366 "*/ int f5366() { // "/* 5366
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5367 "*/ int f5367() { // "/* 5367
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5368 "*/ int f5368() { // "/* 5368
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5369 "*/ int f5369() { // "/* 5369
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5370 "*/ int f5370() { // "/* 5370
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5371 "*/ int f5371() { // "/* 5371
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5372 "*/ int f5372() { // "/* 5372
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5373 "*/ int f5373() { // "/* 5373
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5374 "*/ int f5374() { // "/* 5374
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5375 "*/ int f5375() { // "/* 5375
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5376 "*/ int f5376() { // "/* 5376
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5377 "*/ int f5377() { // "/* 5377
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5378 "*/ int f5378() { // "/* 5378
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5379 "*/ int f5379() { // "/* 5379
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5380 "*/ int f5380() { // "/* 5380
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5381 "*/ int f5381() { // "/* 5381
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5382 "*/ int f5382() { // "/* 5382
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5383 "*/ int f5383() { // "/* 5383
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5384 "*/ int f5384() { // "/* 5384
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5385 "*/ int f5385() { // "/* 5385
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5386 "*/ int f5386() { // "/* 5386
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5387 "*/ int f5387() { // "/* 5387
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5388 "*/ int f5388() { // "/* 5388
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5389 "*/ int f5389() { // "/* 5389
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5390 "*/ int f5390() { // "/* 5390
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5391 "*/ int f5391() { // "/* 5391
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5392 "*/ int f5392() { // "/* 5392
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5393 "*/ int f5393() { // "/* 5393
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5394 "*/ int f5394() { // "/* 5394
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5395 "*/ int f5395() { // "/* 5395
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5396 "*/ int f5396() { // "/* 5396
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5397 "*/ int f5397() { // "/* 5397
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5398 "*/ int f5398() { // "/* 5398
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5399 "*/ int f5399() { // "/* 5399
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5400 "*/ int f5400() { // "/* 5400
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5401 "*/ int f5401() { // "/* 5401
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5402 "*/ int f5402() { // "/* 5402
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5403 "*/ int f5403() { // "/* 5403
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5404 "*/ int f5404() { // "/* 5404
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5405 "*/ int f5405() { // "/* 5405
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5406 "*/ int f5406() { // "/* 5406
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5407 "*/ int f5407() { // "/* 5407
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5408 "*/ int f5408() { // "/* 5408
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5409 "*/ int f5409() { // "/* 5409
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5410 "*/ int f5410() { // "/* 5410
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5411 "*/ int f5411() { // "/* 5411
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5412 "*/ int f5412() { // "/* 5412
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5413 "*/ int f5413() { // "/* 5413
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5414 "*/ int f5414() { // "/* 5414
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5415 "*/ int f5415() { // "/* 5415
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5416 "*/ int f5416() { // "/* 5416
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5417 "*/ int f5417() { // "/* 5417
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5418 "*/ int f5418() { // "/* 5418
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5419 "*/ int f5419() { // "/* 5419
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5420 "*/ int f5420() { // "/* 5420
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5421 "*/ int f5421() { // "/* 5421
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5422 "*/ int f5422() { // "/* 5422
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5423 "*/ int f5423() { // "/* 5423
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5424 "*/ int f5424() { // "/* 5424
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5425 "*/ int f5425() { // "/* 5425
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5426 "*/ int f5426() { // "/* 5426
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5427 "*/ int f5427() { // "/* 5427
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5428 "*/ int f5428() { // "/* 5428
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5429 "*/ int f5429() { // "/* 5429
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5430 "*/ int f5430() { // "/* 5430
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5431 "*/ int f5431() { // "/* 5431
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5432 "*/ int f5432() { // "/* 5432
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5433 "*/ int f5433() { // "/* 5433
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5434 "*/ int f5434() { // "/* 5434
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5435 "*/ int f5435() { // "/* 5435
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5436 "*/ int f5436() { // "/* 5436
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5437 "*/ int f5437() { // "/* 5437
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5438 "*/ int f5438() { // "/* 5438
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5439 "*/ int f5439() { // "/* 5439
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5440 "*/ int f5440() { // "/* 5440
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5441 "*/ int f5441() { // "/* 5441
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5442 "*/ int f5442() { // "/* 5442
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5443 "*/ int f5443() { // "/* 5443
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5444 "*/ int f5444() { // "/* 5444
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5445 "*/ int f5445() { // "/* 5445
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5446 "*/ int f5446() { // "/* 5446
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5447 "*/ int f5447() { // "/* 5447
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5448 "*/ int f5448() { // "/* 5448
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5449 "*/ int f5449() { // "/* 5449
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5450 "*/ int f5450() { // "/* 5450
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5451 "*/ int f5451() { // "/* 5451
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5452 "*/ int f5452() { // "/* 5452
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5453 "*/ int f5453() { // "/* 5453
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5454 "*/ int f5454() { // "/* 5454
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5455 "*/ int f5455() { // "/* 5455
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5456 "*/ int f5456() { // "/* 5456
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5457 "*/ int f5457() { // "/* 5457
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5458 "*/ int f5458() { // "/* 5458
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5459 "*/ int f5459() { // "/* 5459
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5460 "*/ int f5460() { // "/* 5460
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5461 "*/ int f5461() { // "/* 5461
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5462 "*/ int f5462() { // "/* 5462
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5463 "*/ int f5463() { // "/* 5463
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5464 "*/ int f5464() { // "/* 5464
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5465 "*/ int f5465() { // "/* 5465
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5466 "*/ int f5466() { // "/* 5466
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5467 "*/ int f5467() { // "/* 5467
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5468 "*/ int f5468() { // "/* 5468
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5469 "*/ int f5469() { // "/* 5469
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5470 "*/ int f5470() { // "/* 5470
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5471 "*/ int f5471() { // "/* 5471
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5472 "*/ int f5472() { // "/* 5472
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5473 "*/ int f5473() { // "/* 5473
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5474 "*/ int f5474() { // "/* 5474
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5475 "*/ int f5475() { // "/* 5475
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5476 "*/ int f5476() { // "/* 5476
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5477 "*/ int f5477() { // "/* 5477
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5478 "*/ int f5478() { // "/* 5478
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5479 "*/ int f5479() { // "/* 5479
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5480 "*/ int f5480() { // "/* 5480
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5481 "*/ int f5481() { // "/* 5481
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5482 "*/ int f5482() { // "/* 5482
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5483 "*/ int f5483() { // "/* 5483
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5484 "*/ int f5484() { // "/* 5484
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5485 "*/ int f5485() { // "/* 5485
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5486 "*/ int f5486() { // "/* 5486
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5487 "*/ int f5487() { // "/* 5487
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5488 "*/ int f5488() { // "/* 5488
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5489 "*/ int f5489() { // "/* 5489
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5490 "*/ int f5490() { // "/* 5490
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5491 "*/ int f5491() { // "/* 5491
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5492 "*/ int f5492() { // "/* 5492
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5493 "*/ int f5493() { // "/* 5493
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5494 "*/ int f5494() { // "/* 5494
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5495 "*/ int f5495() { // "/* 5495
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5496 "*/ int f5496() { // "/* 5496
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5497 "*/ int f5497() { // "/* 5497
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5498 "*/ int f5498() { // "/* 5498
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5499 "*/ int f5499() { // "/* 5499
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5500 "*/ int f5500() { // "/* 5500
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5501 "*/ int f5501() { // "/* 5501
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5502 "*/ int f5502() { // "/* 5502
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5503 "*/ int f5503() { // "/* 5503
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5504 "*/ int f5504() { // "/* 5504
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5505 "*/ int f5505() { // "/* 5505
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5506 "*/ int f5506() { // "/* 5506
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5507 "*/ int f5507() { // "/* 5507
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5508 "*/ int f5508() { // "/* 5508
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5509 "*/ int f5509() { // "/* 5509
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5510 "*/ int f5510() { // "/* 5510
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5511 "*/ int f5511() { // "/* 5511
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5512 "*/ int f5512() { // "/* 5512
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5513 "*/ int f5513() { // "/* 5513
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5514 "*/ int f5514() { // "/* 5514
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5515 "*/ int f5515() { // "/* 5515
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5516 "*/ int f5516() { // "/* 5516
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5517 "*/ int f5517() { // "/* 5517
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5518 "*/ int f5518() { // "/* 5518
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5519 "*/ int f5519() { // "/* 5519
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5520 "*/ int f5520() { // "/* 5520
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5521 "*/ int f5521() { // "/* 5521
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5522 "*/ int f5522() { // "/* 5522
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5523 "*/ int f5523() { // "/* 5523
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5524 "*/ int f5524() { // "/* 5524
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5525 "*/ int f5525() { // "/* 5525
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5526 "*/ int f5526() { // "/* 5526
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5527 "*/ int f5527() { // "/* 5527
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5528 "*/ int f5528() { // "/* 5528
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5529 "*/ int f5529() { // "/* 5529
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5530 "*/ int f5530() { // "/* 5530
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5531 "*/ int f5531() { // "/* 5531
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5532 "*/ int f5532() { // "/* 5532
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5533 "*/ int f5533() { // "/* 5533
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5534 "*/ int f5534() { // "/* 5534
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5535 "*/ int f5535() { // "/* 5535
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5536 "*/ int f5536() { // "/* 5536
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5537 "*/ int f5537() { // "/* 5537
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5538 "*/ int f5538() { // "/* 5538
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5539 "*/ int f5539() { // "/* 5539
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5540 "*/ int f5540() { // "/* 5540
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5541 "*/ int f5541() { // "/* 5541
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5542 "*/ int f5542() { // "/* 5542
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5543 "*/ int f5543() { // "/* 5543
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5544 "*/ int f5544() { // "/* 5544
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5545 "*/ int f5545() { // "/* 5545
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5546 "*/ int f5546() { // "/* 5546
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5547 "*/ int f5547() { // "/* 5547
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5548 "*/ int f5548() { // "/* 5548
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5549 "*/ int f5549() { // "/* 5549
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5550 "*/ int f5550() { // "/* 5550
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5551 "*/ int f5551() { // "/* 5551
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5552 "*/ int f5552() { // "/* 5552
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5553 "*/ int f5553() { // "/* 5553
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5554 "*/ int f5554() { // "/* 5554
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5555 "*/ int f5555() { // "/* 5555
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5556 "*/ int f5556() { // "/* 5556
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5557 "*/ int f5557() { // "/* 5557
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5558 "*/ int f5558() { // "/* 5558
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5559 "*/ int f5559() { // "/* 5559
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5560 "*/ int f5560() { // "/* 5560
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5561 "*/ int f5561() { // "/* 5561
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5562 "*/ int f5562() { // "/* 5562
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5563 "*/ int f5563() { // "/* 5563
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5564 "*/ int f5564() { // "/* 5564
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5565 "*/ int f5565() { // "/* 5565
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5566 "*/ int f5566() { // "/* 5566
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5567 "*/ int f5567() { // "/* 5567
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5568 "*/ int f5568() { // "/* 5568
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5569 "*/ int f5569() { // "/* 5569
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5570 "*/ int f5570() { // "/* 5570
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5571 "*/ int f5571() { // "/* 5571
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5572 "*/ int f5572() { // "/* 5572
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5573 "*/ int f5573() { // "/* 5573
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5574 "*/ int f5574() { // "/* 5574
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5575 "*/ int f5575() { // "/* 5575
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5576 "*/ int f5576() { // "/* 5576
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5577 "*/ int f5577() { // "/* 5577
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5578 "*/ int f5578() { // "/* 5578
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5579 "*/ int f5579() { // "/* 5579
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5580 "*/ int f5580() { // "/* 5580
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5581 "*/ int f5581() { // "/* 5581
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5582 "*/ int f5582() { // "/* 5582
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5583 "*/ int f5583() { // "/* 5583
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5584 "*/ int f5584() { // "/* 5584
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5585 "*/ int f5585() { // "/* 5585
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5586 "*/ int f5586() { // "/* 5586
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5587 "*/ int f5587() { // "/* 5587
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5588 "*/ int f5588() { // "/* 5588
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5589 "*/ int f5589() { // "/* 5589
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5590 "*/ int f5590() { // "/* 5590
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5591 "*/ int f5591() { // "/* 5591
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5592 "*/ int f5592() { // "/* 5592
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5593 "*/ int f5593() { // "/* 5593
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5594 "*/ int f5594() { // "/* 5594
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5595 "*/ int f5595() { // "/* 5595
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5596 "*/ int f5596() { // "/* 5596
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5597 "*/ int f5597() { // "/* 5597
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5598 "*/ int f5598() { // "/* 5598
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5599 "*/ int f5599() { // "/* 5599
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5600 "*/ int f5600() { // "/* 5600
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5601 "*/ int f5601() { // "/* 5601
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5602 "*/ int f5602() { // "/* 5602
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5603 "*/ int f5603() { // "/* 5603
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5604 "*/ int f5604() { // "/* 5604
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5605 "*/ int f5605() { // "/* 5605
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5606 "*/ int f5606() { // "/* 5606
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5607 "*/ int f5607() { // "/* 5607
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5608 "*/ int f5608() { // "/* 5608
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5609 "*/ int f5609() { // "/* 5609
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5610 "*/ int f5610() { // "/* 5610
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5611 "*/ int f5611() { // "/* 5611
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5612 "*/ int f5612() { // "/* 5612
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5613 "*/ int f5613() { // "/* 5613
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5614 "*/ int f5614() { // "/* 5614
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5615 "*/ int f5615() { // "/* 5615
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5616 "*/ int f5616() { // "/* 5616
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5617 "*/ int f5617() { // "/* 5617
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5618 "*/ int f5618() { // "/* 5618
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5619 "*/ int f5619() { // "/* 5619
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5620 "*/ int f5620() { // "/* 5620
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5621 "*/ int f5621() { // "/* 5621
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5622 "*/ int f5622() { // "/* 5622
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5623 "*/ int f5623() { // "/* 5623
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5624 "*/ int f5624() { // "/* 5624
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5625 "*/ int f5625() { // "/* 5625
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5626 "*/ int f5626() { // "/* 5626
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5627 "*/ int f5627() { // "/* 5627
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5628 "*/ int f5628() { // "/* 5628
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5629 "*/ int f5629() { // "/* 5629
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5630 "*/ int f5630() { // "/* 5630
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5631 "*/ int f5631() { // "/* 5631
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5632 "*/ int f5632() { // "/* 5632
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5633 "*/ int f5633() { // "/* 5633
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5634 "*/ int f5634() { // "/* 5634
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5635 "*/ int f5635() { // "/* 5635
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5636 "*/ int f5636() { // "/* 5636
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5637 "*/ int f5637() { // "/* 5637
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5638 "*/ int f5638() { // "/* 5638
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5639 "*/ int f5639() { // "/* 5639
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5640 "*/ int f5640() { // "/* 5640
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5641 "*/ int f5641() { // "/* 5641
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5642 "*/ int f5642() { // "/* 5642
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5643 "*/ int f5643() { // "/* 5643
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5644 "*/ int f5644() { // "/* 5644
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5645 "*/ int f5645() { // "/* 5645
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5646 "*/ int f5646() { // "/* 5646
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5647 "*/ int f5647() { // "/* 5647
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5648 "*/ int f5648() { // "/* 5648
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5649 "*/ int f5649() { // "/* 5649
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5650 "*/ int f5650() { // "/* 5650
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5651 "*/ int f5651() { // "/* 5651
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5652 "*/ int f5652() { // "/* 5652
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5653 "*/ int f5653() { // "/* 5653
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5654 "*/ int f5654() { // "/* 5654
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5655 "*/ int f5655() { // "/* 5655
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5656 "*/ int f5656() { // "/* 5656
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5657 "*/ int f5657() { // "/* 5657
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5658 "*/ int f5658() { // "/* 5658
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5659 "*/ int f5659() { // "/* 5659
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5660 "*/ int f5660() { // "/* 5660
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5661 "*/ int f5661() { // "/* 5661
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5662 "*/ int f5662() { // "/* 5662
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5663 "*/ int f5663() { // "/* 5663
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5664 "*/ int f5664() { // "/* 5664
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5665 "*/ int f5665() { // "/* 5665
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5666 "*/ int f5666() { // "/* 5666
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5667 "*/ int f5667() { // "/* 5667
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5668 "*/ int f5668() { // "/* 5668
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5669 "*/ int f5669() { // "/* 5669
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5670 "*/ int f5670() { // "/* 5670
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5671 "*/ int f5671() { // "/* 5671
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5672 "*/ int f5672() { // "/* 5672
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5673 "*/ int f5673() { // "/* 5673
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5674 "*/ int f5674() { // "/* 5674
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5675 "*/ int f5675() { // "/* 5675
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5676 "*/ int f5676() { // "/* 5676
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5677 "*/ int f5677() { // "/* 5677
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5678 "*/ int f5678() { // "/* 5678
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5679 "*/ int f5679() { // "/* 5679
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5680 "*/ int f5680() { // "/* 5680
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5681 "*/ int f5681() { // "/* 5681
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5682 "*/ int f5682() { // "/* 5682
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5683 "*/ int f5683() { // "/* 5683
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5684 "*/ int f5684() { // "/* 5684
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5685 "*/ int f5685() { // "/* 5685
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5686 "*/ int f5686() { // "/* 5686
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5687 "*/ int f5687() { // "/* 5687
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5688 "*/ int f5688() { // "/* 5688
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5689 "*/ int f5689() { // "/* 5689
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5690 "*/ int f5690() { // "/* 5690
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5691 "*/ int f5691() { // "/* 5691
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5692 "*/ int f5692() { // "/* 5692
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5693 "*/ int f5693() { // "/* 5693
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5694 "*/ int f5694() { // "/* 5694
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5695 "*/ int f5695() { // "/* 5695
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5696 "*/ int f5696() { // "/* 5696
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5697 "*/ int f5697() { // "/* 5697
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5698 "*/ int f5698() { // "/* 5698
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5699 "*/ int f5699() { // "/* 5699
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5700 "*/ int f5700() { // "/* 5700
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5701 "*/ int f5701() { // "/* 5701
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5702 "*/ int f5702() { // "/* 5702
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5703 "*/ int f5703() { // "/* 5703
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5704 "*/ int f5704() { // "/* 5704
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5705 "*/ int f5705() { // "/* 5705
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5706 "*/ int f5706() { // "/* 5706
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5707 "*/ int f5707() { // "/* 5707
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5708 "*/ int f5708() { // "/* 5708
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5709 "*/ int f5709() { // "/* 5709
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5710 "*/ int f5710() { // "/* 5710
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5711 "*/ int f5711() { // "/* 5711
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5712 "*/ int f5712() { // "/* 5712
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5713 "*/ int f5713() { // "/* 5713
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5714 "*/ int f5714() { // "/* 5714
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5715 "*/ int f5715() { // "/* 5715
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5716 "*/ int f5716() { // "/* 5716
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5717 "*/ int f5717() { // "/* 5717
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5718 "*/ int f5718() { // "/* 5718
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5719 "*/ int f5719() { // "/* 5719
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5720 "*/ int f5720() { // "/* 5720
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5721 "*/ int f5721() { // "/* 5721
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5722 "*/ int f5722() { // "/* 5722
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5723 "*/ int f5723() { // "/* 5723
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5724 "*/ int f5724() { // "/* 5724
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5725 "*/ int f5725() { // "/* 5725
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5726 "*/ int f5726() { // "/* 5726
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5727 "*/ int f5727() { // "/* 5727
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5728 "*/ int f5728() { // "/* 5728
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5729 "*/ int f5729() { // "/* 5729
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5730 "*/ int f5730() { // "/* 5730
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5731 "*/ int f5731() { // "/* 5731
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5732 "*/ int f5732() { // "/* 5732
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5733 "*/ int f5733() { // "/* 5733
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5734 "*/ int f5734() { // "/* 5734
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5735 "*/ int f5735() { // "/* 5735
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5736 "*/ int f5736() { // "/* 5736
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5737 "*/ int f5737() { // "/* 5737
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5738 "*/ int f5738() { // "/* 5738
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5739 "*/ int f5739() { // "/* 5739
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5740 "*/ int f5740() { // "/* 5740
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5741 "*/ int f5741() { // "/* 5741
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5742 "*/ int f5742() { // "/* 5742
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5743 "*/ int f5743() { // "/* 5743
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5744 "*/ int f5744() { // "/* 5744
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5745 "*/ int f5745() { // "/* 5745
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5746 "*/ int f5746() { // "/* 5746
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5747 "*/ int f5747() { // "/* 5747
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5748 "*/ int f5748() { // "/* 5748
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5749 "*/ int f5749() { // "/* 5749
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5750 "*/ int f5750() { // "/* 5750
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5751 "*/ int f5751() { // "/* 5751
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5752 "*/ int f5752() { // "/* 5752
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5753 "*/ int f5753() { // "/* 5753
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5754 "*/ int f5754() { // "/* 5754
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5755 "*/ int f5755() { // "/* 5755
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5756 "*/ int f5756() { // "/* 5756
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5757 "*/ int f5757() { // "/* 5757
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5758 "*/ int f5758() { // "/* 5758
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5759 "*/ int f5759() { // "/* 5759
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5760 "*/ int f5760() { // "/* 5760
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5761 "*/ int f5761() { // "/* 5761
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5762 "*/ int f5762() { // "/* 5762
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5763 "*/ int f5763() { // "/* 5763
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5764 "*/ int f5764() { // "/* 5764
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5765 "*/ int f5765() { // "/* 5765
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5766 "*/ int f5766() { // "/* 5766
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5767 "*/ int f5767() { // "/* 5767
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5768 "*/ int f5768() { // "/* 5768
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5769 "*/ int f5769() { // "/* 5769
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5770 "*/ int f5770() { // "/* 5770
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5771 "*/ int f5771() { // "/* 5771
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5772 "*/ int f5772() { // "/* 5772
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5773 "*/ int f5773() { // "/* 5773
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5774 "*/ int f5774() { // "/* 5774
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5775 "*/ int f5775() { // "/* 5775
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5776 "*/ int f5776() { // "/* 5776
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5777 "*/ int f5777() { // "/* 5777
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5778 "*/ int f5778() { // "/* 5778
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5779 "*/ int f5779() { // "/* 5779
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5780 "*/ int f5780() { // "/* 5780
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5781 "*/ int f5781() { // "/* 5781
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5782 "*/ int f5782() { // "/* 5782
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5783 "*/ int f5783() { // "/* 5783
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5784 "*/ int f5784() { // "/* 5784
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5785 "*/ int f5785() { // "/* 5785
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5786 "*/ int f5786() { // "/* 5786
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5787 "*/ int f5787() { // "/* 5787
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5788 "*/ int f5788() { // "/* 5788
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5789 "*/ int f5789() { // "/* 5789
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5790 "*/ int f5790() { // "/* 5790
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5791 "*/ int f5791() { // "/* 5791
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5792 "*/ int f5792() { // "/* 5792
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5793 "*/ int f5793() { // "/* 5793
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5794 "*/ int f5794() { // "/* 5794
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5795 "*/ int f5795() { // "/* 5795
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5796 "*/ int f5796() { // "/* 5796
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5797 "*/ int f5797() { // "/* 5797
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5798 "*/ int f5798() { // "/* 5798
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5799 "*/ int f5799() { // "/* 5799
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5800 "*/ int f5800() { // "/* 5800
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5801 "*/ int f5801() { // "/* 5801
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5802 "*/ int f5802() { // "/* 5802
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5803 "*/ int f5803() { // "/* 5803
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5804 "*/ int f5804() { // "/* 5804
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5805 "*/ int f5805() { // "/* 5805
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5806 "*/ int f5806() { // "/* 5806
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5807 "*/ int f5807() { // "/* 5807
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5808 "*/ int f5808() { // "/* 5808
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5809 "*/ int f5809() { // "/* 5809
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5810 "*/ int f5810() { // "/* 5810
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5811 "*/ int f5811() { // "/* 5811
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5812 "*/ int f5812() { // "/* 5812
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5813 "*/ int f5813() { // "/* 5813
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5814 "*/ int f5814() { // "/* 5814
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5815 "*/ int f5815() { // "/* 5815
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5816 "*/ int f5816() { // "/* 5816
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5817 "*/ int f5817() { // "/* 5817
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5818 "*/ int f5818() { // "/* 5818
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5819 "*/ int f5819() { // "/* 5819
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5820 "*/ int f5820() { // "/* 5820
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5821 "*/ int f5821() { // "/* 5821
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5822 "*/ int f5822() { // "/* 5822
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5823 "*/ int f5823() { // "/* 5823
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5824 "*/ int f5824() { // "/* 5824
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5825 "*/ int f5825() { // "/* 5825
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5826 "*/ int f5826() { // "/* 5826
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5827 "*/ int f5827() { // "/* 5827
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5828 "*/ int f5828() { // "/* 5828
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5829 "*/ int f5829() { // "/* 5829
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5830 "*/ int f5830() { // "/* 5830
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5831 "*/ int f5831() { // "/* 5831
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5832 "*/ int f5832() { // "/* 5832
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5833 "*/ int f5833() { // "/* 5833
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5834 "*/ int f5834() { // "/* 5834
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5835 "*/ int f5835() { // "/* 5835
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5836 "*/ int f5836() { // "/* 5836
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5837 "*/ int f5837() { // "/* 5837
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5838 "*/ int f5838() { // "/* 5838
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5839 "*/ int f5839() { // "/* 5839
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5840 "*/ int f5840() { // "/* 5840
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5841 "*/ int f5841() { // "/* 5841
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5842 "*/ int f5842() { // "/* 5842
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5843 "*/ int f5843() { // "/* 5843
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5844 "*/ int f5844() { // "/* 5844
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5845 "*/ int f5845() { // "/* 5845
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5846 "*/ int f5846() { // "/* 5846
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5847 "*/ int f5847() { // "/* 5847
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5848 "*/ int f5848() { // "/* 5848
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5849 "*/ int f5849() { // "/* 5849
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5850 "*/ int f5850() { // "/* 5850
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5851 "*/ int f5851() { // "/* 5851
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5852 "*/ int f5852() { // "/* 5852
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5853 "*/ int f5853() { // "/* 5853
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5854 "*/ int f5854() { // "/* 5854
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5855 "*/ int f5855() { // "/* 5855
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5856 "*/ int f5856() { // "/* 5856
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5857 "*/ int f5857() { // "/* 5857
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5858 "*/ int f5858() { // "/* 5858
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5859 "*/ int f5859() { // "/* 5859
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5860 "*/ int f5860() { // "/* 5860
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5861 "*/ int f5861() { // "/* 5861
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5862 "*/ int f5862() { // "/* 5862
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5863 "*/ int f5863() { // "/* 5863
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5864 "*/ int f5864() { // "/* 5864
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5865 "*/ int f5865() { // "/* 5865
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5866 "*/ int f5866() { // "/* 5866
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5867 "*/ int f5867() { // "/* 5867
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5868 "*/ int f5868() { // "/* 5868
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5869 "*/ int f5869() { // "/* 5869
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5870 "*/ int f5870() { // "/* 5870
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5871 "*/ int f5871() { // "/* 5871
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5872 "*/ int f5872() { // "/* 5872
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5873 "*/ int f5873() { // "/* 5873
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5874 "*/ int f5874() { // "/* 5874
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5875 "*/ int f5875() { // "/* 5875
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5876 "*/ int f5876() { // "/* 5876
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5877 "*/ int f5877() { // "/* 5877
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5878 "*/ int f5878() { // "/* 5878
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5879 "*/ int f5879() { // "/* 5879
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5880 "*/ int f5880() { // "/* 5880
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5881 "*/ int f5881() { // "/* 5881
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5882 "*/ int f5882() { // "/* 5882
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5883 "*/ int f5883() { // "/* 5883
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5884 "*/ int f5884() { // "/* 5884
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5885 "*/ int f5885() { // "/* 5885
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5886 "*/ int f5886() { // "/* 5886
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5887 "*/ int f5887() { // "/* 5887
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5888 "*/ int f5888() { // "/* 5888
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5889 "*/ int f5889() { // "/* 5889
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5890 "*/ int f5890() { // "/* 5890
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5891 "*/ int f5891() { // "/* 5891
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5892 "*/ int f5892() { // "/* 5892
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5893 "*/ int f5893() { // "/* 5893
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5894 "*/ int f5894() { // "/* 5894
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5895 "*/ int f5895() { // "/* 5895
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5896 "*/ int f5896() { // "/* 5896
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5897 "*/ int f5897() { // "/* 5897
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5898 "*/ int f5898() { // "/* 5898
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5899 "*/ int f5899() { // "/* 5899
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5900 "*/ int f5900() { // "/* 5900
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5901 "*/ int f5901() { // "/* 5901
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5902 "*/ int f5902() { // "/* 5902
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5903 "*/ int f5903() { // "/* 5903
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5904 "*/ int f5904() { // "/* 5904
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5905 "*/ int f5905() { // "/* 5905
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5906 "*/ int f5906() { // "/* 5906
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5907 "*/ int f5907() { // "/* 5907
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5908 "*/ int f5908() { // "/* 5908
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5909 "*/ int f5909() { // "/* 5909
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5910 "*/ int f5910() { // "/* 5910
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5911 "*/ int f5911() { // "/* 5911
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5912 "*/ int f5912() { // "/* 5912
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5913 "*/ int f5913() { // "/* 5913
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5914 "*/ int f5914() { // "/* 5914
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5915 "*/ int f5915() { // "/* 5915
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5916 "*/ int f5916() { // "/* 5916
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5917 "*/ int f5917() { // "/* 5917
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5918 "*/ int f5918() { // "/* 5918
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5919 "*/ int f5919() { // "/* 5919
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5920 "*/ int f5920() { // "/* 5920
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5921 "*/ int f5921() { // "/* 5921
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5922 "*/ int f5922() { // "/* 5922
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5923 "*/ int f5923() { // "/* 5923
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5924 "*/ int f5924() { // "/* 5924
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5925 "*/ int f5925() { // "/* 5925
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5926 "*/ int f5926() { // "/* 5926
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5927 "*/ int f5927() { // "/* 5927
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5928 "*/ int f5928() { // "/* 5928
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5929 "*/ int f5929() { // "/* 5929
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5930 "*/ int f5930() { // "/* 5930
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5931 "*/ int f5931() { // "/* 5931
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5932 "*/ int f5932() { // "/* 5932
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5933 "*/ int f5933() { // "/* 5933
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5934 "*/ int f5934() { // "/* 5934
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5935 "*/ int f5935() { // "/* 5935
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5936 "*/ int f5936() { // "/* 5936
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5937 "*/ int f5937() { // "/* 5937
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5938 "*/ int f5938() { // "/* 5938
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5939 "*/ int f5939() { // "/* 5939
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5940 "*/ int f5940() { // "/* 5940
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5941 "*/ int f5941() { // "/* 5941
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5942 "*/ int f5942() { // "/* 5942
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5943 "*/ int f5943() { // "/* 5943
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5944 "*/ int f5944() { // "/* 5944
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5945 "*/ int f5945() { // "/* 5945
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5946 "*/ int f5946() { // "/* 5946
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5947 "*/ int f5947() { // "/* 5947
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5948 "*/ int f5948() { // "/* 5948
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5949 "*/ int f5949() { // "/* 5949
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5950 "*/ int f5950() { // "/* 5950
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5951 "*/ int f5951() { // "/* 5951
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5952 "*/ int f5952() { // "/* 5952
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5953 "*/ int f5953() { // "/* 5953
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5954 "*/ int f5954() { // "/* 5954
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5955 "*/ int f5955() { // "/* 5955
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5956 "*/ int f5956() { // "/* 5956
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5957 "*/ int f5957() { // "/* 5957
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5958 "*/ int f5958() { // "/* 5958
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5959 "*/ int f5959() { // "/* 5959
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5960 "*/ int f5960() { // "/* 5960
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5961 "*/ int f5961() { // "/* 5961
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5962 "*/ int f5962() { // "/* 5962
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5963 "*/ int f5963() { // "/* 5963
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5964 "*/ int f5964() { // "/* 5964
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5965 "*/ int f5965() { // "/* 5965
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5966 "*/ int f5966() { // "/* 5966
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5967 "*/ int f5967() { // "/* 5967
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5968 "*/ int f5968() { // "/* 5968
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5969 "*/ int f5969() { // "/* 5969
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5970 "*/ int f5970() { // "/* 5970
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5971 "*/ int f5971() { // "/* 5971
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5972 "*/ int f5972() { // "/* 5972
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5973 "*/ int f5973() { // "/* 5973
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5974 "*/ int f5974() { // "/* 5974
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5975 "*/ int f5975() { // "/* 5975
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5976 "*/ int f5976() { // "/* 5976
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5977 "*/ int f5977() { // "/* 5977
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5978 "*/ int f5978() { // "/* 5978
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5979 "*/ int f5979() { // "/* 5979
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5980 "*/ int f5980() { // "/* 5980
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5981 "*/ int f5981() { // "/* 5981
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5982 "*/ int f5982() { // "/* 5982
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5983 "*/ int f5983() { // "/* 5983
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5984 "*/ int f5984() { // "/* 5984
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5985 "*/ int f5985() { // "/* 5985
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5986 "*/ int f5986() { // "/* 5986
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5987 "*/ int f5987() { // "/* 5987
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5988 "*/ int f5988() { // "/* 5988
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5989 "*/ int f5989() { // "/* 5989
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5990 "*/ int f5990() { // "/* 5990
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5991 "*/ int f5991() { // "/* 5991
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5992 "*/ int f5992() { // "/* 5992
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5993 "*/ int f5993() { // "/* 5993
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5994 "*/ int f5994() { // "/* 5994
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5995 "*/ int f5995() { // "/* 5995
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5996 "*/ int f5996() { // "/* 5996
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5997 "*/ int f5997() { // "/* 5997
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5998 "*/ int f5998() { // "/* 5998
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 5999 "*/ int f5999() { // "/* 5999
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
+/* 6000 "*/ int f6000() { // "/* 6000
+  char *s = "a/*b\"c//d\\"; /* x
+ y
+ */ return s[2]; }
@@ -0,0 +1,58008 @@
+.intel_syntax noprefix
+.section .note.GNU-stack,"",@progbits
+.bss
+.section .rodata.str1.1,"aMS",@progbits,1
+.L.str.e33fb3bb285734e26a55818ab4a11eb8:
+  .string "a/*b\"c//d\\"
+.section .rodata
+.text
+.global f1
+f1:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1
+.L.return.f1:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f2
+f2:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f2
+.L.return.f2:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f3
+f3:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f3
+.L.return.f3:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f4
+f4:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f4
+.L.return.f4:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f5
+f5:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f5
+.L.return.f5:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f6
+f6:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f6
+.L.return.f6:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f7
+f7:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f7
+.L.return.f7:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f8
+f8:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f8
+.L.return.f8:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f9
+f9:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f9
+.L.return.f9:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f10
+f10:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f10
+.L.return.f10:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f11
+f11:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f11
+.L.return.f11:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f12
+f12:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f12
+.L.return.f12:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f13
+f13:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f13
+.L.return.f13:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f14
+f14:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f14
+.L.return.f14:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f15
+f15:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f15
+.L.return.f15:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f16
+f16:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f16
+.L.return.f16:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f17
+f17:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f17
+.L.return.f17:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f18
+f18:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f18
+.L.return.f18:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f19
+f19:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f19
+.L.return.f19:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f20
+f20:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f20
+.L.return.f20:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f21
+f21:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f21
+.L.return.f21:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f22
+f22:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f22
+.L.return.f22:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f23
+f23:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f23
+.L.return.f23:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f24
+f24:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f24
+.L.return.f24:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f25
+f25:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f25
+.L.return.f25:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f26
+f26:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f26
+.L.return.f26:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f27
+f27:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f27
+.L.return.f27:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f28
+f28:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f28
+.L.return.f28:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f29
+f29:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f29
+.L.return.f29:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f30
+f30:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f30
+.L.return.f30:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f31
+f31:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f31
+.L.return.f31:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f32
+f32:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f32
+.L.return.f32:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f33
+f33:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f33
+.L.return.f33:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f34
+f34:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f34
+.L.return.f34:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f35
+f35:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f35
+.L.return.f35:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f36
+f36:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f36
+.L.return.f36:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f37
+f37:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f37
+.L.return.f37:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f38
+f38:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f38
+.L.return.f38:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f39
+f39:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f39
+.L.return.f39:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f40
+f40:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f40
+.L.return.f40:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f41
+f41:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f41
+.L.return.f41:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f42
+f42:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f42
+.L.return.f42:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f43
+f43:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f43
+.L.return.f43:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f44
+f44:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f44
+.L.return.f44:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f45
+f45:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f45
+.L.return.f45:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f46
+f46:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f46
+.L.return.f46:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f47
+f47:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f47
+.L.return.f47:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f48
+f48:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f48
+.L.return.f48:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f49
+f49:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f49
+.L.return.f49:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f50
+f50:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f50
+.L.return.f50:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f51
+f51:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f51
+.L.return.f51:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f52
+f52:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f52
+.L.return.f52:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f53
+f53:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f53
+.L.return.f53:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f54
+f54:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f54
+.L.return.f54:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f55
+f55:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f55
+.L.return.f55:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f56
+f56:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f56
+.L.return.f56:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f57
+f57:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f57
+.L.return.f57:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f58
+f58:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f58
+.L.return.f58:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f59
+f59:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f59
+.L.return.f59:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f60
+f60:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f60
+.L.return.f60:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f61
+f61:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f61
+.L.return.f61:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f62
+f62:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f62
+.L.return.f62:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f63
+f63:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f63
+.L.return.f63:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f64
+f64:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f64
+.L.return.f64:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f65
+f65:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f65
+.L.return.f65:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f66
+f66:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f66
+.L.return.f66:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f67
+f67:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f67
+.L.return.f67:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f68
+f68:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f68
+.L.return.f68:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f69
+f69:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f69
+.L.return.f69:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f70
+f70:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f70
+.L.return.f70:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f71
+f71:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f71
+.L.return.f71:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f72
+f72:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f72
+.L.return.f72:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f73
+f73:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f73
+.L.return.f73:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f74
+f74:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f74
+.L.return.f74:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f75
+f75:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f75
+.L.return.f75:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f76
+f76:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f76
+.L.return.f76:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f77
+f77:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f77
+.L.return.f77:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f78
+f78:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f78
+.L.return.f78:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f79
+f79:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f79
+.L.return.f79:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f80
+f80:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f80
+.L.return.f80:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f81
+f81:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f81
+.L.return.f81:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f82
+f82:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f82
+.L.return.f82:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f83
+f83:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f83
+.L.return.f83:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f84
+f84:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f84
+.L.return.f84:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f85
+f85:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f85
+.L.return.f85:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f86
+f86:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f86
+.L.return.f86:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f87
+f87:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f87
+.L.return.f87:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f88
+f88:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f88
+.L.return.f88:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f89
+f89:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f89
+.L.return.f89:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f90
+f90:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f90
+.L.return.f90:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f91
+f91:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f91
+.L.return.f91:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f92
+f92:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f92
+.L.return.f92:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f93
+f93:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f93
+.L.return.f93:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f94
+f94:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f94
+.L.return.f94:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f95
+f95:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f95
+.L.return.f95:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f96
+f96:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f96
+.L.return.f96:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f97
+f97:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f97
+.L.return.f97:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f98
+f98:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f98
+.L.return.f98:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f99
+f99:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f99
+.L.return.f99:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f100
+f100:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f100
+.L.return.f100:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f101
+f101:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f101
+.L.return.f101:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f102
+f102:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f102
+.L.return.f102:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f103
+f103:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f103
+.L.return.f103:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f104
+f104:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f104
+.L.return.f104:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f105
+f105:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f105
+.L.return.f105:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f106
+f106:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f106
+.L.return.f106:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f107
+f107:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f107
+.L.return.f107:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f108
+f108:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f108
+.L.return.f108:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f109
+f109:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f109
+.L.return.f109:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f110
+f110:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f110
+.L.return.f110:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f111
+f111:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f111
+.L.return.f111:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f112
+f112:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f112
+.L.return.f112:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f113
+f113:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f113
+.L.return.f113:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f114
+f114:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f114
+.L.return.f114:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f115
+f115:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f115
+.L.return.f115:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f116
+f116:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f116
+.L.return.f116:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f117
+f117:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f117
+.L.return.f117:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f118
+f118:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f118
+.L.return.f118:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f119
+f119:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f119
+.L.return.f119:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f120
+f120:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f120
+.L.return.f120:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f121
+f121:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f121
+.L.return.f121:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f122
+f122:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f122
+.L.return.f122:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f123
+f123:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f123
+.L.return.f123:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f124
+f124:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f124
+.L.return.f124:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f125
+f125:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f125
+.L.return.f125:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f126
+f126:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f126
+.L.return.f126:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f127
+f127:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f127
+.L.return.f127:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f128
+f128:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f128
+.L.return.f128:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f129
+f129:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f129
+.L.return.f129:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f130
+f130:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f130
+.L.return.f130:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f131
+f131:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f131
+.L.return.f131:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f132
+f132:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f132
+.L.return.f132:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f133
+f133:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f133
+.L.return.f133:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f134
+f134:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f134
+.L.return.f134:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f135
+f135:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f135
+.L.return.f135:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f136
+f136:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f136
+.L.return.f136:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f137
+f137:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f137
+.L.return.f137:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f138
+f138:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f138
+.L.return.f138:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f139
+f139:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f139
+.L.return.f139:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f140
+f140:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f140
+.L.return.f140:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f141
+f141:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f141
+.L.return.f141:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f142
+f142:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f142
+.L.return.f142:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f143
+f143:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f143
+.L.return.f143:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f144
+f144:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f144
+.L.return.f144:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f145
+f145:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f145
+.L.return.f145:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f146
+f146:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f146
+.L.return.f146:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f147
+f147:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f147
+.L.return.f147:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f148
+f148:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f148
+.L.return.f148:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f149
+f149:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f149
+.L.return.f149:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f150
+f150:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f150
+.L.return.f150:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f151
+f151:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f151
+.L.return.f151:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f152
+f152:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f152
+.L.return.f152:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f153
+f153:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f153
+.L.return.f153:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f154
+f154:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f154
+.L.return.f154:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f155
+f155:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f155
+.L.return.f155:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f156
+f156:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f156
+.L.return.f156:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f157
+f157:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f157
+.L.return.f157:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f158
+f158:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f158
+.L.return.f158:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f159
+f159:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f159
+.L.return.f159:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f160
+f160:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f160
+.L.return.f160:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f161
+f161:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f161
+.L.return.f161:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f162
+f162:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f162
+.L.return.f162:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f163
+f163:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f163
+.L.return.f163:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f164
+f164:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f164
+.L.return.f164:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f165
+f165:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f165
+.L.return.f165:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f166
+f166:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f166
+.L.return.f166:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f167
+f167:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f167
+.L.return.f167:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f168
+f168:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f168
+.L.return.f168:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f169
+f169:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f169
+.L.return.f169:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f170
+f170:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f170
+.L.return.f170:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f171
+f171:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f171
+.L.return.f171:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f172
+f172:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f172
+.L.return.f172:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f173
+f173:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f173
+.L.return.f173:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f174
+f174:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f174
+.L.return.f174:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f175
+f175:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f175
+.L.return.f175:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f176
+f176:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f176
+.L.return.f176:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f177
+f177:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f177
+.L.return.f177:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f178
+f178:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f178
+.L.return.f178:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f179
+f179:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f179
+.L.return.f179:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f180
+f180:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f180
+.L.return.f180:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f181
+f181:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f181
+.L.return.f181:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f182
+f182:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f182
+.L.return.f182:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f183
+f183:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f183
+.L.return.f183:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f184
+f184:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f184
+.L.return.f184:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f185
+f185:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f185
+.L.return.f185:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f186
+f186:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f186
+.L.return.f186:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f187
+f187:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f187
+.L.return.f187:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f188
+f188:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f188
+.L.return.f188:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f189
+f189:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f189
+.L.return.f189:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f190
+f190:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f190
+.L.return.f190:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f191
+f191:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f191
+.L.return.f191:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f192
+f192:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f192
+.L.return.f192:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f193
+f193:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f193
+.L.return.f193:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f194
+f194:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f194
+.L.return.f194:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f195
+f195:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f195
+.L.return.f195:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f196
+f196:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f196
+.L.return.f196:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f197
+f197:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f197
+.L.return.f197:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f198
+f198:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f198
+.L.return.f198:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f199
+f199:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f199
+.L.return.f199:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f200
+f200:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f200
+.L.return.f200:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f201
+f201:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f201
+.L.return.f201:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f202
+f202:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f202
+.L.return.f202:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f203
+f203:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f203
+.L.return.f203:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f204
+f204:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f204
+.L.return.f204:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f205
+f205:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f205
+.L.return.f205:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f206
+f206:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f206
+.L.return.f206:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f207
+f207:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f207
+.L.return.f207:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f208
+f208:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f208
+.L.return.f208:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f209
+f209:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f209
+.L.return.f209:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f210
+f210:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f210
+.L.return.f210:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f211
+f211:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f211
+.L.return.f211:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f212
+f212:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f212
+.L.return.f212:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f213
+f213:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f213
+.L.return.f213:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f214
+f214:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f214
+.L.return.f214:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f215
+f215:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f215
+.L.return.f215:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f216
+f216:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f216
+.L.return.f216:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f217
+f217:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f217
+.L.return.f217:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f218
+f218:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f218
+.L.return.f218:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f219
+f219:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f219
+.L.return.f219:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f220
+f220:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f220
+.L.return.f220:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f221
+f221:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f221
+.L.return.f221:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f222
+f222:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f222
+.L.return.f222:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f223
+f223:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f223
+.L.return.f223:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f224
+f224:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f224
+.L.return.f224:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f225
+f225:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f225
+.L.return.f225:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f226
+f226:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f226
+.L.return.f226:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f227
+f227:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f227
+.L.return.f227:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f228
+f228:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f228
+.L.return.f228:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f229
+f229:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f229
+.L.return.f229:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f230
+f230:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f230
+.L.return.f230:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f231
+f231:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f231
+.L.return.f231:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f232
+f232:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f232
+.L.return.f232:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f233
+f233:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f233
+.L.return.f233:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f234
+f234:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f234
+.L.return.f234:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f235
+f235:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f235
+.L.return.f235:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f236
+f236:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f236
+.L.return.f236:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f237
+f237:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f237
+.L.return.f237:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f238
+f238:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f238
+.L.return.f238:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f239
+f239:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f239
+.L.return.f239:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f240
+f240:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f240
+.L.return.f240:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f241
+f241:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f241
+.L.return.f241:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f242
+f242:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f242
+.L.return.f242:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f243
+f243:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f243
+.L.return.f243:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f244
+f244:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f244
+.L.return.f244:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f245
+f245:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f245
+.L.return.f245:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f246
+f246:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f246
+.L.return.f246:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f247
+f247:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f247
+.L.return.f247:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f248
+f248:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f248
+.L.return.f248:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f249
+f249:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f249
+.L.return.f249:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f250
+f250:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f250
+.L.return.f250:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f251
+f251:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f251
+.L.return.f251:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f252
+f252:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f252
+.L.return.f252:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f253
+f253:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f253
+.L.return.f253:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f254
+f254:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f254
+.L.return.f254:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f255
+f255:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f255
+.L.return.f255:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f256
+f256:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f256
+.L.return.f256:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f257
+f257:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f257
+.L.return.f257:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f258
+f258:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f258
+.L.return.f258:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f259
+f259:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f259
+.L.return.f259:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f260
+f260:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f260
+.L.return.f260:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f261
+f261:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f261
+.L.return.f261:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f262
+f262:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f262
+.L.return.f262:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f263
+f263:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f263
+.L.return.f263:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f264
+f264:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f264
+.L.return.f264:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f265
+f265:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f265
+.L.return.f265:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f266
+f266:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f266
+.L.return.f266:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f267
+f267:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f267
+.L.return.f267:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f268
+f268:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f268
+.L.return.f268:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f269
+f269:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f269
+.L.return.f269:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f270
+f270:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f270
+.L.return.f270:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f271
+f271:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f271
+.L.return.f271:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f272
+f272:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f272
+.L.return.f272:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f273
+f273:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f273
+.L.return.f273:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f274
+f274:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f274
+.L.return.f274:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f275
+f275:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f275
+.L.return.f275:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f276
+f276:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f276
+.L.return.f276:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f277
+f277:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f277
+.L.return.f277:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f278
+f278:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f278
+.L.return.f278:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f279
+f279:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f279
+.L.return.f279:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f280
+f280:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f280
+.L.return.f280:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f281
+f281:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f281
+.L.return.f281:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f282
+f282:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f282
+.L.return.f282:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f283
+f283:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f283
+.L.return.f283:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f284
+f284:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f284
+.L.return.f284:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f285
+f285:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f285
+.L.return.f285:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f286
+f286:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f286
+.L.return.f286:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f287
+f287:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f287
+.L.return.f287:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f288
+f288:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f288
+.L.return.f288:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f289
+f289:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f289
+.L.return.f289:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f290
+f290:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f290
+.L.return.f290:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f291
+f291:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f291
+.L.return.f291:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f292
+f292:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f292
+.L.return.f292:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f293
+f293:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f293
+.L.return.f293:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f294
+f294:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f294
+.L.return.f294:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f295
+f295:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f295
+.L.return.f295:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f296
+f296:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f296
+.L.return.f296:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f297
+f297:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f297
+.L.return.f297:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f298
+f298:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f298
+.L.return.f298:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f299
+f299:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f299
+.L.return.f299:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f300
+f300:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f300
+.L.return.f300:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f301
+f301:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f301
+.L.return.f301:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f302
+f302:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f302
+.L.return.f302:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f303
+f303:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f303
+.L.return.f303:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f304
+f304:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f304
+.L.return.f304:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f305
+f305:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f305
+.L.return.f305:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f306
+f306:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f306
+.L.return.f306:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f307
+f307:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f307
+.L.return.f307:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f308
+f308:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f308
+.L.return.f308:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f309
+f309:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f309
+.L.return.f309:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f310
+f310:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f310
+.L.return.f310:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f311
+f311:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f311
+.L.return.f311:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f312
+f312:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f312
+.L.return.f312:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f313
+f313:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f313
+.L.return.f313:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f314
+f314:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f314
+.L.return.f314:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f315
+f315:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f315
+.L.return.f315:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f316
+f316:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f316
+.L.return.f316:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f317
+f317:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f317
+.L.return.f317:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f318
+f318:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f318
+.L.return.f318:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f319
+f319:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f319
+.L.return.f319:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f320
+f320:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f320
+.L.return.f320:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f321
+f321:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f321
+.L.return.f321:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f322
+f322:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f322
+.L.return.f322:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f323
+f323:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f323
+.L.return.f323:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f324
+f324:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f324
+.L.return.f324:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f325
+f325:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f325
+.L.return.f325:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f326
+f326:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f326
+.L.return.f326:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f327
+f327:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f327
+.L.return.f327:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f328
+f328:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f328
+.L.return.f328:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f329
+f329:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f329
+.L.return.f329:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f330
+f330:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f330
+.L.return.f330:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f331
+f331:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f331
+.L.return.f331:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f332
+f332:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f332
+.L.return.f332:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f333
+f333:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f333
+.L.return.f333:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f334
+f334:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f334
+.L.return.f334:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f335
+f335:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f335
+.L.return.f335:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f336
+f336:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f336
+.L.return.f336:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f337
+f337:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f337
+.L.return.f337:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f338
+f338:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f338
+.L.return.f338:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f339
+f339:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f339
+.L.return.f339:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f340
+f340:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f340
+.L.return.f340:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f341
+f341:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f341
+.L.return.f341:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f342
+f342:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f342
+.L.return.f342:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f343
+f343:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f343
+.L.return.f343:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f344
+f344:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f344
+.L.return.f344:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f345
+f345:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f345
+.L.return.f345:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f346
+f346:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f346
+.L.return.f346:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f347
+f347:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f347
+.L.return.f347:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f348
+f348:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f348
+.L.return.f348:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f349
+f349:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f349
+.L.return.f349:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f350
+f350:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f350
+.L.return.f350:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f351
+f351:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f351
+.L.return.f351:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f352
+f352:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f352
+.L.return.f352:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f353
+f353:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f353
+.L.return.f353:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f354
+f354:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f354
+.L.return.f354:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f355
+f355:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f355
+.L.return.f355:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f356
+f356:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f356
+.L.return.f356:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f357
+f357:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f357
+.L.return.f357:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f358
+f358:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f358
+.L.return.f358:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f359
+f359:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f359
+.L.return.f359:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f360
+f360:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f360
+.L.return.f360:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f361
+f361:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f361
+.L.return.f361:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f362
+f362:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f362
+.L.return.f362:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f363
+f363:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f363
+.L.return.f363:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f364
+f364:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f364
+.L.return.f364:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f365
+f365:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f365
+.L.return.f365:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f366
+f366:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f366
+.L.return.f366:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f367
+f367:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f367
+.L.return.f367:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f368
+f368:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f368
+.L.return.f368:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f369
+f369:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f369
+.L.return.f369:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f370
+f370:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f370
+.L.return.f370:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f371
+f371:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f371
+.L.return.f371:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f372
+f372:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f372
+.L.return.f372:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f373
+f373:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f373
+.L.return.f373:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f374
+f374:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f374
+.L.return.f374:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f375
+f375:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f375
+.L.return.f375:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f376
+f376:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f376
+.L.return.f376:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f377
+f377:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f377
+.L.return.f377:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f378
+f378:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f378
+.L.return.f378:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f379
+f379:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f379
+.L.return.f379:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f380
+f380:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f380
+.L.return.f380:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f381
+f381:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f381
+.L.return.f381:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f382
+f382:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f382
+.L.return.f382:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f383
+f383:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f383
+.L.return.f383:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f384
+f384:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f384
+.L.return.f384:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f385
+f385:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f385
+.L.return.f385:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f386
+f386:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f386
+.L.return.f386:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f387
+f387:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f387
+.L.return.f387:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f388
+f388:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f388
+.L.return.f388:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f389
+f389:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f389
+.L.return.f389:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f390
+f390:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f390
+.L.return.f390:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f391
+f391:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f391
+.L.return.f391:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f392
+f392:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f392
+.L.return.f392:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f393
+f393:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f393
+.L.return.f393:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f394
+f394:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f394
+.L.return.f394:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f395
+f395:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f395
+.L.return.f395:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f396
+f396:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f396
+.L.return.f396:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f397
+f397:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f397
+.L.return.f397:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f398
+f398:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f398
+.L.return.f398:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f399
+f399:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f399
+.L.return.f399:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f400
+f400:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f400
+.L.return.f400:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f401
+f401:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f401
+.L.return.f401:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f402
+f402:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f402
+.L.return.f402:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f403
+f403:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f403
+.L.return.f403:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f404
+f404:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f404
+.L.return.f404:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f405
+f405:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f405
+.L.return.f405:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f406
+f406:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f406
+.L.return.f406:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f407
+f407:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f407
+.L.return.f407:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f408
+f408:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f408
+.L.return.f408:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f409
+f409:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f409
+.L.return.f409:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f410
+f410:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f410
+.L.return.f410:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f411
+f411:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f411
+.L.return.f411:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f412
+f412:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f412
+.L.return.f412:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f413
+f413:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f413
+.L.return.f413:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f414
+f414:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f414
+.L.return.f414:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f415
+f415:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f415
+.L.return.f415:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f416
+f416:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f416
+.L.return.f416:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f417
+f417:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f417
+.L.return.f417:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f418
+f418:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f418
+.L.return.f418:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f419
+f419:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f419
+.L.return.f419:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f420
+f420:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f420
+.L.return.f420:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f421
+f421:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f421
+.L.return.f421:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f422
+f422:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f422
+.L.return.f422:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f423
+f423:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f423
+.L.return.f423:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f424
+f424:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f424
+.L.return.f424:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f425
+f425:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f425
+.L.return.f425:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f426
+f426:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f426
+.L.return.f426:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f427
+f427:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f427
+.L.return.f427:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f428
+f428:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f428
+.L.return.f428:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f429
+f429:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f429
+.L.return.f429:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f430
+f430:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f430
+.L.return.f430:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f431
+f431:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f431
+.L.return.f431:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f432
+f432:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f432
+.L.return.f432:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f433
+f433:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f433
+.L.return.f433:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f434
+f434:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f434
+.L.return.f434:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f435
+f435:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f435
+.L.return.f435:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f436
+f436:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f436
+.L.return.f436:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f437
+f437:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f437
+.L.return.f437:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f438
+f438:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f438
+.L.return.f438:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f439
+f439:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f439
+.L.return.f439:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f440
+f440:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f440
+.L.return.f440:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f441
+f441:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f441
+.L.return.f441:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f442
+f442:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f442
+.L.return.f442:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f443
+f443:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f443
+.L.return.f443:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f444
+f444:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f444
+.L.return.f444:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f445
+f445:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f445
+.L.return.f445:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f446
+f446:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f446
+.L.return.f446:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f447
+f447:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f447
+.L.return.f447:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f448
+f448:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f448
+.L.return.f448:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f449
+f449:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f449
+.L.return.f449:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f450
+f450:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f450
+.L.return.f450:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f451
+f451:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f451
+.L.return.f451:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f452
+f452:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f452
+.L.return.f452:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f453
+f453:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f453
+.L.return.f453:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f454
+f454:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f454
+.L.return.f454:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f455
+f455:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f455
+.L.return.f455:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f456
+f456:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f456
+.L.return.f456:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f457
+f457:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f457
+.L.return.f457:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f458
+f458:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f458
+.L.return.f458:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f459
+f459:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f459
+.L.return.f459:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f460
+f460:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f460
+.L.return.f460:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f461
+f461:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f461
+.L.return.f461:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f462
+f462:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f462
+.L.return.f462:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f463
+f463:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f463
+.L.return.f463:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f464
+f464:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f464
+.L.return.f464:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f465
+f465:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f465
+.L.return.f465:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f466
+f466:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f466
+.L.return.f466:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f467
+f467:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f467
+.L.return.f467:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f468
+f468:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f468
+.L.return.f468:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f469
+f469:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f469
+.L.return.f469:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f470
+f470:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f470
+.L.return.f470:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f471
+f471:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f471
+.L.return.f471:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f472
+f472:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f472
+.L.return.f472:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f473
+f473:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f473
+.L.return.f473:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f474
+f474:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f474
+.L.return.f474:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f475
+f475:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f475
+.L.return.f475:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f476
+f476:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f476
+.L.return.f476:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f477
+f477:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f477
+.L.return.f477:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f478
+f478:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f478
+.L.return.f478:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f479
+f479:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f479
+.L.return.f479:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f480
+f480:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f480
+.L.return.f480:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f481
+f481:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f481
+.L.return.f481:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f482
+f482:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f482
+.L.return.f482:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f483
+f483:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f483
+.L.return.f483:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f484
+f484:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f484
+.L.return.f484:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f485
+f485:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f485
+.L.return.f485:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f486
+f486:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f486
+.L.return.f486:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f487
+f487:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f487
+.L.return.f487:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f488
+f488:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f488
+.L.return.f488:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f489
+f489:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f489
+.L.return.f489:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f490
+f490:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f490
+.L.return.f490:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f491
+f491:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f491
+.L.return.f491:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f492
+f492:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f492
+.L.return.f492:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f493
+f493:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f493
+.L.return.f493:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f494
+f494:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f494
+.L.return.f494:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f495
+f495:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f495
+.L.return.f495:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f496
+f496:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f496
+.L.return.f496:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f497
+f497:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f497
+.L.return.f497:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f498
+f498:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f498
+.L.return.f498:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f499
+f499:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f499
+.L.return.f499:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f500
+f500:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f500
+.L.return.f500:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f501
+f501:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f501
+.L.return.f501:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f502
+f502:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f502
+.L.return.f502:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f503
+f503:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f503
+.L.return.f503:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f504
+f504:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f504
+.L.return.f504:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f505
+f505:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f505
+.L.return.f505:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f506
+f506:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f506
+.L.return.f506:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f507
+f507:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f507
+.L.return.f507:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f508
+f508:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f508
+.L.return.f508:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f509
+f509:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f509
+.L.return.f509:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f510
+f510:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f510
+.L.return.f510:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f511
+f511:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f511
+.L.return.f511:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f512
+f512:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f512
+.L.return.f512:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f513
+f513:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f513
+.L.return.f513:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f514
+f514:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f514
+.L.return.f514:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f515
+f515:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f515
+.L.return.f515:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f516
+f516:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f516
+.L.return.f516:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f517
+f517:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f517
+.L.return.f517:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f518
+f518:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f518
+.L.return.f518:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f519
+f519:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f519
+.L.return.f519:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f520
+f520:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f520
+.L.return.f520:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f521
+f521:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f521
+.L.return.f521:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f522
+f522:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f522
+.L.return.f522:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f523
+f523:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f523
+.L.return.f523:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f524
+f524:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f524
+.L.return.f524:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f525
+f525:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f525
+.L.return.f525:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f526
+f526:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f526
+.L.return.f526:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f527
+f527:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f527
+.L.return.f527:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f528
+f528:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f528
+.L.return.f528:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f529
+f529:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f529
+.L.return.f529:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f530
+f530:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f530
+.L.return.f530:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f531
+f531:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f531
+.L.return.f531:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f532
+f532:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f532
+.L.return.f532:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f533
+f533:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f533
+.L.return.f533:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f534
+f534:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f534
+.L.return.f534:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f535
+f535:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f535
+.L.return.f535:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f536
+f536:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f536
+.L.return.f536:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f537
+f537:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f537
+.L.return.f537:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f538
+f538:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f538
+.L.return.f538:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f539
+f539:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f539
+.L.return.f539:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f540
+f540:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f540
+.L.return.f540:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f541
+f541:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f541
+.L.return.f541:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f542
+f542:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f542
+.L.return.f542:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f543
+f543:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f543
+.L.return.f543:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f544
+f544:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f544
+.L.return.f544:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f545
+f545:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f545
+.L.return.f545:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f546
+f546:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f546
+.L.return.f546:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f547
+f547:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f547
+.L.return.f547:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f548
+f548:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f548
+.L.return.f548:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f549
+f549:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f549
+.L.return.f549:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f550
+f550:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f550
+.L.return.f550:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f551
+f551:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f551
+.L.return.f551:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f552
+f552:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f552
+.L.return.f552:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f553
+f553:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f553
+.L.return.f553:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f554
+f554:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f554
+.L.return.f554:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f555
+f555:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f555
+.L.return.f555:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f556
+f556:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f556
+.L.return.f556:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f557
+f557:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f557
+.L.return.f557:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f558
+f558:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f558
+.L.return.f558:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f559
+f559:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f559
+.L.return.f559:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f560
+f560:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f560
+.L.return.f560:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f561
+f561:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f561
+.L.return.f561:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f562
+f562:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f562
+.L.return.f562:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f563
+f563:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f563
+.L.return.f563:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f564
+f564:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f564
+.L.return.f564:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f565
+f565:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f565
+.L.return.f565:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f566
+f566:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f566
+.L.return.f566:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f567
+f567:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f567
+.L.return.f567:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f568
+f568:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f568
+.L.return.f568:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f569
+f569:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f569
+.L.return.f569:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f570
+f570:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f570
+.L.return.f570:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f571
+f571:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f571
+.L.return.f571:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f572
+f572:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f572
+.L.return.f572:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f573
+f573:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f573
+.L.return.f573:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f574
+f574:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f574
+.L.return.f574:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f575
+f575:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f575
+.L.return.f575:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f576
+f576:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f576
+.L.return.f576:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f577
+f577:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f577
+.L.return.f577:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f578
+f578:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f578
+.L.return.f578:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f579
+f579:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f579
+.L.return.f579:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f580
+f580:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f580
+.L.return.f580:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f581
+f581:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f581
+.L.return.f581:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f582
+f582:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f582
+.L.return.f582:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f583
+f583:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f583
+.L.return.f583:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f584
+f584:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f584
+.L.return.f584:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f585
+f585:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f585
+.L.return.f585:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f586
+f586:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f586
+.L.return.f586:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f587
+f587:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f587
+.L.return.f587:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f588
+f588:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f588
+.L.return.f588:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f589
+f589:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f589
+.L.return.f589:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f590
+f590:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f590
+.L.return.f590:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f591
+f591:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f591
+.L.return.f591:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f592
+f592:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f592
+.L.return.f592:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f593
+f593:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f593
+.L.return.f593:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f594
+f594:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f594
+.L.return.f594:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f595
+f595:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f595
+.L.return.f595:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f596
+f596:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f596
+.L.return.f596:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f597
+f597:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f597
+.L.return.f597:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f598
+f598:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f598
+.L.return.f598:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f599
+f599:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f599
+.L.return.f599:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f600
+f600:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f600
+.L.return.f600:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f601
+f601:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f601
+.L.return.f601:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f602
+f602:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f602
+.L.return.f602:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f603
+f603:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f603
+.L.return.f603:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f604
+f604:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f604
+.L.return.f604:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f605
+f605:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f605
+.L.return.f605:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f606
+f606:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f606
+.L.return.f606:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f607
+f607:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f607
+.L.return.f607:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f608
+f608:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f608
+.L.return.f608:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f609
+f609:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f609
+.L.return.f609:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f610
+f610:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f610
+.L.return.f610:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f611
+f611:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f611
+.L.return.f611:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f612
+f612:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f612
+.L.return.f612:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f613
+f613:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f613
+.L.return.f613:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f614
+f614:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f614
+.L.return.f614:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f615
+f615:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f615
+.L.return.f615:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f616
+f616:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f616
+.L.return.f616:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f617
+f617:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f617
+.L.return.f617:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f618
+f618:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f618
+.L.return.f618:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f619
+f619:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f619
+.L.return.f619:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f620
+f620:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f620
+.L.return.f620:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f621
+f621:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f621
+.L.return.f621:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f622
+f622:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f622
+.L.return.f622:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f623
+f623:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f623
+.L.return.f623:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f624
+f624:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f624
+.L.return.f624:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f625
+f625:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f625
+.L.return.f625:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f626
+f626:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f626
+.L.return.f626:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f627
+f627:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f627
+.L.return.f627:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f628
+f628:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f628
+.L.return.f628:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f629
+f629:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f629
+.L.return.f629:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f630
+f630:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f630
+.L.return.f630:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f631
+f631:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f631
+.L.return.f631:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f632
+f632:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f632
+.L.return.f632:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f633
+f633:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f633
+.L.return.f633:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f634
+f634:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f634
+.L.return.f634:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f635
+f635:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f635
+.L.return.f635:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f636
+f636:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f636
+.L.return.f636:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f637
+f637:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f637
+.L.return.f637:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f638
+f638:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f638
+.L.return.f638:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f639
+f639:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f639
+.L.return.f639:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f640
+f640:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f640
+.L.return.f640:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f641
+f641:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f641
+.L.return.f641:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f642
+f642:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f642
+.L.return.f642:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f643
+f643:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f643
+.L.return.f643:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f644
+f644:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f644
+.L.return.f644:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f645
+f645:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f645
+.L.return.f645:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f646
+f646:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f646
+.L.return.f646:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f647
+f647:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f647
+.L.return.f647:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f648
+f648:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f648
+.L.return.f648:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f649
+f649:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f649
+.L.return.f649:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f650
+f650:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f650
+.L.return.f650:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f651
+f651:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f651
+.L.return.f651:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f652
+f652:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f652
+.L.return.f652:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f653
+f653:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f653
+.L.return.f653:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f654
+f654:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f654
+.L.return.f654:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f655
+f655:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f655
+.L.return.f655:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f656
+f656:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f656
+.L.return.f656:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f657
+f657:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f657
+.L.return.f657:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f658
+f658:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f658
+.L.return.f658:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f659
+f659:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f659
+.L.return.f659:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f660
+f660:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f660
+.L.return.f660:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f661
+f661:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f661
+.L.return.f661:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f662
+f662:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f662
+.L.return.f662:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f663
+f663:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f663
+.L.return.f663:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f664
+f664:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f664
+.L.return.f664:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f665
+f665:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f665
+.L.return.f665:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f666
+f666:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f666
+.L.return.f666:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f667
+f667:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f667
+.L.return.f667:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f668
+f668:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f668
+.L.return.f668:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f669
+f669:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f669
+.L.return.f669:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f670
+f670:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f670
+.L.return.f670:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f671
+f671:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f671
+.L.return.f671:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f672
+f672:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f672
+.L.return.f672:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f673
+f673:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f673
+.L.return.f673:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f674
+f674:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f674
+.L.return.f674:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f675
+f675:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f675
+.L.return.f675:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f676
+f676:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f676
+.L.return.f676:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f677
+f677:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f677
+.L.return.f677:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f678
+f678:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f678
+.L.return.f678:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f679
+f679:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f679
+.L.return.f679:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f680
+f680:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f680
+.L.return.f680:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f681
+f681:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f681
+.L.return.f681:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f682
+f682:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f682
+.L.return.f682:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f683
+f683:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f683
+.L.return.f683:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f684
+f684:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f684
+.L.return.f684:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f685
+f685:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f685
+.L.return.f685:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f686
+f686:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f686
+.L.return.f686:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f687
+f687:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f687
+.L.return.f687:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f688
+f688:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f688
+.L.return.f688:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f689
+f689:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f689
+.L.return.f689:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f690
+f690:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f690
+.L.return.f690:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f691
+f691:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f691
+.L.return.f691:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f692
+f692:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f692
+.L.return.f692:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f693
+f693:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f693
+.L.return.f693:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f694
+f694:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f694
+.L.return.f694:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f695
+f695:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f695
+.L.return.f695:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f696
+f696:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f696
+.L.return.f696:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f697
+f697:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f697
+.L.return.f697:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f698
+f698:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f698
+.L.return.f698:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f699
+f699:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f699
+.L.return.f699:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f700
+f700:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f700
+.L.return.f700:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f701
+f701:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f701
+.L.return.f701:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f702
+f702:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f702
+.L.return.f702:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f703
+f703:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f703
+.L.return.f703:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f704
+f704:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f704
+.L.return.f704:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f705
+f705:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f705
+.L.return.f705:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f706
+f706:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f706
+.L.return.f706:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f707
+f707:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f707
+.L.return.f707:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f708
+f708:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f708
+.L.return.f708:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f709
+f709:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f709
+.L.return.f709:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f710
+f710:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f710
+.L.return.f710:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f711
+f711:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f711
+.L.return.f711:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f712
+f712:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f712
+.L.return.f712:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f713
+f713:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f713
+.L.return.f713:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f714
+f714:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f714
+.L.return.f714:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f715
+f715:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f715
+.L.return.f715:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f716
+f716:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f716
+.L.return.f716:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f717
+f717:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f717
+.L.return.f717:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f718
+f718:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f718
+.L.return.f718:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f719
+f719:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f719
+.L.return.f719:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f720
+f720:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f720
+.L.return.f720:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f721
+f721:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f721
+.L.return.f721:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f722
+f722:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f722
+.L.return.f722:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f723
+f723:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f723
+.L.return.f723:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f724
+f724:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f724
+.L.return.f724:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f725
+f725:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f725
+.L.return.f725:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f726
+f726:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f726
+.L.return.f726:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f727
+f727:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f727
+.L.return.f727:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f728
+f728:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f728
+.L.return.f728:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f729
+f729:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f729
+.L.return.f729:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f730
+f730:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f730
+.L.return.f730:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f731
+f731:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f731
+.L.return.f731:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f732
+f732:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f732
+.L.return.f732:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f733
+f733:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f733
+.L.return.f733:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f734
+f734:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f734
+.L.return.f734:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f735
+f735:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f735
+.L.return.f735:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f736
+f736:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f736
+.L.return.f736:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f737
+f737:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f737
+.L.return.f737:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f738
+f738:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f738
+.L.return.f738:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f739
+f739:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f739
+.L.return.f739:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f740
+f740:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f740
+.L.return.f740:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f741
+f741:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f741
+.L.return.f741:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f742
+f742:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f742
+.L.return.f742:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f743
+f743:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f743
+.L.return.f743:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f744
+f744:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f744
+.L.return.f744:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f745
+f745:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f745
+.L.return.f745:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f746
+f746:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f746
+.L.return.f746:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f747
+f747:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f747
+.L.return.f747:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f748
+f748:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f748
+.L.return.f748:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f749
+f749:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f749
+.L.return.f749:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f750
+f750:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f750
+.L.return.f750:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f751
+f751:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f751
+.L.return.f751:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f752
+f752:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f752
+.L.return.f752:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f753
+f753:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f753
+.L.return.f753:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f754
+f754:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f754
+.L.return.f754:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f755
+f755:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f755
+.L.return.f755:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f756
+f756:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f756
+.L.return.f756:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f757
+f757:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f757
+.L.return.f757:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f758
+f758:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f758
+.L.return.f758:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f759
+f759:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f759
+.L.return.f759:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f760
+f760:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f760
+.L.return.f760:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f761
+f761:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f761
+.L.return.f761:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f762
+f762:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f762
+.L.return.f762:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f763
+f763:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f763
+.L.return.f763:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f764
+f764:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f764
+.L.return.f764:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f765
+f765:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f765
+.L.return.f765:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f766
+f766:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f766
+.L.return.f766:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f767
+f767:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f767
+.L.return.f767:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f768
+f768:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f768
+.L.return.f768:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f769
+f769:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f769
+.L.return.f769:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f770
+f770:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f770
+.L.return.f770:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f771
+f771:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f771
+.L.return.f771:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f772
+f772:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f772
+.L.return.f772:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f773
+f773:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f773
+.L.return.f773:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f774
+f774:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f774
+.L.return.f774:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f775
+f775:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f775
+.L.return.f775:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f776
+f776:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f776
+.L.return.f776:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f777
+f777:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f777
+.L.return.f777:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f778
+f778:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f778
+.L.return.f778:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f779
+f779:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f779
+.L.return.f779:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f780
+f780:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f780
+.L.return.f780:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f781
+f781:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f781
+.L.return.f781:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f782
+f782:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f782
+.L.return.f782:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f783
+f783:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f783
+.L.return.f783:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f784
+f784:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f784
+.L.return.f784:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f785
+f785:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f785
+.L.return.f785:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f786
+f786:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f786
+.L.return.f786:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f787
+f787:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f787
+.L.return.f787:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f788
+f788:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f788
+.L.return.f788:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f789
+f789:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f789
+.L.return.f789:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f790
+f790:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f790
+.L.return.f790:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f791
+f791:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f791
+.L.return.f791:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f792
+f792:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f792
+.L.return.f792:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f793
+f793:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f793
+.L.return.f793:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f794
+f794:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f794
+.L.return.f794:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f795
+f795:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f795
+.L.return.f795:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f796
+f796:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f796
+.L.return.f796:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f797
+f797:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f797
+.L.return.f797:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f798
+f798:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f798
+.L.return.f798:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f799
+f799:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f799
+.L.return.f799:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f800
+f800:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f800
+.L.return.f800:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f801
+f801:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f801
+.L.return.f801:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f802
+f802:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f802
+.L.return.f802:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f803
+f803:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f803
+.L.return.f803:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f804
+f804:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f804
+.L.return.f804:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f805
+f805:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f805
+.L.return.f805:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f806
+f806:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f806
+.L.return.f806:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f807
+f807:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f807
+.L.return.f807:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f808
+f808:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f808
+.L.return.f808:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f809
+f809:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f809
+.L.return.f809:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f810
+f810:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f810
+.L.return.f810:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f811
+f811:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f811
+.L.return.f811:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f812
+f812:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f812
+.L.return.f812:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f813
+f813:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f813
+.L.return.f813:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f814
+f814:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f814
+.L.return.f814:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f815
+f815:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f815
+.L.return.f815:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f816
+f816:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f816
+.L.return.f816:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f817
+f817:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f817
+.L.return.f817:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f818
+f818:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f818
+.L.return.f818:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f819
+f819:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f819
+.L.return.f819:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f820
+f820:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f820
+.L.return.f820:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f821
+f821:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f821
+.L.return.f821:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f822
+f822:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f822
+.L.return.f822:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f823
+f823:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f823
+.L.return.f823:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f824
+f824:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f824
+.L.return.f824:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f825
+f825:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f825
+.L.return.f825:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f826
+f826:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f826
+.L.return.f826:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f827
+f827:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f827
+.L.return.f827:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f828
+f828:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f828
+.L.return.f828:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f829
+f829:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f829
+.L.return.f829:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f830
+f830:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f830
+.L.return.f830:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f831
+f831:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f831
+.L.return.f831:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f832
+f832:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f832
+.L.return.f832:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f833
+f833:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f833
+.L.return.f833:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f834
+f834:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f834
+.L.return.f834:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f835
+f835:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f835
+.L.return.f835:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f836
+f836:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f836
+.L.return.f836:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f837
+f837:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f837
+.L.return.f837:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f838
+f838:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f838
+.L.return.f838:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f839
+f839:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f839
+.L.return.f839:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f840
+f840:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f840
+.L.return.f840:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f841
+f841:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f841
+.L.return.f841:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f842
+f842:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f842
+.L.return.f842:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f843
+f843:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f843
+.L.return.f843:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f844
+f844:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f844
+.L.return.f844:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f845
+f845:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f845
+.L.return.f845:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f846
+f846:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f846
+.L.return.f846:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f847
+f847:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f847
+.L.return.f847:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f848
+f848:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f848
+.L.return.f848:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f849
+f849:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f849
+.L.return.f849:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f850
+f850:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f850
+.L.return.f850:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f851
+f851:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f851
+.L.return.f851:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f852
+f852:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f852
+.L.return.f852:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f853
+f853:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f853
+.L.return.f853:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f854
+f854:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f854
+.L.return.f854:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f855
+f855:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f855
+.L.return.f855:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f856
+f856:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f856
+.L.return.f856:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f857
+f857:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f857
+.L.return.f857:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f858
+f858:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f858
+.L.return.f858:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f859
+f859:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f859
+.L.return.f859:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f860
+f860:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f860
+.L.return.f860:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f861
+f861:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f861
+.L.return.f861:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f862
+f862:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f862
+.L.return.f862:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f863
+f863:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f863
+.L.return.f863:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f864
+f864:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f864
+.L.return.f864:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f865
+f865:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f865
+.L.return.f865:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f866
+f866:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f866
+.L.return.f866:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f867
+f867:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f867
+.L.return.f867:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f868
+f868:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f868
+.L.return.f868:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f869
+f869:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f869
+.L.return.f869:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f870
+f870:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f870
+.L.return.f870:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f871
+f871:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f871
+.L.return.f871:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f872
+f872:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f872
+.L.return.f872:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f873
+f873:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f873
+.L.return.f873:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f874
+f874:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f874
+.L.return.f874:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f875
+f875:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f875
+.L.return.f875:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f876
+f876:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f876
+.L.return.f876:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f877
+f877:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f877
+.L.return.f877:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f878
+f878:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f878
+.L.return.f878:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f879
+f879:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f879
+.L.return.f879:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f880
+f880:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f880
+.L.return.f880:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f881
+f881:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f881
+.L.return.f881:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f882
+f882:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f882
+.L.return.f882:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f883
+f883:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f883
+.L.return.f883:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f884
+f884:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f884
+.L.return.f884:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f885
+f885:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f885
+.L.return.f885:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f886
+f886:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f886
+.L.return.f886:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f887
+f887:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f887
+.L.return.f887:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f888
+f888:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f888
+.L.return.f888:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f889
+f889:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f889
+.L.return.f889:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f890
+f890:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f890
+.L.return.f890:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f891
+f891:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f891
+.L.return.f891:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f892
+f892:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f892
+.L.return.f892:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f893
+f893:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f893
+.L.return.f893:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f894
+f894:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f894
+.L.return.f894:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f895
+f895:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f895
+.L.return.f895:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f896
+f896:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f896
+.L.return.f896:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f897
+f897:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f897
+.L.return.f897:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f898
+f898:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f898
+.L.return.f898:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f899
+f899:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f899
+.L.return.f899:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f900
+f900:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f900
+.L.return.f900:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f901
+f901:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f901
+.L.return.f901:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f902
+f902:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f902
+.L.return.f902:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f903
+f903:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f903
+.L.return.f903:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f904
+f904:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f904
+.L.return.f904:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f905
+f905:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f905
+.L.return.f905:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f906
+f906:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f906
+.L.return.f906:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f907
+f907:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f907
+.L.return.f907:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f908
+f908:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f908
+.L.return.f908:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f909
+f909:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f909
+.L.return.f909:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f910
+f910:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f910
+.L.return.f910:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f911
+f911:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f911
+.L.return.f911:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f912
+f912:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f912
+.L.return.f912:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f913
+f913:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f913
+.L.return.f913:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f914
+f914:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f914
+.L.return.f914:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f915
+f915:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f915
+.L.return.f915:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f916
+f916:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f916
+.L.return.f916:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f917
+f917:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f917
+.L.return.f917:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f918
+f918:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f918
+.L.return.f918:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f919
+f919:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f919
+.L.return.f919:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f920
+f920:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f920
+.L.return.f920:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f921
+f921:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f921
+.L.return.f921:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f922
+f922:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f922
+.L.return.f922:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f923
+f923:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f923
+.L.return.f923:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f924
+f924:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f924
+.L.return.f924:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f925
+f925:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f925
+.L.return.f925:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f926
+f926:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f926
+.L.return.f926:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f927
+f927:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f927
+.L.return.f927:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f928
+f928:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f928
+.L.return.f928:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f929
+f929:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f929
+.L.return.f929:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f930
+f930:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f930
+.L.return.f930:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f931
+f931:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f931
+.L.return.f931:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f932
+f932:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f932
+.L.return.f932:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f933
+f933:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f933
+.L.return.f933:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f934
+f934:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f934
+.L.return.f934:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f935
+f935:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f935
+.L.return.f935:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f936
+f936:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f936
+.L.return.f936:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f937
+f937:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f937
+.L.return.f937:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f938
+f938:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f938
+.L.return.f938:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f939
+f939:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f939
+.L.return.f939:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f940
+f940:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f940
+.L.return.f940:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f941
+f941:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f941
+.L.return.f941:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f942
+f942:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f942
+.L.return.f942:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f943
+f943:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f943
+.L.return.f943:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f944
+f944:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f944
+.L.return.f944:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f945
+f945:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f945
+.L.return.f945:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f946
+f946:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f946
+.L.return.f946:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f947
+f947:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f947
+.L.return.f947:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f948
+f948:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f948
+.L.return.f948:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f949
+f949:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f949
+.L.return.f949:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f950
+f950:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f950
+.L.return.f950:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f951
+f951:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f951
+.L.return.f951:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f952
+f952:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f952
+.L.return.f952:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f953
+f953:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f953
+.L.return.f953:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f954
+f954:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f954
+.L.return.f954:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f955
+f955:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f955
+.L.return.f955:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f956
+f956:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f956
+.L.return.f956:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f957
+f957:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f957
+.L.return.f957:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f958
+f958:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f958
+.L.return.f958:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f959
+f959:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f959
+.L.return.f959:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f960
+f960:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f960
+.L.return.f960:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f961
+f961:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f961
+.L.return.f961:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f962
+f962:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f962
+.L.return.f962:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f963
+f963:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f963
+.L.return.f963:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f964
+f964:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f964
+.L.return.f964:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f965
+f965:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f965
+.L.return.f965:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f966
+f966:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f966
+.L.return.f966:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f967
+f967:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f967
+.L.return.f967:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f968
+f968:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f968
+.L.return.f968:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f969
+f969:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f969
+.L.return.f969:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f970
+f970:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f970
+.L.return.f970:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f971
+f971:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f971
+.L.return.f971:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f972
+f972:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f972
+.L.return.f972:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f973
+f973:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f973
+.L.return.f973:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f974
+f974:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f974
+.L.return.f974:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f975
+f975:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f975
+.L.return.f975:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f976
+f976:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f976
+.L.return.f976:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f977
+f977:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f977
+.L.return.f977:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f978
+f978:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f978
+.L.return.f978:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f979
+f979:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f979
+.L.return.f979:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f980
+f980:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f980
+.L.return.f980:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f981
+f981:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f981
+.L.return.f981:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f982
+f982:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f982
+.L.return.f982:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f983
+f983:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f983
+.L.return.f983:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f984
+f984:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f984
+.L.return.f984:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f985
+f985:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f985
+.L.return.f985:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f986
+f986:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f986
+.L.return.f986:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f987
+f987:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f987
+.L.return.f987:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f988
+f988:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f988
+.L.return.f988:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f989
+f989:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f989
+.L.return.f989:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f990
+f990:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f990
+.L.return.f990:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f991
+f991:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f991
+.L.return.f991:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f992
+f992:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f992
+.L.return.f992:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f993
+f993:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f993
+.L.return.f993:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f994
+f994:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f994
+.L.return.f994:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f995
+f995:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f995
+.L.return.f995:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f996
+f996:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f996
+.L.return.f996:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f997
+f997:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f997
+.L.return.f997:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f998
+f998:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f998
+.L.return.f998:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f999
+f999:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f999
+.L.return.f999:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1000
+f1000:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1000
+.L.return.f1000:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1001
+f1001:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1001
+.L.return.f1001:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1002
+f1002:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1002
+.L.return.f1002:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1003
+f1003:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1003
+.L.return.f1003:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1004
+f1004:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1004
+.L.return.f1004:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1005
+f1005:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1005
+.L.return.f1005:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1006
+f1006:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1006
+.L.return.f1006:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1007
+f1007:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1007
+.L.return.f1007:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1008
+f1008:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1008
+.L.return.f1008:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1009
+f1009:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1009
+.L.return.f1009:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1010
+f1010:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1010
+.L.return.f1010:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1011
+f1011:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1011
+.L.return.f1011:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1012
+f1012:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1012
+.L.return.f1012:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1013
+f1013:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1013
+.L.return.f1013:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1014
+f1014:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1014
+.L.return.f1014:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1015
+f1015:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1015
+.L.return.f1015:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1016
+f1016:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1016
+.L.return.f1016:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1017
+f1017:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1017
+.L.return.f1017:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1018
+f1018:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1018
+.L.return.f1018:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1019
+f1019:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1019
+.L.return.f1019:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1020
+f1020:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1020
+.L.return.f1020:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1021
+f1021:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1021
+.L.return.f1021:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1022
+f1022:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1022
+.L.return.f1022:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1023
+f1023:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1023
+.L.return.f1023:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1024
+f1024:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1024
+.L.return.f1024:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1025
+f1025:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1025
+.L.return.f1025:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1026
+f1026:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1026
+.L.return.f1026:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1027
+f1027:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1027
+.L.return.f1027:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1028
+f1028:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1028
+.L.return.f1028:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1029
+f1029:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1029
+.L.return.f1029:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1030
+f1030:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1030
+.L.return.f1030:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1031
+f1031:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1031
+.L.return.f1031:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1032
+f1032:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1032
+.L.return.f1032:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1033
+f1033:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1033
+.L.return.f1033:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1034
+f1034:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1034
+.L.return.f1034:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1035
+f1035:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1035
+.L.return.f1035:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1036
+f1036:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1036
+.L.return.f1036:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1037
+f1037:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1037
+.L.return.f1037:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1038
+f1038:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1038
+.L.return.f1038:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1039
+f1039:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1039
+.L.return.f1039:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1040
+f1040:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1040
+.L.return.f1040:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1041
+f1041:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1041
+.L.return.f1041:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1042
+f1042:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1042
+.L.return.f1042:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1043
+f1043:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1043
+.L.return.f1043:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1044
+f1044:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1044
+.L.return.f1044:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1045
+f1045:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1045
+.L.return.f1045:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1046
+f1046:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1046
+.L.return.f1046:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1047
+f1047:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1047
+.L.return.f1047:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1048
+f1048:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1048
+.L.return.f1048:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1049
+f1049:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1049
+.L.return.f1049:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1050
+f1050:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1050
+.L.return.f1050:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1051
+f1051:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1051
+.L.return.f1051:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1052
+f1052:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1052
+.L.return.f1052:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1053
+f1053:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1053
+.L.return.f1053:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1054
+f1054:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1054
+.L.return.f1054:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1055
+f1055:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1055
+.L.return.f1055:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1056
+f1056:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1056
+.L.return.f1056:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1057
+f1057:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1057
+.L.return.f1057:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1058
+f1058:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1058
+.L.return.f1058:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1059
+f1059:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1059
+.L.return.f1059:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1060
+f1060:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1060
+.L.return.f1060:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1061
+f1061:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1061
+.L.return.f1061:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1062
+f1062:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1062
+.L.return.f1062:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1063
+f1063:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1063
+.L.return.f1063:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1064
+f1064:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1064
+.L.return.f1064:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1065
+f1065:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1065
+.L.return.f1065:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1066
+f1066:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1066
+.L.return.f1066:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1067
+f1067:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1067
+.L.return.f1067:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1068
+f1068:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1068
+.L.return.f1068:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1069
+f1069:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1069
+.L.return.f1069:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1070
+f1070:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1070
+.L.return.f1070:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1071
+f1071:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1071
+.L.return.f1071:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1072
+f1072:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1072
+.L.return.f1072:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1073
+f1073:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1073
+.L.return.f1073:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1074
+f1074:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1074
+.L.return.f1074:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1075
+f1075:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1075
+.L.return.f1075:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1076
+f1076:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1076
+.L.return.f1076:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1077
+f1077:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1077
+.L.return.f1077:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1078
+f1078:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1078
+.L.return.f1078:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1079
+f1079:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1079
+.L.return.f1079:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1080
+f1080:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1080
+.L.return.f1080:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1081
+f1081:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1081
+.L.return.f1081:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1082
+f1082:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1082
+.L.return.f1082:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1083
+f1083:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1083
+.L.return.f1083:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1084
+f1084:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1084
+.L.return.f1084:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1085
+f1085:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1085
+.L.return.f1085:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1086
+f1086:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1086
+.L.return.f1086:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1087
+f1087:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1087
+.L.return.f1087:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1088
+f1088:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1088
+.L.return.f1088:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1089
+f1089:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1089
+.L.return.f1089:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1090
+f1090:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1090
+.L.return.f1090:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1091
+f1091:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1091
+.L.return.f1091:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1092
+f1092:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1092
+.L.return.f1092:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1093
+f1093:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1093
+.L.return.f1093:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1094
+f1094:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1094
+.L.return.f1094:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1095
+f1095:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1095
+.L.return.f1095:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1096
+f1096:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1096
+.L.return.f1096:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1097
+f1097:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1097
+.L.return.f1097:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1098
+f1098:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1098
+.L.return.f1098:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1099
+f1099:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1099
+.L.return.f1099:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1100
+f1100:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1100
+.L.return.f1100:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1101
+f1101:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1101
+.L.return.f1101:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1102
+f1102:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1102
+.L.return.f1102:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1103
+f1103:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1103
+.L.return.f1103:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1104
+f1104:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1104
+.L.return.f1104:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1105
+f1105:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1105
+.L.return.f1105:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1106
+f1106:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1106
+.L.return.f1106:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1107
+f1107:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1107
+.L.return.f1107:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1108
+f1108:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1108
+.L.return.f1108:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1109
+f1109:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1109
+.L.return.f1109:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1110
+f1110:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1110
+.L.return.f1110:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1111
+f1111:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1111
+.L.return.f1111:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1112
+f1112:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1112
+.L.return.f1112:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1113
+f1113:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1113
+.L.return.f1113:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1114
+f1114:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1114
+.L.return.f1114:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1115
+f1115:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1115
+.L.return.f1115:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1116
+f1116:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1116
+.L.return.f1116:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1117
+f1117:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1117
+.L.return.f1117:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1118
+f1118:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1118
+.L.return.f1118:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1119
+f1119:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1119
+.L.return.f1119:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1120
+f1120:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1120
+.L.return.f1120:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1121
+f1121:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1121
+.L.return.f1121:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1122
+f1122:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1122
+.L.return.f1122:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1123
+f1123:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1123
+.L.return.f1123:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1124
+f1124:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1124
+.L.return.f1124:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1125
+f1125:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1125
+.L.return.f1125:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1126
+f1126:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1126
+.L.return.f1126:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1127
+f1127:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1127
+.L.return.f1127:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1128
+f1128:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1128
+.L.return.f1128:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1129
+f1129:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1129
+.L.return.f1129:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1130
+f1130:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1130
+.L.return.f1130:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1131
+f1131:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1131
+.L.return.f1131:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1132
+f1132:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1132
+.L.return.f1132:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1133
+f1133:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1133
+.L.return.f1133:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1134
+f1134:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1134
+.L.return.f1134:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1135
+f1135:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1135
+.L.return.f1135:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1136
+f1136:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1136
+.L.return.f1136:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1137
+f1137:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1137
+.L.return.f1137:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1138
+f1138:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1138
+.L.return.f1138:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1139
+f1139:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1139
+.L.return.f1139:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1140
+f1140:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1140
+.L.return.f1140:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1141
+f1141:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1141
+.L.return.f1141:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1142
+f1142:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1142
+.L.return.f1142:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1143
+f1143:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1143
+.L.return.f1143:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1144
+f1144:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1144
+.L.return.f1144:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1145
+f1145:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1145
+.L.return.f1145:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1146
+f1146:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1146
+.L.return.f1146:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1147
+f1147:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1147
+.L.return.f1147:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1148
+f1148:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1148
+.L.return.f1148:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1149
+f1149:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1149
+.L.return.f1149:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1150
+f1150:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1150
+.L.return.f1150:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1151
+f1151:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1151
+.L.return.f1151:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1152
+f1152:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1152
+.L.return.f1152:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1153
+f1153:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1153
+.L.return.f1153:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1154
+f1154:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1154
+.L.return.f1154:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1155
+f1155:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1155
+.L.return.f1155:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1156
+f1156:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1156
+.L.return.f1156:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1157
+f1157:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1157
+.L.return.f1157:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1158
+f1158:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1158
+.L.return.f1158:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1159
+f1159:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1159
+.L.return.f1159:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1160
+f1160:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1160
+.L.return.f1160:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1161
+f1161:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1161
+.L.return.f1161:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1162
+f1162:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1162
+.L.return.f1162:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1163
+f1163:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1163
+.L.return.f1163:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1164
+f1164:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1164
+.L.return.f1164:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1165
+f1165:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1165
+.L.return.f1165:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1166
+f1166:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1166
+.L.return.f1166:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1167
+f1167:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1167
+.L.return.f1167:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1168
+f1168:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1168
+.L.return.f1168:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1169
+f1169:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1169
+.L.return.f1169:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1170
+f1170:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1170
+.L.return.f1170:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1171
+f1171:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1171
+.L.return.f1171:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1172
+f1172:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1172
+.L.return.f1172:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1173
+f1173:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1173
+.L.return.f1173:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1174
+f1174:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1174
+.L.return.f1174:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1175
+f1175:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1175
+.L.return.f1175:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1176
+f1176:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1176
+.L.return.f1176:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1177
+f1177:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1177
+.L.return.f1177:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1178
+f1178:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1178
+.L.return.f1178:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1179
+f1179:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1179
+.L.return.f1179:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1180
+f1180:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1180
+.L.return.f1180:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1181
+f1181:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1181
+.L.return.f1181:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1182
+f1182:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1182
+.L.return.f1182:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1183
+f1183:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1183
+.L.return.f1183:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1184
+f1184:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1184
+.L.return.f1184:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1185
+f1185:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1185
+.L.return.f1185:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1186
+f1186:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1186
+.L.return.f1186:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1187
+f1187:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1187
+.L.return.f1187:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1188
+f1188:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1188
+.L.return.f1188:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1189
+f1189:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1189
+.L.return.f1189:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1190
+f1190:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1190
+.L.return.f1190:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1191
+f1191:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1191
+.L.return.f1191:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1192
+f1192:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1192
+.L.return.f1192:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1193
+f1193:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1193
+.L.return.f1193:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1194
+f1194:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1194
+.L.return.f1194:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1195
+f1195:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1195
+.L.return.f1195:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1196
+f1196:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1196
+.L.return.f1196:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1197
+f1197:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1197
+.L.return.f1197:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1198
+f1198:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1198
+.L.return.f1198:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1199
+f1199:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1199
+.L.return.f1199:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1200
+f1200:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1200
+.L.return.f1200:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1201
+f1201:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1201
+.L.return.f1201:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1202
+f1202:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1202
+.L.return.f1202:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1203
+f1203:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1203
+.L.return.f1203:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1204
+f1204:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1204
+.L.return.f1204:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1205
+f1205:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1205
+.L.return.f1205:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1206
+f1206:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1206
+.L.return.f1206:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1207
+f1207:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1207
+.L.return.f1207:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1208
+f1208:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1208
+.L.return.f1208:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1209
+f1209:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1209
+.L.return.f1209:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1210
+f1210:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1210
+.L.return.f1210:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1211
+f1211:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1211
+.L.return.f1211:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1212
+f1212:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1212
+.L.return.f1212:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1213
+f1213:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1213
+.L.return.f1213:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1214
+f1214:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1214
+.L.return.f1214:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1215
+f1215:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1215
+.L.return.f1215:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1216
+f1216:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1216
+.L.return.f1216:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1217
+f1217:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1217
+.L.return.f1217:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1218
+f1218:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1218
+.L.return.f1218:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1219
+f1219:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1219
+.L.return.f1219:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1220
+f1220:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1220
+.L.return.f1220:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1221
+f1221:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1221
+.L.return.f1221:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1222
+f1222:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1222
+.L.return.f1222:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1223
+f1223:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1223
+.L.return.f1223:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1224
+f1224:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1224
+.L.return.f1224:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1225
+f1225:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1225
+.L.return.f1225:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1226
+f1226:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1226
+.L.return.f1226:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1227
+f1227:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1227
+.L.return.f1227:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1228
+f1228:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1228
+.L.return.f1228:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1229
+f1229:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1229
+.L.return.f1229:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1230
+f1230:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1230
+.L.return.f1230:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1231
+f1231:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1231
+.L.return.f1231:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1232
+f1232:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1232
+.L.return.f1232:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1233
+f1233:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1233
+.L.return.f1233:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1234
+f1234:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1234
+.L.return.f1234:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1235
+f1235:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1235
+.L.return.f1235:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1236
+f1236:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1236
+.L.return.f1236:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1237
+f1237:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1237
+.L.return.f1237:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1238
+f1238:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1238
+.L.return.f1238:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1239
+f1239:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1239
+.L.return.f1239:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1240
+f1240:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1240
+.L.return.f1240:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1241
+f1241:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1241
+.L.return.f1241:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1242
+f1242:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1242
+.L.return.f1242:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1243
+f1243:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1243
+.L.return.f1243:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1244
+f1244:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1244
+.L.return.f1244:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1245
+f1245:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1245
+.L.return.f1245:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1246
+f1246:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1246
+.L.return.f1246:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1247
+f1247:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1247
+.L.return.f1247:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1248
+f1248:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1248
+.L.return.f1248:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1249
+f1249:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1249
+.L.return.f1249:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1250
+f1250:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1250
+.L.return.f1250:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1251
+f1251:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1251
+.L.return.f1251:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1252
+f1252:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1252
+.L.return.f1252:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1253
+f1253:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1253
+.L.return.f1253:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1254
+f1254:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1254
+.L.return.f1254:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1255
+f1255:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1255
+.L.return.f1255:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1256
+f1256:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1256
+.L.return.f1256:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1257
+f1257:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1257
+.L.return.f1257:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1258
+f1258:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1258
+.L.return.f1258:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1259
+f1259:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1259
+.L.return.f1259:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1260
+f1260:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1260
+.L.return.f1260:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1261
+f1261:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1261
+.L.return.f1261:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1262
+f1262:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1262
+.L.return.f1262:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1263
+f1263:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1263
+.L.return.f1263:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1264
+f1264:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1264
+.L.return.f1264:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1265
+f1265:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1265
+.L.return.f1265:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1266
+f1266:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1266
+.L.return.f1266:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1267
+f1267:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1267
+.L.return.f1267:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1268
+f1268:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1268
+.L.return.f1268:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1269
+f1269:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1269
+.L.return.f1269:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1270
+f1270:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1270
+.L.return.f1270:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1271
+f1271:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1271
+.L.return.f1271:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1272
+f1272:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1272
+.L.return.f1272:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1273
+f1273:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1273
+.L.return.f1273:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1274
+f1274:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1274
+.L.return.f1274:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1275
+f1275:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1275
+.L.return.f1275:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1276
+f1276:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1276
+.L.return.f1276:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1277
+f1277:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1277
+.L.return.f1277:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1278
+f1278:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1278
+.L.return.f1278:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1279
+f1279:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1279
+.L.return.f1279:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1280
+f1280:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1280
+.L.return.f1280:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1281
+f1281:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1281
+.L.return.f1281:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1282
+f1282:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1282
+.L.return.f1282:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1283
+f1283:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1283
+.L.return.f1283:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1284
+f1284:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1284
+.L.return.f1284:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1285
+f1285:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1285
+.L.return.f1285:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1286
+f1286:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1286
+.L.return.f1286:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1287
+f1287:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1287
+.L.return.f1287:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1288
+f1288:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1288
+.L.return.f1288:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1289
+f1289:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1289
+.L.return.f1289:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1290
+f1290:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1290
+.L.return.f1290:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1291
+f1291:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1291
+.L.return.f1291:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1292
+f1292:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1292
+.L.return.f1292:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1293
+f1293:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1293
+.L.return.f1293:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1294
+f1294:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1294
+.L.return.f1294:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1295
+f1295:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1295
+.L.return.f1295:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1296
+f1296:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1296
+.L.return.f1296:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1297
+f1297:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1297
+.L.return.f1297:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1298
+f1298:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1298
+.L.return.f1298:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1299
+f1299:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1299
+.L.return.f1299:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1300
+f1300:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1300
+.L.return.f1300:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1301
+f1301:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1301
+.L.return.f1301:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1302
+f1302:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1302
+.L.return.f1302:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1303
+f1303:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1303
+.L.return.f1303:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1304
+f1304:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1304
+.L.return.f1304:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1305
+f1305:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1305
+.L.return.f1305:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1306
+f1306:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1306
+.L.return.f1306:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1307
+f1307:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1307
+.L.return.f1307:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1308
+f1308:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1308
+.L.return.f1308:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1309
+f1309:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1309
+.L.return.f1309:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1310
+f1310:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1310
+.L.return.f1310:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1311
+f1311:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1311
+.L.return.f1311:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1312
+f1312:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1312
+.L.return.f1312:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1313
+f1313:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1313
+.L.return.f1313:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1314
+f1314:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1314
+.L.return.f1314:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1315
+f1315:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1315
+.L.return.f1315:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1316
+f1316:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1316
+.L.return.f1316:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1317
+f1317:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1317
+.L.return.f1317:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1318
+f1318:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1318
+.L.return.f1318:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1319
+f1319:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1319
+.L.return.f1319:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1320
+f1320:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1320
+.L.return.f1320:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1321
+f1321:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1321
+.L.return.f1321:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1322
+f1322:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1322
+.L.return.f1322:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1323
+f1323:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1323
+.L.return.f1323:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1324
+f1324:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1324
+.L.return.f1324:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1325
+f1325:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1325
+.L.return.f1325:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1326
+f1326:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1326
+.L.return.f1326:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1327
+f1327:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1327
+.L.return.f1327:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1328
+f1328:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1328
+.L.return.f1328:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1329
+f1329:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1329
+.L.return.f1329:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1330
+f1330:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1330
+.L.return.f1330:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1331
+f1331:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1331
+.L.return.f1331:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1332
+f1332:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1332
+.L.return.f1332:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1333
+f1333:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1333
+.L.return.f1333:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1334
+f1334:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1334
+.L.return.f1334:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1335
+f1335:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1335
+.L.return.f1335:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1336
+f1336:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1336
+.L.return.f1336:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1337
+f1337:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1337
+.L.return.f1337:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1338
+f1338:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1338
+.L.return.f1338:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1339
+f1339:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1339
+.L.return.f1339:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1340
+f1340:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1340
+.L.return.f1340:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1341
+f1341:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1341
+.L.return.f1341:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1342
+f1342:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1342
+.L.return.f1342:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1343
+f1343:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1343
+.L.return.f1343:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1344
+f1344:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1344
+.L.return.f1344:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1345
+f1345:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1345
+.L.return.f1345:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1346
+f1346:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1346
+.L.return.f1346:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1347
+f1347:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1347
+.L.return.f1347:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1348
+f1348:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1348
+.L.return.f1348:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1349
+f1349:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1349
+.L.return.f1349:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1350
+f1350:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1350
+.L.return.f1350:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1351
+f1351:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1351
+.L.return.f1351:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1352
+f1352:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1352
+.L.return.f1352:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1353
+f1353:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1353
+.L.return.f1353:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1354
+f1354:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1354
+.L.return.f1354:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1355
+f1355:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1355
+.L.return.f1355:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1356
+f1356:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1356
+.L.return.f1356:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1357
+f1357:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1357
+.L.return.f1357:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1358
+f1358:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1358
+.L.return.f1358:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1359
+f1359:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1359
+.L.return.f1359:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1360
+f1360:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1360
+.L.return.f1360:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1361
+f1361:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1361
+.L.return.f1361:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1362
+f1362:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1362
+.L.return.f1362:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1363
+f1363:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1363
+.L.return.f1363:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1364
+f1364:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1364
+.L.return.f1364:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1365
+f1365:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1365
+.L.return.f1365:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1366
+f1366:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1366
+.L.return.f1366:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1367
+f1367:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1367
+.L.return.f1367:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1368
+f1368:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1368
+.L.return.f1368:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1369
+f1369:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1369
+.L.return.f1369:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1370
+f1370:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1370
+.L.return.f1370:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1371
+f1371:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1371
+.L.return.f1371:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1372
+f1372:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1372
+.L.return.f1372:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1373
+f1373:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1373
+.L.return.f1373:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1374
+f1374:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1374
+.L.return.f1374:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1375
+f1375:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1375
+.L.return.f1375:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1376
+f1376:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1376
+.L.return.f1376:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1377
+f1377:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1377
+.L.return.f1377:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1378
+f1378:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1378
+.L.return.f1378:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1379
+f1379:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1379
+.L.return.f1379:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1380
+f1380:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1380
+.L.return.f1380:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1381
+f1381:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1381
+.L.return.f1381:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1382
+f1382:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1382
+.L.return.f1382:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1383
+f1383:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1383
+.L.return.f1383:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1384
+f1384:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1384
+.L.return.f1384:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1385
+f1385:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1385
+.L.return.f1385:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1386
+f1386:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1386
+.L.return.f1386:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1387
+f1387:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1387
+.L.return.f1387:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1388
+f1388:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1388
+.L.return.f1388:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1389
+f1389:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1389
+.L.return.f1389:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1390
+f1390:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1390
+.L.return.f1390:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1391
+f1391:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1391
+.L.return.f1391:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1392
+f1392:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1392
+.L.return.f1392:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1393
+f1393:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1393
+.L.return.f1393:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1394
+f1394:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1394
+.L.return.f1394:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1395
+f1395:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1395
+.L.return.f1395:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1396
+f1396:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1396
+.L.return.f1396:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1397
+f1397:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1397
+.L.return.f1397:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1398
+f1398:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1398
+.L.return.f1398:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1399
+f1399:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1399
+.L.return.f1399:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1400
+f1400:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1400
+.L.return.f1400:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1401
+f1401:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1401
+.L.return.f1401:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1402
+f1402:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1402
+.L.return.f1402:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1403
+f1403:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1403
+.L.return.f1403:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1404
+f1404:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1404
+.L.return.f1404:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1405
+f1405:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1405
+.L.return.f1405:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1406
+f1406:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1406
+.L.return.f1406:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1407
+f1407:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1407
+.L.return.f1407:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1408
+f1408:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1408
+.L.return.f1408:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1409
+f1409:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1409
+.L.return.f1409:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1410
+f1410:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1410
+.L.return.f1410:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1411
+f1411:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1411
+.L.return.f1411:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1412
+f1412:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1412
+.L.return.f1412:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1413
+f1413:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1413
+.L.return.f1413:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1414
+f1414:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1414
+.L.return.f1414:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1415
+f1415:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1415
+.L.return.f1415:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1416
+f1416:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1416
+.L.return.f1416:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1417
+f1417:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1417
+.L.return.f1417:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1418
+f1418:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1418
+.L.return.f1418:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1419
+f1419:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1419
+.L.return.f1419:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1420
+f1420:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1420
+.L.return.f1420:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1421
+f1421:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1421
+.L.return.f1421:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1422
+f1422:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1422
+.L.return.f1422:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1423
+f1423:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1423
+.L.return.f1423:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1424
+f1424:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1424
+.L.return.f1424:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1425
+f1425:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1425
+.L.return.f1425:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1426
+f1426:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1426
+.L.return.f1426:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1427
+f1427:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1427
+.L.return.f1427:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1428
+f1428:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1428
+.L.return.f1428:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1429
+f1429:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1429
+.L.return.f1429:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1430
+f1430:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1430
+.L.return.f1430:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1431
+f1431:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1431
+.L.return.f1431:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1432
+f1432:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1432
+.L.return.f1432:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1433
+f1433:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1433
+.L.return.f1433:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1434
+f1434:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1434
+.L.return.f1434:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1435
+f1435:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1435
+.L.return.f1435:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1436
+f1436:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1436
+.L.return.f1436:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1437
+f1437:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1437
+.L.return.f1437:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1438
+f1438:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1438
+.L.return.f1438:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1439
+f1439:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1439
+.L.return.f1439:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1440
+f1440:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1440
+.L.return.f1440:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1441
+f1441:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1441
+.L.return.f1441:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1442
+f1442:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1442
+.L.return.f1442:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1443
+f1443:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1443
+.L.return.f1443:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1444
+f1444:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1444
+.L.return.f1444:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1445
+f1445:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1445
+.L.return.f1445:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1446
+f1446:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1446
+.L.return.f1446:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1447
+f1447:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1447
+.L.return.f1447:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1448
+f1448:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1448
+.L.return.f1448:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1449
+f1449:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1449
+.L.return.f1449:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1450
+f1450:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1450
+.L.return.f1450:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1451
+f1451:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1451
+.L.return.f1451:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1452
+f1452:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1452
+.L.return.f1452:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1453
+f1453:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1453
+.L.return.f1453:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1454
+f1454:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1454
+.L.return.f1454:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1455
+f1455:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1455
+.L.return.f1455:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1456
+f1456:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1456
+.L.return.f1456:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1457
+f1457:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1457
+.L.return.f1457:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1458
+f1458:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1458
+.L.return.f1458:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1459
+f1459:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1459
+.L.return.f1459:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1460
+f1460:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1460
+.L.return.f1460:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1461
+f1461:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1461
+.L.return.f1461:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1462
+f1462:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1462
+.L.return.f1462:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1463
+f1463:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1463
+.L.return.f1463:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1464
+f1464:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1464
+.L.return.f1464:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1465
+f1465:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1465
+.L.return.f1465:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1466
+f1466:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1466
+.L.return.f1466:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1467
+f1467:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1467
+.L.return.f1467:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1468
+f1468:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1468
+.L.return.f1468:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1469
+f1469:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1469
+.L.return.f1469:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1470
+f1470:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1470
+.L.return.f1470:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1471
+f1471:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1471
+.L.return.f1471:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1472
+f1472:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1472
+.L.return.f1472:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1473
+f1473:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1473
+.L.return.f1473:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1474
+f1474:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1474
+.L.return.f1474:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1475
+f1475:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1475
+.L.return.f1475:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1476
+f1476:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1476
+.L.return.f1476:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1477
+f1477:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1477
+.L.return.f1477:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1478
+f1478:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1478
+.L.return.f1478:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1479
+f1479:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1479
+.L.return.f1479:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1480
+f1480:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1480
+.L.return.f1480:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1481
+f1481:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1481
+.L.return.f1481:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1482
+f1482:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1482
+.L.return.f1482:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1483
+f1483:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1483
+.L.return.f1483:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1484
+f1484:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1484
+.L.return.f1484:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1485
+f1485:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1485
+.L.return.f1485:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1486
+f1486:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1486
+.L.return.f1486:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1487
+f1487:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1487
+.L.return.f1487:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1488
+f1488:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1488
+.L.return.f1488:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1489
+f1489:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1489
+.L.return.f1489:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1490
+f1490:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1490
+.L.return.f1490:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1491
+f1491:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1491
+.L.return.f1491:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1492
+f1492:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1492
+.L.return.f1492:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1493
+f1493:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1493
+.L.return.f1493:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1494
+f1494:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1494
+.L.return.f1494:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1495
+f1495:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1495
+.L.return.f1495:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1496
+f1496:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1496
+.L.return.f1496:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1497
+f1497:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1497
+.L.return.f1497:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1498
+f1498:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1498
+.L.return.f1498:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1499
+f1499:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1499
+.L.return.f1499:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1500
+f1500:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1500
+.L.return.f1500:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1501
+f1501:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1501
+.L.return.f1501:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1502
+f1502:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1502
+.L.return.f1502:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1503
+f1503:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1503
+.L.return.f1503:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1504
+f1504:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1504
+.L.return.f1504:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1505
+f1505:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1505
+.L.return.f1505:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1506
+f1506:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1506
+.L.return.f1506:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1507
+f1507:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1507
+.L.return.f1507:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1508
+f1508:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1508
+.L.return.f1508:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1509
+f1509:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1509
+.L.return.f1509:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1510
+f1510:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1510
+.L.return.f1510:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1511
+f1511:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1511
+.L.return.f1511:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1512
+f1512:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1512
+.L.return.f1512:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1513
+f1513:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1513
+.L.return.f1513:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1514
+f1514:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1514
+.L.return.f1514:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1515
+f1515:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1515
+.L.return.f1515:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1516
+f1516:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1516
+.L.return.f1516:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1517
+f1517:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1517
+.L.return.f1517:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1518
+f1518:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1518
+.L.return.f1518:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1519
+f1519:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1519
+.L.return.f1519:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1520
+f1520:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1520
+.L.return.f1520:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1521
+f1521:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1521
+.L.return.f1521:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1522
+f1522:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1522
+.L.return.f1522:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1523
+f1523:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1523
+.L.return.f1523:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1524
+f1524:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1524
+.L.return.f1524:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1525
+f1525:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1525
+.L.return.f1525:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1526
+f1526:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1526
+.L.return.f1526:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1527
+f1527:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1527
+.L.return.f1527:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1528
+f1528:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1528
+.L.return.f1528:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1529
+f1529:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1529
+.L.return.f1529:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1530
+f1530:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1530
+.L.return.f1530:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1531
+f1531:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1531
+.L.return.f1531:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1532
+f1532:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1532
+.L.return.f1532:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1533
+f1533:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1533
+.L.return.f1533:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1534
+f1534:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1534
+.L.return.f1534:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1535
+f1535:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1535
+.L.return.f1535:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1536
+f1536:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1536
+.L.return.f1536:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1537
+f1537:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1537
+.L.return.f1537:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1538
+f1538:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1538
+.L.return.f1538:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1539
+f1539:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1539
+.L.return.f1539:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1540
+f1540:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1540
+.L.return.f1540:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1541
+f1541:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1541
+.L.return.f1541:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1542
+f1542:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1542
+.L.return.f1542:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1543
+f1543:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1543
+.L.return.f1543:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1544
+f1544:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1544
+.L.return.f1544:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1545
+f1545:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1545
+.L.return.f1545:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1546
+f1546:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1546
+.L.return.f1546:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1547
+f1547:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1547
+.L.return.f1547:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1548
+f1548:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1548
+.L.return.f1548:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1549
+f1549:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1549
+.L.return.f1549:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1550
+f1550:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1550
+.L.return.f1550:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1551
+f1551:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1551
+.L.return.f1551:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1552
+f1552:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1552
+.L.return.f1552:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1553
+f1553:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1553
+.L.return.f1553:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1554
+f1554:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1554
+.L.return.f1554:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1555
+f1555:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1555
+.L.return.f1555:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1556
+f1556:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1556
+.L.return.f1556:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1557
+f1557:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1557
+.L.return.f1557:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1558
+f1558:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1558
+.L.return.f1558:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1559
+f1559:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1559
+.L.return.f1559:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1560
+f1560:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1560
+.L.return.f1560:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1561
+f1561:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1561
+.L.return.f1561:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1562
+f1562:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1562
+.L.return.f1562:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1563
+f1563:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1563
+.L.return.f1563:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1564
+f1564:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1564
+.L.return.f1564:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1565
+f1565:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1565
+.L.return.f1565:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1566
+f1566:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1566
+.L.return.f1566:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1567
+f1567:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1567
+.L.return.f1567:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1568
+f1568:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1568
+.L.return.f1568:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1569
+f1569:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1569
+.L.return.f1569:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1570
+f1570:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1570
+.L.return.f1570:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1571
+f1571:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1571
+.L.return.f1571:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1572
+f1572:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1572
+.L.return.f1572:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1573
+f1573:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1573
+.L.return.f1573:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1574
+f1574:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1574
+.L.return.f1574:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1575
+f1575:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1575
+.L.return.f1575:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1576
+f1576:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1576
+.L.return.f1576:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1577
+f1577:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1577
+.L.return.f1577:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1578
+f1578:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1578
+.L.return.f1578:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1579
+f1579:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1579
+.L.return.f1579:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1580
+f1580:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1580
+.L.return.f1580:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1581
+f1581:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1581
+.L.return.f1581:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1582
+f1582:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1582
+.L.return.f1582:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1583
+f1583:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1583
+.L.return.f1583:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1584
+f1584:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1584
+.L.return.f1584:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1585
+f1585:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1585
+.L.return.f1585:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1586
+f1586:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1586
+.L.return.f1586:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1587
+f1587:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1587
+.L.return.f1587:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1588
+f1588:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1588
+.L.return.f1588:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1589
+f1589:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1589
+.L.return.f1589:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1590
+f1590:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1590
+.L.return.f1590:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1591
+f1591:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1591
+.L.return.f1591:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1592
+f1592:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1592
+.L.return.f1592:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1593
+f1593:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1593
+.L.return.f1593:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1594
+f1594:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1594
+.L.return.f1594:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1595
+f1595:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1595
+.L.return.f1595:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1596
+f1596:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1596
+.L.return.f1596:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1597
+f1597:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1597
+.L.return.f1597:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1598
+f1598:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1598
+.L.return.f1598:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1599
+f1599:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1599
+.L.return.f1599:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1600
+f1600:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1600
+.L.return.f1600:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1601
+f1601:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1601
+.L.return.f1601:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1602
+f1602:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1602
+.L.return.f1602:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1603
+f1603:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1603
+.L.return.f1603:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1604
+f1604:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1604
+.L.return.f1604:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1605
+f1605:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1605
+.L.return.f1605:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1606
+f1606:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1606
+.L.return.f1606:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1607
+f1607:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1607
+.L.return.f1607:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1608
+f1608:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1608
+.L.return.f1608:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1609
+f1609:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1609
+.L.return.f1609:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1610
+f1610:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1610
+.L.return.f1610:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1611
+f1611:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1611
+.L.return.f1611:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1612
+f1612:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1612
+.L.return.f1612:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1613
+f1613:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1613
+.L.return.f1613:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1614
+f1614:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1614
+.L.return.f1614:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1615
+f1615:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1615
+.L.return.f1615:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1616
+f1616:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1616
+.L.return.f1616:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1617
+f1617:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1617
+.L.return.f1617:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1618
+f1618:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1618
+.L.return.f1618:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1619
+f1619:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1619
+.L.return.f1619:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1620
+f1620:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1620
+.L.return.f1620:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1621
+f1621:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1621
+.L.return.f1621:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1622
+f1622:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1622
+.L.return.f1622:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1623
+f1623:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1623
+.L.return.f1623:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1624
+f1624:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1624
+.L.return.f1624:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1625
+f1625:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1625
+.L.return.f1625:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1626
+f1626:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1626
+.L.return.f1626:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1627
+f1627:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1627
+.L.return.f1627:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1628
+f1628:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1628
+.L.return.f1628:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1629
+f1629:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1629
+.L.return.f1629:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1630
+f1630:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1630
+.L.return.f1630:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1631
+f1631:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1631
+.L.return.f1631:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1632
+f1632:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1632
+.L.return.f1632:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1633
+f1633:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1633
+.L.return.f1633:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1634
+f1634:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1634
+.L.return.f1634:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1635
+f1635:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1635
+.L.return.f1635:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1636
+f1636:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1636
+.L.return.f1636:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1637
+f1637:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1637
+.L.return.f1637:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1638
+f1638:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1638
+.L.return.f1638:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1639
+f1639:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1639
+.L.return.f1639:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1640
+f1640:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1640
+.L.return.f1640:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1641
+f1641:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1641
+.L.return.f1641:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1642
+f1642:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1642
+.L.return.f1642:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1643
+f1643:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1643
+.L.return.f1643:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1644
+f1644:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1644
+.L.return.f1644:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1645
+f1645:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1645
+.L.return.f1645:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1646
+f1646:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1646
+.L.return.f1646:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1647
+f1647:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1647
+.L.return.f1647:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1648
+f1648:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1648
+.L.return.f1648:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1649
+f1649:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1649
+.L.return.f1649:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1650
+f1650:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1650
+.L.return.f1650:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1651
+f1651:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1651
+.L.return.f1651:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1652
+f1652:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1652
+.L.return.f1652:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1653
+f1653:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1653
+.L.return.f1653:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1654
+f1654:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1654
+.L.return.f1654:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1655
+f1655:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1655
+.L.return.f1655:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1656
+f1656:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1656
+.L.return.f1656:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1657
+f1657:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1657
+.L.return.f1657:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1658
+f1658:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1658
+.L.return.f1658:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1659
+f1659:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1659
+.L.return.f1659:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1660
+f1660:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1660
+.L.return.f1660:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1661
+f1661:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1661
+.L.return.f1661:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1662
+f1662:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1662
+.L.return.f1662:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1663
+f1663:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1663
+.L.return.f1663:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1664
+f1664:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1664
+.L.return.f1664:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1665
+f1665:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1665
+.L.return.f1665:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1666
+f1666:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1666
+.L.return.f1666:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1667
+f1667:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1667
+.L.return.f1667:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1668
+f1668:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1668
+.L.return.f1668:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1669
+f1669:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1669
+.L.return.f1669:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1670
+f1670:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1670
+.L.return.f1670:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1671
+f1671:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1671
+.L.return.f1671:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1672
+f1672:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1672
+.L.return.f1672:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1673
+f1673:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1673
+.L.return.f1673:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1674
+f1674:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1674
+.L.return.f1674:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1675
+f1675:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1675
+.L.return.f1675:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1676
+f1676:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1676
+.L.return.f1676:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1677
+f1677:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1677
+.L.return.f1677:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1678
+f1678:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1678
+.L.return.f1678:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1679
+f1679:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1679
+.L.return.f1679:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1680
+f1680:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1680
+.L.return.f1680:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1681
+f1681:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1681
+.L.return.f1681:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1682
+f1682:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1682
+.L.return.f1682:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1683
+f1683:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1683
+.L.return.f1683:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1684
+f1684:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1684
+.L.return.f1684:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1685
+f1685:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1685
+.L.return.f1685:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1686
+f1686:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1686
+.L.return.f1686:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1687
+f1687:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1687
+.L.return.f1687:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1688
+f1688:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1688
+.L.return.f1688:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1689
+f1689:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1689
+.L.return.f1689:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1690
+f1690:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1690
+.L.return.f1690:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1691
+f1691:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1691
+.L.return.f1691:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1692
+f1692:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1692
+.L.return.f1692:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1693
+f1693:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1693
+.L.return.f1693:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1694
+f1694:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1694
+.L.return.f1694:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1695
+f1695:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1695
+.L.return.f1695:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1696
+f1696:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1696
+.L.return.f1696:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1697
+f1697:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1697
+.L.return.f1697:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1698
+f1698:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1698
+.L.return.f1698:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1699
+f1699:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1699
+.L.return.f1699:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1700
+f1700:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1700
+.L.return.f1700:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1701
+f1701:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1701
+.L.return.f1701:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1702
+f1702:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1702
+.L.return.f1702:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1703
+f1703:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1703
+.L.return.f1703:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1704
+f1704:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1704
+.L.return.f1704:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1705
+f1705:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1705
+.L.return.f1705:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1706
+f1706:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1706
+.L.return.f1706:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1707
+f1707:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1707
+.L.return.f1707:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1708
+f1708:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1708
+.L.return.f1708:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1709
+f1709:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1709
+.L.return.f1709:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1710
+f1710:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1710
+.L.return.f1710:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1711
+f1711:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1711
+.L.return.f1711:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1712
+f1712:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1712
+.L.return.f1712:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1713
+f1713:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1713
+.L.return.f1713:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1714
+f1714:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1714
+.L.return.f1714:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1715
+f1715:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1715
+.L.return.f1715:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1716
+f1716:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1716
+.L.return.f1716:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1717
+f1717:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1717
+.L.return.f1717:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1718
+f1718:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1718
+.L.return.f1718:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1719
+f1719:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1719
+.L.return.f1719:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1720
+f1720:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1720
+.L.return.f1720:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1721
+f1721:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1721
+.L.return.f1721:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1722
+f1722:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1722
+.L.return.f1722:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1723
+f1723:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1723
+.L.return.f1723:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1724
+f1724:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1724
+.L.return.f1724:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1725
+f1725:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1725
+.L.return.f1725:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1726
+f1726:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1726
+.L.return.f1726:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1727
+f1727:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1727
+.L.return.f1727:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1728
+f1728:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1728
+.L.return.f1728:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1729
+f1729:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1729
+.L.return.f1729:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1730
+f1730:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1730
+.L.return.f1730:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1731
+f1731:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1731
+.L.return.f1731:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1732
+f1732:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1732
+.L.return.f1732:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1733
+f1733:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1733
+.L.return.f1733:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1734
+f1734:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1734
+.L.return.f1734:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1735
+f1735:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1735
+.L.return.f1735:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1736
+f1736:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1736
+.L.return.f1736:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1737
+f1737:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1737
+.L.return.f1737:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1738
+f1738:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1738
+.L.return.f1738:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1739
+f1739:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1739
+.L.return.f1739:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1740
+f1740:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1740
+.L.return.f1740:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1741
+f1741:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1741
+.L.return.f1741:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1742
+f1742:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1742
+.L.return.f1742:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1743
+f1743:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1743
+.L.return.f1743:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1744
+f1744:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1744
+.L.return.f1744:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1745
+f1745:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1745
+.L.return.f1745:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1746
+f1746:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1746
+.L.return.f1746:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1747
+f1747:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1747
+.L.return.f1747:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1748
+f1748:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1748
+.L.return.f1748:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1749
+f1749:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1749
+.L.return.f1749:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1750
+f1750:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1750
+.L.return.f1750:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1751
+f1751:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1751
+.L.return.f1751:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1752
+f1752:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1752
+.L.return.f1752:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1753
+f1753:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1753
+.L.return.f1753:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1754
+f1754:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1754
+.L.return.f1754:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1755
+f1755:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1755
+.L.return.f1755:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1756
+f1756:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1756
+.L.return.f1756:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1757
+f1757:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1757
+.L.return.f1757:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1758
+f1758:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1758
+.L.return.f1758:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1759
+f1759:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1759
+.L.return.f1759:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1760
+f1760:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1760
+.L.return.f1760:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1761
+f1761:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1761
+.L.return.f1761:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1762
+f1762:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1762
+.L.return.f1762:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1763
+f1763:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1763
+.L.return.f1763:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1764
+f1764:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1764
+.L.return.f1764:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1765
+f1765:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1765
+.L.return.f1765:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1766
+f1766:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1766
+.L.return.f1766:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1767
+f1767:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1767
+.L.return.f1767:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1768
+f1768:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1768
+.L.return.f1768:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1769
+f1769:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1769
+.L.return.f1769:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1770
+f1770:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1770
+.L.return.f1770:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1771
+f1771:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1771
+.L.return.f1771:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1772
+f1772:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1772
+.L.return.f1772:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1773
+f1773:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1773
+.L.return.f1773:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1774
+f1774:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1774
+.L.return.f1774:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1775
+f1775:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1775
+.L.return.f1775:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1776
+f1776:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1776
+.L.return.f1776:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1777
+f1777:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1777
+.L.return.f1777:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1778
+f1778:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1778
+.L.return.f1778:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1779
+f1779:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1779
+.L.return.f1779:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1780
+f1780:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1780
+.L.return.f1780:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1781
+f1781:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1781
+.L.return.f1781:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1782
+f1782:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1782
+.L.return.f1782:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1783
+f1783:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1783
+.L.return.f1783:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1784
+f1784:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1784
+.L.return.f1784:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1785
+f1785:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1785
+.L.return.f1785:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1786
+f1786:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1786
+.L.return.f1786:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1787
+f1787:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1787
+.L.return.f1787:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1788
+f1788:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1788
+.L.return.f1788:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1789
+f1789:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1789
+.L.return.f1789:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1790
+f1790:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1790
+.L.return.f1790:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1791
+f1791:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1791
+.L.return.f1791:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1792
+f1792:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1792
+.L.return.f1792:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1793
+f1793:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1793
+.L.return.f1793:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1794
+f1794:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1794
+.L.return.f1794:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1795
+f1795:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1795
+.L.return.f1795:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1796
+f1796:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1796
+.L.return.f1796:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1797
+f1797:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1797
+.L.return.f1797:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1798
+f1798:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1798
+.L.return.f1798:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1799
+f1799:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1799
+.L.return.f1799:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1800
+f1800:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1800
+.L.return.f1800:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1801
+f1801:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1801
+.L.return.f1801:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1802
+f1802:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1802
+.L.return.f1802:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1803
+f1803:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1803
+.L.return.f1803:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1804
+f1804:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1804
+.L.return.f1804:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1805
+f1805:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1805
+.L.return.f1805:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1806
+f1806:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1806
+.L.return.f1806:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1807
+f1807:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1807
+.L.return.f1807:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1808
+f1808:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1808
+.L.return.f1808:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1809
+f1809:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1809
+.L.return.f1809:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1810
+f1810:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1810
+.L.return.f1810:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1811
+f1811:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1811
+.L.return.f1811:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1812
+f1812:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1812
+.L.return.f1812:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1813
+f1813:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1813
+.L.return.f1813:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1814
+f1814:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1814
+.L.return.f1814:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1815
+f1815:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1815
+.L.return.f1815:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1816
+f1816:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1816
+.L.return.f1816:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1817
+f1817:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1817
+.L.return.f1817:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1818
+f1818:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1818
+.L.return.f1818:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1819
+f1819:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1819
+.L.return.f1819:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1820
+f1820:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1820
+.L.return.f1820:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1821
+f1821:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1821
+.L.return.f1821:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1822
+f1822:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1822
+.L.return.f1822:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1823
+f1823:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1823
+.L.return.f1823:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1824
+f1824:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1824
+.L.return.f1824:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1825
+f1825:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1825
+.L.return.f1825:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1826
+f1826:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1826
+.L.return.f1826:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1827
+f1827:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1827
+.L.return.f1827:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1828
+f1828:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1828
+.L.return.f1828:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1829
+f1829:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1829
+.L.return.f1829:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1830
+f1830:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1830
+.L.return.f1830:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1831
+f1831:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1831
+.L.return.f1831:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1832
+f1832:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1832
+.L.return.f1832:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1833
+f1833:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1833
+.L.return.f1833:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1834
+f1834:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1834
+.L.return.f1834:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1835
+f1835:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1835
+.L.return.f1835:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1836
+f1836:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1836
+.L.return.f1836:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1837
+f1837:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1837
+.L.return.f1837:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1838
+f1838:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1838
+.L.return.f1838:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1839
+f1839:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1839
+.L.return.f1839:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1840
+f1840:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1840
+.L.return.f1840:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1841
+f1841:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1841
+.L.return.f1841:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1842
+f1842:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1842
+.L.return.f1842:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1843
+f1843:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1843
+.L.return.f1843:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1844
+f1844:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1844
+.L.return.f1844:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1845
+f1845:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1845
+.L.return.f1845:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1846
+f1846:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1846
+.L.return.f1846:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1847
+f1847:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1847
+.L.return.f1847:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1848
+f1848:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1848
+.L.return.f1848:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1849
+f1849:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1849
+.L.return.f1849:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1850
+f1850:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1850
+.L.return.f1850:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1851
+f1851:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1851
+.L.return.f1851:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1852
+f1852:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1852
+.L.return.f1852:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1853
+f1853:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1853
+.L.return.f1853:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1854
+f1854:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1854
+.L.return.f1854:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1855
+f1855:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1855
+.L.return.f1855:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1856
+f1856:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1856
+.L.return.f1856:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1857
+f1857:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1857
+.L.return.f1857:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1858
+f1858:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1858
+.L.return.f1858:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1859
+f1859:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1859
+.L.return.f1859:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1860
+f1860:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1860
+.L.return.f1860:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1861
+f1861:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1861
+.L.return.f1861:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1862
+f1862:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1862
+.L.return.f1862:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1863
+f1863:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1863
+.L.return.f1863:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1864
+f1864:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1864
+.L.return.f1864:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1865
+f1865:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1865
+.L.return.f1865:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1866
+f1866:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1866
+.L.return.f1866:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1867
+f1867:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1867
+.L.return.f1867:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1868
+f1868:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1868
+.L.return.f1868:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1869
+f1869:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1869
+.L.return.f1869:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1870
+f1870:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1870
+.L.return.f1870:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1871
+f1871:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1871
+.L.return.f1871:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1872
+f1872:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1872
+.L.return.f1872:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1873
+f1873:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1873
+.L.return.f1873:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1874
+f1874:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1874
+.L.return.f1874:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1875
+f1875:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1875
+.L.return.f1875:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1876
+f1876:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1876
+.L.return.f1876:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1877
+f1877:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1877
+.L.return.f1877:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1878
+f1878:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1878
+.L.return.f1878:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1879
+f1879:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1879
+.L.return.f1879:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1880
+f1880:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1880
+.L.return.f1880:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1881
+f1881:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1881
+.L.return.f1881:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1882
+f1882:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1882
+.L.return.f1882:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1883
+f1883:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1883
+.L.return.f1883:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1884
+f1884:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1884
+.L.return.f1884:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1885
+f1885:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1885
+.L.return.f1885:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1886
+f1886:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1886
+.L.return.f1886:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1887
+f1887:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1887
+.L.return.f1887:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1888
+f1888:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1888
+.L.return.f1888:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1889
+f1889:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1889
+.L.return.f1889:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1890
+f1890:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1890
+.L.return.f1890:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1891
+f1891:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1891
+.L.return.f1891:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1892
+f1892:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1892
+.L.return.f1892:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1893
+f1893:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1893
+.L.return.f1893:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1894
+f1894:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1894
+.L.return.f1894:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1895
+f1895:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1895
+.L.return.f1895:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1896
+f1896:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1896
+.L.return.f1896:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1897
+f1897:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1897
+.L.return.f1897:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1898
+f1898:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1898
+.L.return.f1898:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1899
+f1899:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1899
+.L.return.f1899:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1900
+f1900:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1900
+.L.return.f1900:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1901
+f1901:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1901
+.L.return.f1901:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1902
+f1902:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1902
+.L.return.f1902:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1903
+f1903:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1903
+.L.return.f1903:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1904
+f1904:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1904
+.L.return.f1904:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1905
+f1905:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1905
+.L.return.f1905:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1906
+f1906:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1906
+.L.return.f1906:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1907
+f1907:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1907
+.L.return.f1907:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1908
+f1908:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1908
+.L.return.f1908:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1909
+f1909:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1909
+.L.return.f1909:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1910
+f1910:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1910
+.L.return.f1910:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1911
+f1911:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1911
+.L.return.f1911:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1912
+f1912:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1912
+.L.return.f1912:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1913
+f1913:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1913
+.L.return.f1913:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1914
+f1914:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1914
+.L.return.f1914:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1915
+f1915:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1915
+.L.return.f1915:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1916
+f1916:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1916
+.L.return.f1916:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1917
+f1917:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1917
+.L.return.f1917:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1918
+f1918:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1918
+.L.return.f1918:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1919
+f1919:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1919
+.L.return.f1919:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1920
+f1920:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1920
+.L.return.f1920:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1921
+f1921:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1921
+.L.return.f1921:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1922
+f1922:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1922
+.L.return.f1922:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1923
+f1923:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1923
+.L.return.f1923:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1924
+f1924:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1924
+.L.return.f1924:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1925
+f1925:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1925
+.L.return.f1925:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1926
+f1926:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1926
+.L.return.f1926:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1927
+f1927:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1927
+.L.return.f1927:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1928
+f1928:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1928
+.L.return.f1928:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1929
+f1929:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1929
+.L.return.f1929:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1930
+f1930:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1930
+.L.return.f1930:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1931
+f1931:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1931
+.L.return.f1931:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1932
+f1932:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1932
+.L.return.f1932:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1933
+f1933:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1933
+.L.return.f1933:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1934
+f1934:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1934
+.L.return.f1934:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1935
+f1935:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1935
+.L.return.f1935:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1936
+f1936:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1936
+.L.return.f1936:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1937
+f1937:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1937
+.L.return.f1937:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1938
+f1938:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1938
+.L.return.f1938:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1939
+f1939:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1939
+.L.return.f1939:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1940
+f1940:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1940
+.L.return.f1940:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1941
+f1941:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1941
+.L.return.f1941:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1942
+f1942:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1942
+.L.return.f1942:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1943
+f1943:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1943
+.L.return.f1943:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1944
+f1944:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1944
+.L.return.f1944:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1945
+f1945:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1945
+.L.return.f1945:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1946
+f1946:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1946
+.L.return.f1946:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1947
+f1947:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1947
+.L.return.f1947:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1948
+f1948:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1948
+.L.return.f1948:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1949
+f1949:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1949
+.L.return.f1949:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1950
+f1950:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1950
+.L.return.f1950:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1951
+f1951:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1951
+.L.return.f1951:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1952
+f1952:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1952
+.L.return.f1952:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1953
+f1953:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1953
+.L.return.f1953:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1954
+f1954:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1954
+.L.return.f1954:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1955
+f1955:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1955
+.L.return.f1955:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1956
+f1956:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1956
+.L.return.f1956:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1957
+f1957:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1957
+.L.return.f1957:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1958
+f1958:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1958
+.L.return.f1958:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1959
+f1959:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1959
+.L.return.f1959:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1960
+f1960:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1960
+.L.return.f1960:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1961
+f1961:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1961
+.L.return.f1961:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1962
+f1962:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1962
+.L.return.f1962:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1963
+f1963:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1963
+.L.return.f1963:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1964
+f1964:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1964
+.L.return.f1964:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1965
+f1965:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1965
+.L.return.f1965:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1966
+f1966:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1966
+.L.return.f1966:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1967
+f1967:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1967
+.L.return.f1967:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1968
+f1968:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1968
+.L.return.f1968:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1969
+f1969:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1969
+.L.return.f1969:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1970
+f1970:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1970
+.L.return.f1970:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1971
+f1971:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1971
+.L.return.f1971:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1972
+f1972:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1972
+.L.return.f1972:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1973
+f1973:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1973
+.L.return.f1973:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1974
+f1974:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1974
+.L.return.f1974:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1975
+f1975:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1975
+.L.return.f1975:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1976
+f1976:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1976
+.L.return.f1976:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1977
+f1977:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1977
+.L.return.f1977:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1978
+f1978:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1978
+.L.return.f1978:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1979
+f1979:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1979
+.L.return.f1979:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1980
+f1980:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1980
+.L.return.f1980:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1981
+f1981:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1981
+.L.return.f1981:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1982
+f1982:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1982
+.L.return.f1982:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1983
+f1983:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1983
+.L.return.f1983:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1984
+f1984:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1984
+.L.return.f1984:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1985
+f1985:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1985
+.L.return.f1985:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1986
+f1986:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1986
+.L.return.f1986:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1987
+f1987:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1987
+.L.return.f1987:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1988
+f1988:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1988
+.L.return.f1988:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1989
+f1989:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1989
+.L.return.f1989:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1990
+f1990:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1990
+.L.return.f1990:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1991
+f1991:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1991
+.L.return.f1991:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1992
+f1992:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1992
+.L.return.f1992:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1993
+f1993:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1993
+.L.return.f1993:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1994
+f1994:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1994
+.L.return.f1994:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1995
+f1995:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1995
+.L.return.f1995:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1996
+f1996:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1996
+.L.return.f1996:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1997
+f1997:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1997
+.L.return.f1997:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1998
+f1998:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1998
+.L.return.f1998:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f1999
+f1999:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f1999
+.L.return.f1999:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global f2000
+f2000:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  lea rax, [rip+.L.str.e33fb3bb285734e26a55818ab4a11eb8]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-8], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-8]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rax
+  jmp .L.return.f2000
+.L.return.f2000:
+  mov rsp, rbp
+  pop rbp
+  ret
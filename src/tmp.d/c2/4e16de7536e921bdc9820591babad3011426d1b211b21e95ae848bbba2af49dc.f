@@ -0,0 +1,25 @@
+A
+.global addx
+addx:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-16], rdi
+  mov [rbp-4], esi
+  mov rax, qword ptr [rbp-16]
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  mov eax, dword ptr [rbp-4]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rax
+  jmp .L.return.addx
+.L.return.addx:
+  mov rsp, rbp
+  pop rbp
+  ret
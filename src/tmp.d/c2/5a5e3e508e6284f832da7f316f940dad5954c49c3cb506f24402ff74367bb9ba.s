@@ -0,0 +1,16 @@
+.intel_syntax noprefix
+.section .note.GNU-stack,"",@progbits
+.bss
+.text
+.global two
+two:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 0
+  push 2
+  pop rax
+  jmp .L.return.two
+.L.return.two:
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,61 @@
+A
+.global sw_table
+sw_table:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  mov [rbp-4], edi
+  mov eax, dword ptr [rbp-4]
+  push rax
+  pop rax
+  sub eax, 0
+  cmp eax, 5
+  ja .L.case.sw_table.6
+  lea rdi, [rip+.L.jt.sw_table.7]
+  movsxd rax, dword ptr [rdi+rax*4]
+  add rax, rdi
+  jmp rax
+.section .rodata
+.align 4
+.L.jt.sw_table.7:
+  .long .L.case.sw_table.5-.L.jt.sw_table.7
+  .long .L.case.sw_table.4-.L.jt.sw_table.7
+  .long .L.case.sw_table.3-.L.jt.sw_table.7
+  .long .L.case.sw_table.6-.L.jt.sw_table.7
+  .long .L.case.sw_table.2-.L.jt.sw_table.7
+  .long .L.case.sw_table.1-.L.jt.sw_table.7
+.text
+.L.case.sw_table.5:
+  push 10
+  pop rax
+  jmp .L.return.sw_table
+.L.case.sw_table.4:
+  push 11
+  pop rax
+  jmp .L.return.sw_table
+.L.case.sw_table.3:
+  push 12
+  pop rax
+  jmp .L.return.sw_table
+.L.case.sw_table.2:
+  push 14
+  pop rax
+  jmp .L.return.sw_table
+.L.case.sw_table.1:
+  push 15
+  pop rax
+  jmp .L.return.sw_table
+.L.case.sw_table.6:
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  sub eax, edi
+  push rax
+  pop rax
+  jmp .L.return.sw_table
+.L.end.sw_table.0:
+.L.return.sw_table:
+  mov rsp, rbp
+  pop rbp
+  ret
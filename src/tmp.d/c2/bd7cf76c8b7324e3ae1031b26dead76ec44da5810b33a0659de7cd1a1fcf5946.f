@@ -0,0 +1,59 @@
+A
+.global sw_tree
+sw_tree:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  mov [rbp-8], rdi
+  mov rax, qword ptr [rbp-8]
+  push rax
+  pop rax
+  cmp rax, 1000
+  je .L.case.sw_tree.3
+  jg .L.switch.sw_tree.7
+  cmp rax, -100
+  je .L.case.sw_tree.6
+  cmp rax, 3
+  je .L.case.sw_tree.5
+  cmp rax, 50
+  je .L.case.sw_tree.4
+  jmp .L.end.sw_tree.0
+.L.switch.sw_tree.7:
+  cmp rax, 70000
+  je .L.case.sw_tree.2
+  movabs rdi, 5000000000
+  cmp rax, rdi
+  je .L.case.sw_tree.1
+  jmp .L.end.sw_tree.0
+.L.case.sw_tree.6:
+  push 1
+  pop rax
+  jmp .L.return.sw_tree
+.L.case.sw_tree.5:
+  push 2
+  pop rax
+  jmp .L.return.sw_tree
+.L.case.sw_tree.4:
+  push 3
+  pop rax
+  jmp .L.return.sw_tree
+.L.case.sw_tree.3:
+  push 4
+  pop rax
+  jmp .L.return.sw_tree
+.L.case.sw_tree.2:
+  push 5
+  pop rax
+  jmp .L.return.sw_tree
+.L.case.sw_tree.1:
+  push 6
+  pop rax
+  jmp .L.return.sw_tree
+.L.end.sw_tree.0:
+  push 0
+  pop rax
+  jmp .L.return.sw_tree
+.L.return.sw_tree:
+  mov rsp, rbp
+  pop rbp
+  ret
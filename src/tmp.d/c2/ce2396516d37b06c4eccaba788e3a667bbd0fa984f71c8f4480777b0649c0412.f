@@ -0,0 +1,22 @@
+A
+.global sub2
+sub2:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  mov [rbp-8], edi
+  mov [rbp-4], esi
+  mov eax, dword ptr [rbp-8]
+  push rax
+  mov eax, dword ptr [rbp-4]
+  push rax
+  pop rdi
+  pop rax
+  sub eax, edi
+  push rax
+  pop rax
+  jmp .L.return.sub2
+.L.return.sub2:
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,13 @@
+A
+.global two
+two:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 0
+  push 2
+  pop rax
+  jmp .L.return.two
+.L.return.two:
+  mov rsp, rbp
+  pop rbp
+  ret
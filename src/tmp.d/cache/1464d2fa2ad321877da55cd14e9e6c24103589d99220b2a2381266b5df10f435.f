@@ -0,0 +1,15 @@
+R g1
+A
+.global g1_ptr
+g1_ptr:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 0
+  lea rax, [rip+g1]
+  push rax
+  pop rax
+  jmp .L.return.g1_ptr
+.L.return.g1_ptr:
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,50 @@
+A
+.global add6
+add6:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 24
+  mov [rbp-24], edi
+  mov [rbp-20], esi
+  mov [rbp-16], edx
+  mov [rbp-12], ecx
+  mov [rbp-8], r8d
+  mov [rbp-4], r9d
+  mov eax, dword ptr [rbp-24]
+  push rax
+  mov eax, dword ptr [rbp-20]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  mov eax, dword ptr [rbp-16]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  mov eax, dword ptr [rbp-12]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  mov eax, dword ptr [rbp-8]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  mov eax, dword ptr [rbp-4]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rax
+  jmp .L.return.add6
+.L.return.add6:
+  mov rsp, rbp
+  pop rbp
+  ret
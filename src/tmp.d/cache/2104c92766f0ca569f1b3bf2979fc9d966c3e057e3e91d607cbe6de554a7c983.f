@@ -0,0 +1,26 @@
+R g3
+R g3
+R g3
+A
+static_fn:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 0
+  push 7
+  pop rdi
+  mov dword ptr [rip+g3], edi
+  push rdi
+  add rsp, 8
+  push 7
+  pop rdi
+  mov dword ptr [rip+g3], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rip+g3]
+  push rax
+  pop rax
+  jmp .L.return.static_fn
+.L.return.static_fn:
+  mov rsp, rbp
+  pop rbp
+  ret
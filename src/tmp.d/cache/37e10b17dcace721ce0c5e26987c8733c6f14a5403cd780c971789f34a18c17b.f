@@ -0,0 +1,29 @@
+A
+.global sub_short
+sub_short:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  mov [rbp-6], di
+  mov [rbp-4], si
+  mov [rbp-2], dx
+  movsx eax, word ptr [rbp-6]
+  push rax
+  movsx eax, word ptr [rbp-4]
+  push rax
+  pop rdi
+  pop rax
+  sub eax, edi
+  push rax
+  movsx eax, word ptr [rbp-2]
+  push rax
+  pop rdi
+  pop rax
+  sub eax, edi
+  push rax
+  pop rax
+  jmp .L.return.sub_short
+.L.return.sub_short:
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,29 @@
+A
+.global sub_char
+sub_char:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  mov [rbp-3], dil
+  mov [rbp-2], sil
+  mov [rbp-1], dl
+  movsx eax, byte ptr [rbp-3]
+  push rax
+  movsx eax, byte ptr [rbp-2]
+  push rax
+  pop rdi
+  pop rax
+  sub eax, edi
+  push rax
+  movsx eax, byte ptr [rbp-1]
+  push rax
+  pop rdi
+  pop rax
+  sub eax, edi
+  push rax
+  pop rax
+  jmp .L.return.sub_char
+.L.return.sub_char:
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,74 @@
+R fib
+R fib
+A
+.global fib
+fib:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  mov [rbp-4], edi
+  mov eax, dword ptr [rbp-4]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  cmp eax, edi
+  jg .L.end.fib.0
+  push 1
+  pop rax
+  jmp .L.return.fib
+.L.end.fib.0:
+  mov eax, dword ptr [rbp-4]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  sub eax, edi
+  push rax
+  pop rdi
+  movsxd rdi, edi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.fib.1
+  mov eax, 0
+  call fib
+  jmp .L.end.fib.1
+.L.call.fib.1:
+  sub rsp, 8
+  mov eax, 0
+  call fib
+  add rsp, 8
+.L.end.fib.1:
+  push rax
+  mov eax, dword ptr [rbp-4]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  sub eax, edi
+  push rax
+  pop rdi
+  movsxd rdi, edi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.fib.2
+  mov eax, 0
+  call fib
+  jmp .L.end.fib.2
+.L.call.fib.2:
+  sub rsp, 8
+  mov eax, 0
+  call fib
+  add rsp, 8
+.L.end.fib.2:
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rax
+  jmp .L.return.fib
+.L.return.fib:
+  mov rsp, rbp
+  pop rbp
+  ret
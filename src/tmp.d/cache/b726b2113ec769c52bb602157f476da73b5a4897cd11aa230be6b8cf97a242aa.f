@@ -0,0 +1,29 @@
+A
+.global sub_long
+sub_long:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 24
+  mov [rbp-24], rdi
+  mov [rbp-16], rsi
+  mov [rbp-8], rdx
+  mov rax, qword ptr [rbp-24]
+  push rax
+  mov rax, qword ptr [rbp-16]
+  push rax
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  mov rax, qword ptr [rbp-8]
+  push rax
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rax
+  jmp .L.return.sub_long
+.L.return.sub_long:
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,483 @@
+// -*- c -*-
+
+// This is a line comment.
+
+/*
+ * This is a block comment.
+ */
+
+int printf();
+int exit();
+void *memcpy();
+void *memset();
+
+int g1;
+int g2[4];
+static int g3;
+static int g4;
+extern int ext_var;
+
+typedef int MyInt;
+
+int assert(long expected, long actual, char *code) {
+  if (expected == actual) {
+    printf("%s => %ld\n", code, actual);
+  } else {
+    printf("%s => %ld expected but got %ld\n", code, expected, actual);
+    exit(1);
+  }
+}
+
+int ret3() {
+  return 3;
+  return 5;
+}
+
+static int static_fn() {
+  g3 = 7; g3 = 7;
+  return g3;
+}
+
+static int unused_fn() {
+  return g4;
+}
+
+int add2(int x, int y) {
+  return x + y;
+}
+
+int sub2(int x, int y) {
+  return x - y;
+}
+
+int add6(int a, int b, int c, int d, int e, int f) {
+  return a + b + c + d + e + f;
+}
+
+int addx(int *x, int y) {
+  return *x + y;
+}
+
+int sub_char(char a, char b, char c) {
+  return a - b - c;
+}
+
+int sub_short(short a, short b, short c) {
+  return a - b - c;
+}
+
+int sub_long(long a, long b, long c) {
+  return a - b - c;
+}
+
+int *g1_ptr() {
+  return &g1;
+}
+
+int fib(int x) {
+  if (x<=1)
+    return 1;
+  return fib(x-1) + fib(x-2);
+}
+
+int sw_table(int x) {
+  switch (x) {
+  case 0: return 10;
+  case 1: return 11;
+  case 2: return 12;
+  case 4: return 14;
+  case 5: return 15;
+  default: return -1;
+  }
+}
+
+int sw_tree(long x) {
+  switch (x) {
+  case -100: return 1;
+  case 3: return 2;
+  case 50: return 3;
+  case 1000: return 4;
+  case 70000: return 5;
+  case 5000000000: return 6;
+  }
+  return 0;
+}
+
+int main() {
+  assert(3, ({ int a; a=3; a; }), "int a; a=3; a;");
+  assert(8, ({ int a; int z; a=3; z=5; a+z; }), "int a; int z; a=3; z=5; a+z;");
+  assert(3, ({ int a=3; a; }), "int a=3; a;");
+  assert(8, ({ int a=3; int z=5; a+z; }), "int a=3; int z=5; a+z;");
+
+  assert(3, ({ int foo=3; foo; }), "int foo=3; foo;");
+  assert(8, ({ int foo123=3; int bar=5; foo123+bar; }), "int foo123=3; int bar=5; foo123+bar;");
+
+  assert(3, ret3(), "ret3();");
+
+  assert(3, ({ int x=0; if (0) x=2; else x=3; x; }), "int x=0; if (0) x=2; else x=3; x;");
+  assert(3, ({ int x=0; if (1-1) x=2; else x=3; x; }), "int x=0; if (1-1) x=2; else x=3; x;");
+  assert(2, ({ int x=0; if (1) x=2; else x=3; x; }), "int x=0; if (1) x=2; else x=3; x;");
+  assert(2, ({ int x=0; if (2-1) x=2; else x=3; x; }), "int x=0; if (2-1) x=2; else x=3; x;");
+
+  assert(3, ({ 1; {2;} 3; }), "1; {2;} 3;");
+  assert(10, ({ int i=0; i=0; while(i<10) i=i+1; i; }), "int i=0; i=0; while(i<10) i=i+1; i;");
+  assert(55, ({ int i=0; int j=0; while(i<=10) {j=i+j; i=i+1;} j; }), "int i=0; int j=0; while(i<=10) {j=i+j; i=i+1;} j;");
+  assert(55, ({ int i=0; int j=0; for (i=0; i<=10; i=i+1) j=i+j; j; }), "int i=0; int j=0; for (i=0; i<=10; i=i+1) j=i+j; j;");
+
+  assert(8, add2(3, 5), "add(3, 5)");
+  assert(2, sub2(5, 3), "sub(5, 3)");
+  assert(21, add6(1,2,3,4,5,6), "add6(1,2,3,4,5,6)");
+  assert(55, fib(9), "fib(9)");
+
+  assert(3, ({ int x=3; *&x; }), "int x=3; *&x;");
+  assert(3, ({ int x=3; int *y=&x; int **z=&y; **z; }), "int x=3; int *y=&x; int **z=&y; **z;");
+  assert(5, ({ int x=3; int y=5; *(&x+1); }), "int x=3; int y=5; *(&x+1);");
+  assert(5, ({ int x=3; int y=5; *(1+&x); }), "int x=3; int y=5; *(1+&x);");
+  assert(3, ({ int x=3; int y=5; *(&y-1); }), "int x=3; int y=5; *(&y-1);");
+  assert(2, ({ int x=3; (&x+2)-&x; }), "int x=3; (&x+2)-&x;");
+
+  assert(5, ({ int x=3; int y=5; int *z=&x; *(z+1); }), "int x=3; int y=5; int *z=&x; *(z+1);");
+  assert(3, ({ int x=3; int y=5; int *z=&y; *(z-1); }), "int x=3; int y=5; int *z=&y; *(z-1);");
+  assert(5, ({ int x=3; int *y=&x; *y=5; x; }), "int x=3; int *y=&x; *y=5; x;");
+  assert(7, ({ int x=3; int y=5; *(&x+1)=7; y; }), "int x=3; int y=5; *(&x+1)=7; y;");
+  assert(7, ({ int x=3; int y=5; *(&y-1)=7; x; }), "int x=3; int y=5; *(&y-1)=7; x;");
+  assert(8, ({ int x=3; int y=5; addx(&x, y); }), "int x=3; int y=5; addx(&x, y);");
+
+  assert(3, ({ int x[2]; int *y=&x; *y=3; *x; }), "int x[2]; int *y=&x; *y=3; *x;");
+
+  assert(3, ({ int x[3]; *x=3; *(x+1)=4; *(x+2)=5; *x; }), "int x[3]; *x=3; *(x+1)=4; *(x+2)=5; *x;");
+  assert(4, ({ int x[3]; *x=3; *(x+1)=4; *(x+2)=5; *(x+1); }), "int x[3]; *x=3; *(x+1)=4; *(x+2)=5; *(x+1);");
+  assert(5, ({ int x[3]; *x=3; *(x+1)=4; *(x+2)=5; *(x+2); }), "int x[3]; *x=3; *(x+1)=4; *(x+2)=5; *(x+2);");
+
+  assert(0, ({ int x[2][3]; int *y=x; *y=0; **x; }), "int x[2][3]; int *y=x; *y=0; **x;");
+  assert(1, ({ int x[2][3]; int *y=x; *(y+1)=1; *(*x+1); }), "int x[2][3]; int *y=x; *(y+1)=1; *(*x+1);");
+  assert(2, ({ int x[2][3]; int *y=x; *(y+2)=2; *(*x+2); }), "int x[2][3]; int *y=x; *(y+2)=2; *(*x+2);");
+  assert(3, ({ int x[2][3]; int *y=x; *(y+3)=3; **(x+1); }), "int x[2][3]; int *y=x; *(y+3)=3; **(x+1);");
+  assert(4, ({ int x[2][3]; int *y=x; *(y+4)=4; *(*(x+1)+1); }), "int x[2][3]; int *y=x; *(y+4)=4; *(*(x+1)+1);");
+  assert(5, ({ int x[2][3]; int *y=x; *(y+5)=5; *(*(x+1)+2); }), "int x[2][3]; int *y=x; *(y+5)=5; *(*(x+1)+2);");
+  assert(6, ({ int x[2][3]; int *y=x; *(y+6)=6; **(x+2); }), "int x[2][3]; int *y=x; *(y+6)=6; **(x+2);");
+
+  assert(3, ({ int x[3]; *x=3; x[1]=4; x[2]=5; *x; }), "int x[3]; *x=3; x[1]=4; x[2]=5; *x;");
+  assert(4, ({ int x[3]; *x=3; x[1]=4; x[2]=5; *(x+1); }), "int x[3]; *x=3; x[1]=4; x[2]=5; *(x+1);");
+  assert(5, ({ int x[3]; *x=3; x[1]=4; x[2]=5; *(x+2); }), "int x[3]; *x=3; x[1]=4; x[2]=5; *(x+2);");
+  assert(5, ({ int x[3]; *x=3; x[1]=4; x[2]=5; *(x+2); }), "int x[3]; *x=3; x[1]=4; x[2]=5; *(x+2);");
+  assert(5, ({ int x[3]; *x=3; x[1]=4; 2[x]=5; *(x+2); }), "int x[3]; *x=3; x[1]=4; 2[x]=5; *(x+2);");
+
+  assert(0, ({ int x[2][3]; int *y=x; y[0]=0; x[0][0]; }), "int x[2][3]; int *y=x; y[0]=0; x[0][0];");
+  assert(1, ({ int x[2][3]; int *y=x; y[1]=1; x[0][1]; }), "int x[2][3]; int *y=x; y[1]=1; x[0][1];");
+  assert(2, ({ int x[2][3]; int *y=x; y[2]=2; x[0][2]; }), "int x[2][3]; int *y=x; y[2]=2; x[0][2];");
+  assert(3, ({ int x[2][3]; int *y=x; y[3]=3; x[1][0]; }), "int x[2][3]; int *y=x; y[3]=3; x[1][0];");
+  assert(4, ({ int x[2][3]; int *y=x; y[4]=4; x[1][1]; }), "int x[2][3]; int *y=x; y[4]=4; x[1][1];");
+  assert(5, ({ int x[2][3]; int *y=x; y[5]=5; x[1][2]; }), "int x[2][3]; int *y=x; y[5]=5; x[1][2];");
+  assert(6, ({ int x[2][3]; int *y=x; y[6]=6; x[2][0]; }), "int x[2][3]; int *y=x; y[6]=6; x[2][0];");
+
+  assert(4, ({ int x; sizeof(x); }), "int x; sizeof(x);");
+  assert(4, ({ int x; sizeof x; }), "int x; sizeof x;");
+  assert(8, ({ int *x; sizeof(x); }), "int *x; sizeof(x);");
+  assert(16, ({ int x[4]; sizeof(x); }), "int x[4]; sizeof(x);");
+  assert(48, ({ int x[3][4]; sizeof(x); }), "int x[3][4]; sizeof(x);");
+  assert(16, ({ int x[3][4]; sizeof(*x); }), "int x[3][4]; sizeof(*x);");
+  assert(4, ({ int x[3][4]; sizeof(**x); }), "int x[3][4]; sizeof(**x);");
+  assert(5, ({ int x[3][4]; sizeof(**x) + 1; }), "int x[3][4]; sizeof(**x) + 1;");
+  assert(5, ({ int x[3][4]; sizeof **x + 1; }), "int x[3][4]; sizeof **x + 1;");
+  assert(4, ({ int x[3][4]; sizeof(**x + 1); }), "int x[3][4]; sizeof(**x + 1);");
+
+  assert(0, g1, "g1");
+  g1=3;
+  assert(3, g1, "g1");
+
+  g2[0]=0; g2[1]=1; g2[2]=2; g2[3]=3;
+  assert(0, g2[0], "g2[0]");
+  assert(1, g2[1], "g2[1]");
+  assert(2, g2[2], "g2[2]");
+  assert(3, g2[3], "g2[3]");
+
+  assert(4, sizeof(g1), "sizeof(g1)");
+  assert(16, sizeof(g2), "sizeof(g2)");
+
+  assert(1, ({ char x=1; x; }), "char x=1; x;");
+  assert(1, ({ char x=1; char y=2; x; }), "char x=1; char y=2; x;");
+  assert(2, ({ char x=1; char y=2; y; }), "char x=1; char y=2; y;");
+
+  assert(1, ({ char x; sizeof(x); }), "char x; sizeof(x);");
+  assert(10, ({ char x[10]; sizeof(x); }), "char x[10]; sizeof(x);");
+  assert(1, sub_char(7, 3, 3), "sub_char(7, 3, 3)");
+
+  assert(97, "abc"[0], "\"abc\"[0]");
+  assert(98, "abc"[1], "\"abc\"[1]");
+  assert(99, "abc"[2], "\"abc\"[2]");
+  assert(0, "abc"[3], "\"abc\"[3]");
+  assert(4, sizeof("abc"), "sizeof(\"abc\")");
+
+  assert(7, "\a"[0], "\"\\a\"[0]");
+  assert(8, "\b"[0], "\"\\b\"[0]");
+  assert(9, "\t"[0], "\"\\t\"[0]");
+  assert(10, "\n"[0], "\"\\n\"[0]");
+  assert(11, "\v"[0], "\"\\v\"[0]");
+  assert(12, "\f"[0], "\"\\f\"[0]");
+  assert(13, "\r"[0], "\"\\r\"[0]");
+  assert(27, "\e"[0], "\"\\e\"[0]");
+  assert(0, "\0"[0], "\"\\0\"[0]");
+
+  assert(34, "\""[0], "\"\\\"\"[0]");
+  assert(92, "\\"[0], "\"\\\\\"[0]");
+  assert(0, "a\0b"[1], "\"a\\0b\"[1]");
+  assert(98, "a\0b"[2], "\"a\\0b\"[2]");
+  assert(4, sizeof("a\0b"), "sizeof(\"a\\0b\")");
+
+  assert(1, "abc" == "abc", "\"abc\" == \"abc\"");
+  assert(1, "bc" == "abc" + 1, "\"bc\" == \"abc\" + 1");
+  assert(0, "ab" == "abc", "\"ab\" == \"abc\"");
+
+  assert(106, "\j"[0], "\"\\j\"[0]");
+  assert(107, "\k"[0], "\"\\k\"[0]");
+  assert(108, "\l"[0], "\"\\l\"[0]");
+
+  assert(2, ({ int x=2; { int x=3; } x; }), "int x=2; { int x=3; } x;");
+  assert(2, ({ int x=2; { int x=3; } int y=4; x; }), "int x=2; { int x=3; } int y=4; x;");
+  assert(3, ({ int x=2; { x=3; } x; }), "int x=2; { x=3; } x;");
+
+  assert(2, ({ int x[5]; int *y=x+2; y-x; }), "int x[5]; int *y=x+2; y-x;");
+
+  assert(1, ({ struct {int a; int b;} x; x.a=1; x.b=2; x.a; }), "struct {int a; int b;} x; x.a=1; x.b=2; x.a;");
+  assert(2, ({ struct {int a; int b;} x; x.a=1; x.b=2; x.b; }), "struct {int a; int b;} x; x.a=1; x.b=2; x.b;");
+  assert(1, ({ struct {char a; int b; char c;} x; x.a=1; x.b=2; x.c=3; x.a; }), "struct {char a; int b; char c;} x; x.a=1; x.b=2; x.c=3; x.a;");
+  assert(2, ({ struct {char a; int b; char c;} x; x.b=1; x.b=2; x.c=3; x.b; }), "struct {char a; int b; char c;} a; x.b=x; x.a=2; x.b=3; x.b;");
+  assert(3, ({ struct {char a; int b; char c;} x; x.a=1; x.b=2; x.c=3; x.c; }), "struct {char a; int b; char c;} x; x.a=1; x.b=2; x.c=3; x.c;");
+
+  assert(0, ({ struct {int a; int b;} x[3]; int *p=x; p[0]=0; x[0].a; }), "struct {int a; int b;} x[3]; int *p=x; p[0]=0; x[0].a;");
+  assert(1, ({ struct {int a; int b;} x[3]; int *p=x; p[1]=1; x[0].b; }), "struct {int a; int b;} x[3]; int *p=x; p[1]=1; x[0].b;");
+  assert(2, ({ struct {int a; int b;} x[3]; int *p=x; p[2]=2; x[1].a; }), "struct {int a; int b;} x[3]; int *p=x; p[2]=2; x[1].a;");
+  assert(3, ({ struct {int a; int b;} x[3]; int *p=x; p[3]=3; x[1].b; }), "struct {int a; int b;} x[3]; int *p=x; p[3]=3; x[1].b;");
+
+  assert(6, ({ struct {int a[3]; int b[5];} x; int *p=&x; x.a[0]=6; p[0]; }), "struct {int a[3]; int b[5];} x; int *p=&x; x.a[0]=6; p[0];");
+  assert(7, ({ struct {int a[3]; int b[5];} x; int *p=&x; x.b[0]=7; p[3]; }), "struct {int a[3]; int b[5];} x; int *p=&x; x.b[0]=7; p[3];");
+
+  assert(6, ({ struct { struct { int b; } a; } x; x.a.b=6; x.a.b; }), "struct { struct { int b; } a; } x; x.a.b=6; x.a.b;");
+
+  assert(4, ({ struct {int a;} x; sizeof(x); }), "struct {int a;} x; sizeof(x);");
+  assert(8, ({ struct {int a; int b;} x; sizeof(x); }), "struct {int a; int b;} x; sizeof(x);");
+  assert(12, ({ struct {int a[3];} x; sizeof(x); }), "struct {int a[3];} x; sizeof(x);");
+  assert(16, ({ struct {int a;} x[4]; sizeof(x); }), "struct {int a;} x[4]; sizeof(x);");
+  assert(24, ({ struct {int a[3];} x[2]; sizeof(x); }), "struct {int a[3];} x[2]; sizeof(x)};");
+  assert(2, ({ struct {char a; char b;} x; sizeof(x); }), "struct {char a; char b;} x; sizeof(x);");
+  assert(8, ({ struct {char a; int b;} x; sizeof(x); }), "struct {char a; int b;} x; sizeof(x);");
+  assert(8, ({ struct {int a; char b;} x; sizeof(x); }), "struct {int a; char b;} x; sizeof(x);");
+
+  assert(7, ({ int x; char y; int a=&x; int b=&y; b-a; }), "int x; char y; int a=&x; int b=&y; b-a;");
+  assert(1, ({ char x; int y; int a=&x; int b=&y; b-a; }), "char x; int y; int a=&x; int b=&y; b-a;");
+
+  assert(8, ({ struct t {int a; int b;} x; struct t y; sizeof(y); }), "struct t {int a; int b;} x; struct t y; sizeof(y);");
+  assert(8, ({ struct t {int a; int b;}; struct t y; sizeof(y); }), "struct t {int a; int b;}; struct t y; sizeof(y);");
+  assert(2, ({ struct t {char a[2];}; { struct t {char a[4];}; } struct t y; sizeof(y); }), "struct t {char a[2];}; { struct t {char a[4];}; } struct t y; sizeof(y);");
+  assert(3, ({ struct t {int x;}; int t=1; struct t y; y.x=2; t+y.x; }), "struct t {int x;}; int t=1; struct t y; y.x=2; t+y.x;");
+
+  assert(3, ({ struct t {char a;} x; struct t *y = &x; x.a=3; y->a; }), "struct t {char a;} x; struct t *y = &x; x.a=3; y->a;");
+  assert(3, ({ struct t {char a;} x; struct t *y = &x; y->a=3; x.a; }), "struct t {char a;} x; struct t *y = &x; y->a=3; x.a;");
+
+  assert(1, ({ typedef int t; t x=1; x; }), "typedef int t; t x=1; x;");
+  assert(1, ({ typedef struct {int a;} t; t x; x.a=1; x.a; }), "typedef struct {int a;} t; t x; x.a=1; x.a;");
+  assert(1, ({ typedef int t; t t=1; t; }), "typedef int t; t t=1; t;");
+  assert(2, ({ typedef struct {int a;} t; { typedef int t; } t x; x.a=2; x.a; }), "typedef struct {int a;} t; { typedef int t; } t x; x.a=2; x.a;");
+
+  assert(2, ({ short x; sizeof(x); }), "short x; sizeof(x);");
+  assert(4, ({ struct {char a; short b;} x; sizeof(x); }), "struct {char a; short b;} x; sizeof(x);");
+
+  assert(8, ({ long x; sizeof(x); }), "long x; sizeof(x);");
+  assert(16, ({ struct {char a; long b;} x; sizeof(x); }), "struct {char a; long b} x; sizeof(x);");
+
+  assert(1, sub_short(7, 3, 3), "sub_short(7, 3, 3)");
+  assert(1, sub_long(7, 3, 3), "sub_long(7, 3, 3)");
+
+  assert(24, ({ int *x[3]; sizeof(x); }), "int *x[3]; sizeof(x);");
+  assert(8, ({ int (*x)[3]; sizeof(x); }), "int (*x)[3]; sizeof(x);");
+  assert(3, ({ int *x[3]; int y; x[0]=&y; y=3; x[0][0]; }), "int *x[3]; int y; x[0]=&y; y=3; x[0][0];");
+  assert(4, ({ int x[3]; int (*y)[3]=x; y[0][0]=4; y[0][0]; }), "int x[3]; int (*y)[3]=x; y[0][0]=4; y[0][0];");
+
+  assert(3, *g1_ptr(), "*g1_ptr()");
+  assert(7, static_fn(), "static_fn()");
+
+  assert(7, ({ struct {int x; int y;} a[4]; int i=2; a[i].x=3; a[i].y=4; a[i].x+a[i].y; }), "struct {int x; int y;} a[4]; int i=2; a[i].x=3; a[i].y=4; a[i].x+a[i].y;");
+  assert(11, ({ int a[4]; int i=1; a[1]=5; a[2]=6; int s=a[i]; i=2; s+a[i]; }), "int a[4]; int i=1; a[1]=5; a[2]=6; int s=a[i]; i=2; s+a[i];");
+  assert(12, ({ int x=1; int *p=&x; int y=x+x; *p=5; y+x+x; }), "int x=1; int *p=&x; int y=x+x; *p=5; y+x+x;");
+  assert(53, ({ g3=2; int y=g3*g3; static_fn(); y+g3*g3; }), "g3=2; int y=g3*g3; static_fn(); y+g3*g3;");
+  assert(3, ({ int i=1; int a[3]; a[0]=0; a[1]=1; a[2]=2; int s=a[i+1]; if (s) i=0; s+a[i+1]; }), "int i=1; int a[3]; a[0]=0; a[1]=1; a[2]=2; int s=a[i+1]; if (s) i=0; s+a[i+1];");
+
+  assert(150, ({ int n=5; int s=0; int i; for (i=0; i<n*2; i=i+1) s=s+n*3; s; }), "int n=5; int s=0; int i; for (i=0; i<n*2; i=i+1) s=s+n*3; s;");
+  assert(12, ({ g1=2; int s=0; int i=0; while (i<3) { s=s+g1*g1; i=i+1; } s; }), "g1=2; int s=0; int i=0; while (i<3) { s=s+g1*g1; i=i+1; } s;");
+  assert(12, ({ int x=1; int s=0; int i; for (i=0; i<3; i=i+1) { s=s+x*2; x=x+1; } s; }), "int x=1; int s=0; int i; for (i=0; i<3; i=i+1) { s=s+x*2; x=x+1; } s;");
+  assert(12, ({ int x=1; int *p=&x; int s=0; int i; for (i=0; i<3; i=i+1) { s=s+x*2; *p=*p+1; } s; }), "int x=1; int *p=&x; int s=0; int i; for (i=0; i<3; i=i+1) { s=s+x*2; *p=*p+1; } s;");
+  assert(6, ({ int n=2; int s=0; int i; int j; for (i=0; i<n+1; i=i+1) for (j=0; j<n; j=j+1) s=s+1; s; }), "int n=2; int s=0; int i; int j; for (i=0; i<n+1; i=i+1) for (j=0; j<n; j=j+1) s=s+1; s;");
+
+  assert(4510, ({ int i; int s=0; for (i=0; i<10; i=i+1) s=s+i; s*100+i; }), "int i; int s=0; for (i=0; i<10; i=i+1) s=s+i; s*100+i;");
+  assert(1206, ({ int i; int s=0; for (i=3; i<=5; i=i+1) s=s+i; s*100+i; }), "int i; int s=0; for (i=3; i<=5; i=i+1) s=s+i; s*100+i;");
+  assert(5, ({ int i=7; int s=0; for (i=5; i<2; i=i+1) s=s+1; s*100+i; }), "int i=7; int s=0; for (i=5; i<2; i=i+1) s=s+1; s*100+i;");
+
+  assert(132, ({ int a[10]; int b[10]; int c[10]; int i; for (i=0; i<10; i=i+1) { b[i]=i; c[i]=i*10; } for (i=0; i<10; i=i+1) a[i]=b[i]+c[i]; a[0]+a[3]+a[9]; }), "int a[10]; int b[10]; int c[10]; int i; for (i=0; i<10; i=i+1) { b[i]=i; c[i]=i*10; } for (i=0; i<10; i=i+1) a[i]=b[i]+c[i]; a[0]+a[3]+a[9];");
+  assert(-106, ({ char a[20]; char b[20]; int i; for (i=0; i<20; i=i+1) b[i]=i*10; for (i=0; i<20; i=i+1) a[i]=b[i]+100; a[5]; }), "char a[20]; char b[20]; int i; for (i=0; i<20; i=i+1) b[i]=i*10; for (i=0; i<20; i=i+1) a[i]=b[i]+100; a[5];");
+  assert(34, ({ char a[20]; char b[20]; int i; for (i=0; i<20; i=i+1) b[i]=i*10; for (i=0; i<20; i=i+1) a[i]=b[i]+100; a[19]; }), "char a[20]; char b[20]; int i; for (i=0; i<20; i=i+1) b[i]=i*10; for (i=0; i<20; i=i+1) a[i]=b[i]+100; a[19];");
+  assert(13, ({ short a[9]; short b[9]; int i; for (i=0; i<9; i=i+1) b[i]=i; for (i=0; i<=8; i=i+1) { a[i]=b[i]-1; b[i]=a[i]+a[i]; } a[8]+b[4]; }), "short a[9]; short b[9]; int i; for (i=0; i<9; i=i+1) b[i]=i; for (i=0; i<=8; i=i+1) { a[i]=b[i]-1; b[i]=a[i]+a[i]; } a[8]+b[4];");
+  assert(8, ({ long a[5]; long b[5]; int i; for (i=0; i<5; i=i+1) b[i]=i; for (i=0; i<5; i=i+1) a[i]=b[i]-3+b[i]; a[4]+a[3]; }), "long a[5]; long b[5]; int i; for (i=0; i<5; i=i+1) b[i]=i; for (i=0; i<5; i=i+1) a[i]=b[i]-3+b[i]; a[4]+a[3];");
+  assert(10, ({ int n=4; int i; for (i=0; i<n; i=i+1) g2[i]=i; for (i=0; i<n; i=i+1) g2[i]=g2[i]+1; g2[0]+g2[1]+g2[2]+g2[3]; }), "int n=4; int i; for (i=0; i<n; i=i+1) g2[i]=i; for (i=0; i<n; i=i+1) g2[i]=g2[i]+1; g2[0]+g2[1]+g2[2]+g2[3];");
+  assert(16, ({ int a[8]; char c[8]; int n=8; int i; int s=0; for (i=0; i<n; i=i+1) { a[i]=0; c[i]=0; } for (i=0; i<n; i=i+1) { a[i]=a[i]+1; c[i]=c[i]+1; } for (i=0; i<n; i=i+1) s=s+c[i]+a[i]; s; }), "int a[8]; char c[8]; int n=8; int i; int s=0; for (i=0; i<n; i=i+1) { a[i]=0; c[i]=0; } for (i=0; i<n; i=i+1) { a[i]=a[i]+1; c[i]=c[i]+1; } for (i=0; i<n; i=i+1) s=s+c[i]+a[i]; s;");
+
+  assert(7, ({ int a=3; int b=7; int x; if (a<b) x=b; else x=a; x; }), "int a=3; int b=7; int x; if (a<b) x=b; else x=a; x;");
+  assert(5, ({ int a=5; int x=2; if (a>x) x=a; x; }), "int a=5; int x=2; if (a>x) x=a; x;");
+  assert(2, ({ int a=5; int x=2; if (a<x) x=a; x; }), "int a=5; int x=2; if (a<x) x=a; x;");
+  assert(1, ({ int a=5; int x; if (a) x=1; else x=0; x; }), "int a=5; int x; if (a) x=1; else x=0; x;");
+  assert(1, ({ int a=0; int x; if (a) { x=0; } else { x=1; } x; }), "int a=0; int x; if (a) { x=0; } else { x=1; } x;");
+  assert(9, ({ int i; int m=0; for (i=0; i<10; i=i+1) { if (i>m) m=i; } m; }), "int i; int m=0; for (i=0; i<10; i=i+1) { if (i>m) m=i; } m;");
+  assert(3, ({ int a=1; int b=0; int x=3; if (b) x=a/b; x; }), "int a=1; int b=0; int x=3; if (b) x=a/b; x;");
+
+  assert(-2147483648, ({ int x=2147483647; x+1; }), "int x=2147483647; x+1;");
+  assert(2147483648, ({ long x=2147483647; x+1; }), "long x=2147483647; x+1;");
+  assert(128, ({ char x=127; x+1; }), "char x=127; x+1;");
+  assert(44, ({ (char)300; }), "(char)300;");
+  assert(1, ({ (short)65537; }), "(short)65537;");
+  assert(1, ({ (long)(int)4294967297; }), "(long)(int)4294967297;");
+  assert(-1, ({ int x=-1; long y=x; y; }), "int x=-1; long y=x; y;");
+  assert(1, ({ long x=4294967296; int y=0; y<x; }), "long x=4294967296; int y=0; y<x;");
+  assert(-2, ({ int x=-5; x/2; }), "int x=-5; x/2;");
+  assert(5, ({ int a[3]; int *p=a+2; int i=-1; *(p+i)=5; a[1]; }), "int a[3]; int *p=a+2; int i=-1; *(p+i)=5; a[1];");
+
+  assert(8, ({ struct t {int a; int b;} x; struct t y; x.a=3; x.b=5; y=x; y.a+y.b; }), "struct t {int a; int b;} x; struct t y; x.a=3; x.b=5; y=x; y.a+y.b;");
+  assert(9, ({ struct t {int a[5]; char b;} x; struct t y; x.a[4]=4; x.b=5; y=x; y.a[4]+y.b; }), "struct t {int a[5]; char b;} x; struct t y; x.a[4]=4; x.b=5; y=x; y.a[4]+y.b;");
+  assert(9, ({ struct t {char a[300];} x; struct t y; x.a[0]=2; x.a[299]=7; y=x; y.a[0]+y.a[299]; }), "struct t {char a[300];} x; struct t y; x.a[0]=2; x.a[299]=7; y=x; y.a[0]+y.a[299];");
+  assert(3, ({ struct t {int a;} x[2]; x[0].a=3; x[1]=x[0]; x[1].a; }), "struct t {int a;} x[2]; x[0].a=3; x[1]=x[0]; x[1].a;");
+  assert(12, ({ char a[10]; char b[10]; int i; for (i=0; i<10; i=i+1) a[i]=i; memcpy(b, a, 10); b[9]+b[3]; }), "char a[10]; char b[10]; int i; for (i=0; i<10; i=i+1) a[i]=i; memcpy(b, a, 10); b[9]+b[3];");
+  assert(5, ({ char a[4]; char b[4]; a[0]=5; *(char *)memcpy(b, a, 4); }), "char a[4]; char b[4]; a[0]=5; *(char *)memcpy(b, a, 4);");
+  assert(16843009, ({ int a[5]; memset(a, 1, 20); a[4]; }), "int a[5]; memset(a, 1, 20); a[4];");
+  assert(6, ({ char a[400]; memset(a, 3, 400); a[0]+a[399]; }), "char a[400]; memset(a, 3, 400); a[0]+a[399];");
+  assert(7, ({ int n=3; char a[3]; a[2]=0; memset(a, 7, n); a[2]; }), "int n=3; char a[3]; a[2]=0; memset(a, 7, n); a[2];");
+
+  assert(20, ({ int x=2; int y=0; switch (x) { case 1: y=10; break; case 2: y=20; break; default: y=30; } y; }), "int x=2; int y=0; switch (x) { case 1: y=10; break; case 2: y=20; break; default: y=30; } y;");
+  assert(30, ({ int x=5; int y=0; switch (x) { case 1: y=10; break; case 2: y=20; break; default: y=30; } y; }), "int x=5; int y=0; switch (x) { case 1: y=10; break; case 2: y=20; break; default: y=30; } y;");
+  assert(3, ({ int x=1; int y=0; switch (x) { case 1: y=y+1; case 2: y=y+2; break; case 3: y=y+4; } y; }), "int x=1; int y=0; switch (x) { case 1: y=y+1; case 2: y=y+2; break; case 3: y=y+4; } y;");
+  assert(7, ({ int y=7; switch (3) { case 1: y=1; } y; }), "int y=7; switch (3) { case 1: y=1; } y;");
+  assert(2, ({ char c=65; int y=0; switch (c) { case 64+1: y=2; break; case 66: y=3; } y; }), "char c=65; int y=0; switch (c) { case 64+1: y=2; break; case 66: y=3; } y;");
+  assert(5, ({ int i=0; while (1) { i=i+1; if (i==5) break; } i; }), "int i=0; while (1) { i=i+1; if (i==5) break; } i;");
+  assert(3, ({ int i; for (i=0; i<10; i=i+1) if (i==3) break; i; }), "int i; for (i=0; i<10; i=i+1) if (i==3) break; i;");
+  assert(11, ({ int i; int s=0; for (i=0; i<5; i=i+1) { switch (i) { case 1: s=s+1; break; case 3: s=s+10; break; } } s; }), "int i; int s=0; for (i=0; i<5; i=i+1) { switch (i) { case 1: s=s+1; break; case 3: s=s+10; break; } } s;");
+  assert(10, sw_table(0), "sw_table(0)");
+  assert(14, sw_table(4), "sw_table(4)");
+  assert(-1, sw_table(3), "sw_table(3)");
+  assert(-1, sw_table(6), "sw_table(6)");
+  assert(-1, sw_table(-1), "sw_table(-1)");
+  assert(1, sw_tree(-100), "sw_tree(-100)");
+  assert(4, sw_tree(1000), "sw_tree(1000)");
+  assert(6, sw_tree(5000000000), "sw_tree(5000000000)");
+  assert(0, sw_tree(4), "sw_tree(4)");
+
+  assert(1, ({ 1 && 2; }), "1 && 2;");
+  assert(0, ({ 1 && 0; }), "1 && 0;");
+  assert(1, ({ 0 || 3; }), "0 || 3;");
+  assert(0, ({ 0 || 0; }), "0 || 0;");
+  assert(1, ({ !0; }), "!0;");
+  assert(0, ({ !5; }), "!5;");
+  assert(1, ({ long x=4294967296; !!x; }), "long x=4294967296; !!x;");
+  assert(3, ({ int x=3; 0 && (x=5); x; }), "int x=3; 0 && (x=5); x;");
+  assert(3, ({ int x=3; 1 || (x=5); x; }), "int x=3; 1 || (x=5); x;");
+  assert(5, ({ int x=3; 1 && (x=5); x; }), "int x=3; 1 && (x=5); x;");
+  assert(2, ({ int x=1; int y=2; if (x==1 && y==2) x=2; else x=3; x; }), "int x=1; int y=2; if (x==1 && y==2) x=2; else x=3; x;");
+  assert(7, ({ int x=0; int y=0; if (!(x || y)) x=7; x; }), "int x=0; int y=0; if (!(x || y)) x=7; x;");
+  assert(4, ({ int i=0; while (i<10 && !(i==4)) i=i+1; i; }), "int i=0; while (i<10 && !(i==4)) i=i+1; i;");
+  assert(2, ({ int a=1; int b=0; int c=a+b; b && (c=a+b+5); a+b+1; }), "int a=1; int b=0; int c=a+b; b && (c=a+b+5); a+b+1;");
+
+  assert(7, ({ int i=2; i+=5; i; }), "int i=2; i+=5; i;");
+  assert(7, ({ int i=2; i+=5; }), "int i=2; i+=5;");
+  assert(3, ({ int i=5; i-=2; i; }), "int i=5; i-=2; i;");
+  assert(6, ({ int i=3; i*=2; i; }), "int i=3; i*=2; i;");
+  assert(3, ({ int i=7; i/=2; i; }), "int i=7; i/=2; i;");
+  assert(3, ({ int i=2; ++i; }), "int i=2; ++i;");
+  assert(1, ({ int i=2; --i; }), "int i=2; --i;");
+  assert(2, ({ int i=2; i++; }), "int i=2; i++;");
+  assert(2, ({ int i=2; i--; }), "int i=2; i--;");
+  assert(3, ({ int i=2; i++; i; }), "int i=2; i++; i;");
+  assert(1, ({ int i=2; i--; i; }), "int i=2; i--; i;");
+  assert(5, ({ int a[3]; a[0]=1; a[1]=3; a[2]=5; int *p=a; p+=2; *p; }), "int a[3]; a[0]=1; a[1]=3; a[2]=5; int *p=a; p+=2; *p;");
+  assert(3, ({ int a[3]; a[0]=1; a[1]=3; a[2]=5; int *p=a; p++; *p; }), "int a[3]; a[0]=1; a[1]=3; a[2]=5; int *p=a; p++; *p;");
+  assert(1, ({ int a[3]; a[0]=1; a[1]=3; a[2]=5; int *p=a+1; *p--; *p; }), "int a[3]; a[0]=1; a[1]=3; a[2]=5; int *p=a+1; *p--; *p;");
+  assert(4, ({ int a[2]; a[1]=3; a[1]++; a[1]; }), "int a[2]; a[1]=3; a[1]++; a[1];");
+  assert(-128, ({ char c=127; c+=1; c; }), "char c=127; c+=1; c;");
+  assert(0, ({ int x=10; x/=4294967298; x; }), "int x=10; x/=4294967298; x;");
+  assert(4294967296, ({ long x=2147483648; x*=2; x; }), "long x=2147483648; x*=2; x;");
+  assert(45, ({ int i; int s=0; for (i=0; i<10; i++) s+=i; s; }), "int i; int s=0; for (i=0; i<10; i++) s+=i; s;");
+  assert(45, ({ int i; int s=0; for (i=0; i<10; ++i) s+=i; s; }), "int i; int s=0; for (i=0; i<10; ++i) s+=i; s;");
+  assert(1, ({ _Bool b=0; b++; b; }), "_Bool b=0; b++; b;");
+  assert(1, ({ _Bool b=0; b--; b; }), "_Bool b=0; b--; b;");
+
+  assert(5, ({ ext_var; }), "ext_var;");
+  assert(7, ({ ext_var=7; ext_var; }), "ext_var=7; ext_var;");
+  assert(8, ({ ext_var++; ext_var; }), "ext_var++; ext_var;");
+  assert(3, ({ int *p=&ext_var; *p=3; ext_var; }), "int *p=&ext_var; *p=3; ext_var;");
+
+  assert(3, ({ int x=3; while (0) x=2; x; }), "int x=3; while (0) x=2; x;");
+  assert(3, ({ int x=3; for (x=3; 0;) x=2; x; }), "int x=3; for (x=3; 0;) x=2; x;");
+
+  { void *x; }
+
+  assert(0, ({ _Bool x=0; x; }), "_Bool x=0; x;");
+  assert(1, ({ _Bool x=1; x; }), "_Bool x=1; x;");
+  assert(1, ({ _Bool x=2; x; }), "_Bool x=2; x;");
+
+  assert(8, ({ long long x; sizeof(x); }), "long long x; sizeof(x);");
+
+  assert(1, ({ char x; sizeof(x); }), "char x; sizeof(x);");
+  assert(2, ({ short int x; sizeof(x); }), "short int x; sizeof(x);");
+  assert(2, ({ int short x; sizeof(x); }), "int short x; sizeof(x);");
+  assert(4, ({ int x; sizeof(x); }), "int x; sizeof(x);");
+  assert(4, ({ typedef t; t x; sizeof(x); }), "typedef t; t x; sizeof(x);");
+  assert(4, ({ typedef typedef t; t x; sizeof(x); }), "typedef typedef t; t x; sizeof(x);");
+  assert(8, ({ long int x; sizeof(x); }), "long int x; sizeof(x);");
+  assert(8, ({ int long x; sizeof(x); }), "int long x; sizeof(x);");
+  assert(8, ({ long long x; sizeof(x); }), "long long x; sizeof(x);");
+  assert(8, ({ long int long x; sizeof(x); }), "long int long x; sizeof(x);");
+
+  assert(3, ({ MyInt x=3; x; }), "MyInt x=3; x;");
+
+  assert(1, sizeof(char), "sizeof(char)");
+  assert(2, sizeof(short), "sizeof(short)");
+  assert(2, sizeof(short int), "sizeof(short int)");
+  assert(2, sizeof(int short), "sizeof(int short)");
+  assert(4, sizeof(int), "sizeof(int)");
+  assert(8, sizeof(long), "sizeof(long)");
+  assert(8, sizeof(long int), "sizeof(long int)");
+  assert(8, sizeof(long int), "sizeof(long int)");
+  assert(8, sizeof(char *), "sizeof(char *)");
+  assert(8, sizeof(int *), "sizeof(int *)");
+  assert(8, sizeof(long *), "sizeof(long *)");
+  assert(8, sizeof(int **), "sizeof(int **)");
+  assert(8, sizeof(int(*)[4]), "sizeof(int(*)[4])");
+  assert(32, sizeof(int*[4]), "sizeof(int(*)[4])");
+  assert(16, sizeof(int[4]), "sizeof(int[4])");
+  assert(48, sizeof(int[3][4]), "sizeof(int[3][4])");
+  assert(8, sizeof(struct {int a; int b;}), "sizeof(struct {int a; int b;})");
+
+  assert(131585, (int)8590066177, "(int)8590066177");
+  assert(513, (short)8590066177, "(short)8590066177");
+  assert(1, (char)8590066177, "(char)8590066177");
+  assert(1, (_Bool)1, "(_Bool)1");
+  assert(1, (_Bool)2, "(_Bool)2");
+  assert(0, (_Bool)(char)256, "(_Bool)(char)256");
+  assert(1, (long)1, "(long)1");
+  assert(0, (long)&*(int *)0, "(long)&*(int *)0");
+  assert(5, ({ int x=5; long y=(long)&x; *(int*)y; }), "int x=5; long y=(long)&x; *(int*)y");
+
+  assert(97, 'a', "'a'");
+  assert(10, '\n', "\'\\n\'");
+
+  assert(0, ({ enum { zero, one, two }; zero; }), "enum { zero, one, two }; zero;");
+  assert(1, ({ enum { zero, one, two }; one; }), "enum { zero, one, two }; one;");
+  assert(2, ({ enum { zero, one, two }; two; }), "enum { zero, one, two }; two;");
+  assert(5, ({ enum { five=5, six, seven }; five; }), "enum { five=5, six, seven }; five;");
+  assert(6, ({ enum { five=5, six, seven }; six; }), "enum { five=5, six, seven }; six;");
+  assert(0, ({ enum { zero, five=5, three=3, four }; zero; }), "enum { zero, five=5, three=3, four }; zero;");
+  assert(5, ({ enum { zero, five=5, three=3, four }; five; }), "enum { zero, five=5, three=3, four }; five;");
+  assert(3, ({ enum { zero, five=5, three=3, four }; three; }), "enum { zero, five=5, three=3, four }; three;");
+  assert(4, ({ enum { zero, five=5, three=3, four }; four; }), "enum { zero, five=5, three=3, four }; four;");
+  assert(4, ({ enum { zero, one, two } x; sizeof(x); }), "enum { zero, one, two } x; sizeof(x);");
+  assert(4, ({ enum t { zero, one, two }; enum t y; sizeof(y); }), "enum t { zero, one, two }; enum t y; sizeof(y);");
+
+  printf("OK\n");
+  return 0;
+}
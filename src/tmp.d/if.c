@@ -0,0 +1,2 @@
+int g; int f(int c) { if (c) g = 3; return g; }
+int h(int c) { int x = 1; if (c) x = 3; return x; }
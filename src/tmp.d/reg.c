@@ -0,0 +1 @@
+int rax; int eax; int rip; int main() { rax = 5; eax = 2; rip = 1; return rax + eax + rip - 8; }
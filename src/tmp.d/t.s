@@ -0,0 +1,6 @@
+  .intel_syntax noprefix
+  mov r8b, 1
+  mov r9w, 300
+  mov sil, 2
+  mov r8d, 5
+  mov dil, -1
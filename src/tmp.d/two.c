@@ -0,0 +1 @@
+int two() { return 2; }
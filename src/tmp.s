@@ -0,0 +1,18495 @@
+.intel_syntax noprefix
+.section .note.GNU-stack,"",@progbits
+.bss
+.align 4
+g3:
+  .zero 4
+.global g2
+.align 4
+g2:
+  .zero 16
+.global g1
+.align 4
+g1:
+  .zero 4
+.section .rodata.str1.1,"aMS",@progbits,1
+.L.str.0a6361b3a802f55cd5ae06101c88a1e2:
+  .string "\007"
+.L.str.e545d395bb3fd971f91bf9a2b6722831:
+  .string "\010"
+.L.str.a2c4aed1cf757cd9a509734a267ffc7b:
+  .string "\011"
+.L.str.c9a18416659e4d3a4f61d143a1830006:
+  .string "OK\012"
+.L.str.58e899820eb2bb633abdc6c2fb0198cd:
+  .string "%s => %ld\012"
+.L.str.0a4112fdee08ab4b4cd8372912b1dc8b:
+  .string "%s => %ld expected but got %ld\012"
+.L.str.cbe2268747c9c8072c7f9926f2288f27:
+  .string "\013"
+.L.str.bf60e4349cace6bce0d552e8d783428d:
+  .string "\014"
+.L.str.f566cc6fccc657365c0197accf3a7d6f:
+  .string "\015"
+.L.str.3a898eecdae167231275338e9a79153c:
+  .string "\033"
+.L.str.70e35361cbf0b60185df2503323ed403:
+  .string "\"ab\" == \"abc\""
+.L.str.e0c43d15dfd0e14e77e95f9611705623:
+  .string "\"abc\" == \"abc\""
+.L.str.c4a22671064cce89ee32bf8bdf13314f:
+  .string "'a'"
+.L.str.3de678646d93ee7f0fd1281fba18dae2:
+  .string "'\\n'"
+.L.str.e18b38e1466002daccb8f5b1ed6be2c9:
+  .string "sizeof(\"a\\0b\")"
+.L.str.8cd9748cec1a44f7a75a948210fc5a20:
+  .string "sizeof(\"abc\")"
+.L.str.f6604ce205c71b65a05e3100341285c0:
+  .string "static_fn()"
+.L.str.bba2aa78ed52cdb4702a51bffb810f08:
+  .string "*g1_ptr()"
+.L.str.7ef3ceda88b6d082b0b5905e789197d1:
+  .string "sizeof(long *)"
+.L.str.e76a2f0cd71fdd2b88fa8c4e6a7b000c:
+  .string "sizeof(char *)"
+.L.str.844e3762e9972cbf82858d282ab9544d:
+  .string "sizeof(int *)"
+.L.str.2d263ea17f5ed81941975c3b4aec3ac4:
+  .string "sizeof(int **)"
+.L.str.07d6a034c7efe7208fdb3651377be5b3:
+  .string "sw_table(0)"
+.L.str.cc4acc45810fd1534a8c3f6713a305a7:
+  .string "sw_tree(5000000000)"
+.L.str.aefc6e4b174275b901e05989b2b5566b:
+  .string "sw_tree(1000)"
+.L.str.96c788cc5295b8dd16c49fce5ffaa0e0:
+  .string "sw_tree(-100)"
+.L.str.56897484e029024c6e5a29819e7b4253:
+  .string "sw_table(-1)"
+.L.str.40f6a06b70025d2a4ed581d07e7ff09e:
+  .string "sizeof(g1)"
+.L.str.934bb6ee7615f4206af8281fb86601a3:
+  .string "sizeof(g2)"
+.L.str.6e7f905b8190262ec3236a38a4297d1a:
+  .string "sub_long(7, 3, 3)"
+.L.str.3a0bb40f16ca50b7ed4ef9cdde9b0d60:
+  .string "sub_char(7, 3, 3)"
+.L.str.1288342e2d207955aae6e1eed432f46e:
+  .string "sub_short(7, 3, 3)"
+.L.str.361299b437ea35ea596c88c255284413:
+  .string "sub(5, 3)"
+.L.str.d43362f44313dd005ad4a49e11deb8b8:
+  .string "sw_table(3)"
+.L.str.0aa1a4c0edab0c3832a732cf1dd689d1:
+  .string "sw_tree(4)"
+.L.str.96dd762ee00d8c06920263734d27ad7b:
+  .string "sw_table(4)"
+.L.str.4ce85ab491bc036a98906f17f2daa4f5:
+  .string "add(3, 5)"
+.L.str.02658df46c23a06bdcebe845d02ab136:
+  .string "sw_table(6)"
+.L.str.55ba8a5d7c6a552653e49083486e9644:
+  .string "add6(1,2,3,4,5,6)"
+.L.str.5818e50f62f73ecc350c657e16fa73a9:
+  .string "fib(9)"
+.L.str.6a0455dc011cc0ad76ba920292de017a:
+  .string "sizeof(int(*)[4])"
+.L.str.df8ffa80c3534702da83b5b11cbf24df:
+  .string "sizeof(int[3][4])"
+.L.str.6556dda1315f084c09eafc8757fc8d97:
+  .string "sizeof(int[4])"
+.L.str.029591dc2e1ed78a5ea73ea7dd426cee:
+  .string "sizeof(long)"
+.L.str.28a9586c5eb89e7dc0341c4a34b80381:
+  .string "sizeof(char)"
+.L.str.f0347494906049277393903f0fe3ec80:
+  .string "sizeof(long int)"
+.L.str.8106660d799d6b2d424204074b734ce4:
+  .string "sizeof(short int)"
+.L.str.33fce0a8c77e7651cc8e955585fbf538:
+  .string "sizeof(int)"
+.L.str.9d5087796ea9aa4e5509249d9c10ab03:
+  .string "sizeof(int short)"
+.L.str.055a5294750582ce3e25a649529c81b7:
+  .string "sizeof(short)"
+.L.str.78aa51470699b0d15abc5c6c315449d9:
+  .string "sizeof(struct {int a; int b;})"
+.L.str.e5bfb1ad6d144f304448700a2a7fd7c5:
+  .string "(long)&*(int *)0"
+.L.str.ba2f6b47bb1847ba8d29b360f915215d:
+  .string "\"bc\" == \"abc\" + 1"
+.L.str.812dd478527b978d9f6b99070372bc0c:
+  .string "(long)1"
+.L.str.8311e6343bbedd4860bff1037e2622c5:
+  .string "(_Bool)1"
+.L.str.78f7a87c4c5daf4c19343c5c1fd9cc70:
+  .string "g1"
+.L.str.795f22f7de2dfb656de56611668e7e20:
+  .string "(_Bool)2"
+.L.str.0a93f3a2970ffb7e2a4992181f8a8769:
+  .string "(_Bool)(char)256"
+.L.str.a72110c33c03a0ce5d6bffc7cf5f9d4d:
+  .string "(char)8590066177"
+.L.str.2adeb3104c2d0fbf11e458a655ac05be:
+  .string "(int)8590066177"
+.L.str.99d195a0d8aee13f5fa1d8d987244381:
+  .string "(short)8590066177"
+.L.str.7cd84d2196ed561abc671a13ce6dc670:
+  .string "ret3();"
+.L.str.14f76637ecac0973537e479e9d3e1063:
+  .string "int x[3][4]; sizeof(**x + 1);"
+.L.str.ede1ae0e8c76aadd7c4a616ee179a317:
+  .string "int x[2][3]; int *y=x; *(y+4)=4; *(*(x+1)+1);"
+.L.str.a5d2f94210f047d632dce5aa13864b18:
+  .string "int x=3; int y=5; *(&x+1);"
+.L.str.8eb202b03eb5cd343adbc8ddd2bceddb:
+  .string "int x[3]; *x=3; *(x+1)=4; *(x+2)=5; *(x+1);"
+.L.str.7066b31f553ec0c777e897cc400ac3b9:
+  .string "int x[3]; *x=3; x[1]=4; x[2]=5; *(x+1);"
+.L.str.aae2ec9af712a7cb78c1d09b7eafbc49:
+  .string "int x[2][3]; int *y=x; *(y+3)=3; **(x+1);"
+.L.str.948b65c1111aaa4a0491c09098af0df9:
+  .string "int x[2][3]; int *y=x; *(y+1)=1; *(*x+1);"
+.L.str.7d95455daa5756d0614d4a9928e03fbb:
+  .string "int x=3; int y=5; int *z=&x; *(z+1);"
+.L.str.b77658b504f8ec778c1a41f77dfe425e:
+  .string "int x=3; int y=5; *(&y-1);"
+.L.str.2beefd8a3844bc53073d28faa439d9f6:
+  .string "int x=3; int y=5; int *z=&y; *(z-1);"
+.L.str.1e006430081a28c9f4649c21413e9ad4:
+  .string "int x[2][3]; int *y=x; *(y+5)=5; *(*(x+1)+2);"
+.L.str.a3d0f5f3545cf9418b878c26f0dd3d65:
+  .string "int x[3]; *x=3; *(x+1)=4; *(x+2)=5; *(x+2);"
+.L.str.be757aa6f3fa3b72d89b1291defce435:
+  .string "int x[3]; *x=3; x[1]=4; x[2]=5; *(x+2);"
+.L.str.dccb622995e25f906fc70391bda522fa:
+  .string "int x[3]; *x=3; x[1]=4; 2[x]=5; *(x+2);"
+.L.str.d8efff27b652783840595a45782baffd:
+  .string "int x[2][3]; int *y=x; *(y+6)=6; **(x+2);"
+.L.str.c618da2f2f8b0a248f18b170b22e51af:
+  .string "int x[2][3]; int *y=x; *(y+2)=2; *(*x+2);"
+.L.str.fd22ff0f026a088e842a9bc7ea20df88:
+  .string "char a[4]; char b[4]; a[0]=5; *(char *)memcpy(b, a, 4);"
+.L.str.504f61c3af9a0a7fe6fa14bef91a6f7c:
+  .string "int x=3; int y=5; *(1+&x);"
+.L.str.559a732f64fa716cc2684bef03318d04:
+  .string "char x[10]; sizeof(x);"
+.L.str.e37f1f517327142def5b1de539d8e9b2:
+  .string "int (*x)[3]; sizeof(x);"
+.L.str.630ffa999740fb875555f0a785de50d1:
+  .string "int *x[3]; sizeof(x);"
+.L.str.053adfe07d14d4276873bb2acdb72831:
+  .string "int x[3][4]; sizeof(x);"
+.L.str.6c1bb7b0f5c95edeab56f0dd347fb173:
+  .string "int x[4]; sizeof(x);"
+.L.str.cb384dac3f81a4c4cfd9469289565fbf:
+  .string "struct {int a;} x[4]; sizeof(x);"
+.L.str.7ae900c7015cac9e2ad803c2e23112b7:
+  .string "long long x; sizeof(x);"
+.L.str.9b72946ba14451ef88bed149bfea9da5:
+  .string "long int long x; sizeof(x);"
+.L.str.77f136a7fde31280ec22f06a60f71b10:
+  .string "char x; sizeof(x);"
+.L.str.90963e0f34119cf766492c04fc6a1bb3:
+  .string "typedef typedef t; t x; sizeof(x);"
+.L.str.617e6589d50834f26595c3ec227728a6:
+  .string "long int x; sizeof(x);"
+.L.str.7117d3914679e49707e6868bf8582f89:
+  .string "short int x; sizeof(x);"
+.L.str.49bfec0c1029b910014f410d0d65191b:
+  .string "int short x; sizeof(x);"
+.L.str.546756f578f12c00689b89cf87c05d54:
+  .string "enum { zero, one, two } x; sizeof(x);"
+.L.str.74a17cf3ae565bb9cbb89c8eb47b69d4:
+  .string "struct {int a[3];} x; sizeof(x);"
+.L.str.b2dfb8603a713fb0943317444e57bdcc:
+  .string "struct {int a;} x; sizeof(x);"
+.L.str.ceb510d574129dba93341f178196892c:
+  .string "struct {char a; char b;} x; sizeof(x);"
+.L.str.b942e8437183a901094ace367989f693:
+  .string "struct {int a; char b;} x; sizeof(x);"
+.L.str.ccab97874c0fae89548a3ce990545d57:
+  .string "struct {char a; int b;} x; sizeof(x);"
+.L.str.5cc5175a151e1fc8497e10391a80200e:
+  .string "struct {int a; int b;} x; sizeof(x);"
+.L.str.5640cee72193a937193042f65ed602b1:
+  .string "struct {char a; short b;} x; sizeof(x);"
+.L.str.380fa6aa90ca1ac7ffcb39908436a4ca:
+  .string "struct {char a; long b} x; sizeof(x);"
+.L.str.670a5a10b5f42563a3b9e166465c9caa:
+  .string "int *x; sizeof(x);"
+.L.str.eaaac6722f3df068a83d12270e18e7cf:
+  .string "int x[3][4]; sizeof(*x);"
+.L.str.132adee116a7cc705269392ffa916fbb:
+  .string "int x[3][4]; sizeof(**x);"
+.L.str.a806fd3f4323667eef46dc3542347e8d:
+  .string "int x=3; int y=5; addx(&x, y);"
+.L.str.cdfa864dc21a45f7e07299625170454d:
+  .string "enum t { zero, one, two }; enum t y; sizeof(y);"
+.L.str.8ec4790dc17a9313b23e8ff48e75ecaf:
+  .string "struct t {int a; int b;} x; struct t y; sizeof(y);"
+.L.str.bc1b424690b1c416826e7bc0c891ec34:
+  .string "struct t {int a; int b;}; struct t y; sizeof(y);"
+.L.str.ae5ddb315dafbc2b1627ddb43c955168:
+  .string "struct t {char a[2];}; { struct t {char a[4];}; } struct t y; sizeof(y);"
+.L.str.2ec2c60e7cd52148882b3c2cf9cab606:
+  .string "int i=2; i++;"
+.L.str.ae3ec36ff434da4a426dc1ed7cba449a:
+  .string "int i=2; i--;"
+.L.str.d9cf41a1fedd26a415d3a2e118673e82:
+  .string "1 && 0;"
+.L.str.69f6e030807cdded136b14c612040526:
+  .string "0 || 0;"
+.L.str.8f3f8d704d3f114510b565888f789c60:
+  .string "!0;"
+.L.str.0b0e039af7d1d6110e72ac64d94efb50:
+  .string "(char)300;"
+.L.str.7547a64f7cee5cc9c8a9a92ae841109f:
+  .string "int x[3][4]; sizeof(**x) + 1;"
+.L.str.8013586ef7e14ab66a260d4038b7237c:
+  .string "int x[3][4]; sizeof **x + 1;"
+.L.str.2194c1406d212fcb39d6beb8b59b4969:
+  .string "int a=1; int b=0; int c=a+b; b && (c=a+b+5); a+b+1;"
+.L.str.ab2f494056d8e51c9dbfc627ab979616:
+  .string "char x=127; x+1;"
+.L.str.42447ebf4263d5a59635f7c685ad91fd:
+  .string "long x=2147483647; x+1;"
+.L.str.f63b0eef10cc4cd418b373fde820791d:
+  .string "int x=2147483647; x+1;"
+.L.str.0439e281a0237c277fd73a193fb2d700:
+  .string "1 && 2;"
+.L.str.60e57a4a86af9ef0cd7a95c5d583fdb6:
+  .string "int x=-5; x/2;"
+.L.str.f32913c22e03f796e2a28cf87fb9e0c2:
+  .string "0 || 3;"
+.L.str.9005bd0b82bc0465f6658d80ea5cd425:
+  .string "1; {2;} 3;"
+.L.str.84869a8fb29d643602633b0154e6f655:
+  .string "g3=2; int y=g3*g3; static_fn(); y+g3*g3;"
+.L.str.7d6f51b10af20c6be216aacae0e62e04:
+  .string "!5;"
+.L.str.fef02e81ed9483c1e09932a9e6acc77a:
+  .string "int i=2; i+=5;"
+.L.str.1364f1039e429537e5896057779547cb:
+  .string "(short)65537;"
+.L.str.8e59a56bf2942c667e70d36080367eb5:
+  .string "(long)(int)4294967297;"
+.L.str.77e5d980ce9e7f9f6f9895ba77817f9d:
+  .string "int x[2][3]; int *y=x; y[0]=0; x[0][0];"
+.L.str.1ff94e56bc2792c27a14e93fec517be4:
+  .string "int *x[3]; int y; x[0]=&y; y=3; x[0][0];"
+.L.str.8870628f75608238cb3bec22d6e348f3:
+  .string "int x[3]; int (*y)[3]=x; y[0][0]=4; y[0][0];"
+.L.str.26937f9f5d4bb71a9697e89bf7bcbadd:
+  .string "int x[2][3]; int *y=x; y[3]=3; x[1][0];"
+.L.str.9245a90f48ce428b976545a20b7c6eff:
+  .string "int x[2][3]; int *y=x; y[6]=6; x[2][0];"
+.L.str.35bd72117d2a9135fe98484ad9f5e053:
+  .string "struct {int a[3]; int b[5];} x; int *p=&x; x.a[0]=6; p[0];"
+.L.str.0a367bad0cd891293295141a4be153f7:
+  .string "int i=1; int a[3]; a[0]=0; a[1]=1; a[2]=2; int s=a[i+1]; if (s) i=0; s+a[i+1];"
+.L.str.a5a20aaa47519462e05d1c2297c589bb:
+  .string "int x[2][3]; int *y=x; y[1]=1; x[0][1];"
+.L.str.20f6f5e3c033b48cc95d705144172478:
+  .string "int x[2][3]; int *y=x; y[4]=4; x[1][1];"
+.L.str.35b13059603584f4d370b8e902e9dab6:
+  .string "int a[2]; a[1]=3; a[1]++; a[1];"
+.L.str.367b0e2878f49f8d78c0f009ac5f5c0b:
+  .string "int a[3]; int *p=a+2; int i=-1; *(p+i)=5; a[1];"
+.L.str.f2ac7e545a87cd6ca4ef6a07f2101cae:
+  .string "int x[2][3]; int *y=x; y[2]=2; x[0][2];"
+.L.str.23d1d9b9706b603a07488bf7e9a7d5f2:
+  .string "int x[2][3]; int *y=x; y[5]=5; x[1][2];"
+.L.str.6ef231a5df07ca32990399fb5d267e57:
+  .string "int n=3; char a[3]; a[2]=0; memset(a, 7, n); a[2];"
+.L.str.601efb1f3533e72417beeda539a6eb65:
+  .string "int n=4; int i; for (i=0; i<n; i=i+1) g2[i]=i; for (i=0; i<n; i=i+1) g2[i]=g2[i]+1; g2[0]+g2[1]+g2[2]+g2[3];"
+.L.str.eefa5e8b7d4c6b5ec58ba2870a4e6d3f:
+  .string "long a[5]; long b[5]; int i; for (i=0; i<5; i=i+1) b[i]=i; for (i=0; i<5; i=i+1) a[i]=b[i]-3+b[i]; a[4]+a[3];"
+.L.str.82f5864ae0d571aca73671817b1a1146:
+  .string "char a[10]; char b[10]; int i; for (i=0; i<10; i=i+1) a[i]=i; memcpy(b, a, 10); b[9]+b[3];"
+.L.str.20959ab29c5e9aa28405cdc580398bf6:
+  .string "struct {int a[3]; int b[5];} x; int *p=&x; x.b[0]=7; p[3];"
+.L.str.0e82adfb184161ebc70ca21d40785f57:
+  .string "int a[5]; memset(a, 1, 20); a[4];"
+.L.str.688d27d3ddbdc176353ec722d7c4b9d5:
+  .string "short a[9]; short b[9]; int i; for (i=0; i<9; i=i+1) b[i]=i; for (i=0; i<=8; i=i+1) { a[i]=b[i]-1; b[i]=a[i]+a[i]; } a[8]+b[4];"
+.L.str.46deca2b6ca9f86748b0bfa4a21bf952:
+  .string "char a[20]; char b[20]; int i; for (i=0; i<20; i=i+1) b[i]=i*10; for (i=0; i<20; i=i+1) a[i]=b[i]+100; a[5];"
+.L.str.ba8d8ca6314e49082f2c9bcebae89db1:
+  .string "char a[20]; char b[20]; int i; for (i=0; i<20; i=i+1) b[i]=i*10; for (i=0; i<20; i=i+1) a[i]=b[i]+100; a[19];"
+.L.str.506d01b15b2dc27689c706605050c8a4:
+  .string "struct t {char a[300];} x; struct t y; x.a[0]=2; x.a[299]=7; y=x; y.a[0]+y.a[299];"
+.L.str.ea54d4381fb3b555b57cd6ef2e6fd77f:
+  .string "char a[400]; memset(a, 3, 400); a[0]+a[399];"
+.L.str.61186092a7140c82fae61a46a9af3a78:
+  .string "int a[10]; int b[10]; int c[10]; int i; for (i=0; i<10; i=i+1) { b[i]=i; c[i]=i*10; } for (i=0; i<10; i=i+1) a[i]=b[i]+c[i]; a[0]+a[3]+a[9];"
+.L.str.267f4873cb4f97438cca6b5bc46c26d9:
+  .string "int a[4]; int i=1; a[1]=5; a[2]=6; int s=a[i]; i=2; s+a[i];"
+.L.str.eb02cf4f0fa671eec10df2107fcbc4e1:
+  .string "int a; a=3; a;"
+.L.str.bff07e4475e7c91e28220e9c22a39953:
+  .string "int a=3; a;"
+.L.str.f148bfbee9d5b51df1a631dd790ed083:
+  .string "int x; char y; int a=&x; int b=&y; b-a;"
+.L.str.c0edd7f17cce629ff96926e0b524d23e:
+  .string "char x; int y; int a=&x; int b=&y; b-a;"
+.L.str.00a91cb49822b57bc4480403478a35c6:
+  .string "struct {int a; int b;} x[3]; int *p=x; p[0]=0; x[0].a;"
+.L.str.ed9d311dee45c0f6a4ef37bca4e76a7b:
+  .string "struct {int a; int b;} x[3]; int *p=x; p[2]=2; x[1].a;"
+.L.str.6b992f95d67eb49fce7e4b612d190c07:
+  .string "struct t {int a;} x[2]; x[0].a=3; x[1]=x[0]; x[1].a;"
+.L.str.1e987877c64e3b465cc46c286d040787:
+  .string "typedef struct {int a;} t; t x; x.a=1; x.a;"
+.L.str.5d9ece73a69d01d30169814bdb8ffdd1:
+  .string "typedef struct {int a;} t; { typedef int t; } t x; x.a=2; x.a;"
+.L.str.c9eaf70fa8211e0f031af7720ffb1f1b:
+  .string "struct {int a; int b;} x; x.a=1; x.b=2; x.a;"
+.L.str.6ad8cbc3c5be947148b042213d86ed2f:
+  .string "struct t {char a;} x; struct t *y = &x; y->a=3; x.a;"
+.L.str.5efa81f0e283b9d674d2cffdff269de4:
+  .string "struct {char a; int b; char c;} x; x.a=1; x.b=2; x.c=3; x.a;"
+.L.str.70aba65e40d3127bcf37672025d3b441:
+  .string "struct t {char a;} x; struct t *y = &x; x.a=3; y->a;"
+.L.str.59621272fef1cf6331a9b435f0d392c5:
+  .string "_Bool b=0; b++; b;"
+.L.str.398b1264350125de2e04b49f436ffce3:
+  .string "_Bool b=0; b--; b;"
+.L.str.436be983a691101c4d99b288229d3eae:
+  .string "struct {int a; int b;} x[3]; int *p=x; p[1]=1; x[0].b;"
+.L.str.75a8037bbbbc90ca1e23e1a844dda8ea:
+  .string "struct {int a; int b;} x[3]; int *p=x; p[3]=3; x[1].b;"
+.L.str.195310ad1496e9c75be31a00b983ccaa:
+  .string "struct { struct { int b; } a; } x; x.a.b=6; x.a.b;"
+.L.str.ed7aaed020e915c87e6343b54c2a52fb:
+  .string "struct {int a; int b;} x; x.a=1; x.b=2; x.b;"
+.L.str.a812ec3b7ef1d3c8a6a6fe35386f7526:
+  .string "struct {char a; int b; char c;} a; x.b=x; x.a=2; x.b=3; x.b;"
+.L.str.d9bce6b10cd600f21e18cb9c9f149bca:
+  .string "struct t {int a[5]; char b;} x; struct t y; x.a[4]=4; x.b=5; y=x; y.a[4]+y.b;"
+.L.str.f82fd8c164a6a1409bb4fa88753b4ece:
+  .string "struct t {int a; int b;} x; struct t y; x.a=3; x.b=5; y=x; y.a+y.b;"
+.L.str.f0ab0331e8926c9a46f0731b226ee9c6:
+  .string "char c=127; c+=1; c;"
+.L.str.5cb2b61221ae8b6cae539cf97c219776:
+  .string "struct {char a; int b; char c;} x; x.a=1; x.b=2; x.c=3; x.c;"
+.L.str.0e1560a14ea59705d567906227a961eb:
+  .string "enum { zero, five=5, three=3, four }; three;"
+.L.str.ab9a5a7438c6dec5978de0b8f949c977:
+  .string "enum { zero, one, two }; one;"
+.L.str.321c5604317f9159e4465fa82bc39b95:
+  .string "enum { five=5, six, seven }; five;"
+.L.str.4e55b007d5f9357bca8c30a394a8da4a:
+  .string "enum { zero, five=5, three=3, four }; five;"
+.L.str.7da29f77d6a82c24fed284cd206b18da:
+  .string "int i=2; i++; i;"
+.L.str.12256247d11889ddd89cccbe8259df5f:
+  .string "int i=2; i--; i;"
+.L.str.a43b633a27c00c0c2d33082e4cc6e079:
+  .string "int i=0; while (i<10 && !(i==4)) i=i+1; i;"
+.L.str.6659d69bc8c9aa93fbc6d1fb9ed07143:
+  .string "int i=0; i=0; while(i<10) i=i+1; i;"
+.L.str.f6aca27649cd629a220ac44cf2a71f0b:
+  .string "int i=3; i*=2; i;"
+.L.str.ab1900584642b7c3ea4ef888824ede20:
+  .string "int i=5; i-=2; i;"
+.L.str.93ca8075e659effa9aef013f8b0fd369:
+  .string "int i=7; i/=2; i;"
+.L.str.811617f51804e1bedd72c87c6207bd8f:
+  .string "int i=2; i+=5; i;"
+.L.str.abafcac2ed4fd61d19e2599c21963219:
+  .string "int i; for (i=0; i<10; i=i+1) if (i==3) break; i;"
+.L.str.79ae131263ac9c0b6a00ab8e1707074e:
+  .string "int i=0; while (1) { i=i+1; if (i==5) break; } i;"
+.L.str.003629b6af7aeaa613eef983412b0411:
+  .string "int i=2; ++i;"
+.L.str.323bc316527669469fcda58c8d2f4151:
+  .string "int i=7; int s=0; for (i=5; i<2; i=i+1) s=s+1; s*100+i;"
+.L.str.c403ed00efa237b74be213e67e6ed4a3:
+  .string "int i; int s=0; for (i=0; i<10; i=i+1) s=s+i; s*100+i;"
+.L.str.7e7339e7b103727f42a24722dfe59dbb:
+  .string "int i; int s=0; for (i=3; i<=5; i=i+1) s=s+i; s*100+i;"
+.L.str.69640d600d59fbb199270a5b57c74f5e:
+  .string "int i=2; --i;"
+.L.str.3ba7d2372a374ac9df153d46f731509b:
+  .string "int i=0; int j=0; for (i=0; i<=10; i=i+1) j=i+j; j;"
+.L.str.c14bab3bdc6dddeaabd5a436a8e26aa1:
+  .string "int i=0; int j=0; while(i<=10) {j=i+j; i=i+1;} j;"
+.L.str.605618fae558db27d27440241c76ce4f:
+  .string "int i; int m=0; for (i=0; i<10; i=i+1) { if (i>m) m=i; } m;"
+.L.str.7d223b4dfc91472d0dd869cd041e363f:
+  .string "int foo=3; foo;"
+.L.str.66f69ee0a861237f78aaa0495dc13b2b:
+  .string "enum { zero, one, two }; zero;"
+.L.str.1fa86f80ef4e8ecf49917ac491cec917:
+  .string "enum { zero, five=5, three=3, four }; zero;"
+.L.str.40d3c989fe21a9ea656431446d082fd5:
+  .string "enum { zero, one, two }; two;"
+.L.str.a8a37ffe62568d14ee0d83d14408dbd8:
+  .string "int a[3]; a[0]=1; a[1]=3; a[2]=5; int *p=a; p++; *p;"
+.L.str.ba4dc2ad9da3dea9c14998e180bdcd01:
+  .string "int a[3]; a[0]=1; a[1]=3; a[2]=5; int *p=a+1; *p--; *p;"
+.L.str.67a49b6aea5f52da89ead7d8a301ec0e:
+  .string "int a[3]; a[0]=1; a[1]=3; a[2]=5; int *p=a; p+=2; *p;"
+.L.str.43e541d66574d3565e5a24bae8e1e39e:
+  .string "int foo123=3; int bar=5; foo123+bar;"
+.L.str.8c006d8e1ba33251cf7b7c1b767d50b9:
+  .string "ext_var++; ext_var;"
+.L.str.022267a8f7e6276661dea7211e933297:
+  .string "int *p=&ext_var; *p=3; ext_var;"
+.L.str.20c4fa3a9e0566bbbe635f9dcd8bfcc6:
+  .string "ext_var=7; ext_var;"
+.L.str.383da69f7fd89d8099d0422f9a57d8aa:
+  .string "enum { zero, five=5, three=3, four }; four;"
+.L.str.b8989dc68667bc52af6a301edaea644a:
+  .string "int n=2; int s=0; int i; int j; for (i=0; i<n+1; i=i+1) for (j=0; j<n; j=j+1) s=s+1; s;"
+.L.str.03e4bdbbbc2d8b3a4c7e14d48b254b5c:
+  .string "int n=5; int s=0; int i; for (i=0; i<n*2; i=i+1) s=s+n*3; s;"
+.L.str.88e4445a4bb3a443cb3cbb57b9f2b6e0:
+  .string "int a[8]; char c[8]; int n=8; int i; int s=0; for (i=0; i<n; i=i+1) { a[i]=0; c[i]=0; } for (i=0; i<n; i=i+1) { a[i]=a[i]+1; c[i]=c[i]+1; } for (i=0; i<n; i=i+1) s=s+c[i]+a[i]; s;"
+.L.str.1812ac021bef972d704ae9fa1e610d46:
+  .string "int i; int s=0; for (i=0; i<10; i++) s+=i; s;"
+.L.str.02b5f7f889ebfd57475e201b8c75d846:
+  .string "int i; int s=0; for (i=0; i<10; ++i) s+=i; s;"
+.L.str.de2e2eb85163ed97482f98f1ae291782:
+  .string "g1=2; int s=0; int i=0; while (i<3) { s=s+g1*g1; i=i+1; } s;"
+.L.str.d34e108b21e4eb5f48057603315d31fc:
+  .string "int x=1; int *p=&x; int s=0; int i; for (i=0; i<3; i=i+1) { s=s+x*2; *p=*p+1; } s;"
+.L.str.1d4373798881ea6a4e023e087632524d:
+  .string "int x=1; int s=0; int i; for (i=0; i<3; i=i+1) { s=s+x*2; x=x+1; } s;"
+.L.str.28605310ffb58f74aa61896945fc1cfc:
+  .string "int i; int s=0; for (i=0; i<5; i=i+1) { switch (i) { case 1: s=s+1; break; case 3: s=s+10; break; } } s;"
+.L.str.a35953d2d8ff2ddf559bbf18de297c18:
+  .string "typedef int t; t t=1; t;"
+.L.str.644dde19fc6027a0d6618647df4625e8:
+  .string "int x=3; 0 && (x=5); x;"
+.L.str.957863870423bcf79749087c92c0b8f6:
+  .string "int x=3; 1 && (x=5); x;"
+.L.str.a8eebbf7492e50b8e3970b86a9b03b13:
+  .string "int x=3; 1 || (x=5); x;"
+.L.str.397cb00e55ab915c8ff1b8a5b4a45a89:
+  .string "int a=5; int x; if (a) x=1; else x=0; x;"
+.L.str.81bb5ded49f5bb2da11a57834052435e:
+  .string "_Bool x=0; x;"
+.L.str.980d1a779c50f50aa019a4e6da5aec94:
+  .string "_Bool x=1; x;"
+.L.str.09b4581033ee978fcd51ff9b1336ac12:
+  .string "char x=1; x;"
+.L.str.a439ee11fc317059c2042da1ac859551:
+  .string "typedef int t; t x=1; x;"
+.L.str.1265dfea306e217b83e0bc20ccff4679:
+  .string "long x=2147483648; x*=2; x;"
+.L.str.b9d7d38977ed0294676e508d1bf772fe:
+  .string "int x=3; while (0) x=2; x;"
+.L.str.38e8474815dde26b7d709b09499cbd5b:
+  .string "int x=3; for (x=3; 0;) x=2; x;"
+.L.str.670c1131975590e1a728be9d4ce9726d:
+  .string "_Bool x=2; x;"
+.L.str.13f8b9c9406cfbba707f6c5a4f92f2a8:
+  .string "char x=1; char y=2; x;"
+.L.str.0deb1def93bfdffce01625051cf5c945:
+  .string "int x=0; if (0) x=2; else x=3; x;"
+.L.str.a824bd33b49a240f37885184999ece40:
+  .string "int x=0; if (1) x=2; else x=3; x;"
+.L.str.356a8635b1b0d32ab12db34831217a23:
+  .string "int x=0; if (1-1) x=2; else x=3; x;"
+.L.str.2bcc9b7abfcd90991a9216b5dace1958:
+  .string "int x=0; if (2-1) x=2; else x=3; x;"
+.L.str.faab73209810b2b3c67822ad241e6038:
+  .string "int x=1; int y=2; if (x==1 && y==2) x=2; else x=3; x;"
+.L.str.e63271fb4a3739eb00ff4968ddf2bb64:
+  .string "MyInt x=3; x;"
+.L.str.8b1041c80bd2d054519e03892ed88bb5:
+  .string "int x=2; { int x=3; } int y=4; x;"
+.L.str.20c538d7c20ee7de4328e6cb32de7509:
+  .string "int x=3; int *y=&x; *y=5; x;"
+.L.str.569eed998946a1c05829453513cb83c2:
+  .string "int x=3; int y=5; *(&y-1)=7; x;"
+.L.str.c2ba37646b74f7916a85b2860508b471:
+  .string "int x=0; int y=0; if (!(x || y)) x=7; x;"
+.L.str.2f4a7fbf9dd607f3e32a348ffca12151:
+  .string "int x=10; x/=4294967298; x;"
+.L.str.d6940b9ff193b6ccdcced5789a01d311:
+  .string "int a=5; int x=2; if (a<x) x=a; x;"
+.L.str.82969bdd7b2cb798d58cec7da1d6e507:
+  .string "int a=5; int x=2; if (a>x) x=a; x;"
+.L.str.c2994af005e52b62bd6b600a4e9e7ddd:
+  .string "int a=3; int b=7; int x; if (a<b) x=b; else x=a; x;"
+.L.str.d1b581db3f1e32448ccc7df8a82f82e0:
+  .string "int a=1; int b=0; int x=3; if (b) x=a/b; x;"
+.L.str.276066715fee51d4daebb8ee6cd5487d:
+  .string "int x; sizeof x;"
+.L.str.7c7c7839ffbd50e3c0465292642e59c9:
+  .string "int a=0; int x; if (a) { x=0; } else { x=1; } x;"
+.L.str.620f7a59099efc5c0cda26d776e8d27e:
+  .string "int x=2; { int x=3; } x;"
+.L.str.3d1cd028325b19f3fc68cffa5911d3ce:
+  .string "int x=2; { x=3; } x;"
+.L.str.5c46484b1b58930033413acbf7e01e13:
+  .string "long x=4294967296; !!x;"
+.L.str.ffd0b215090e8e28fec32136566a46b4:
+  .string "int x=3; *&x;"
+.L.str.2949231164504139461bc8956a71bdc8:
+  .string "int x=3; (&x+2)-&x;"
+.L.str.a5453265b5f86be2cb3e123d2666b3ca:
+  .string "int x[2]; int *y=&x; *y=3; *x;"
+.L.str.74e2eb9cf9444000fe348e1174af42ae:
+  .string "int x[3]; *x=3; *(x+1)=4; *(x+2)=5; *x;"
+.L.str.85cf3e461180ca4ddf71e6f38c684f22:
+  .string "int x[3]; *x=3; x[1]=4; x[2]=5; *x;"
+.L.str.65ae45a44dc25ac6869d634411434a7f:
+  .string "int x[2][3]; int *y=x; *y=0; **x;"
+.L.str.d14ca92df7f0de7733ec28731031c411:
+  .string "int x=1; int *p=&x; int y=x+x; *p=5; y+x+x;"
+.L.str.f51bc45a5b19667ef3fc6728b8ccff07:
+  .string "int x[5]; int *y=x+2; y-x;"
+.L.str.4ccb525be0a1df4a2988d3e6c8670545:
+  .string "struct t {int x;}; int t=1; struct t y; y.x=2; t+y.x;"
+.L.str.f3b63261298586108e04ab535ed402a5:
+  .string "long x=4294967296; int y=0; y<x;"
+.L.str.69517039e7cbd135cbe09aa3b05d377d:
+  .string "enum { five=5, six, seven }; six;"
+.L.str.967905f3d115da8d4d5f5c044d0d89ac:
+  .string "char x=1; char y=2; y;"
+.L.str.7474f3159ad0c511b3b8ea6fd0721428:
+  .string "int x=3; int y=5; *(&x+1)=7; y;"
+.L.str.a9b572f1d6091b830d4261c72b2c8ec7:
+  .string "int x=-1; long y=x; y;"
+.L.str.5ee2748953e1c2751a769a1af214b6a2:
+  .string "int x=2; int y=0; switch (x) { case 1: y=10; break; case 2: y=20; break; default: y=30; } y;"
+.L.str.adb67f01e21efe58eec402960bb8f2fa:
+  .string "int x=5; int y=0; switch (x) { case 1: y=10; break; case 2: y=20; break; default: y=30; } y;"
+.L.str.ed3e158be828b1677dc412526b8b9cdb:
+  .string "int y=7; switch (3) { case 1: y=1; } y;"
+.L.str.2560572b4bda853d2ccc015a3e58a2db:
+  .string "char c=65; int y=0; switch (c) { case 64+1: y=2; break; case 66: y=3; } y;"
+.L.str.5acd0cf45da4ded1cfc19d92a5d1503b:
+  .string "int x=1; int y=0; switch (x) { case 1: y=y+1; case 2: y=y+2; break; case 3: y=y+4; } y;"
+.L.str.18e3115df67b19255a824a04e1e4a7cc:
+  .string "struct {int x; int y;} a[4]; int i=2; a[i].x=3; a[i].y=4; a[i].x+a[i].y;"
+.L.str.e728910c39606823d26aa1debe7364b7:
+  .string "int x=3; int *y=&x; int **z=&y; **z;"
+.L.str.fc29472e80f70d2ada532efcc5207f50:
+  .string "int a; int z; a=3; z=5; a+z;"
+.L.str.476c182988082f9b73c1a80e2eb79cc5:
+  .string "int a=3; int z=5; a+z;"
+.L.str.886a05412cab00c2fdb511a0f442f44c:
+  .string "struct {int a[3];} x[2]; sizeof(x)};"
+.L.str.1472d0645f552820b5472b91341c2d9a:
+  .string "\\"
+.L.str.160c0004c07fedbcbd48da89acfaa01d:
+  .string "\"\\\"\"[0]"
+.L.str.4558494c3ded80b9477b24eb95e9606a:
+  .string "\"\\0\"[0]"
+.L.str.4f423fb70484c373fd5f2b2bffbb8381:
+  .string "\"\\\\\"[0]"
+.L.str.ec7a85bab4bd463ebbdeef73ad37a9d2:
+  .string "\"\\a\"[0]"
+.L.str.649864307115aba9e96d5a860da11cf0:
+  .string "\"\\b\"[0]"
+.L.str.dcf756d85f13b2a8461fcd4fcd3c2734:
+  .string "\"abc\"[0]"
+.L.str.bc440b6be83cc9603700ebca91bd5038:
+  .string "\"\\e\"[0]"
+.L.str.a705a460d1ce11dfb3659957f91c53c7:
+  .string "\"\\f\"[0]"
+.L.str.089c643df35ef3052ee23f5a3d9808f7:
+  .string "\"\\j\"[0]"
+.L.str.b6e3dcda40e4650360f8a44c066564a2:
+  .string "\"\\k\"[0]"
+.L.str.97c46205024f4eae5f186c8503e1bdbf:
+  .string "\"\\l\"[0]"
+.L.str.cb72953a04f7ea94f7bcf527374d4fae:
+  .string "\"\\n\"[0]"
+.L.str.7cc77db87bd41c33fff16628c322f330:
+  .string "\"\\r\"[0]"
+.L.str.a1855ad59e86de36e0bc4d025486c2b4:
+  .string "\"\\t\"[0]"
+.L.str.f0a819a93579f544609286ccfe1e4f25:
+  .string "\"\\v\"[0]"
+.L.str.7fafcd43d3e631d640294b2bdd412365:
+  .string "g2[0]"
+.L.str.38766324d62bc06529786b6ca82f6ccf:
+  .string "\"a\\0b\"[1]"
+.L.str.b3daf5f809bda487e98a790234b06f11:
+  .string "\"abc\"[1]"
+.L.str.ef82f8233930610b67e4304adc360a7b:
+  .string "g2[1]"
+.L.str.13677e293772a72bb1e5c47ec280d227:
+  .string "\"a\\0b\"[2]"
+.L.str.94835f3df5fb84e21da48d594985321e:
+  .string "\"abc\"[2]"
+.L.str.d9279ad34482a8aa02f4a57b9150ad4c:
+  .string "g2[2]"
+.L.str.f1827b74e5f5b9f723f02e0fa3881b55:
+  .string "\"abc\"[3]"
+.L.str.8e9e7c7146866dd6e6d2189a02bfa34d:
+  .string "g2[3]"
+.L.str.969caaeb3626c0d5695eefa6aea53305:
+  .string "ab"
+.L.str.dc1114cd074914bd872cc1f9a23ec910:
+  .string "abc"
+.L.str.91046df2aa008410555df240b14243aa:
+  .string "j"
+.L.str.3038a3216fba1e955d90addce0a77d46:
+  .string "k"
+.L.str.fcaeb82b28d0198401682757c9e266df:
+  .string "l"
+.L.str.88d4f4fdbdb8045e712c67678a150d3f:
+  .string "int x=5; long y=(long)&x; *(int*)y"
+.section .rodata
+.L.str.96a296d224f285c67bee93c30f8a3091:
+  .zero 2
+.L.str.8fb20ef63ced4145fc2e983ffe597d1d:
+  .string "a"
+  .string "b"
+.set .L.str.102b51b9765a56a3e899f7cf0ee38e52, .L.str.c9a18416659e4d3a4f61d143a1830006+2
+.set .L.str.37aa3970b6801c9d286464f7d86e50bf, .L.str.70e35361cbf0b60185df2503323ed403+12
+.set .L.str.75ca199a2410b101f85ea5e07e2c9848, .L.str.7ae900c7015cac9e2ad803c2e23112b7+5
+.set .L.str.31dfd8dab42f9df415358cf93844f717, .L.str.9b72946ba14451ef88bed149bfea9da5+5
+.set .L.str.62989980a56306dbf9f3fb966f967533, .L.str.90963e0f34119cf766492c04fc6a1bb3+8
+.set .L.str.06236a87c1c77a2c4d3f653082b54204, .L.str.617e6589d50834f26595c3ec227728a6+5
+.set .L.str.67cdf221af07985c55fd0a8fcb7465ec, .L.str.49bfec0c1029b910014f410d0d65191b+4
+.set .L.str.74bc4fd2b43fba1083fabc53c60269f6, .L.str.8c006d8e1ba33251cf7b7c1b767d50b9+11
+.set .L.str.485f9a3ce60cb7873fb74ada7462b8ae, .L.str.dc1114cd074914bd872cc1f9a23ec910+1
+.text
+.global assert
+assert:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 24
+  mov [rbp-24], rdi
+  mov [rbp-16], rsi
+  mov [rbp-8], rdx
+  mov rax, qword ptr [rbp-24]
+  push rax
+  mov rax, qword ptr [rbp-16]
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  jne .L.else.assert.0
+  lea rax, [rip+.L.str.58e899820eb2bb633abdc6c2fb0198cd]
+  push rax
+  mov rax, qword ptr [rbp-8]
+  push rax
+  mov rax, qword ptr [rbp-16]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.assert.1
+  mov eax, 0
+  call printf@PLT
+  jmp .L.end.assert.1
+.L.call.assert.1:
+  sub rsp, 8
+  mov eax, 0
+  call printf@PLT
+  add rsp, 8
+.L.end.assert.1:
+  push rax
+  add rsp, 8
+  jmp .L.end.assert.0
+.L.else.assert.0:
+  lea rax, [rip+.L.str.0a4112fdee08ab4b4cd8372912b1dc8b]
+  push rax
+  mov rax, qword ptr [rbp-8]
+  push rax
+  mov rax, qword ptr [rbp-24]
+  push rax
+  mov rax, qword ptr [rbp-16]
+  push rax
+  pop rcx
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.assert.2
+  mov eax, 0
+  call printf@PLT
+  jmp .L.end.assert.2
+.L.call.assert.2:
+  sub rsp, 8
+  mov eax, 0
+  call printf@PLT
+  add rsp, 8
+.L.end.assert.2:
+  push rax
+  add rsp, 8
+  push 1
+  pop rdi
+  movsxd rdi, edi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.assert.3
+  mov eax, 0
+  call exit@PLT
+  jmp .L.end.assert.3
+.L.call.assert.3:
+  sub rsp, 8
+  mov eax, 0
+  call exit@PLT
+  add rsp, 8
+.L.end.assert.3:
+  push rax
+  add rsp, 8
+.L.end.assert.0:
+.L.return.assert:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global ret3
+ret3:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 0
+  push 3
+  pop rax
+  jmp .L.return.ret3
+.L.return.ret3:
+  mov rsp, rbp
+  pop rbp
+  ret
+static_fn:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 0
+  push 7
+  pop rdi
+  mov dword ptr [rip+g3], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rip+g3]
+  push rax
+  pop rax
+  jmp .L.return.static_fn
+.L.return.static_fn:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global add2
+add2:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  mov [rbp-8], edi
+  mov [rbp-4], esi
+  mov eax, dword ptr [rbp-8]
+  push rax
+  mov eax, dword ptr [rbp-4]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rax
+  jmp .L.return.add2
+.L.return.add2:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global sub2
+sub2:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  mov [rbp-8], edi
+  mov [rbp-4], esi
+  mov eax, dword ptr [rbp-8]
+  push rax
+  mov eax, dword ptr [rbp-4]
+  push rax
+  pop rdi
+  pop rax
+  sub eax, edi
+  push rax
+  pop rax
+  jmp .L.return.sub2
+.L.return.sub2:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global add6
+add6:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 24
+  mov [rbp-24], edi
+  mov [rbp-20], esi
+  mov [rbp-16], edx
+  mov [rbp-12], ecx
+  mov [rbp-8], r8d
+  mov [rbp-4], r9d
+  mov eax, dword ptr [rbp-24]
+  push rax
+  mov eax, dword ptr [rbp-20]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  mov eax, dword ptr [rbp-16]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  mov eax, dword ptr [rbp-12]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  mov eax, dword ptr [rbp-8]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  mov eax, dword ptr [rbp-4]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rax
+  jmp .L.return.add6
+.L.return.add6:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global addx
+addx:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-16], rdi
+  mov [rbp-4], esi
+  mov rax, qword ptr [rbp-16]
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  mov eax, dword ptr [rbp-4]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rax
+  jmp .L.return.addx
+.L.return.addx:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global sub_char
+sub_char:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  mov [rbp-3], dil
+  mov [rbp-2], sil
+  mov [rbp-1], dl
+  movsx eax, byte ptr [rbp-3]
+  push rax
+  movsx eax, byte ptr [rbp-2]
+  push rax
+  pop rdi
+  pop rax
+  sub eax, edi
+  push rax
+  movsx eax, byte ptr [rbp-1]
+  push rax
+  pop rdi
+  pop rax
+  sub eax, edi
+  push rax
+  pop rax
+  jmp .L.return.sub_char
+.L.return.sub_char:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global sub_short
+sub_short:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  mov [rbp-6], di
+  mov [rbp-4], si
+  mov [rbp-2], dx
+  movsx eax, word ptr [rbp-6]
+  push rax
+  movsx eax, word ptr [rbp-4]
+  push rax
+  pop rdi
+  pop rax
+  sub eax, edi
+  push rax
+  movsx eax, word ptr [rbp-2]
+  push rax
+  pop rdi
+  pop rax
+  sub eax, edi
+  push rax
+  pop rax
+  jmp .L.return.sub_short
+.L.return.sub_short:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global sub_long
+sub_long:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 24
+  mov [rbp-24], rdi
+  mov [rbp-16], rsi
+  mov [rbp-8], rdx
+  mov rax, qword ptr [rbp-24]
+  push rax
+  mov rax, qword ptr [rbp-16]
+  push rax
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  mov rax, qword ptr [rbp-8]
+  push rax
+  pop rdi
+  pop rax
+  sub rax, rdi
+  push rax
+  pop rax
+  jmp .L.return.sub_long
+.L.return.sub_long:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global g1_ptr
+g1_ptr:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 0
+  mov rax, qword ptr g1@GOTPCREL[rip]
+  push rax
+  pop rax
+  jmp .L.return.g1_ptr
+.L.return.g1_ptr:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global fib
+fib:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  mov [rbp-4], edi
+  mov eax, dword ptr [rbp-4]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  cmp eax, edi
+  jg .L.end.fib.0
+  push 1
+  pop rax
+  jmp .L.return.fib
+.L.end.fib.0:
+  mov eax, dword ptr [rbp-4]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  sub eax, edi
+  push rax
+  pop rdi
+  movsxd rdi, edi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.fib.1
+  mov eax, 0
+  call fib@PLT
+  jmp .L.end.fib.1
+.L.call.fib.1:
+  sub rsp, 8
+  mov eax, 0
+  call fib@PLT
+  add rsp, 8
+.L.end.fib.1:
+  push rax
+  mov eax, dword ptr [rbp-4]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  sub eax, edi
+  push rax
+  pop rdi
+  movsxd rdi, edi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.fib.2
+  mov eax, 0
+  call fib@PLT
+  jmp .L.end.fib.2
+.L.call.fib.2:
+  sub rsp, 8
+  mov eax, 0
+  call fib@PLT
+  add rsp, 8
+.L.end.fib.2:
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rax
+  jmp .L.return.fib
+.L.return.fib:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global sw_table
+sw_table:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  mov [rbp-4], edi
+  mov eax, dword ptr [rbp-4]
+  push rax
+  pop rax
+  sub eax, 0
+  cmp eax, 5
+  ja .L.case.sw_table.6
+  lea rdi, [rip+.L.jt.sw_table.7]
+  movsxd rax, dword ptr [rdi+rax*4]
+  add rax, rdi
+  jmp rax
+.section .rodata
+.align 4
+.L.jt.sw_table.7:
+  .long .L.case.sw_table.5-.L.jt.sw_table.7
+  .long .L.case.sw_table.4-.L.jt.sw_table.7
+  .long .L.case.sw_table.3-.L.jt.sw_table.7
+  .long .L.case.sw_table.6-.L.jt.sw_table.7
+  .long .L.case.sw_table.2-.L.jt.sw_table.7
+  .long .L.case.sw_table.1-.L.jt.sw_table.7
+.text
+.L.case.sw_table.5:
+  push 10
+  pop rax
+  jmp .L.return.sw_table
+.L.case.sw_table.4:
+  push 11
+  pop rax
+  jmp .L.return.sw_table
+.L.case.sw_table.3:
+  push 12
+  pop rax
+  jmp .L.return.sw_table
+.L.case.sw_table.2:
+  push 14
+  pop rax
+  jmp .L.return.sw_table
+.L.case.sw_table.1:
+  push 15
+  pop rax
+  jmp .L.return.sw_table
+.L.case.sw_table.6:
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  sub eax, edi
+  push rax
+  pop rax
+  jmp .L.return.sw_table
+.L.end.sw_table.0:
+.L.return.sw_table:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global sw_tree
+sw_tree:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 8
+  mov [rbp-8], rdi
+  mov rax, qword ptr [rbp-8]
+  push rax
+  pop rax
+  cmp rax, 1000
+  je .L.case.sw_tree.3
+  jg .L.switch.sw_tree.7
+  cmp rax, -100
+  je .L.case.sw_tree.6
+  cmp rax, 3
+  je .L.case.sw_tree.5
+  cmp rax, 50
+  je .L.case.sw_tree.4
+  jmp .L.end.sw_tree.0
+.L.switch.sw_tree.7:
+  cmp rax, 70000
+  je .L.case.sw_tree.2
+  movabs rdi, 5000000000
+  cmp rax, rdi
+  je .L.case.sw_tree.1
+  jmp .L.end.sw_tree.0
+.L.case.sw_tree.6:
+  push 1
+  pop rax
+  jmp .L.return.sw_tree
+.L.case.sw_tree.5:
+  push 2
+  pop rax
+  jmp .L.return.sw_tree
+.L.case.sw_tree.4:
+  push 3
+  pop rax
+  jmp .L.return.sw_tree
+.L.case.sw_tree.3:
+  push 4
+  pop rax
+  jmp .L.return.sw_tree
+.L.case.sw_tree.2:
+  push 5
+  pop rax
+  jmp .L.return.sw_tree
+.L.case.sw_tree.1:
+  push 6
+  pop rax
+  jmp .L.return.sw_tree
+.L.end.sw_tree.0:
+  push 0
+  pop rax
+  jmp .L.return.sw_tree
+.L.return.sw_tree:
+  mov rsp, rbp
+  pop rbp
+  ret
+.global main
+main:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 4184
+  push 3
+  push 3
+  pop rdi
+  mov dword ptr [rbp-4184], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-4184]
+  push rax
+  lea rax, [rip+.L.str.eb02cf4f0fa671eec10df2107fcbc4e1]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.0
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.0
+.L.call.main.0:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.0:
+  push rax
+  add rsp, 8
+  push 8
+  push 3
+  pop rdi
+  mov dword ptr [rbp-4180], edi
+  push rdi
+  add rsp, 8
+  push 5
+  pop rdi
+  mov dword ptr [rbp-4176], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-4180]
+  push rax
+  mov eax, dword ptr [rbp-4176]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  lea rax, [rip+.L.str.fc29472e80f70d2ada532efcc5207f50]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.1
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.1
+.L.call.main.1:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.1:
+  push rax
+  add rsp, 8
+  push 3
+  push 3
+  pop rdi
+  mov dword ptr [rbp-4172], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-4172]
+  push rax
+  lea rax, [rip+.L.str.bff07e4475e7c91e28220e9c22a39953]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.2
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.2
+.L.call.main.2:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.2:
+  push rax
+  add rsp, 8
+  push 8
+  push 3
+  pop rdi
+  mov dword ptr [rbp-4168], edi
+  push rdi
+  add rsp, 8
+  push 5
+  pop rdi
+  mov dword ptr [rbp-4164], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-4168]
+  push rax
+  mov eax, dword ptr [rbp-4164]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  lea rax, [rip+.L.str.476c182988082f9b73c1a80e2eb79cc5]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.3
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.3
+.L.call.main.3:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.3:
+  push rax
+  add rsp, 8
+  push 3
+  push 3
+  pop rdi
+  mov dword ptr [rbp-4160], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-4160]
+  push rax
+  lea rax, [rip+.L.str.7d223b4dfc91472d0dd869cd041e363f]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.4
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.4
+.L.call.main.4:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.4:
+  push rax
+  add rsp, 8
+  push 8
+  push 3
+  pop rdi
+  mov dword ptr [rbp-4156], edi
+  push rdi
+  add rsp, 8
+  push 5
+  pop rdi
+  mov dword ptr [rbp-4152], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-4156]
+  push rax
+  mov eax, dword ptr [rbp-4152]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  lea rax, [rip+.L.str.43e541d66574d3565e5a24bae8e1e39e]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.5
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.5
+.L.call.main.5:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.5:
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.6
+  mov eax, 0
+  call ret3@PLT
+  jmp .L.end.main.6
+.L.call.main.6:
+  sub rsp, 8
+  mov eax, 0
+  call ret3@PLT
+  add rsp, 8
+.L.end.main.6:
+  push rax
+  lea rax, [rip+.L.str.7cd84d2196ed561abc671a13ce6dc670]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.7
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.7
+.L.call.main.7:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.7:
+  push rax
+  add rsp, 8
+  push 3
+  push 0
+  pop rdi
+  mov dword ptr [rbp-4148], edi
+  push rdi
+  add rsp, 8
+  push 3
+  pop rdi
+  mov dword ptr [rbp-4148], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-4148]
+  push rax
+  lea rax, [rip+.L.str.0deb1def93bfdffce01625051cf5c945]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.8
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.8
+.L.call.main.8:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.8:
+  push rax
+  add rsp, 8
+  push 3
+  push 0
+  pop rdi
+  mov dword ptr [rbp-4144], edi
+  push rdi
+  add rsp, 8
+  push 1
+  push 1
+  pop rdi
+  pop rax
+  sub eax, edi
+  push rax
+  push 2
+  push 3
+  pop rdi
+  pop rax
+  pop rcx
+  cmp ecx, 0
+  cmove eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-4144], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-4144]
+  push rax
+  lea rax, [rip+.L.str.356a8635b1b0d32ab12db34831217a23]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.9
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.9
+.L.call.main.9:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.9:
+  push rax
+  add rsp, 8
+  push 2
+  push 0
+  pop rdi
+  mov dword ptr [rbp-4140], edi
+  push rdi
+  add rsp, 8
+  push 2
+  pop rdi
+  mov dword ptr [rbp-4140], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-4140]
+  push rax
+  lea rax, [rip+.L.str.a824bd33b49a240f37885184999ece40]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.10
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.10
+.L.call.main.10:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.10:
+  push rax
+  add rsp, 8
+  push 2
+  push 0
+  pop rdi
+  mov dword ptr [rbp-4136], edi
+  push rdi
+  add rsp, 8
+  push 2
+  push 1
+  pop rdi
+  pop rax
+  sub eax, edi
+  push rax
+  push 2
+  push 3
+  pop rdi
+  pop rax
+  pop rcx
+  cmp ecx, 0
+  cmove eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-4136], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-4136]
+  push rax
+  lea rax, [rip+.L.str.2bcc9b7abfcd90991a9216b5dace1958]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.11
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.11
+.L.call.main.11:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.11:
+  push rax
+  add rsp, 8
+  push 3
+  push 1
+  add rsp, 8
+  push 2
+  add rsp, 8
+  push 3
+  lea rax, [rip+.L.str.9005bd0b82bc0465f6658d80ea5cd425]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.12
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.12
+.L.call.main.12:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.12:
+  push rax
+  add rsp, 8
+  push 10
+  push 0
+  pop rdi
+  mov dword ptr [rbp-4132], edi
+  push rdi
+  add rsp, 8
+  push 0
+  pop rdi
+  mov dword ptr [rbp-4132], edi
+  push rdi
+  add rsp, 8
+.L.begin.main.13:
+  mov eax, dword ptr [rbp-4132]
+  push rax
+  push 10
+  pop rdi
+  pop rax
+  cmp eax, edi
+  jge .L.end.main.13
+  mov eax, dword ptr [rbp-4132]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-4132], edi
+  push rdi
+  add rsp, 8
+  jmp .L.begin.main.13
+.L.end.main.13:
+  mov eax, dword ptr [rbp-4132]
+  push rax
+  lea rax, [rip+.L.str.6659d69bc8c9aa93fbc6d1fb9ed07143]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.14
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.14
+.L.call.main.14:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.14:
+  push rax
+  add rsp, 8
+  push 55
+  push 0
+  pop rdi
+  mov dword ptr [rbp-4128], edi
+  push rdi
+  add rsp, 8
+  push 0
+  pop rdi
+  mov dword ptr [rbp-4124], edi
+  push rdi
+  add rsp, 8
+.L.begin.main.15:
+  mov eax, dword ptr [rbp-4128]
+  push rax
+  push 10
+  pop rdi
+  pop rax
+  cmp eax, edi
+  jg .L.end.main.15
+  mov eax, dword ptr [rbp-4128]
+  push rax
+  mov eax, dword ptr [rbp-4124]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-4124], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-4128]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-4128], edi
+  push rdi
+  add rsp, 8
+  jmp .L.begin.main.15
+.L.end.main.15:
+  mov eax, dword ptr [rbp-4124]
+  push rax
+  lea rax, [rip+.L.str.c14bab3bdc6dddeaabd5a436a8e26aa1]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.16
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.16
+.L.call.main.16:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.16:
+  push rax
+  add rsp, 8
+  push 55
+  push 0
+  pop rdi
+  mov dword ptr [rbp-4120], edi
+  push rdi
+  add rsp, 8
+  push 0
+  pop rdi
+  mov dword ptr [rbp-4116], edi
+  push rdi
+  add rsp, 8
+  push 0
+  pop rdi
+  mov dword ptr [rbp-4120], edi
+  push rdi
+  add rsp, 8
+.L.begin.main.17:
+  mov eax, dword ptr [rbp-4120]
+  push rax
+  push 8
+  pop rdi
+  pop rax
+  cmp eax, edi
+  jge .L.end.main.17
+  mov eax, dword ptr [rbp-4120]
+  push rax
+  mov eax, dword ptr [rbp-4116]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-4116], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-4120]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-4120], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-4120]
+  push rax
+  mov eax, dword ptr [rbp-4116]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-4116], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-4120]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-4120], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-4120]
+  push rax
+  mov eax, dword ptr [rbp-4116]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-4116], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-4120]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-4120], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-4120]
+  push rax
+  mov eax, dword ptr [rbp-4116]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-4116], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-4120]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-4120], edi
+  push rdi
+  add rsp, 8
+  jmp .L.begin.main.17
+.L.end.main.17:
+  mov eax, dword ptr [rbp-4120]
+  push rax
+  mov eax, dword ptr [rbp-4116]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-4116], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-4120]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-4120], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-4120]
+  push rax
+  mov eax, dword ptr [rbp-4116]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-4116], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-4120]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-4120], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-4120]
+  push rax
+  mov eax, dword ptr [rbp-4116]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-4116], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-4120]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-4120], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-4116]
+  push rax
+  lea rax, [rip+.L.str.3ba7d2372a374ac9df153d46f731509b]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.18
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.18
+.L.call.main.18:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.18:
+  push rax
+  add rsp, 8
+  push 8
+  push 3
+  push 5
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.19
+  mov eax, 0
+  call add2@PLT
+  jmp .L.end.main.19
+.L.call.main.19:
+  sub rsp, 8
+  mov eax, 0
+  call add2@PLT
+  add rsp, 8
+.L.end.main.19:
+  push rax
+  lea rax, [rip+.L.str.4ce85ab491bc036a98906f17f2daa4f5]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.20
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.20
+.L.call.main.20:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.20:
+  push rax
+  add rsp, 8
+  push 2
+  push 5
+  push 3
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.21
+  mov eax, 0
+  call sub2@PLT
+  jmp .L.end.main.21
+.L.call.main.21:
+  sub rsp, 8
+  mov eax, 0
+  call sub2@PLT
+  add rsp, 8
+.L.end.main.21:
+  push rax
+  lea rax, [rip+.L.str.361299b437ea35ea596c88c255284413]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.22
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.22
+.L.call.main.22:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.22:
+  push rax
+  add rsp, 8
+  push 21
+  push 1
+  push 2
+  push 3
+  push 4
+  push 5
+  push 6
+  pop r9
+  pop r8
+  pop rcx
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  movsxd rdx, edx
+  movsxd rcx, ecx
+  movsxd r8, r8d
+  movsxd r9, r9d
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.23
+  mov eax, 0
+  call add6@PLT
+  jmp .L.end.main.23
+.L.call.main.23:
+  sub rsp, 8
+  mov eax, 0
+  call add6@PLT
+  add rsp, 8
+.L.end.main.23:
+  push rax
+  lea rax, [rip+.L.str.55ba8a5d7c6a552653e49083486e9644]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.24
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.24
+.L.call.main.24:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.24:
+  push rax
+  add rsp, 8
+  push 55
+  push 9
+  pop rdi
+  movsxd rdi, edi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.25
+  mov eax, 0
+  call fib@PLT
+  jmp .L.end.main.25
+.L.call.main.25:
+  sub rsp, 8
+  mov eax, 0
+  call fib@PLT
+  add rsp, 8
+.L.end.main.25:
+  push rax
+  lea rax, [rip+.L.str.5818e50f62f73ecc350c657e16fa73a9]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.26
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.26
+.L.call.main.26:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.26:
+  push rax
+  add rsp, 8
+  push 3
+  push 3
+  pop rdi
+  mov dword ptr [rbp-4112], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 4112
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.ffd0b215090e8e28fec32136566a46b4]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.27
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.27
+.L.call.main.27:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.27:
+  push rax
+  add rsp, 8
+  push 3
+  push 3
+  pop rdi
+  mov dword ptr [rbp-4108], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 4108
+  push rax
+  pop rdi
+  mov qword ptr [rbp-4104], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 4104
+  push rax
+  pop rdi
+  mov qword ptr [rbp-4096], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-4096]
+  push rax
+  pop rax
+  mov rax, qword ptr [rax]
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.e728910c39606823d26aa1debe7364b7]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.28
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.28
+.L.call.main.28:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.28:
+  push rax
+  add rsp, 8
+  push 5
+  push 3
+  pop rdi
+  mov dword ptr [rbp-4084], edi
+  push rdi
+  add rsp, 8
+  push 5
+  pop rdi
+  mov dword ptr [rbp-4080], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 4084
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.a5d2f94210f047d632dce5aa13864b18]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.29
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.29
+.L.call.main.29:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.29:
+  push rax
+  add rsp, 8
+  push 5
+  push 3
+  pop rdi
+  mov dword ptr [rbp-4076], edi
+  push rdi
+  add rsp, 8
+  push 5
+  pop rdi
+  mov dword ptr [rbp-4072], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 4076
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.504f61c3af9a0a7fe6fa14bef91a6f7c]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.30
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.30
+.L.call.main.30:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.30:
+  push rax
+  add rsp, 8
+  push 3
+  push 3
+  pop rdi
+  mov dword ptr [rbp-4068], edi
+  push rdi
+  add rsp, 8
+  push 5
+  pop rdi
+  mov dword ptr [rbp-4064], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 4064
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  sub rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.b77658b504f8ec778c1a41f77dfe425e]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.31
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.31
+.L.call.main.31:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.31:
+  push rax
+  add rsp, 8
+  push 2
+  push 3
+  pop rdi
+  mov dword ptr [rbp-4060], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 4060
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  mov rax, rbp
+  sub rax, 4060
+  push rax
+  pop rdi
+  pop rax
+  sub rax, rdi
+  cqo
+  mov rdi, 4
+  idiv rdi
+  push rax
+  lea rax, [rip+.L.str.2949231164504139461bc8956a71bdc8]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.32
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.32
+.L.call.main.32:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.32:
+  push rax
+  add rsp, 8
+  push 5
+  push 3
+  pop rdi
+  mov dword ptr [rbp-4056], edi
+  push rdi
+  add rsp, 8
+  push 5
+  pop rdi
+  mov dword ptr [rbp-4052], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 4056
+  push rax
+  pop rdi
+  mov qword ptr [rbp-4048], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-4048]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.7d95455daa5756d0614d4a9928e03fbb]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.33
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.33
+.L.call.main.33:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.33:
+  push rax
+  add rsp, 8
+  push 3
+  push 3
+  pop rdi
+  mov dword ptr [rbp-4040], edi
+  push rdi
+  add rsp, 8
+  push 5
+  pop rdi
+  mov dword ptr [rbp-4036], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 4036
+  push rax
+  pop rdi
+  mov qword ptr [rbp-4032], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-4032]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  sub rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.2beefd8a3844bc53073d28faa439d9f6]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.34
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.34
+.L.call.main.34:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.34:
+  push rax
+  add rsp, 8
+  push 5
+  push 3
+  pop rdi
+  mov dword ptr [rbp-4020], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 4020
+  push rax
+  pop rdi
+  mov qword ptr [rbp-4016], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-4016]
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-4020]
+  push rax
+  lea rax, [rip+.L.str.20c538d7c20ee7de4328e6cb32de7509]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.35
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.35
+.L.call.main.35:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.35:
+  push rax
+  add rsp, 8
+  push 7
+  push 3
+  pop rdi
+  mov dword ptr [rbp-4008], edi
+  push rdi
+  add rsp, 8
+  push 5
+  pop rdi
+  mov dword ptr [rbp-4004], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 4008
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 7
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-4004]
+  push rax
+  lea rax, [rip+.L.str.7474f3159ad0c511b3b8ea6fd0721428]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.36
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.36
+.L.call.main.36:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.36:
+  push rax
+  add rsp, 8
+  push 7
+  push 3
+  pop rdi
+  mov dword ptr [rbp-4000], edi
+  push rdi
+  add rsp, 8
+  push 5
+  pop rdi
+  mov dword ptr [rbp-3996], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3996
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  sub rax, rdi
+  push rax
+  push 7
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-4000]
+  push rax
+  lea rax, [rip+.L.str.569eed998946a1c05829453513cb83c2]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.37
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.37
+.L.call.main.37:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.37:
+  push rax
+  add rsp, 8
+  push 8
+  push 3
+  pop rdi
+  mov dword ptr [rbp-3992], edi
+  push rdi
+  add rsp, 8
+  push 5
+  pop rdi
+  mov dword ptr [rbp-3988], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3992
+  push rax
+  mov eax, dword ptr [rbp-3988]
+  push rax
+  pop rsi
+  pop rdi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.38
+  mov eax, 0
+  call addx@PLT
+  jmp .L.end.main.38
+.L.call.main.38:
+  sub rsp, 8
+  mov eax, 0
+  call addx@PLT
+  add rsp, 8
+.L.end.main.38:
+  push rax
+  lea rax, [rip+.L.str.a806fd3f4323667eef46dc3542347e8d]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.39
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.39
+.L.call.main.39:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.39:
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 3984
+  push rax
+  pop rdi
+  mov qword ptr [rbp-3976], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-3976]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3984
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.a5453265b5f86be2cb3e123d2666b3ca]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.40
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.40
+.L.call.main.40:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.40:
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 3964
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3964
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3964
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3964
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.74e2eb9cf9444000fe348e1174af42ae]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.41
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.41
+.L.call.main.41:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.41:
+  push rax
+  add rsp, 8
+  push 4
+  mov rax, rbp
+  sub rax, 3952
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3952
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3952
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3952
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.8eb202b03eb5cd343adbc8ddd2bceddb]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.42
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.42
+.L.call.main.42:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.42:
+  push rax
+  add rsp, 8
+  push 5
+  mov rax, rbp
+  sub rax, 3940
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3940
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3940
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3940
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.a3d0f5f3545cf9418b878c26f0dd3d65]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.43
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.43
+.L.call.main.43:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.43:
+  push rax
+  add rsp, 8
+  push 0
+  mov rax, rbp
+  sub rax, 3928
+  push rax
+  pop rdi
+  mov qword ptr [rbp-3904], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-3904]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3928
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.65ae45a44dc25ac6869d634411434a7f]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.44
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.44
+.L.call.main.44:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.44:
+  push rax
+  add rsp, 8
+  push 1
+  mov rax, rbp
+  sub rax, 3896
+  push rax
+  pop rdi
+  mov qword ptr [rbp-3872], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-3872]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3896
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.948b65c1111aaa4a0491c09098af0df9]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.45
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.45
+.L.call.main.45:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.45:
+  push rax
+  add rsp, 8
+  push 2
+  mov rax, rbp
+  sub rax, 3864
+  push rax
+  pop rdi
+  mov qword ptr [rbp-3840], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-3840]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3864
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.c618da2f2f8b0a248f18b170b22e51af]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.46
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.46
+.L.call.main.46:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.46:
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 3832
+  push rax
+  pop rdi
+  mov qword ptr [rbp-3808], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-3808]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3832
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.aae2ec9af712a7cb78c1d09b7eafbc49]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.47
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.47
+.L.call.main.47:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.47:
+  push rax
+  add rsp, 8
+  push 4
+  mov rax, rbp
+  sub rax, 3800
+  push rax
+  pop rdi
+  mov qword ptr [rbp-3776], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-3776]
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3800
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.ede1ae0e8c76aadd7c4a616ee179a317]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.48
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.48
+.L.call.main.48:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.48:
+  push rax
+  add rsp, 8
+  push 5
+  mov rax, rbp
+  sub rax, 3768
+  push rax
+  pop rdi
+  mov qword ptr [rbp-3744], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-3744]
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3768
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.1e006430081a28c9f4649c21413e9ad4]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.49
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.49
+.L.call.main.49:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.49:
+  push rax
+  add rsp, 8
+  push 6
+  mov rax, rbp
+  sub rax, 3736
+  push rax
+  pop rdi
+  mov qword ptr [rbp-3712], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-3712]
+  push rax
+  push 6
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 6
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3736
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.d8efff27b652783840595a45782baffd]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.50
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.50
+.L.call.main.50:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.50:
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 3700
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3700
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3700
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3700
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.85cf3e461180ca4ddf71e6f38c684f22]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.51
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.51
+.L.call.main.51:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.51:
+  push rax
+  add rsp, 8
+  push 4
+  mov rax, rbp
+  sub rax, 3688
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3688
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3688
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3688
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.7066b31f553ec0c777e897cc400ac3b9]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.52
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.52
+.L.call.main.52:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.52:
+  push rax
+  add rsp, 8
+  push 5
+  mov rax, rbp
+  sub rax, 3676
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3676
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3676
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3676
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.be757aa6f3fa3b72d89b1291defce435]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.53
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.53
+.L.call.main.53:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.53:
+  push rax
+  add rsp, 8
+  push 5
+  mov rax, rbp
+  sub rax, 3664
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3664
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3664
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3664
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.be757aa6f3fa3b72d89b1291defce435]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.54
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.54
+.L.call.main.54:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.54:
+  push rax
+  add rsp, 8
+  push 5
+  mov rax, rbp
+  sub rax, 3652
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3652
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3652
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3652
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.dccb622995e25f906fc70391bda522fa]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.55
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.55
+.L.call.main.55:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.55:
+  push rax
+  add rsp, 8
+  push 0
+  mov rax, rbp
+  sub rax, 3640
+  push rax
+  pop rdi
+  mov qword ptr [rbp-3616], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-3616]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3640
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.77e5d980ce9e7f9f6f9895ba77817f9d]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.56
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.56
+.L.call.main.56:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.56:
+  push rax
+  add rsp, 8
+  push 1
+  mov rax, rbp
+  sub rax, 3608
+  push rax
+  pop rdi
+  mov qword ptr [rbp-3584], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-3584]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3608
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.a5a20aaa47519462e05d1c2297c589bb]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.57
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.57
+.L.call.main.57:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.57:
+  push rax
+  add rsp, 8
+  push 2
+  mov rax, rbp
+  sub rax, 3576
+  push rax
+  pop rdi
+  mov qword ptr [rbp-3552], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-3552]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3576
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.f2ac7e545a87cd6ca4ef6a07f2101cae]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.58
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.58
+.L.call.main.58:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.58:
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 3544
+  push rax
+  pop rdi
+  mov qword ptr [rbp-3520], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-3520]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3544
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.26937f9f5d4bb71a9697e89bf7bcbadd]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.59
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.59
+.L.call.main.59:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.59:
+  push rax
+  add rsp, 8
+  push 4
+  mov rax, rbp
+  sub rax, 3512
+  push rax
+  pop rdi
+  mov qword ptr [rbp-3488], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-3488]
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3512
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.20f6f5e3c033b48cc95d705144172478]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.60
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.60
+.L.call.main.60:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.60:
+  push rax
+  add rsp, 8
+  push 5
+  mov rax, rbp
+  sub rax, 3480
+  push rax
+  pop rdi
+  mov qword ptr [rbp-3456], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-3456]
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3480
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.23d1d9b9706b603a07488bf7e9a7d5f2]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.61
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.61
+.L.call.main.61:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.61:
+  push rax
+  add rsp, 8
+  push 6
+  mov rax, rbp
+  sub rax, 3448
+  push rax
+  pop rdi
+  mov qword ptr [rbp-3424], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-3424]
+  push rax
+  push 6
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 6
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3448
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.9245a90f48ce428b976545a20b7c6eff]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.62
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.62
+.L.call.main.62:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.62:
+  push rax
+  add rsp, 8
+  push 4
+  push 4
+  lea rax, [rip+.L.str.06236a87c1c77a2c4d3f653082b54204]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.63
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.63
+.L.call.main.63:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.63:
+  push rax
+  add rsp, 8
+  push 4
+  push 4
+  lea rax, [rip+.L.str.276066715fee51d4daebb8ee6cd5487d]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.64
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.64
+.L.call.main.64:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.64:
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  lea rax, [rip+.L.str.670a5a10b5f42563a3b9e166465c9caa]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.65
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.65
+.L.call.main.65:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.65:
+  push rax
+  add rsp, 8
+  push 16
+  push 16
+  lea rax, [rip+.L.str.6c1bb7b0f5c95edeab56f0dd347fb173]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.66
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.66
+.L.call.main.66:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.66:
+  push rax
+  add rsp, 8
+  push 48
+  push 48
+  lea rax, [rip+.L.str.053adfe07d14d4276873bb2acdb72831]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.67
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.67
+.L.call.main.67:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.67:
+  push rax
+  add rsp, 8
+  push 16
+  push 16
+  lea rax, [rip+.L.str.eaaac6722f3df068a83d12270e18e7cf]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.68
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.68
+.L.call.main.68:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.68:
+  push rax
+  add rsp, 8
+  push 4
+  push 4
+  lea rax, [rip+.L.str.132adee116a7cc705269392ffa916fbb]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.69
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.69
+.L.call.main.69:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.69:
+  push rax
+  add rsp, 8
+  push 5
+  push 4
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  lea rax, [rip+.L.str.7547a64f7cee5cc9c8a9a92ae841109f]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.70
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.70
+.L.call.main.70:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.70:
+  push rax
+  add rsp, 8
+  push 5
+  push 4
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  lea rax, [rip+.L.str.8013586ef7e14ab66a260d4038b7237c]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.71
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.71
+.L.call.main.71:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.71:
+  push rax
+  add rsp, 8
+  push 4
+  push 4
+  lea rax, [rip+.L.str.14f76637ecac0973537e479e9d3e1063]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.72
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.72
+.L.call.main.72:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.72:
+  push rax
+  add rsp, 8
+  push 0
+  mov rax, qword ptr g1@GOTPCREL[rip]
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.78f7a87c4c5daf4c19343c5c1fd9cc70]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.73
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.73
+.L.call.main.73:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.73:
+  push rax
+  add rsp, 8
+  mov rax, qword ptr g1@GOTPCREL[rip]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  push 3
+  mov rax, qword ptr g1@GOTPCREL[rip]
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.78f7a87c4c5daf4c19343c5c1fd9cc70]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.74
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.74
+.L.call.main.74:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.74:
+  push rax
+  add rsp, 8
+  mov rax, qword ptr g2@GOTPCREL[rip]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr g2@GOTPCREL[rip]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr g2@GOTPCREL[rip]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr g2@GOTPCREL[rip]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  push 0
+  mov rax, qword ptr g2@GOTPCREL[rip]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.7fafcd43d3e631d640294b2bdd412365]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.75
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.75
+.L.call.main.75:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.75:
+  push rax
+  add rsp, 8
+  push 1
+  mov rax, qword ptr g2@GOTPCREL[rip]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.ef82f8233930610b67e4304adc360a7b]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.76
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.76
+.L.call.main.76:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.76:
+  push rax
+  add rsp, 8
+  push 2
+  mov rax, qword ptr g2@GOTPCREL[rip]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.d9279ad34482a8aa02f4a57b9150ad4c]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.77
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.77
+.L.call.main.77:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.77:
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, qword ptr g2@GOTPCREL[rip]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.8e9e7c7146866dd6e6d2189a02bfa34d]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.78
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.78
+.L.call.main.78:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.78:
+  push rax
+  add rsp, 8
+  push 4
+  push 4
+  lea rax, [rip+.L.str.40f6a06b70025d2a4ed581d07e7ff09e]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.79
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.79
+.L.call.main.79:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.79:
+  push rax
+  add rsp, 8
+  push 16
+  push 16
+  lea rax, [rip+.L.str.934bb6ee7615f4206af8281fb86601a3]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.80
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.80
+.L.call.main.80:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.80:
+  push rax
+  add rsp, 8
+  push 1
+  push 1
+  pop rdi
+  movsx edi, dil
+  mov byte ptr [rbp-3092], dil
+  push rdi
+  add rsp, 8
+  movsx eax, byte ptr [rbp-3092]
+  push rax
+  lea rax, [rip+.L.str.09b4581033ee978fcd51ff9b1336ac12]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.81
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.81
+.L.call.main.81:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.81:
+  push rax
+  add rsp, 8
+  push 1
+  push 1
+  pop rdi
+  movsx edi, dil
+  mov byte ptr [rbp-3091], dil
+  push rdi
+  add rsp, 8
+  push 2
+  pop rdi
+  movsx edi, dil
+  mov byte ptr [rbp-3090], dil
+  push rdi
+  add rsp, 8
+  movsx eax, byte ptr [rbp-3091]
+  push rax
+  lea rax, [rip+.L.str.13f8b9c9406cfbba707f6c5a4f92f2a8]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.82
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.82
+.L.call.main.82:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.82:
+  push rax
+  add rsp, 8
+  push 2
+  push 1
+  pop rdi
+  movsx edi, dil
+  mov byte ptr [rbp-3089], dil
+  push rdi
+  add rsp, 8
+  push 2
+  pop rdi
+  movsx edi, dil
+  mov byte ptr [rbp-3088], dil
+  push rdi
+  add rsp, 8
+  movsx eax, byte ptr [rbp-3088]
+  push rax
+  lea rax, [rip+.L.str.967905f3d115da8d4d5f5c044d0d89ac]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.83
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.83
+.L.call.main.83:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.83:
+  push rax
+  add rsp, 8
+  push 1
+  push 1
+  lea rax, [rip+.L.str.77f136a7fde31280ec22f06a60f71b10]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.84
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.84
+.L.call.main.84:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.84:
+  push rax
+  add rsp, 8
+  push 10
+  push 10
+  lea rax, [rip+.L.str.559a732f64fa716cc2684bef03318d04]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.85
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.85
+.L.call.main.85:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.85:
+  push rax
+  add rsp, 8
+  push 1
+  push 7
+  push 3
+  push 3
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  movsxd rdx, edx
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.86
+  mov eax, 0
+  call sub_char@PLT
+  jmp .L.end.main.86
+.L.call.main.86:
+  sub rsp, 8
+  mov eax, 0
+  call sub_char@PLT
+  add rsp, 8
+.L.end.main.86:
+  push rax
+  lea rax, [rip+.L.str.3a0bb40f16ca50b7ed4ef9cdde9b0d60]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.87
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.87
+.L.call.main.87:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.87:
+  push rax
+  add rsp, 8
+  push 97
+  lea rax, [rip+.L.str.dc1114cd074914bd872cc1f9a23ec910]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.dcf756d85f13b2a8461fcd4fcd3c2734]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.88
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.88
+.L.call.main.88:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.88:
+  push rax
+  add rsp, 8
+  push 98
+  lea rax, [rip+.L.str.dc1114cd074914bd872cc1f9a23ec910]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.b3daf5f809bda487e98a790234b06f11]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.89
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.89
+.L.call.main.89:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.89:
+  push rax
+  add rsp, 8
+  push 99
+  lea rax, [rip+.L.str.dc1114cd074914bd872cc1f9a23ec910]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.94835f3df5fb84e21da48d594985321e]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.90
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.90
+.L.call.main.90:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.90:
+  push rax
+  add rsp, 8
+  push 0
+  lea rax, [rip+.L.str.dc1114cd074914bd872cc1f9a23ec910]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.f1827b74e5f5b9f723f02e0fa3881b55]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.91
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.91
+.L.call.main.91:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.91:
+  push rax
+  add rsp, 8
+  push 4
+  push 4
+  lea rax, [rip+.L.str.8cd9748cec1a44f7a75a948210fc5a20]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.92
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.92
+.L.call.main.92:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.92:
+  push rax
+  add rsp, 8
+  push 7
+  lea rax, [rip+.L.str.0a6361b3a802f55cd5ae06101c88a1e2]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.ec7a85bab4bd463ebbdeef73ad37a9d2]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.93
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.93
+.L.call.main.93:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.93:
+  push rax
+  add rsp, 8
+  push 8
+  lea rax, [rip+.L.str.e545d395bb3fd971f91bf9a2b6722831]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.649864307115aba9e96d5a860da11cf0]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.94
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.94
+.L.call.main.94:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.94:
+  push rax
+  add rsp, 8
+  push 9
+  lea rax, [rip+.L.str.a2c4aed1cf757cd9a509734a267ffc7b]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.a1855ad59e86de36e0bc4d025486c2b4]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.95
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.95
+.L.call.main.95:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.95:
+  push rax
+  add rsp, 8
+  push 10
+  lea rax, [rip+.L.str.102b51b9765a56a3e899f7cf0ee38e52]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.cb72953a04f7ea94f7bcf527374d4fae]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.96
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.96
+.L.call.main.96:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.96:
+  push rax
+  add rsp, 8
+  push 11
+  lea rax, [rip+.L.str.cbe2268747c9c8072c7f9926f2288f27]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.f0a819a93579f544609286ccfe1e4f25]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.97
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.97
+.L.call.main.97:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.97:
+  push rax
+  add rsp, 8
+  push 12
+  lea rax, [rip+.L.str.bf60e4349cace6bce0d552e8d783428d]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.a705a460d1ce11dfb3659957f91c53c7]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.98
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.98
+.L.call.main.98:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.98:
+  push rax
+  add rsp, 8
+  push 13
+  lea rax, [rip+.L.str.f566cc6fccc657365c0197accf3a7d6f]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.7cc77db87bd41c33fff16628c322f330]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.99
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.99
+.L.call.main.99:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.99:
+  push rax
+  add rsp, 8
+  push 27
+  lea rax, [rip+.L.str.3a898eecdae167231275338e9a79153c]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.bc440b6be83cc9603700ebca91bd5038]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.100
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.100
+.L.call.main.100:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.100:
+  push rax
+  add rsp, 8
+  push 0
+  lea rax, [rip+.L.str.96a296d224f285c67bee93c30f8a3091]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.4558494c3ded80b9477b24eb95e9606a]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.101
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.101
+.L.call.main.101:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.101:
+  push rax
+  add rsp, 8
+  push 34
+  lea rax, [rip+.L.str.37aa3970b6801c9d286464f7d86e50bf]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.160c0004c07fedbcbd48da89acfaa01d]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.102
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.102
+.L.call.main.102:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.102:
+  push rax
+  add rsp, 8
+  push 92
+  lea rax, [rip+.L.str.1472d0645f552820b5472b91341c2d9a]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.4f423fb70484c373fd5f2b2bffbb8381]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.103
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.103
+.L.call.main.103:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.103:
+  push rax
+  add rsp, 8
+  push 0
+  lea rax, [rip+.L.str.8fb20ef63ced4145fc2e983ffe597d1d]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.38766324d62bc06529786b6ca82f6ccf]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.104
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.104
+.L.call.main.104:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.104:
+  push rax
+  add rsp, 8
+  push 98
+  lea rax, [rip+.L.str.8fb20ef63ced4145fc2e983ffe597d1d]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.13677e293772a72bb1e5c47ec280d227]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.105
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.105
+.L.call.main.105:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.105:
+  push rax
+  add rsp, 8
+  push 4
+  push 4
+  lea rax, [rip+.L.str.e18b38e1466002daccb8f5b1ed6be2c9]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.106
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.106
+.L.call.main.106:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.106:
+  push rax
+  add rsp, 8
+  push 1
+  lea rax, [rip+.L.str.dc1114cd074914bd872cc1f9a23ec910]
+  push rax
+  lea rax, [rip+.L.str.dc1114cd074914bd872cc1f9a23ec910]
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  sete al
+  movzx eax, al
+  push rax
+  lea rax, [rip+.L.str.e0c43d15dfd0e14e77e95f9611705623]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.107
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.107
+.L.call.main.107:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.107:
+  push rax
+  add rsp, 8
+  push 1
+  lea rax, [rip+.L.str.485f9a3ce60cb7873fb74ada7462b8ae]
+  push rax
+  lea rax, [rip+.L.str.dc1114cd074914bd872cc1f9a23ec910]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  sete al
+  movzx eax, al
+  push rax
+  lea rax, [rip+.L.str.ba2f6b47bb1847ba8d29b360f915215d]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.108
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.108
+.L.call.main.108:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.108:
+  push rax
+  add rsp, 8
+  push 0
+  lea rax, [rip+.L.str.969caaeb3626c0d5695eefa6aea53305]
+  push rax
+  lea rax, [rip+.L.str.dc1114cd074914bd872cc1f9a23ec910]
+  push rax
+  pop rdi
+  pop rax
+  cmp rax, rdi
+  sete al
+  movzx eax, al
+  push rax
+  lea rax, [rip+.L.str.70e35361cbf0b60185df2503323ed403]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.109
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.109
+.L.call.main.109:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.109:
+  push rax
+  add rsp, 8
+  push 106
+  lea rax, [rip+.L.str.91046df2aa008410555df240b14243aa]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.089c643df35ef3052ee23f5a3d9808f7]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.110
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.110
+.L.call.main.110:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.110:
+  push rax
+  add rsp, 8
+  push 107
+  lea rax, [rip+.L.str.3038a3216fba1e955d90addce0a77d46]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.b6e3dcda40e4650360f8a44c066564a2]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.111
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.111
+.L.call.main.111:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.111:
+  push rax
+  add rsp, 8
+  push 108
+  lea rax, [rip+.L.str.fcaeb82b28d0198401682757c9e266df]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.97c46205024f4eae5f186c8503e1bdbf]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.112
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.112
+.L.call.main.112:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.112:
+  push rax
+  add rsp, 8
+  push 2
+  push 2
+  pop rdi
+  mov dword ptr [rbp-3076], edi
+  push rdi
+  add rsp, 8
+  push 3
+  pop rdi
+  mov dword ptr [rbp-3072], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-3076]
+  push rax
+  lea rax, [rip+.L.str.620f7a59099efc5c0cda26d776e8d27e]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.113
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.113
+.L.call.main.113:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.113:
+  push rax
+  add rsp, 8
+  push 2
+  push 2
+  pop rdi
+  mov dword ptr [rbp-3068], edi
+  push rdi
+  add rsp, 8
+  push 3
+  pop rdi
+  mov dword ptr [rbp-3064], edi
+  push rdi
+  add rsp, 8
+  push 4
+  pop rdi
+  mov dword ptr [rbp-3060], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-3068]
+  push rax
+  lea rax, [rip+.L.str.8b1041c80bd2d054519e03892ed88bb5]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.114
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.114
+.L.call.main.114:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.114:
+  push rax
+  add rsp, 8
+  push 3
+  push 2
+  pop rdi
+  mov dword ptr [rbp-3056], edi
+  push rdi
+  add rsp, 8
+  push 3
+  pop rdi
+  mov dword ptr [rbp-3056], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-3056]
+  push rax
+  lea rax, [rip+.L.str.3d1cd028325b19f3fc68cffa5911d3ce]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.115
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.115
+.L.call.main.115:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.115:
+  push rax
+  add rsp, 8
+  push 2
+  mov rax, rbp
+  sub rax, 3052
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rdi
+  mov qword ptr [rbp-3032], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-3032]
+  push rax
+  mov rax, rbp
+  sub rax, 3052
+  push rax
+  pop rdi
+  pop rax
+  sub rax, rdi
+  cqo
+  mov rdi, 4
+  idiv rdi
+  push rax
+  lea rax, [rip+.L.str.f51bc45a5b19667ef3fc6728b8ccff07]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.116
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.116
+.L.call.main.116:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.116:
+  push rax
+  add rsp, 8
+  push 1
+  mov rax, rbp
+  sub rax, 3020
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3020
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3020
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.c9eaf70fa8211e0f031af7720ffb1f1b]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.117
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.117
+.L.call.main.117:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.117:
+  push rax
+  add rsp, 8
+  push 2
+  mov rax, rbp
+  sub rax, 3012
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3012
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3012
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.ed7aaed020e915c87e6343b54c2a52fb]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.118
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.118
+.L.call.main.118:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.118:
+  push rax
+  add rsp, 8
+  push 1
+  mov rax, rbp
+  sub rax, 3004
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3004
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3004
+  push rax
+  pop rax
+  add rax, 8
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 3004
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.5efa81f0e283b9d674d2cffdff269de4]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.119
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.119
+.L.call.main.119:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.119:
+  push rax
+  add rsp, 8
+  push 2
+  mov rax, rbp
+  sub rax, 2992
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2992
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2992
+  push rax
+  pop rax
+  add rax, 8
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2992
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.a812ec3b7ef1d3c8a6a6fe35386f7526]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.120
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.120
+.L.call.main.120:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.120:
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 2980
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2980
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2980
+  push rax
+  pop rax
+  add rax, 8
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2980
+  push rax
+  pop rax
+  add rax, 8
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.5cb2b61221ae8b6cae539cf97c219776]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.121
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.121
+.L.call.main.121:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.121:
+  push rax
+  add rsp, 8
+  push 0
+  mov rax, rbp
+  sub rax, 2968
+  push rax
+  pop rdi
+  mov qword ptr [rbp-2944], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-2944]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2968
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.00a91cb49822b57bc4480403478a35c6]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.122
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.122
+.L.call.main.122:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.122:
+  push rax
+  add rsp, 8
+  push 1
+  mov rax, rbp
+  sub rax, 2936
+  push rax
+  pop rdi
+  mov qword ptr [rbp-2912], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-2912]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2936
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.436be983a691101c4d99b288229d3eae]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.123
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.123
+.L.call.main.123:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.123:
+  push rax
+  add rsp, 8
+  push 2
+  mov rax, rbp
+  sub rax, 2904
+  push rax
+  pop rdi
+  mov qword ptr [rbp-2880], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-2880]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2904
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.ed9d311dee45c0f6a4ef37bca4e76a7b]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.124
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.124
+.L.call.main.124:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.124:
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 2872
+  push rax
+  pop rdi
+  mov qword ptr [rbp-2848], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-2848]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2872
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.75a8037bbbbc90ca1e23e1a844dda8ea]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.125
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.125
+.L.call.main.125:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.125:
+  push rax
+  add rsp, 8
+  push 6
+  mov rax, rbp
+  sub rax, 2840
+  push rax
+  pop rdi
+  mov qword ptr [rbp-2808], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2840
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 6
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-2808]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.35bd72117d2a9135fe98484ad9f5e053]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.126
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.126
+.L.call.main.126:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.126:
+  push rax
+  add rsp, 8
+  push 7
+  mov rax, rbp
+  sub rax, 2800
+  push rax
+  pop rdi
+  mov qword ptr [rbp-2768], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2800
+  push rax
+  pop rax
+  add rax, 12
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 7
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-2768]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.20959ab29c5e9aa28405cdc580398bf6]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.127
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.127
+.L.call.main.127:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.127:
+  push rax
+  add rsp, 8
+  push 6
+  mov rax, rbp
+  sub rax, 2760
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 6
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2760
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.195310ad1496e9c75be31a00b983ccaa]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.128
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.128
+.L.call.main.128:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.128:
+  push rax
+  add rsp, 8
+  push 4
+  push 4
+  lea rax, [rip+.L.str.b2dfb8603a713fb0943317444e57bdcc]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.129
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.129
+.L.call.main.129:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.129:
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  lea rax, [rip+.L.str.5cc5175a151e1fc8497e10391a80200e]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.130
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.130
+.L.call.main.130:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.130:
+  push rax
+  add rsp, 8
+  push 12
+  push 12
+  lea rax, [rip+.L.str.74a17cf3ae565bb9cbb89c8eb47b69d4]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.131
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.131
+.L.call.main.131:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.131:
+  push rax
+  add rsp, 8
+  push 16
+  push 16
+  lea rax, [rip+.L.str.cb384dac3f81a4c4cfd9469289565fbf]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.132
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.132
+.L.call.main.132:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.132:
+  push rax
+  add rsp, 8
+  push 24
+  push 24
+  lea rax, [rip+.L.str.886a05412cab00c2fdb511a0f442f44c]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.133
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.133
+.L.call.main.133:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.133:
+  push rax
+  add rsp, 8
+  push 2
+  push 2
+  lea rax, [rip+.L.str.ceb510d574129dba93341f178196892c]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.134
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.134
+.L.call.main.134:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.134:
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  lea rax, [rip+.L.str.ccab97874c0fae89548a3ce990545d57]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.135
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.135
+.L.call.main.135:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.135:
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  lea rax, [rip+.L.str.b942e8437183a901094ace367989f693]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.136
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.136
+.L.call.main.136:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.136:
+  push rax
+  add rsp, 8
+  push 7
+  mov rax, rbp
+  sub rax, 2672
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2664], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2665
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2660], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2660]
+  push rax
+  mov eax, dword ptr [rbp-2664]
+  push rax
+  pop rdi
+  pop rax
+  sub eax, edi
+  push rax
+  lea rax, [rip+.L.str.f148bfbee9d5b51df1a631dd790ed083]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.137
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.137
+.L.call.main.137:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.137:
+  push rax
+  add rsp, 8
+  push 1
+  mov rax, rbp
+  sub rax, 2653
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2648], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2652
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2644], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2644]
+  push rax
+  mov eax, dword ptr [rbp-2648]
+  push rax
+  pop rdi
+  pop rax
+  sub eax, edi
+  push rax
+  lea rax, [rip+.L.str.c0edd7f17cce629ff96926e0b524d23e]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.138
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.138
+.L.call.main.138:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.138:
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  lea rax, [rip+.L.str.8ec4790dc17a9313b23e8ff48e75ecaf]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.139
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.139
+.L.call.main.139:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.139:
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  lea rax, [rip+.L.str.bc1b424690b1c416826e7bc0c891ec34]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.140
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.140
+.L.call.main.140:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.140:
+  push rax
+  add rsp, 8
+  push 2
+  push 2
+  lea rax, [rip+.L.str.ae5ddb315dafbc2b1627ddb43c955168]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.141
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.141
+.L.call.main.141:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.141:
+  push rax
+  add rsp, 8
+  push 3
+  push 1
+  pop rdi
+  mov dword ptr [rbp-2612], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2608
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2612]
+  push rax
+  mov rax, rbp
+  sub rax, 2608
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  lea rax, [rip+.L.str.4ccb525be0a1df4a2988d3e6c8670545]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.142
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.142
+.L.call.main.142:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.142:
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 2601
+  push rax
+  pop rdi
+  mov qword ptr [rbp-2600], rdi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2601
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-2600]
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.70aba65e40d3127bcf37672025d3b441]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.143
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.143
+.L.call.main.143:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.143:
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 2585
+  push rax
+  pop rdi
+  mov qword ptr [rbp-2584], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-2584]
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2585
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.6ad8cbc3c5be947148b042213d86ed2f]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.144
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.144
+.L.call.main.144:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.144:
+  push rax
+  add rsp, 8
+  push 1
+  push 1
+  pop rdi
+  mov dword ptr [rbp-2576], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2576]
+  push rax
+  lea rax, [rip+.L.str.a439ee11fc317059c2042da1ac859551]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.145
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.145
+.L.call.main.145:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.145:
+  push rax
+  add rsp, 8
+  push 1
+  mov rax, rbp
+  sub rax, 2572
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2572
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.1e987877c64e3b465cc46c286d040787]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.146
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.146
+.L.call.main.146:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.146:
+  push rax
+  add rsp, 8
+  push 1
+  push 1
+  pop rdi
+  mov dword ptr [rbp-2568], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2568]
+  push rax
+  lea rax, [rip+.L.str.a35953d2d8ff2ddf559bbf18de297c18]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.147
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.147
+.L.call.main.147:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.147:
+  push rax
+  add rsp, 8
+  push 2
+  mov rax, rbp
+  sub rax, 2564
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2564
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.5d9ece73a69d01d30169814bdb8ffdd1]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.148
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.148
+.L.call.main.148:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.148:
+  push rax
+  add rsp, 8
+  push 2
+  push 2
+  lea rax, [rip+.L.str.67cdf221af07985c55fd0a8fcb7465ec]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.149
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.149
+.L.call.main.149:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.149:
+  push rax
+  add rsp, 8
+  push 4
+  push 4
+  lea rax, [rip+.L.str.5640cee72193a937193042f65ed602b1]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.150
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.150
+.L.call.main.150:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.150:
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  lea rax, [rip+.L.str.75ca199a2410b101f85ea5e07e2c9848]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.151
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.151
+.L.call.main.151:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.151:
+  push rax
+  add rsp, 8
+  push 16
+  push 16
+  lea rax, [rip+.L.str.380fa6aa90ca1ac7ffcb39908436a4ca]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.152
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.152
+.L.call.main.152:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.152:
+  push rax
+  add rsp, 8
+  push 1
+  push 7
+  push 3
+  push 3
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  movsxd rdx, edx
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.153
+  mov eax, 0
+  call sub_short@PLT
+  jmp .L.end.main.153
+.L.call.main.153:
+  sub rsp, 8
+  mov eax, 0
+  call sub_short@PLT
+  add rsp, 8
+.L.end.main.153:
+  push rax
+  lea rax, [rip+.L.str.1288342e2d207955aae6e1eed432f46e]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.154
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.154
+.L.call.main.154:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.154:
+  push rax
+  add rsp, 8
+  push 1
+  push 7
+  push 3
+  push 3
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  movsxd rdx, edx
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.155
+  mov eax, 0
+  call sub_long@PLT
+  jmp .L.end.main.155
+.L.call.main.155:
+  sub rsp, 8
+  mov eax, 0
+  call sub_long@PLT
+  add rsp, 8
+.L.end.main.155:
+  push rax
+  lea rax, [rip+.L.str.6e7f905b8190262ec3236a38a4297d1a]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.156
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.156
+.L.call.main.156:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.156:
+  push rax
+  add rsp, 8
+  push 24
+  push 24
+  lea rax, [rip+.L.str.630ffa999740fb875555f0a785de50d1]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.157
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.157
+.L.call.main.157:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.157:
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  lea rax, [rip+.L.str.e37f1f517327142def5b1de539d8e9b2]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.158
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.158
+.L.call.main.158:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.158:
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 2496
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  mov rax, rbp
+  sub rax, 2472
+  push rax
+  pop rdi
+  pop rax
+  mov qword ptr [rax], rdi
+  push rdi
+  add rsp, 8
+  push 3
+  pop rdi
+  mov dword ptr [rbp-2472], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2496
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  mov rax, qword ptr [rax]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.1ff94e56bc2792c27a14e93fec517be4]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.159
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.159
+.L.call.main.159:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.159:
+  push rax
+  add rsp, 8
+  push 4
+  mov rax, rbp
+  sub rax, 2468
+  push rax
+  pop rdi
+  mov qword ptr [rbp-2456], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-2456]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 12
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rdi
+  mov qword ptr [rbp-176], rdi
+  push rdi
+  push 4
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-176]
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.8870628f75608238cb3bec22d6e348f3]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.160
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.160
+.L.call.main.160:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.160:
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.161
+  mov eax, 0
+  call g1_ptr@PLT
+  jmp .L.end.main.161
+.L.call.main.161:
+  sub rsp, 8
+  mov eax, 0
+  call g1_ptr@PLT
+  add rsp, 8
+.L.end.main.161:
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.bba2aa78ed52cdb4702a51bffb810f08]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.162
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.162
+.L.call.main.162:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.162:
+  push rax
+  add rsp, 8
+  push 7
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.163
+  mov eax, 0
+  call static_fn
+  jmp .L.end.main.163
+.L.call.main.163:
+  sub rsp, 8
+  mov eax, 0
+  call static_fn
+  add rsp, 8
+.L.end.main.163:
+  push rax
+  lea rax, [rip+.L.str.f6604ce205c71b65a05e3100341285c0]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.164
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.164
+.L.call.main.164:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.164:
+  push rax
+  add rsp, 8
+  push 7
+  push 2
+  pop rdi
+  mov dword ptr [rbp-2416], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2448
+  push rax
+  mov eax, dword ptr [rbp-2416]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rdi
+  mov qword ptr [rbp-168], rdi
+  push rdi
+  pop rax
+  add rax, 0
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-168]
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-168]
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  mov rax, qword ptr [rbp-168]
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  lea rax, [rip+.L.str.18e3115df67b19255a824a04e1e4a7cc]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.165
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.165
+.L.call.main.165:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.165:
+  push rax
+  add rsp, 8
+  push 11
+  push 1
+  pop rdi
+  mov dword ptr [rbp-2396], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2412
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2412
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 6
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2412
+  push rax
+  mov eax, dword ptr [rbp-2396]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2392], edi
+  push rdi
+  add rsp, 8
+  push 2
+  pop rdi
+  mov dword ptr [rbp-2396], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2392]
+  push rax
+  mov rax, rbp
+  sub rax, 2412
+  push rax
+  mov eax, dword ptr [rbp-2396]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  lea rax, [rip+.L.str.267f4873cb4f97438cca6b5bc46c26d9]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.166
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.166
+.L.call.main.166:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.166:
+  push rax
+  add rsp, 8
+  push 12
+  push 1
+  pop rdi
+  mov dword ptr [rbp-2388], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2388
+  push rax
+  pop rdi
+  mov qword ptr [rbp-2384], rdi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2388]
+  push rax
+  mov eax, dword ptr [rbp-2388]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2376], edi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-2384]
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2376]
+  push rax
+  mov eax, dword ptr [rbp-2388]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  mov eax, dword ptr [rbp-2388]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  lea rax, [rip+.L.str.d14ca92df7f0de7733ec28731031c411]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.167
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.167
+.L.call.main.167:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.167:
+  push rax
+  add rsp, 8
+  push 53
+  push 2
+  pop rdi
+  mov dword ptr [rip+g3], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rip+g3]
+  push rax
+  mov eax, dword ptr [rip+g3]
+  push rax
+  pop rdi
+  pop rax
+  imul eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2372], edi
+  push rdi
+  add rsp, 8
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.168
+  mov eax, 0
+  call static_fn
+  jmp .L.end.main.168
+.L.call.main.168:
+  sub rsp, 8
+  mov eax, 0
+  call static_fn
+  add rsp, 8
+.L.end.main.168:
+  push rax
+  add rsp, 8
+  mov eax, dword ptr [rbp-2372]
+  push rax
+  mov eax, dword ptr [rip+g3]
+  push rax
+  mov eax, dword ptr [rip+g3]
+  push rax
+  pop rdi
+  pop rax
+  imul eax, edi
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  lea rax, [rip+.L.str.84869a8fb29d643602633b0154e6f655]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.169
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.169
+.L.call.main.169:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.169:
+  push rax
+  add rsp, 8
+  push 3
+  push 1
+  pop rdi
+  mov dword ptr [rbp-2368], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2364
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2364
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2364
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2364
+  push rax
+  mov eax, dword ptr [rbp-2368]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2352], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2352]
+  push rax
+  push 0
+  mov eax, dword ptr [rbp-2368]
+  push rax
+  pop rdi
+  pop rax
+  pop rcx
+  cmp ecx, 0
+  cmove eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2368], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2352]
+  push rax
+  mov rax, rbp
+  sub rax, 2364
+  push rax
+  mov eax, dword ptr [rbp-2368]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  lea rax, [rip+.L.str.0a367bad0cd891293295141a4be153f7]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.170
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.170
+.L.call.main.170:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.170:
+  push rax
+  add rsp, 8
+  push 150
+  push 5
+  pop rdi
+  mov dword ptr [rbp-2348], edi
+  push rdi
+  add rsp, 8
+  push 0
+  pop rdi
+  mov dword ptr [rbp-2344], edi
+  push rdi
+  add rsp, 8
+  push 0
+  pop rdi
+  mov dword ptr [rbp-2340], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2348]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-192], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2348]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  imul eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-188], edi
+  push rdi
+  add rsp, 8
+.L.begin.main.171:
+  mov eax, dword ptr [rbp-2340]
+  push rax
+  mov eax, dword ptr [rbp-192]
+  push rax
+  pop rdi
+  pop rax
+  cmp eax, edi
+  jge .L.end.main.171
+  mov eax, dword ptr [rbp-2344]
+  push rax
+  mov eax, dword ptr [rbp-188]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2344], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2340]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2340], edi
+  push rdi
+  add rsp, 8
+  jmp .L.begin.main.171
+.L.end.main.171:
+  mov eax, dword ptr [rbp-2344]
+  push rax
+  lea rax, [rip+.L.str.03e4bdbbbc2d8b3a4c7e14d48b254b5c]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.172
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.172
+.L.call.main.172:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.172:
+  push rax
+  add rsp, 8
+  push 12
+  mov rax, qword ptr g1@GOTPCREL[rip]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  push 0
+  pop rdi
+  mov dword ptr [rbp-2336], edi
+  push rdi
+  add rsp, 8
+  push 0
+  pop rdi
+  mov dword ptr [rbp-2332], edi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr g1@GOTPCREL[rip]
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  mov rax, qword ptr g1@GOTPCREL[rip]
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  imul eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-184], edi
+  push rdi
+  add rsp, 8
+.L.begin.main.173:
+  mov eax, dword ptr [rbp-2332]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  cmp eax, edi
+  jge .L.end.main.173
+  mov eax, dword ptr [rbp-2336]
+  push rax
+  mov eax, dword ptr [rbp-184]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2336], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2332]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2332], edi
+  push rdi
+  add rsp, 8
+  jmp .L.begin.main.173
+.L.end.main.173:
+  mov eax, dword ptr [rbp-2336]
+  push rax
+  lea rax, [rip+.L.str.de2e2eb85163ed97482f98f1ae291782]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.174
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.174
+.L.call.main.174:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.174:
+  push rax
+  add rsp, 8
+  push 12
+  push 1
+  pop rdi
+  mov dword ptr [rbp-2328], edi
+  push rdi
+  add rsp, 8
+  push 0
+  pop rdi
+  mov dword ptr [rbp-2324], edi
+  push rdi
+  add rsp, 8
+  push 0
+  pop rdi
+  mov dword ptr [rbp-2320], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2324]
+  push rax
+  mov eax, dword ptr [rbp-2328]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul eax, edi
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2324], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2328]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2328], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2320]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2320], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2324]
+  push rax
+  mov eax, dword ptr [rbp-2328]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul eax, edi
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2324], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2328]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2328], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2320]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2320], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2324]
+  push rax
+  mov eax, dword ptr [rbp-2328]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul eax, edi
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2324], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2328]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2328], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2320]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2320], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2324]
+  push rax
+  lea rax, [rip+.L.str.1d4373798881ea6a4e023e087632524d]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.175
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.175
+.L.call.main.175:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.175:
+  push rax
+  add rsp, 8
+  push 12
+  push 1
+  pop rdi
+  mov dword ptr [rbp-2316], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2316
+  push rax
+  pop rdi
+  mov qword ptr [rbp-2312], rdi
+  push rdi
+  add rsp, 8
+  push 0
+  pop rdi
+  mov dword ptr [rbp-2300], edi
+  push rdi
+  add rsp, 8
+  push 0
+  pop rdi
+  mov dword ptr [rbp-2296], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2300]
+  push rax
+  mov eax, dword ptr [rbp-2316]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul eax, edi
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2300], edi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-2312]
+  push rax
+  mov rax, qword ptr [rbp-2312]
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2296]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2296], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2300]
+  push rax
+  mov eax, dword ptr [rbp-2316]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul eax, edi
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2300], edi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-2312]
+  push rax
+  mov rax, qword ptr [rbp-2312]
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2296]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2296], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2300]
+  push rax
+  mov eax, dword ptr [rbp-2316]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  imul eax, edi
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2300], edi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-2312]
+  push rax
+  mov rax, qword ptr [rbp-2312]
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2296]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2296], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2300]
+  push rax
+  lea rax, [rip+.L.str.d34e108b21e4eb5f48057603315d31fc]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.176
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.176
+.L.call.main.176:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.176:
+  push rax
+  add rsp, 8
+  push 6
+  push 2
+  pop rdi
+  mov dword ptr [rbp-2292], edi
+  push rdi
+  add rsp, 8
+  push 0
+  pop rdi
+  mov dword ptr [rbp-2288], edi
+  push rdi
+  add rsp, 8
+  push 0
+  pop rdi
+  mov dword ptr [rbp-2284], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2292]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-180], edi
+  push rdi
+  add rsp, 8
+.L.begin.main.177:
+  mov eax, dword ptr [rbp-2284]
+  push rax
+  mov eax, dword ptr [rbp-180]
+  push rax
+  pop rdi
+  pop rax
+  cmp eax, edi
+  jge .L.end.main.177
+  push 0
+  pop rdi
+  mov dword ptr [rbp-2280], edi
+  push rdi
+  add rsp, 8
+.L.begin.main.178:
+  mov eax, dword ptr [rbp-2280]
+  push rax
+  mov eax, dword ptr [rbp-2292]
+  push rax
+  pop rdi
+  pop rax
+  cmp eax, edi
+  jge .L.end.main.178
+  mov eax, dword ptr [rbp-2288]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2288], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2280]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2280], edi
+  push rdi
+  add rsp, 8
+  jmp .L.begin.main.178
+.L.end.main.178:
+  mov eax, dword ptr [rbp-2284]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2284], edi
+  push rdi
+  add rsp, 8
+  jmp .L.begin.main.177
+.L.end.main.177:
+  mov eax, dword ptr [rbp-2288]
+  push rax
+  lea rax, [rip+.L.str.b8989dc68667bc52af6a301edaea644a]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.179
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.179
+.L.call.main.179:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.179:
+  push rax
+  add rsp, 8
+  push 4510
+  push 0
+  pop rdi
+  mov dword ptr [rbp-2272], edi
+  push rdi
+  add rsp, 8
+  push 0
+  pop rdi
+  mov dword ptr [rbp-2276], edi
+  push rdi
+  add rsp, 8
+.L.begin.main.180:
+  mov eax, dword ptr [rbp-2276]
+  push rax
+  push 8
+  pop rdi
+  pop rax
+  cmp eax, edi
+  jge .L.end.main.180
+  mov eax, dword ptr [rbp-2272]
+  push rax
+  mov eax, dword ptr [rbp-2276]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2272], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2276]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2276], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2272]
+  push rax
+  mov eax, dword ptr [rbp-2276]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2272], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2276]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2276], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2272]
+  push rax
+  mov eax, dword ptr [rbp-2276]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2272], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2276]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2276], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2272]
+  push rax
+  mov eax, dword ptr [rbp-2276]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2272], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2276]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2276], edi
+  push rdi
+  add rsp, 8
+  jmp .L.begin.main.180
+.L.end.main.180:
+  mov eax, dword ptr [rbp-2272]
+  push rax
+  mov eax, dword ptr [rbp-2276]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2272], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2276]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2276], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2272]
+  push rax
+  mov eax, dword ptr [rbp-2276]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2272], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2276]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2276], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2272]
+  push rax
+  push 100
+  pop rdi
+  pop rax
+  imul eax, edi
+  push rax
+  mov eax, dword ptr [rbp-2276]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  lea rax, [rip+.L.str.c403ed00efa237b74be213e67e6ed4a3]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.181
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.181
+.L.call.main.181:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.181:
+  push rax
+  add rsp, 8
+  push 1206
+  push 0
+  pop rdi
+  mov dword ptr [rbp-2264], edi
+  push rdi
+  add rsp, 8
+  push 3
+  pop rdi
+  mov dword ptr [rbp-2268], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2264]
+  push rax
+  mov eax, dword ptr [rbp-2268]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2264], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2268]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2268], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2264]
+  push rax
+  mov eax, dword ptr [rbp-2268]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2264], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2268]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2268], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2264]
+  push rax
+  mov eax, dword ptr [rbp-2268]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2264], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2268]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2268], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2264]
+  push rax
+  push 100
+  pop rdi
+  pop rax
+  imul eax, edi
+  push rax
+  mov eax, dword ptr [rbp-2268]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  lea rax, [rip+.L.str.7e7339e7b103727f42a24722dfe59dbb]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.182
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.182
+.L.call.main.182:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.182:
+  push rax
+  add rsp, 8
+  push 5
+  push 7
+  pop rdi
+  mov dword ptr [rbp-2260], edi
+  push rdi
+  add rsp, 8
+  push 0
+  pop rdi
+  mov dword ptr [rbp-2256], edi
+  push rdi
+  add rsp, 8
+  push 5
+  pop rdi
+  mov dword ptr [rbp-2260], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2256]
+  push rax
+  push 100
+  pop rdi
+  pop rax
+  imul eax, edi
+  push rax
+  mov eax, dword ptr [rbp-2260]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  lea rax, [rip+.L.str.323bc316527669469fcda58c8d2f4151]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.183
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.183
+.L.call.main.183:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.183:
+  push rax
+  add rsp, 8
+  push 132
+  push 0
+  pop rdi
+  mov dword ptr [rbp-2132], edi
+  push rdi
+  add rsp, 8
+.L.begin.main.184:
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  push 8
+  pop rdi
+  pop rax
+  cmp eax, edi
+  jge .L.end.main.184
+  mov rax, rbp
+  sub rax, 2212
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2172
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  push 10
+  pop rdi
+  pop rax
+  imul eax, edi
+  push rax
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2132], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2212
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2172
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  push 10
+  pop rdi
+  pop rax
+  imul eax, edi
+  push rax
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2132], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2212
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2172
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  push 10
+  pop rdi
+  pop rax
+  imul eax, edi
+  push rax
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2132], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2212
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2172
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  push 10
+  pop rdi
+  pop rax
+  imul eax, edi
+  push rax
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2132], edi
+  push rdi
+  add rsp, 8
+  jmp .L.begin.main.184
+.L.end.main.184:
+  mov rax, rbp
+  sub rax, 2212
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2172
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  push 10
+  pop rdi
+  pop rax
+  imul eax, edi
+  push rax
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2132], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2212
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2172
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  push 10
+  pop rdi
+  pop rax
+  imul eax, edi
+  push rax
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2132], edi
+  push rdi
+  add rsp, 8
+  push 0
+  pop rdi
+  mov dword ptr [rbp-2132], edi
+  push rdi
+  add rsp, 8
+.L.begin.main.185:
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  push 8
+  pop rdi
+  pop rax
+  cmp eax, edi
+  jge .L.end.main.185
+  mov rax, rbp
+  sub rax, 2252
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  mov rax, rbp
+  sub rax, 2212
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  mov rax, rbp
+  sub rax, 2172
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2132], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2252
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  mov rax, rbp
+  sub rax, 2212
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  mov rax, rbp
+  sub rax, 2172
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2132], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2252
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  mov rax, rbp
+  sub rax, 2212
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  mov rax, rbp
+  sub rax, 2172
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2132], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2252
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  mov rax, rbp
+  sub rax, 2212
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  mov rax, rbp
+  sub rax, 2172
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2132], edi
+  push rdi
+  add rsp, 8
+  jmp .L.begin.main.185
+.L.end.main.185:
+  mov rax, rbp
+  sub rax, 2252
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  mov rax, rbp
+  sub rax, 2212
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  mov rax, rbp
+  sub rax, 2172
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2132], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2252
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  mov rax, rbp
+  sub rax, 2212
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  mov rax, rbp
+  sub rax, 2172
+  push rax
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2132]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2132], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2252
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  mov rax, rbp
+  sub rax, 2252
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  mov rax, rbp
+  sub rax, 2252
+  push rax
+  push 9
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  lea rax, [rip+.L.str.61186092a7140c82fae61a46a9af3a78]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.186
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.186
+.L.call.main.186:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.186:
+  push rax
+  add rsp, 8
+  push 0
+  push 106
+  pop rdi
+  pop rax
+  sub eax, edi
+  push rax
+  push 0
+  pop rdi
+  mov dword ptr [rbp-2088], edi
+  push rdi
+  add rsp, 8
+.L.begin.main.187:
+  mov eax, dword ptr [rbp-2088]
+  push rax
+  push 20
+  pop rdi
+  pop rax
+  cmp eax, edi
+  jge .L.end.main.187
+  mov rax, rbp
+  sub rax, 2108
+  push rax
+  mov eax, dword ptr [rbp-2088]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  mov eax, dword ptr [rbp-2088]
+  push rax
+  push 10
+  pop rdi
+  pop rax
+  imul eax, edi
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2088]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2088], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2108
+  push rax
+  mov eax, dword ptr [rbp-2088]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  mov eax, dword ptr [rbp-2088]
+  push rax
+  push 10
+  pop rdi
+  pop rax
+  imul eax, edi
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2088]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2088], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2108
+  push rax
+  mov eax, dword ptr [rbp-2088]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  mov eax, dword ptr [rbp-2088]
+  push rax
+  push 10
+  pop rdi
+  pop rax
+  imul eax, edi
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2088]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2088], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2108
+  push rax
+  mov eax, dword ptr [rbp-2088]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  mov eax, dword ptr [rbp-2088]
+  push rax
+  push 10
+  pop rdi
+  pop rax
+  imul eax, edi
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2088]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2088], edi
+  push rdi
+  add rsp, 8
+  jmp .L.begin.main.187
+.L.end.main.187:
+  push 0
+  pop rdi
+  mov dword ptr [rbp-2088], edi
+  push rdi
+  add rsp, 8
+.L.begin.main.188:
+  mov eax, dword ptr [rbp-2088]
+  push rax
+  push 20
+  pop rdi
+  pop rax
+  cmp eax, edi
+  jge .L.end.main.188
+  mov rax, rbp
+  sub rax, 2128
+  push rax
+  mov eax, dword ptr [rbp-2088]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  mov rax, rbp
+  sub rax, 2108
+  push rax
+  mov eax, dword ptr [rbp-2088]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  push 100
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2088]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2088], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2128
+  push rax
+  mov eax, dword ptr [rbp-2088]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  mov rax, rbp
+  sub rax, 2108
+  push rax
+  mov eax, dword ptr [rbp-2088]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  push 100
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2088]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2088], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2128
+  push rax
+  mov eax, dword ptr [rbp-2088]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  mov rax, rbp
+  sub rax, 2108
+  push rax
+  mov eax, dword ptr [rbp-2088]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  push 100
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2088]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2088], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2128
+  push rax
+  mov eax, dword ptr [rbp-2088]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  mov rax, rbp
+  sub rax, 2108
+  push rax
+  mov eax, dword ptr [rbp-2088]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  push 100
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2088]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2088], edi
+  push rdi
+  add rsp, 8
+  jmp .L.begin.main.188
+.L.end.main.188:
+  movsx eax, byte ptr [rbp-154]
+  push rax
+  movsx eax, byte ptr [rbp-154]
+  push rax
+  push 0
+  pop rdi
+  mov dword ptr [rbp-2088], edi
+  push rdi
+  add rsp, 8
+.L.begin.main.189:
+  mov eax, dword ptr [rbp-2088]
+  push rax
+  push 20
+  pop rdi
+  pop rax
+  cmp eax, edi
+  jge .L.end.main.189
+  mov rax, rbp
+  sub rax, 2128
+  push rax
+  mov eax, dword ptr [rbp-2088]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  mov rax, rbp
+  sub rax, 2108
+  push rax
+  mov eax, dword ptr [rbp-2088]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  push 100
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2088]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2088], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2128
+  push rax
+  mov eax, dword ptr [rbp-2088]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  mov rax, rbp
+  sub rax, 2108
+  push rax
+  mov eax, dword ptr [rbp-2088]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  push 100
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2088]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2088], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2128
+  push rax
+  mov eax, dword ptr [rbp-2088]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  mov rax, rbp
+  sub rax, 2108
+  push rax
+  mov eax, dword ptr [rbp-2088]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  push 100
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2088]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2088], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2128
+  push rax
+  mov eax, dword ptr [rbp-2088]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  mov rax, rbp
+  sub rax, 2108
+  push rax
+  mov eax, dword ptr [rbp-2088]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  push 100
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2088]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2088], edi
+  push rdi
+  add rsp, 8
+  jmp .L.begin.main.189
+.L.end.main.189:
+  movsx eax, byte ptr [rbp-154]
+  push rax
+  movsx eax, byte ptr [rbp-154]
+  push rax
+  lea rax, [rip+.L.str.46deca2b6ca9f86748b0bfa4a21bf952]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.190
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.190
+.L.call.main.190:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.190:
+  push rax
+  add rsp, 8
+  push 34
+  push 0
+  pop rdi
+  mov dword ptr [rbp-2044], edi
+  push rdi
+  add rsp, 8
+.L.begin.main.191:
+  mov eax, dword ptr [rbp-2044]
+  push rax
+  push 20
+  pop rdi
+  pop rax
+  cmp eax, edi
+  jge .L.end.main.191
+  mov rax, rbp
+  sub rax, 2064
+  push rax
+  mov eax, dword ptr [rbp-2044]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  mov eax, dword ptr [rbp-2044]
+  push rax
+  push 10
+  pop rdi
+  pop rax
+  imul eax, edi
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2044]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2044], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2064
+  push rax
+  mov eax, dword ptr [rbp-2044]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  mov eax, dword ptr [rbp-2044]
+  push rax
+  push 10
+  pop rdi
+  pop rax
+  imul eax, edi
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2044]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2044], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2064
+  push rax
+  mov eax, dword ptr [rbp-2044]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  mov eax, dword ptr [rbp-2044]
+  push rax
+  push 10
+  pop rdi
+  pop rax
+  imul eax, edi
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2044]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2044], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2064
+  push rax
+  mov eax, dword ptr [rbp-2044]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  mov eax, dword ptr [rbp-2044]
+  push rax
+  push 10
+  pop rdi
+  pop rax
+  imul eax, edi
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2044]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2044], edi
+  push rdi
+  add rsp, 8
+  jmp .L.begin.main.191
+.L.end.main.191:
+  push 0
+  pop rdi
+  mov dword ptr [rbp-2044], edi
+  push rdi
+  add rsp, 8
+.L.begin.main.192:
+  mov eax, dword ptr [rbp-2044]
+  push rax
+  push 20
+  pop rdi
+  pop rax
+  cmp eax, edi
+  jge .L.end.main.192
+  mov rax, rbp
+  sub rax, 2084
+  push rax
+  mov eax, dword ptr [rbp-2044]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  mov rax, rbp
+  sub rax, 2064
+  push rax
+  mov eax, dword ptr [rbp-2044]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  push 100
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2044]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2044], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2084
+  push rax
+  mov eax, dword ptr [rbp-2044]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  mov rax, rbp
+  sub rax, 2064
+  push rax
+  mov eax, dword ptr [rbp-2044]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  push 100
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2044]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2044], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2084
+  push rax
+  mov eax, dword ptr [rbp-2044]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  mov rax, rbp
+  sub rax, 2064
+  push rax
+  mov eax, dword ptr [rbp-2044]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  push 100
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2044]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2044], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2084
+  push rax
+  mov eax, dword ptr [rbp-2044]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  mov rax, rbp
+  sub rax, 2064
+  push rax
+  mov eax, dword ptr [rbp-2044]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  push 100
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2044]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2044], edi
+  push rdi
+  add rsp, 8
+  jmp .L.begin.main.192
+.L.end.main.192:
+  movsx eax, byte ptr [rbp-153]
+  push rax
+  movsx eax, byte ptr [rbp-153]
+  push rax
+  push 0
+  pop rdi
+  mov dword ptr [rbp-2044], edi
+  push rdi
+  add rsp, 8
+.L.begin.main.193:
+  mov eax, dword ptr [rbp-2044]
+  push rax
+  push 20
+  pop rdi
+  pop rax
+  cmp eax, edi
+  jge .L.end.main.193
+  mov rax, rbp
+  sub rax, 2084
+  push rax
+  mov eax, dword ptr [rbp-2044]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  mov rax, rbp
+  sub rax, 2064
+  push rax
+  mov eax, dword ptr [rbp-2044]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  push 100
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2044]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2044], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2084
+  push rax
+  mov eax, dword ptr [rbp-2044]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  mov rax, rbp
+  sub rax, 2064
+  push rax
+  mov eax, dword ptr [rbp-2044]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  push 100
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2044]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2044], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2084
+  push rax
+  mov eax, dword ptr [rbp-2044]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  mov rax, rbp
+  sub rax, 2064
+  push rax
+  mov eax, dword ptr [rbp-2044]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  push 100
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2044]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2044], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2084
+  push rax
+  mov eax, dword ptr [rbp-2044]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  mov rax, rbp
+  sub rax, 2064
+  push rax
+  mov eax, dword ptr [rbp-2044]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  push 100
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2044]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2044], edi
+  push rdi
+  add rsp, 8
+  jmp .L.begin.main.193
+.L.end.main.193:
+  movsx eax, byte ptr [rbp-153]
+  push rax
+  movsx eax, byte ptr [rbp-153]
+  push rax
+  lea rax, [rip+.L.str.ba8d8ca6314e49082f2c9bcebae89db1]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.194
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.194
+.L.call.main.194:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.194:
+  push rax
+  add rsp, 8
+  push 13
+  push 0
+  pop rdi
+  mov dword ptr [rbp-2004], edi
+  push rdi
+  add rsp, 8
+.L.begin.main.195:
+  mov eax, dword ptr [rbp-2004]
+  push rax
+  push 8
+  pop rdi
+  pop rax
+  cmp eax, edi
+  jge .L.end.main.195
+  mov rax, rbp
+  sub rax, 2022
+  push rax
+  mov eax, dword ptr [rbp-2004]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 2
+  add rax, rdi
+  push rax
+  mov eax, dword ptr [rbp-2004]
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, di
+  mov word ptr [rax], di
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2004]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2004], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2022
+  push rax
+  mov eax, dword ptr [rbp-2004]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 2
+  add rax, rdi
+  push rax
+  mov eax, dword ptr [rbp-2004]
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, di
+  mov word ptr [rax], di
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2004]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2004], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2022
+  push rax
+  mov eax, dword ptr [rbp-2004]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 2
+  add rax, rdi
+  push rax
+  mov eax, dword ptr [rbp-2004]
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, di
+  mov word ptr [rax], di
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2004]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2004], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2022
+  push rax
+  mov eax, dword ptr [rbp-2004]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 2
+  add rax, rdi
+  push rax
+  mov eax, dword ptr [rbp-2004]
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, di
+  mov word ptr [rax], di
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2004]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2004], edi
+  push rdi
+  add rsp, 8
+  jmp .L.begin.main.195
+.L.end.main.195:
+  mov rax, rbp
+  sub rax, 2022
+  push rax
+  mov eax, dword ptr [rbp-2004]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 2
+  add rax, rdi
+  push rax
+  mov eax, dword ptr [rbp-2004]
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, di
+  mov word ptr [rax], di
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2004]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2004], edi
+  push rdi
+  add rsp, 8
+  push 0
+  pop rdi
+  mov dword ptr [rbp-2004], edi
+  push rdi
+  add rsp, 8
+.L.begin.main.196:
+  mov eax, dword ptr [rbp-2004]
+  push rax
+  push 8
+  pop rdi
+  pop rax
+  cmp eax, edi
+  jge .L.end.main.196
+  mov rax, rbp
+  sub rax, 2040
+  push rax
+  mov eax, dword ptr [rbp-2004]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 2
+  add rax, rdi
+  push rax
+  pop rdi
+  mov qword ptr [rbp-144], rdi
+  push rdi
+  mov rax, rbp
+  sub rax, 2022
+  push rax
+  mov eax, dword ptr [rbp-2004]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 2
+  add rax, rdi
+  push rax
+  pop rdi
+  mov qword ptr [rbp-152], rdi
+  push rdi
+  pop rax
+  movsx eax, word ptr [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  sub eax, edi
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, di
+  mov word ptr [rax], di
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-152]
+  push rax
+  mov rax, qword ptr [rbp-144]
+  push rax
+  pop rax
+  movsx eax, word ptr [rax]
+  push rax
+  mov rax, qword ptr [rbp-144]
+  push rax
+  pop rax
+  movsx eax, word ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, di
+  mov word ptr [rax], di
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2004]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2004], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2040
+  push rax
+  mov eax, dword ptr [rbp-2004]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 2
+  add rax, rdi
+  push rax
+  pop rdi
+  mov qword ptr [rbp-128], rdi
+  push rdi
+  mov rax, rbp
+  sub rax, 2022
+  push rax
+  mov eax, dword ptr [rbp-2004]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 2
+  add rax, rdi
+  push rax
+  pop rdi
+  mov qword ptr [rbp-136], rdi
+  push rdi
+  pop rax
+  movsx eax, word ptr [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  sub eax, edi
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, di
+  mov word ptr [rax], di
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-136]
+  push rax
+  mov rax, qword ptr [rbp-128]
+  push rax
+  pop rax
+  movsx eax, word ptr [rax]
+  push rax
+  mov rax, qword ptr [rbp-128]
+  push rax
+  pop rax
+  movsx eax, word ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, di
+  mov word ptr [rax], di
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2004]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2004], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2040
+  push rax
+  mov eax, dword ptr [rbp-2004]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 2
+  add rax, rdi
+  push rax
+  pop rdi
+  mov qword ptr [rbp-112], rdi
+  push rdi
+  mov rax, rbp
+  sub rax, 2022
+  push rax
+  mov eax, dword ptr [rbp-2004]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 2
+  add rax, rdi
+  push rax
+  pop rdi
+  mov qword ptr [rbp-120], rdi
+  push rdi
+  pop rax
+  movsx eax, word ptr [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  sub eax, edi
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, di
+  mov word ptr [rax], di
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-120]
+  push rax
+  mov rax, qword ptr [rbp-112]
+  push rax
+  pop rax
+  movsx eax, word ptr [rax]
+  push rax
+  mov rax, qword ptr [rbp-112]
+  push rax
+  pop rax
+  movsx eax, word ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, di
+  mov word ptr [rax], di
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2004]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2004], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2040
+  push rax
+  mov eax, dword ptr [rbp-2004]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 2
+  add rax, rdi
+  push rax
+  pop rdi
+  mov qword ptr [rbp-96], rdi
+  push rdi
+  mov rax, rbp
+  sub rax, 2022
+  push rax
+  mov eax, dword ptr [rbp-2004]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 2
+  add rax, rdi
+  push rax
+  pop rdi
+  mov qword ptr [rbp-104], rdi
+  push rdi
+  pop rax
+  movsx eax, word ptr [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  sub eax, edi
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, di
+  mov word ptr [rax], di
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-104]
+  push rax
+  mov rax, qword ptr [rbp-96]
+  push rax
+  pop rax
+  movsx eax, word ptr [rax]
+  push rax
+  mov rax, qword ptr [rbp-96]
+  push rax
+  pop rax
+  movsx eax, word ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, di
+  mov word ptr [rax], di
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2004]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2004], edi
+  push rdi
+  add rsp, 8
+  jmp .L.begin.main.196
+.L.end.main.196:
+  mov rax, rbp
+  sub rax, 2040
+  push rax
+  mov eax, dword ptr [rbp-2004]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 2
+  add rax, rdi
+  push rax
+  pop rdi
+  mov qword ptr [rbp-80], rdi
+  push rdi
+  mov rax, rbp
+  sub rax, 2022
+  push rax
+  mov eax, dword ptr [rbp-2004]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 2
+  add rax, rdi
+  push rax
+  pop rdi
+  mov qword ptr [rbp-88], rdi
+  push rdi
+  pop rax
+  movsx eax, word ptr [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  sub eax, edi
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, di
+  mov word ptr [rax], di
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-88]
+  push rax
+  mov rax, qword ptr [rbp-80]
+  push rax
+  pop rax
+  movsx eax, word ptr [rax]
+  push rax
+  mov rax, qword ptr [rbp-80]
+  push rax
+  pop rax
+  movsx eax, word ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, di
+  mov word ptr [rax], di
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-2004]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-2004], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2040
+  push rax
+  push 8
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 2
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, word ptr [rax]
+  push rax
+  mov rax, rbp
+  sub rax, 2022
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 2
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, word ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  lea rax, [rip+.L.str.688d27d3ddbdc176353ec722d7c4b9d5]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.197
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.197
+.L.call.main.197:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.197:
+  push rax
+  add rsp, 8
+  push 8
+  push 0
+  pop rdi
+  mov dword ptr [rbp-1916], edi
+  push rdi
+  add rsp, 8
+.L.begin.main.198:
+  mov eax, dword ptr [rbp-1916]
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  cmp eax, edi
+  jge .L.end.main.198
+  mov rax, rbp
+  sub rax, 1960
+  push rax
+  mov eax, dword ptr [rbp-1916]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  mov eax, dword ptr [rbp-1916]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  mov qword ptr [rax], rdi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1916]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1916], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1960
+  push rax
+  mov eax, dword ptr [rbp-1916]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  mov eax, dword ptr [rbp-1916]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  mov qword ptr [rax], rdi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1916]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1916], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1960
+  push rax
+  mov eax, dword ptr [rbp-1916]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  mov eax, dword ptr [rbp-1916]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  mov qword ptr [rax], rdi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1916]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1916], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1960
+  push rax
+  mov eax, dword ptr [rbp-1916]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  mov eax, dword ptr [rbp-1916]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  mov qword ptr [rax], rdi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1916]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1916], edi
+  push rdi
+  add rsp, 8
+  jmp .L.begin.main.198
+.L.end.main.198:
+  mov rax, rbp
+  sub rax, 1960
+  push rax
+  mov eax, dword ptr [rbp-1916]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  mov eax, dword ptr [rbp-1916]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  mov qword ptr [rax], rdi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1916]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1916], edi
+  push rdi
+  add rsp, 8
+  push 0
+  pop rdi
+  mov dword ptr [rbp-1916], edi
+  push rdi
+  add rsp, 8
+.L.begin.main.199:
+  mov eax, dword ptr [rbp-1916]
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  cmp eax, edi
+  jge .L.end.main.199
+  mov rax, rbp
+  sub rax, 2000
+  push rax
+  mov eax, dword ptr [rbp-1916]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  mov rax, rbp
+  sub rax, 1960
+  push rax
+  mov eax, dword ptr [rbp-1916]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  mov rax, qword ptr [rax]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-72], rdi
+  push rdi
+  push 3
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  sub rax, rdi
+  push rax
+  mov rax, qword ptr [rbp-72]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov qword ptr [rax], rdi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1916]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1916], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2000
+  push rax
+  mov eax, dword ptr [rbp-1916]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  mov rax, rbp
+  sub rax, 1960
+  push rax
+  mov eax, dword ptr [rbp-1916]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  mov rax, qword ptr [rax]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-64], rdi
+  push rdi
+  push 3
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  sub rax, rdi
+  push rax
+  mov rax, qword ptr [rbp-64]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov qword ptr [rax], rdi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1916]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1916], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2000
+  push rax
+  mov eax, dword ptr [rbp-1916]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  mov rax, rbp
+  sub rax, 1960
+  push rax
+  mov eax, dword ptr [rbp-1916]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  mov rax, qword ptr [rax]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-56], rdi
+  push rdi
+  push 3
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  sub rax, rdi
+  push rax
+  mov rax, qword ptr [rbp-56]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov qword ptr [rax], rdi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1916]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1916], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2000
+  push rax
+  mov eax, dword ptr [rbp-1916]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  mov rax, rbp
+  sub rax, 1960
+  push rax
+  mov eax, dword ptr [rbp-1916]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  mov rax, qword ptr [rax]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-48], rdi
+  push rdi
+  push 3
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  sub rax, rdi
+  push rax
+  mov rax, qword ptr [rbp-48]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov qword ptr [rax], rdi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1916]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1916], edi
+  push rdi
+  add rsp, 8
+  jmp .L.begin.main.199
+.L.end.main.199:
+  mov rax, rbp
+  sub rax, 2000
+  push rax
+  mov eax, dword ptr [rbp-1916]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  mov rax, rbp
+  sub rax, 1960
+  push rax
+  mov eax, dword ptr [rbp-1916]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  mov rax, qword ptr [rax]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-40], rdi
+  push rdi
+  push 3
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  sub rax, rdi
+  push rax
+  mov rax, qword ptr [rbp-40]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  pop rdi
+  pop rax
+  mov qword ptr [rax], rdi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1916]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1916], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 2000
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  mov rax, qword ptr [rax]
+  push rax
+  mov rax, rbp
+  sub rax, 2000
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 8
+  add rax, rdi
+  push rax
+  pop rax
+  mov rax, qword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add rax, rdi
+  push rax
+  lea rax, [rip+.L.str.eefa5e8b7d4c6b5ec58ba2870a4e6d3f]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.200
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.200
+.L.call.main.200:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.200:
+  push rax
+  add rsp, 8
+  push 10
+  push 4
+  pop rdi
+  mov dword ptr [rbp-1912], edi
+  push rdi
+  add rsp, 8
+  push 0
+  pop rdi
+  mov dword ptr [rbp-1908], edi
+  push rdi
+  add rsp, 8
+.L.begin.main.201:
+  mov eax, dword ptr [rbp-1908]
+  push rax
+  mov eax, dword ptr [rbp-1912]
+  push rax
+  pop rdi
+  pop rax
+  cmp eax, edi
+  jge .L.end.main.201
+  mov rax, qword ptr g2@GOTPCREL[rip]
+  push rax
+  mov eax, dword ptr [rbp-1908]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  mov eax, dword ptr [rbp-1908]
+  push rax
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1908]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1908], edi
+  push rdi
+  add rsp, 8
+  jmp .L.begin.main.201
+.L.end.main.201:
+  push 0
+  pop rdi
+  mov dword ptr [rbp-1908], edi
+  push rdi
+  add rsp, 8
+.L.begin.main.202:
+  mov eax, dword ptr [rbp-1908]
+  push rax
+  mov eax, dword ptr [rbp-1912]
+  push rax
+  pop rdi
+  pop rax
+  cmp eax, edi
+  jge .L.end.main.202
+  mov rax, qword ptr g2@GOTPCREL[rip]
+  push rax
+  mov eax, dword ptr [rbp-1908]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rdi
+  mov qword ptr [rbp-32], rdi
+  push rdi
+  mov rax, qword ptr [rbp-32]
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1908]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1908], edi
+  push rdi
+  add rsp, 8
+  jmp .L.begin.main.202
+.L.end.main.202:
+  mov rax, qword ptr g2@GOTPCREL[rip]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  mov rax, qword ptr g2@GOTPCREL[rip]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  mov rax, qword ptr g2@GOTPCREL[rip]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  mov rax, qword ptr g2@GOTPCREL[rip]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  lea rax, [rip+.L.str.601efb1f3533e72417beeda539a6eb65]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.203
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.203
+.L.call.main.203:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.203:
+  push rax
+  add rsp, 8
+  push 16
+  push 8
+  pop rdi
+  mov dword ptr [rbp-1864], edi
+  push rdi
+  add rsp, 8
+  push 0
+  pop rdi
+  mov dword ptr [rbp-1856], edi
+  push rdi
+  add rsp, 8
+  push 0
+  pop rdi
+  mov dword ptr [rbp-1860], edi
+  push rdi
+  add rsp, 8
+.L.begin.main.204:
+  mov eax, dword ptr [rbp-1860]
+  push rax
+  mov eax, dword ptr [rbp-1864]
+  push rax
+  pop rdi
+  pop rax
+  cmp eax, edi
+  jge .L.end.main.204
+  mov rax, rbp
+  sub rax, 1904
+  push rax
+  mov eax, dword ptr [rbp-1860]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1872
+  push rax
+  mov eax, dword ptr [rbp-1860]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1860]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1860], edi
+  push rdi
+  add rsp, 8
+  jmp .L.begin.main.204
+.L.end.main.204:
+  push 0
+  pop rdi
+  mov dword ptr [rbp-1860], edi
+  push rdi
+  add rsp, 8
+.L.begin.main.205:
+  mov eax, dword ptr [rbp-1860]
+  push rax
+  mov eax, dword ptr [rbp-1864]
+  push rax
+  pop rdi
+  pop rax
+  cmp eax, edi
+  jge .L.end.main.205
+  mov rax, rbp
+  sub rax, 1904
+  push rax
+  mov eax, dword ptr [rbp-1860]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rdi
+  mov qword ptr [rbp-24], rdi
+  push rdi
+  mov rax, qword ptr [rbp-24]
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1872
+  push rax
+  mov eax, dword ptr [rbp-1860]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rdi
+  mov qword ptr [rbp-16], rdi
+  push rdi
+  mov rax, qword ptr [rbp-16]
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1860]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1860], edi
+  push rdi
+  add rsp, 8
+  jmp .L.begin.main.205
+.L.end.main.205:
+  push 0
+  pop rdi
+  mov dword ptr [rbp-1860], edi
+  push rdi
+  add rsp, 8
+.L.begin.main.206:
+  mov eax, dword ptr [rbp-1860]
+  push rax
+  mov eax, dword ptr [rbp-1864]
+  push rax
+  pop rdi
+  pop rax
+  cmp eax, edi
+  jge .L.end.main.206
+  mov eax, dword ptr [rbp-1856]
+  push rax
+  mov rax, rbp
+  sub rax, 1872
+  push rax
+  mov eax, dword ptr [rbp-1860]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  mov rax, rbp
+  sub rax, 1904
+  push rax
+  mov eax, dword ptr [rbp-1860]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1856], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1860]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1860], edi
+  push rdi
+  add rsp, 8
+  jmp .L.begin.main.206
+.L.end.main.206:
+  mov eax, dword ptr [rbp-1856]
+  push rax
+  lea rax, [rip+.L.str.88e4445a4bb3a443cb3cbb57b9f2b6e0]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.207
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.207
+.L.call.main.207:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.207:
+  push rax
+  add rsp, 8
+  push 7
+  push 3
+  pop rdi
+  mov dword ptr [rbp-1852], edi
+  push rdi
+  add rsp, 8
+  push 7
+  pop rdi
+  mov dword ptr [rbp-1848], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1852]
+  push rax
+  mov eax, dword ptr [rbp-1848]
+  push rax
+  pop rdi
+  pop rax
+  cmp eax, edi
+  setl al
+  movzx eax, al
+  push rax
+  mov eax, dword ptr [rbp-1848]
+  push rax
+  mov eax, dword ptr [rbp-1852]
+  push rax
+  pop rdi
+  pop rax
+  pop rcx
+  cmp ecx, 0
+  cmove eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1844], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1844]
+  push rax
+  lea rax, [rip+.L.str.c2994af005e52b62bd6b600a4e9e7ddd]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.208
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.208
+.L.call.main.208:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.208:
+  push rax
+  add rsp, 8
+  push 5
+  push 5
+  pop rdi
+  mov dword ptr [rbp-1840], edi
+  push rdi
+  add rsp, 8
+  push 2
+  pop rdi
+  mov dword ptr [rbp-1836], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1836]
+  push rax
+  mov eax, dword ptr [rbp-1840]
+  push rax
+  pop rdi
+  pop rax
+  cmp eax, edi
+  setl al
+  movzx eax, al
+  push rax
+  mov eax, dword ptr [rbp-1840]
+  push rax
+  mov eax, dword ptr [rbp-1836]
+  push rax
+  pop rdi
+  pop rax
+  pop rcx
+  cmp ecx, 0
+  cmove eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1836], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1836]
+  push rax
+  lea rax, [rip+.L.str.82969bdd7b2cb798d58cec7da1d6e507]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.209
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.209
+.L.call.main.209:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.209:
+  push rax
+  add rsp, 8
+  push 2
+  push 5
+  pop rdi
+  mov dword ptr [rbp-1832], edi
+  push rdi
+  add rsp, 8
+  push 2
+  pop rdi
+  mov dword ptr [rbp-1828], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1832]
+  push rax
+  mov eax, dword ptr [rbp-1828]
+  push rax
+  pop rdi
+  pop rax
+  cmp eax, edi
+  setl al
+  movzx eax, al
+  push rax
+  mov eax, dword ptr [rbp-1832]
+  push rax
+  mov eax, dword ptr [rbp-1828]
+  push rax
+  pop rdi
+  pop rax
+  pop rcx
+  cmp ecx, 0
+  cmove eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1828], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1828]
+  push rax
+  lea rax, [rip+.L.str.d6940b9ff193b6ccdcced5789a01d311]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.210
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.210
+.L.call.main.210:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.210:
+  push rax
+  add rsp, 8
+  push 1
+  push 5
+  pop rdi
+  mov dword ptr [rbp-1824], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1824]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  cmp eax, edi
+  setne al
+  movzx eax, al
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1820], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1820]
+  push rax
+  lea rax, [rip+.L.str.397cb00e55ab915c8ff1b8a5b4a45a89]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.211
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.211
+.L.call.main.211:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.211:
+  push rax
+  add rsp, 8
+  push 1
+  push 0
+  pop rdi
+  mov dword ptr [rbp-1816], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1816]
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  cmp eax, edi
+  sete al
+  movzx eax, al
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1812], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1812]
+  push rax
+  lea rax, [rip+.L.str.7c7c7839ffbd50e3c0465292642e59c9]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.212
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.212
+.L.call.main.212:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.212:
+  push rax
+  add rsp, 8
+  push 9
+  push 0
+  pop rdi
+  mov dword ptr [rbp-1804], edi
+  push rdi
+  add rsp, 8
+  push 0
+  pop rdi
+  mov dword ptr [rbp-1808], edi
+  push rdi
+  add rsp, 8
+.L.begin.main.213:
+  mov eax, dword ptr [rbp-1808]
+  push rax
+  push 8
+  pop rdi
+  pop rax
+  cmp eax, edi
+  jge .L.end.main.213
+  mov eax, dword ptr [rbp-1804]
+  push rax
+  mov eax, dword ptr [rbp-1808]
+  push rax
+  pop rdi
+  pop rax
+  cmp eax, edi
+  setl al
+  movzx eax, al
+  push rax
+  mov eax, dword ptr [rbp-1808]
+  push rax
+  mov eax, dword ptr [rbp-1804]
+  push rax
+  pop rdi
+  pop rax
+  pop rcx
+  cmp ecx, 0
+  cmove eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1804], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1808]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1808], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1804]
+  push rax
+  mov eax, dword ptr [rbp-1808]
+  push rax
+  pop rdi
+  pop rax
+  cmp eax, edi
+  setl al
+  movzx eax, al
+  push rax
+  mov eax, dword ptr [rbp-1808]
+  push rax
+  mov eax, dword ptr [rbp-1804]
+  push rax
+  pop rdi
+  pop rax
+  pop rcx
+  cmp ecx, 0
+  cmove eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1804], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1808]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1808], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1804]
+  push rax
+  mov eax, dword ptr [rbp-1808]
+  push rax
+  pop rdi
+  pop rax
+  cmp eax, edi
+  setl al
+  movzx eax, al
+  push rax
+  mov eax, dword ptr [rbp-1808]
+  push rax
+  mov eax, dword ptr [rbp-1804]
+  push rax
+  pop rdi
+  pop rax
+  pop rcx
+  cmp ecx, 0
+  cmove eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1804], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1808]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1808], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1804]
+  push rax
+  mov eax, dword ptr [rbp-1808]
+  push rax
+  pop rdi
+  pop rax
+  cmp eax, edi
+  setl al
+  movzx eax, al
+  push rax
+  mov eax, dword ptr [rbp-1808]
+  push rax
+  mov eax, dword ptr [rbp-1804]
+  push rax
+  pop rdi
+  pop rax
+  pop rcx
+  cmp ecx, 0
+  cmove eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1804], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1808]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1808], edi
+  push rdi
+  add rsp, 8
+  jmp .L.begin.main.213
+.L.end.main.213:
+  mov eax, dword ptr [rbp-1804]
+  push rax
+  mov eax, dword ptr [rbp-1808]
+  push rax
+  pop rdi
+  pop rax
+  cmp eax, edi
+  setl al
+  movzx eax, al
+  push rax
+  mov eax, dword ptr [rbp-1808]
+  push rax
+  mov eax, dword ptr [rbp-1804]
+  push rax
+  pop rdi
+  pop rax
+  pop rcx
+  cmp ecx, 0
+  cmove eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1804], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1808]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1808], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1804]
+  push rax
+  mov eax, dword ptr [rbp-1808]
+  push rax
+  pop rdi
+  pop rax
+  cmp eax, edi
+  setl al
+  movzx eax, al
+  push rax
+  mov eax, dword ptr [rbp-1808]
+  push rax
+  mov eax, dword ptr [rbp-1804]
+  push rax
+  pop rdi
+  pop rax
+  pop rcx
+  cmp ecx, 0
+  cmove eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1804], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1808]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1808], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1804]
+  push rax
+  lea rax, [rip+.L.str.605618fae558db27d27440241c76ce4f]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.214
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.214
+.L.call.main.214:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.214:
+  push rax
+  add rsp, 8
+  push 3
+  push 1
+  pop rdi
+  mov dword ptr [rbp-1800], edi
+  push rdi
+  add rsp, 8
+  push 0
+  pop rdi
+  mov dword ptr [rbp-1796], edi
+  push rdi
+  add rsp, 8
+  push 3
+  pop rdi
+  mov dword ptr [rbp-1792], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1796]
+  push rax
+  pop rax
+  cmp eax, 0
+  je .L.end.main.215
+  mov eax, dword ptr [rbp-1800]
+  push rax
+  mov eax, dword ptr [rbp-1796]
+  push rax
+  pop rdi
+  pop rax
+  cdq
+  idiv edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1792], edi
+  push rdi
+  add rsp, 8
+.L.end.main.215:
+  mov eax, dword ptr [rbp-1792]
+  push rax
+  lea rax, [rip+.L.str.d1b581db3f1e32448ccc7df8a82f82e0]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.216
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.216
+.L.call.main.216:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.216:
+  push rax
+  add rsp, 8
+  push 0
+  movabs rax, 2147483648
+  push rax
+  pop rdi
+  pop rax
+  movsxd rax, eax
+  sub rax, rdi
+  push rax
+  push 2147483647
+  pop rdi
+  mov dword ptr [rbp-1788], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1788]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  lea rax, [rip+.L.str.f63b0eef10cc4cd418b373fde820791d]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.217
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.217
+.L.call.main.217:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.217:
+  push rax
+  add rsp, 8
+  movabs rax, 2147483648
+  push rax
+  push 2147483647
+  pop rdi
+  movsxd rdi, edi
+  mov qword ptr [rbp-1784], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-1784]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  add rax, rdi
+  push rax
+  lea rax, [rip+.L.str.42447ebf4263d5a59635f7c685ad91fd]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.218
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.218
+.L.call.main.218:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.218:
+  push rax
+  add rsp, 8
+  push 128
+  push 127
+  pop rdi
+  movsx edi, dil
+  mov byte ptr [rbp-1773], dil
+  push rdi
+  add rsp, 8
+  movsx eax, byte ptr [rbp-1773]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  lea rax, [rip+.L.str.ab2f494056d8e51c9dbfc627ab979616]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.219
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.219
+.L.call.main.219:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.219:
+  push rax
+  add rsp, 8
+  push 44
+  push 300
+  pop rax
+  movsx eax, al
+  push rax
+  lea rax, [rip+.L.str.0b0e039af7d1d6110e72ac64d94efb50]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.220
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.220
+.L.call.main.220:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.220:
+  push rax
+  add rsp, 8
+  push 1
+  push 65537
+  pop rax
+  movsx eax, ax
+  push rax
+  lea rax, [rip+.L.str.1364f1039e429537e5896057779547cb]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.221
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.221
+.L.call.main.221:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.221:
+  push rax
+  add rsp, 8
+  push 1
+  movabs rax, 4294967297
+  push rax
+  pop rax
+  push rax
+  pop rax
+  movsxd rax, eax
+  push rax
+  lea rax, [rip+.L.str.8e59a56bf2942c667e70d36080367eb5]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.222
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.222
+.L.call.main.222:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.222:
+  push rax
+  add rsp, 8
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  sub eax, edi
+  push rax
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  sub eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1772], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1772]
+  push rax
+  pop rdi
+  movsxd rdi, edi
+  mov qword ptr [rbp-1768], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-1768]
+  push rax
+  lea rax, [rip+.L.str.a9b572f1d6091b830d4261c72b2c8ec7]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.223
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.223
+.L.call.main.223:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.223:
+  push rax
+  add rsp, 8
+  push 1
+  movabs rax, 4294967296
+  push rax
+  pop rdi
+  mov qword ptr [rbp-1760], rdi
+  push rdi
+  add rsp, 8
+  push 0
+  pop rdi
+  mov dword ptr [rbp-1748], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1748]
+  push rax
+  mov rax, qword ptr [rbp-1760]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rax, eax
+  cmp rax, rdi
+  setl al
+  movzx eax, al
+  push rax
+  lea rax, [rip+.L.str.f3b63261298586108e04ab535ed402a5]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.224
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.224
+.L.call.main.224:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.224:
+  push rax
+  add rsp, 8
+  push 0
+  push 2
+  pop rdi
+  pop rax
+  sub eax, edi
+  push rax
+  push 0
+  push 5
+  pop rdi
+  pop rax
+  sub eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1744], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1744]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  cdq
+  idiv edi
+  push rax
+  lea rax, [rip+.L.str.60e57a4a86af9ef0cd7a95c5d583fdb6]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.225
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.225
+.L.call.main.225:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.225:
+  push rax
+  add rsp, 8
+  push 5
+  mov rax, rbp
+  sub rax, 1740
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rdi
+  mov qword ptr [rbp-1728], rdi
+  push rdi
+  add rsp, 8
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  sub eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1716], edi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-1728]
+  push rax
+  mov eax, dword ptr [rbp-1716]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1740
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.367b0e2878f49f8d78c0f009ac5f5c0b]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.226
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.226
+.L.call.main.226:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.226:
+  push rax
+  add rsp, 8
+  push 8
+  mov rax, rbp
+  sub rax, 1712
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1712
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1704
+  push rax
+  mov rax, rbp
+  sub rax, 1712
+  push rax
+  pop rsi
+  mov rdi, [rsp]
+  mov rax, [rsi+0]
+  mov [rdi+0], rax
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1704
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  mov rax, rbp
+  sub rax, 1704
+  push rax
+  pop rax
+  add rax, 4
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  lea rax, [rip+.L.str.f82fd8c164a6a1409bb4fa88753b4ece]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.227
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.227
+.L.call.main.227:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.227:
+  push rax
+  add rsp, 8
+  push 9
+  mov rax, rbp
+  sub rax, 1696
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1696
+  push rax
+  pop rax
+  add rax, 20
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1672
+  push rax
+  mov rax, rbp
+  sub rax, 1696
+  push rax
+  pop rsi
+  mov rdi, [rsp]
+  movdqu xmm0, [rsi+0]
+  movdqu [rdi+0], xmm0
+  mov rax, [rsi+16]
+  mov [rdi+16], rax
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1672
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  mov rax, rbp
+  sub rax, 1672
+  push rax
+  pop rax
+  add rax, 20
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  lea rax, [rip+.L.str.d9bce6b10cd600f21e18cb9c9f149bca]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.228
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.228
+.L.call.main.228:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.228:
+  push rax
+  add rsp, 8
+  push 9
+  mov rax, rbp
+  sub rax, 1648
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1648
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 299
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 7
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1348
+  push rax
+  mov rax, rbp
+  sub rax, 1648
+  push rax
+  pop rsi
+  mov rdi, [rsp]
+  mov rcx, 300
+  rep movsb
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1348
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  mov rax, rbp
+  sub rax, 1348
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 299
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  lea rax, [rip+.L.str.506d01b15b2dc27689c706605050c8a4]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.229
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.229
+.L.call.main.229:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.229:
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 1048
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1048
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  mov rax, rbp
+  sub rax, 1048
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rsi
+  mov rdi, [rsp]
+  mov eax, [rsi+0]
+  mov [rdi+0], eax
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1048
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  add rax, 0
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.6b992f95d67eb49fce7e4b612d190c07]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.230
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.230
+.L.call.main.230:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.230:
+  push rax
+  add rsp, 8
+  push 12
+  push 0
+  pop rdi
+  mov dword ptr [rbp-1020], edi
+  push rdi
+  add rsp, 8
+.L.begin.main.231:
+  mov eax, dword ptr [rbp-1020]
+  push rax
+  push 8
+  pop rdi
+  pop rax
+  cmp eax, edi
+  jge .L.end.main.231
+  mov rax, rbp
+  sub rax, 1040
+  push rax
+  mov eax, dword ptr [rbp-1020]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  mov eax, dword ptr [rbp-1020]
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1020]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1020], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1040
+  push rax
+  mov eax, dword ptr [rbp-1020]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  mov eax, dword ptr [rbp-1020]
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1020]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1020], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1040
+  push rax
+  mov eax, dword ptr [rbp-1020]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  mov eax, dword ptr [rbp-1020]
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1020]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1020], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1040
+  push rax
+  mov eax, dword ptr [rbp-1020]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  mov eax, dword ptr [rbp-1020]
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1020]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1020], edi
+  push rdi
+  add rsp, 8
+  jmp .L.begin.main.231
+.L.end.main.231:
+  mov rax, rbp
+  sub rax, 1040
+  push rax
+  mov eax, dword ptr [rbp-1020]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  mov eax, dword ptr [rbp-1020]
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1020]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1020], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1040
+  push rax
+  mov eax, dword ptr [rbp-1020]
+  push rax
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  mov eax, dword ptr [rbp-1020]
+  push rax
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-1020]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-1020], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1030
+  push rax
+  mov rax, rbp
+  sub rax, 1040
+  push rax
+  pop rsi
+  mov rdi, [rsp]
+  mov rax, [rsi+0]
+  mov [rdi+0], rax
+  mov ax, [rsi+8]
+  mov [rdi+8], ax
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1030
+  push rax
+  push 9
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  mov rax, rbp
+  sub rax, 1030
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  lea rax, [rip+.L.str.82f5864ae0d571aca73671817b1a1146]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.232
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.232
+.L.call.main.232:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.232:
+  push rax
+  add rsp, 8
+  push 5
+  mov rax, rbp
+  sub rax, 1016
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1012
+  push rax
+  mov rax, rbp
+  sub rax, 1016
+  push rax
+  pop rsi
+  mov rdi, [rsp]
+  mov eax, [rsi+0]
+  mov [rdi+0], eax
+  pop rax
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.fd22ff0f026a088e842a9bc7ea20df88]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.233
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.233
+.L.call.main.233:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.233:
+  push rax
+  add rsp, 8
+  push 16843009
+  mov rax, rbp
+  sub rax, 1008
+  push rax
+  push 1
+  pop rax
+  mov rdi, [rsp]
+  movzx eax, al
+  movabs rcx, 0x0101010101010101
+  imul rax, rcx
+  movq xmm0, rax
+  punpcklqdq xmm0, xmm0
+  movdqu [rdi+0], xmm0
+  mov [rdi+16], eax
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 1008
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.0e82adfb184161ebc70ca21d40785f57]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.234
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.234
+.L.call.main.234:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.234:
+  push rax
+  add rsp, 8
+  push 6
+  mov rax, rbp
+  sub rax, 988
+  push rax
+  push 3
+  pop rax
+  mov rdi, [rsp]
+  mov rcx, 400
+  rep stosb
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 988
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  mov rax, rbp
+  sub rax, 988
+  push rax
+  push 399
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  lea rax, [rip+.L.str.ea54d4381fb3b555b57cd6ef2e6fd77f]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.235
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.235
+.L.call.main.235:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.235:
+  push rax
+  add rsp, 8
+  push 7
+  push 3
+  pop rdi
+  mov dword ptr [rbp-588], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 583
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsx edi, dil
+  mov byte ptr [rax], dil
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 583
+  push rax
+  push 7
+  mov eax, dword ptr [rbp-588]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rsi, esi
+  movsxd rdx, edx
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.236
+  mov eax, 0
+  call memset@PLT
+  jmp .L.end.main.236
+.L.call.main.236:
+  sub rsp, 8
+  mov eax, 0
+  call memset@PLT
+  add rsp, 8
+.L.end.main.236:
+  push rax
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 583
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 1
+  add rax, rdi
+  push rax
+  pop rax
+  movsx eax, byte ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.6ef231a5df07ca32990399fb5d267e57]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.237
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.237
+.L.call.main.237:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.237:
+  push rax
+  add rsp, 8
+  push 20
+  push 2
+  pop rdi
+  mov dword ptr [rbp-580], edi
+  push rdi
+  add rsp, 8
+  push 0
+  pop rdi
+  mov dword ptr [rbp-576], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-580]
+  push rax
+  pop rax
+  cmp eax, 1
+  je .L.case.main.240
+  cmp eax, 2
+  je .L.case.main.239
+  jmp .L.case.main.241
+.L.case.main.240:
+  push 10
+  pop rdi
+  mov dword ptr [rbp-576], edi
+  push rdi
+  add rsp, 8
+  jmp .L.end.main.238
+.L.case.main.239:
+  push 20
+  pop rdi
+  mov dword ptr [rbp-576], edi
+  push rdi
+  add rsp, 8
+  jmp .L.end.main.238
+.L.case.main.241:
+  push 30
+  pop rdi
+  mov dword ptr [rbp-576], edi
+  push rdi
+  add rsp, 8
+.L.end.main.238:
+  mov eax, dword ptr [rbp-576]
+  push rax
+  lea rax, [rip+.L.str.5ee2748953e1c2751a769a1af214b6a2]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.242
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.242
+.L.call.main.242:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.242:
+  push rax
+  add rsp, 8
+  push 30
+  push 5
+  pop rdi
+  mov dword ptr [rbp-572], edi
+  push rdi
+  add rsp, 8
+  push 0
+  pop rdi
+  mov dword ptr [rbp-568], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-572]
+  push rax
+  pop rax
+  cmp eax, 1
+  je .L.case.main.245
+  cmp eax, 2
+  je .L.case.main.244
+  jmp .L.case.main.246
+.L.case.main.245:
+  push 10
+  pop rdi
+  mov dword ptr [rbp-568], edi
+  push rdi
+  add rsp, 8
+  jmp .L.end.main.243
+.L.case.main.244:
+  push 20
+  pop rdi
+  mov dword ptr [rbp-568], edi
+  push rdi
+  add rsp, 8
+  jmp .L.end.main.243
+.L.case.main.246:
+  push 30
+  pop rdi
+  mov dword ptr [rbp-568], edi
+  push rdi
+  add rsp, 8
+.L.end.main.243:
+  mov eax, dword ptr [rbp-568]
+  push rax
+  lea rax, [rip+.L.str.adb67f01e21efe58eec402960bb8f2fa]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.247
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.247
+.L.call.main.247:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.247:
+  push rax
+  add rsp, 8
+  push 3
+  push 1
+  pop rdi
+  mov dword ptr [rbp-564], edi
+  push rdi
+  add rsp, 8
+  push 0
+  pop rdi
+  mov dword ptr [rbp-560], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-564]
+  push rax
+  pop rax
+  cmp eax, 1
+  je .L.case.main.251
+  cmp eax, 2
+  je .L.case.main.250
+  cmp eax, 3
+  je .L.case.main.249
+  jmp .L.end.main.248
+.L.case.main.251:
+  mov eax, dword ptr [rbp-560]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-560], edi
+  push rdi
+  add rsp, 8
+.L.case.main.250:
+  mov eax, dword ptr [rbp-560]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-560], edi
+  push rdi
+  add rsp, 8
+  jmp .L.end.main.248
+.L.case.main.249:
+  mov eax, dword ptr [rbp-560]
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-560], edi
+  push rdi
+  add rsp, 8
+.L.end.main.248:
+  mov eax, dword ptr [rbp-560]
+  push rax
+  lea rax, [rip+.L.str.5acd0cf45da4ded1cfc19d92a5d1503b]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.252
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.252
+.L.call.main.252:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.252:
+  push rax
+  add rsp, 8
+  push 7
+  push 7
+  pop rdi
+  mov dword ptr [rbp-556], edi
+  push rdi
+  add rsp, 8
+  push 3
+  pop rax
+  cmp eax, 1
+  je .L.case.main.254
+  jmp .L.end.main.253
+.L.case.main.254:
+  push 1
+  pop rdi
+  mov dword ptr [rbp-556], edi
+  push rdi
+  add rsp, 8
+.L.end.main.253:
+  mov eax, dword ptr [rbp-556]
+  push rax
+  lea rax, [rip+.L.str.ed3e158be828b1677dc412526b8b9cdb]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.255
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.255
+.L.call.main.255:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.255:
+  push rax
+  add rsp, 8
+  push 2
+  push 65
+  pop rdi
+  movsx edi, dil
+  mov byte ptr [rbp-549], dil
+  push rdi
+  add rsp, 8
+  push 0
+  pop rdi
+  mov dword ptr [rbp-548], edi
+  push rdi
+  add rsp, 8
+  movsx eax, byte ptr [rbp-549]
+  push rax
+  pop rax
+  cmp eax, 65
+  je .L.case.main.258
+  cmp eax, 66
+  je .L.case.main.257
+  jmp .L.end.main.256
+.L.case.main.258:
+  push 2
+  pop rdi
+  mov dword ptr [rbp-548], edi
+  push rdi
+  add rsp, 8
+  jmp .L.end.main.256
+.L.case.main.257:
+  push 3
+  pop rdi
+  mov dword ptr [rbp-548], edi
+  push rdi
+  add rsp, 8
+.L.end.main.256:
+  mov eax, dword ptr [rbp-548]
+  push rax
+  lea rax, [rip+.L.str.2560572b4bda853d2ccc015a3e58a2db]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.259
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.259
+.L.call.main.259:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.259:
+  push rax
+  add rsp, 8
+  push 5
+  push 0
+  pop rdi
+  mov dword ptr [rbp-544], edi
+  push rdi
+  add rsp, 8
+.L.begin.main.260:
+  mov eax, dword ptr [rbp-544]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-544], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-544]
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  cmp eax, edi
+  jne .L.end.main.261
+  jmp .L.end.main.260
+.L.end.main.261:
+  jmp .L.begin.main.260
+.L.end.main.260:
+  mov eax, dword ptr [rbp-544]
+  push rax
+  lea rax, [rip+.L.str.79ae131263ac9c0b6a00ab8e1707074e]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.262
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.262
+.L.call.main.262:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.262:
+  push rax
+  add rsp, 8
+  push 3
+  push 0
+  pop rdi
+  mov dword ptr [rbp-540], edi
+  push rdi
+  add rsp, 8
+.L.begin.main.263:
+  mov eax, dword ptr [rbp-540]
+  push rax
+  push 10
+  pop rdi
+  pop rax
+  cmp eax, edi
+  jge .L.end.main.263
+  mov eax, dword ptr [rbp-540]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  cmp eax, edi
+  jne .L.end.main.264
+  jmp .L.end.main.263
+.L.end.main.264:
+  mov eax, dword ptr [rbp-540]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-540], edi
+  push rdi
+  add rsp, 8
+  jmp .L.begin.main.263
+.L.end.main.263:
+  mov eax, dword ptr [rbp-540]
+  push rax
+  lea rax, [rip+.L.str.abafcac2ed4fd61d19e2599c21963219]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.265
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.265
+.L.call.main.265:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.265:
+  push rax
+  add rsp, 8
+  push 11
+  push 0
+  pop rdi
+  mov dword ptr [rbp-532], edi
+  push rdi
+  add rsp, 8
+  push 0
+  pop rdi
+  mov dword ptr [rbp-536], edi
+  push rdi
+  add rsp, 8
+.L.begin.main.266:
+  mov eax, dword ptr [rbp-536]
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  cmp eax, edi
+  jge .L.end.main.266
+  mov eax, dword ptr [rbp-536]
+  push rax
+  pop rax
+  cmp eax, 1
+  je .L.case.main.269
+  cmp eax, 3
+  je .L.case.main.268
+  jmp .L.end.main.267
+.L.case.main.269:
+  mov eax, dword ptr [rbp-532]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-532], edi
+  push rdi
+  add rsp, 8
+  jmp .L.end.main.267
+.L.case.main.268:
+  mov eax, dword ptr [rbp-532]
+  push rax
+  push 10
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-532], edi
+  push rdi
+  add rsp, 8
+  jmp .L.end.main.267
+.L.end.main.267:
+  mov eax, dword ptr [rbp-536]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-536], edi
+  push rdi
+  add rsp, 8
+  jmp .L.begin.main.266
+.L.end.main.266:
+  mov eax, dword ptr [rbp-532]
+  push rax
+  lea rax, [rip+.L.str.28605310ffb58f74aa61896945fc1cfc]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.270
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.270
+.L.call.main.270:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.270:
+  push rax
+  add rsp, 8
+  push 10
+  push 0
+  pop rdi
+  movsxd rdi, edi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.271
+  mov eax, 0
+  call sw_table@PLT
+  jmp .L.end.main.271
+.L.call.main.271:
+  sub rsp, 8
+  mov eax, 0
+  call sw_table@PLT
+  add rsp, 8
+.L.end.main.271:
+  push rax
+  lea rax, [rip+.L.str.07d6a034c7efe7208fdb3651377be5b3]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.272
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.272
+.L.call.main.272:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.272:
+  push rax
+  add rsp, 8
+  push 14
+  push 4
+  pop rdi
+  movsxd rdi, edi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.273
+  mov eax, 0
+  call sw_table@PLT
+  jmp .L.end.main.273
+.L.call.main.273:
+  sub rsp, 8
+  mov eax, 0
+  call sw_table@PLT
+  add rsp, 8
+.L.end.main.273:
+  push rax
+  lea rax, [rip+.L.str.96dd762ee00d8c06920263734d27ad7b]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.274
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.274
+.L.call.main.274:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.274:
+  push rax
+  add rsp, 8
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  sub eax, edi
+  push rax
+  push 3
+  pop rdi
+  movsxd rdi, edi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.275
+  mov eax, 0
+  call sw_table@PLT
+  jmp .L.end.main.275
+.L.call.main.275:
+  sub rsp, 8
+  mov eax, 0
+  call sw_table@PLT
+  add rsp, 8
+.L.end.main.275:
+  push rax
+  lea rax, [rip+.L.str.d43362f44313dd005ad4a49e11deb8b8]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.276
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.276
+.L.call.main.276:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.276:
+  push rax
+  add rsp, 8
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  sub eax, edi
+  push rax
+  push 6
+  pop rdi
+  movsxd rdi, edi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.277
+  mov eax, 0
+  call sw_table@PLT
+  jmp .L.end.main.277
+.L.call.main.277:
+  sub rsp, 8
+  mov eax, 0
+  call sw_table@PLT
+  add rsp, 8
+.L.end.main.277:
+  push rax
+  lea rax, [rip+.L.str.02658df46c23a06bdcebe845d02ab136]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.278
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.278
+.L.call.main.278:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.278:
+  push rax
+  add rsp, 8
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  sub eax, edi
+  push rax
+  push 0
+  push 1
+  pop rdi
+  pop rax
+  sub eax, edi
+  push rax
+  pop rdi
+  movsxd rdi, edi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.279
+  mov eax, 0
+  call sw_table@PLT
+  jmp .L.end.main.279
+.L.call.main.279:
+  sub rsp, 8
+  mov eax, 0
+  call sw_table@PLT
+  add rsp, 8
+.L.end.main.279:
+  push rax
+  lea rax, [rip+.L.str.56897484e029024c6e5a29819e7b4253]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.280
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.280
+.L.call.main.280:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.280:
+  push rax
+  add rsp, 8
+  push 1
+  push 0
+  push 100
+  pop rdi
+  pop rax
+  sub eax, edi
+  push rax
+  pop rdi
+  movsxd rdi, edi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.281
+  mov eax, 0
+  call sw_tree@PLT
+  jmp .L.end.main.281
+.L.call.main.281:
+  sub rsp, 8
+  mov eax, 0
+  call sw_tree@PLT
+  add rsp, 8
+.L.end.main.281:
+  push rax
+  lea rax, [rip+.L.str.96c788cc5295b8dd16c49fce5ffaa0e0]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.282
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.282
+.L.call.main.282:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.282:
+  push rax
+  add rsp, 8
+  push 4
+  push 1000
+  pop rdi
+  movsxd rdi, edi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.283
+  mov eax, 0
+  call sw_tree@PLT
+  jmp .L.end.main.283
+.L.call.main.283:
+  sub rsp, 8
+  mov eax, 0
+  call sw_tree@PLT
+  add rsp, 8
+.L.end.main.283:
+  push rax
+  lea rax, [rip+.L.str.aefc6e4b174275b901e05989b2b5566b]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.284
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.284
+.L.call.main.284:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.284:
+  push rax
+  add rsp, 8
+  push 6
+  movabs rax, 5000000000
+  push rax
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.285
+  mov eax, 0
+  call sw_tree@PLT
+  jmp .L.end.main.285
+.L.call.main.285:
+  sub rsp, 8
+  mov eax, 0
+  call sw_tree@PLT
+  add rsp, 8
+.L.end.main.285:
+  push rax
+  lea rax, [rip+.L.str.cc4acc45810fd1534a8c3f6713a305a7]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.286
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.286
+.L.call.main.286:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.286:
+  push rax
+  add rsp, 8
+  push 0
+  push 4
+  pop rdi
+  movsxd rdi, edi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.287
+  mov eax, 0
+  call sw_tree@PLT
+  jmp .L.end.main.287
+.L.call.main.287:
+  sub rsp, 8
+  mov eax, 0
+  call sw_tree@PLT
+  add rsp, 8
+.L.end.main.287:
+  push rax
+  lea rax, [rip+.L.str.0aa1a4c0edab0c3832a732cf1dd689d1]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.288
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.288
+.L.call.main.288:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.288:
+  push rax
+  add rsp, 8
+  push 1
+  push 1
+  jmp .L.done.main.289
+.L.false.main.289:
+  push 0
+.L.done.main.289:
+  lea rax, [rip+.L.str.0439e281a0237c277fd73a193fb2d700]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.290
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.290
+.L.call.main.290:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.290:
+  push rax
+  add rsp, 8
+  push 0
+  jmp .L.false.main.291
+  push 1
+  jmp .L.done.main.291
+.L.false.main.291:
+  push 0
+.L.done.main.291:
+  lea rax, [rip+.L.str.d9cf41a1fedd26a415d3a2e118673e82]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.292
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.292
+.L.call.main.292:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.292:
+  push rax
+  add rsp, 8
+  push 1
+.L.cond.main.294:
+  push 1
+  jmp .L.done.main.293
+.L.false.main.293:
+  push 0
+.L.done.main.293:
+  lea rax, [rip+.L.str.f32913c22e03f796e2a28cf87fb9e0c2]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.295
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.295
+.L.call.main.295:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.295:
+  push rax
+  add rsp, 8
+  push 0
+  jmp .L.false.main.296
+.L.cond.main.297:
+  push 1
+  jmp .L.done.main.296
+.L.false.main.296:
+  push 0
+.L.done.main.296:
+  lea rax, [rip+.L.str.69f6e030807cdded136b14c612040526]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.298
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.298
+.L.call.main.298:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.298:
+  push rax
+  add rsp, 8
+  push 1
+  push 0
+  pop rax
+  cmp eax, 0
+  sete al
+  movzx eax, al
+  push rax
+  lea rax, [rip+.L.str.8f3f8d704d3f114510b565888f789c60]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.299
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.299
+.L.call.main.299:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.299:
+  push rax
+  add rsp, 8
+  push 0
+  push 5
+  pop rax
+  cmp eax, 0
+  sete al
+  movzx eax, al
+  push rax
+  lea rax, [rip+.L.str.7d6f51b10af20c6be216aacae0e62e04]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.300
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.300
+.L.call.main.300:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.300:
+  push rax
+  add rsp, 8
+  push 1
+  movabs rax, 4294967296
+  push rax
+  pop rdi
+  mov qword ptr [rbp-528], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-528]
+  push rax
+  pop rax
+  cmp rax, 0
+  sete al
+  movzx eax, al
+  push rax
+  pop rax
+  cmp eax, 0
+  sete al
+  movzx eax, al
+  push rax
+  lea rax, [rip+.L.str.5c46484b1b58930033413acbf7e01e13]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.301
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.301
+.L.call.main.301:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.301:
+  push rax
+  add rsp, 8
+  push 3
+  push 3
+  pop rdi
+  mov dword ptr [rbp-516], edi
+  push rdi
+  add rsp, 8
+  jmp .L.false.main.302
+  push 5
+  pop rdi
+  mov dword ptr [rbp-516], edi
+  push rdi
+  pop rax
+  cmp eax, 0
+  je .L.false.main.302
+  push 1
+  jmp .L.done.main.302
+.L.false.main.302:
+  push 0
+.L.done.main.302:
+  add rsp, 8
+  mov eax, dword ptr [rbp-516]
+  push rax
+  lea rax, [rip+.L.str.644dde19fc6027a0d6618647df4625e8]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.303
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.303
+.L.call.main.303:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.303:
+  push rax
+  add rsp, 8
+  push 3
+  push 3
+  pop rdi
+  mov dword ptr [rbp-512], edi
+  push rdi
+  add rsp, 8
+  jmp .L.cond.main.305
+  push 5
+  pop rdi
+  mov dword ptr [rbp-512], edi
+  push rdi
+  pop rax
+  cmp eax, 0
+  je .L.false.main.304
+.L.cond.main.305:
+  push 1
+  jmp .L.done.main.304
+.L.false.main.304:
+  push 0
+.L.done.main.304:
+  add rsp, 8
+  mov eax, dword ptr [rbp-512]
+  push rax
+  lea rax, [rip+.L.str.a8eebbf7492e50b8e3970b86a9b03b13]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.306
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.306
+.L.call.main.306:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.306:
+  push rax
+  add rsp, 8
+  push 5
+  push 3
+  pop rdi
+  mov dword ptr [rbp-508], edi
+  push rdi
+  add rsp, 8
+  push 5
+  pop rdi
+  mov dword ptr [rbp-508], edi
+  push rdi
+  pop rax
+  cmp eax, 0
+  je .L.false.main.307
+  push 1
+  jmp .L.done.main.307
+.L.false.main.307:
+  push 0
+.L.done.main.307:
+  add rsp, 8
+  mov eax, dword ptr [rbp-508]
+  push rax
+  lea rax, [rip+.L.str.957863870423bcf79749087c92c0b8f6]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.308
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.308
+.L.call.main.308:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.308:
+  push rax
+  add rsp, 8
+  push 2
+  push 1
+  pop rdi
+  mov dword ptr [rbp-504], edi
+  push rdi
+  add rsp, 8
+  push 2
+  pop rdi
+  mov dword ptr [rbp-500], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-504]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  cmp eax, edi
+  jne .L.false.main.309
+  mov eax, dword ptr [rbp-500]
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  cmp eax, edi
+  jne .L.false.main.309
+  push 1
+  jmp .L.done.main.309
+.L.false.main.309:
+  push 0
+.L.done.main.309:
+  push 2
+  push 3
+  pop rdi
+  pop rax
+  pop rcx
+  cmp ecx, 0
+  cmove eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-504], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-504]
+  push rax
+  lea rax, [rip+.L.str.faab73209810b2b3c67822ad241e6038]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.310
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.310
+.L.call.main.310:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.310:
+  push rax
+  add rsp, 8
+  push 7
+  push 0
+  pop rdi
+  mov dword ptr [rbp-496], edi
+  push rdi
+  add rsp, 8
+  push 0
+  pop rdi
+  mov dword ptr [rbp-492], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-496]
+  push rax
+  pop rax
+  cmp eax, 0
+  jne .L.cond.main.312
+  mov eax, dword ptr [rbp-492]
+  push rax
+  pop rax
+  cmp eax, 0
+  je .L.false.main.311
+.L.cond.main.312:
+  push 1
+  jmp .L.done.main.311
+.L.false.main.311:
+  push 0
+.L.done.main.311:
+  pop rax
+  cmp eax, 0
+  sete al
+  movzx eax, al
+  push rax
+  push 7
+  mov eax, dword ptr [rbp-496]
+  push rax
+  pop rdi
+  pop rax
+  pop rcx
+  cmp ecx, 0
+  cmove eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-496], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-496]
+  push rax
+  lea rax, [rip+.L.str.c2ba37646b74f7916a85b2860508b471]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.313
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.313
+.L.call.main.313:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.313:
+  push rax
+  add rsp, 8
+  push 4
+  push 0
+  pop rdi
+  mov dword ptr [rbp-488], edi
+  push rdi
+  add rsp, 8
+.L.begin.main.314:
+  mov eax, dword ptr [rbp-488]
+  push rax
+  push 10
+  pop rdi
+  pop rax
+  cmp eax, edi
+  jge .L.end.main.314
+  mov eax, dword ptr [rbp-488]
+  push rax
+  push 4
+  pop rdi
+  pop rax
+  cmp eax, edi
+  je .L.end.main.314
+  mov eax, dword ptr [rbp-488]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-488], edi
+  push rdi
+  add rsp, 8
+  jmp .L.begin.main.314
+.L.end.main.314:
+  mov eax, dword ptr [rbp-488]
+  push rax
+  lea rax, [rip+.L.str.a43b633a27c00c0c2d33082e4cc6e079]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.315
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.315
+.L.call.main.315:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.315:
+  push rax
+  add rsp, 8
+  push 2
+  push 1
+  pop rdi
+  mov dword ptr [rbp-484], edi
+  push rdi
+  add rsp, 8
+  push 0
+  pop rdi
+  mov dword ptr [rbp-480], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-484]
+  push rax
+  mov eax, dword ptr [rbp-480]
+  push rax
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-4], edi
+  push rdi
+  pop rdi
+  mov dword ptr [rbp-476], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-480]
+  push rax
+  pop rax
+  cmp eax, 0
+  je .L.false.main.316
+  mov eax, dword ptr [rbp-4]
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  pop rdi
+  mov dword ptr [rbp-476], edi
+  push rdi
+  pop rax
+  cmp eax, 0
+  je .L.false.main.316
+  push 1
+  jmp .L.done.main.316
+.L.false.main.316:
+  push 0
+.L.done.main.316:
+  add rsp, 8
+  mov eax, dword ptr [rbp-4]
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  add eax, edi
+  push rax
+  lea rax, [rip+.L.str.2194c1406d212fcb39d6beb8b59b4969]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.317
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.317
+.L.call.main.317:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.317:
+  push rax
+  add rsp, 8
+  push 7
+  push 2
+  pop rdi
+  mov dword ptr [rbp-472], edi
+  push rdi
+  add rsp, 8
+  add dword ptr [rbp-472], 5
+  mov eax, dword ptr [rbp-472]
+  push rax
+  lea rax, [rip+.L.str.811617f51804e1bedd72c87c6207bd8f]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.318
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.318
+.L.call.main.318:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.318:
+  push rax
+  add rsp, 8
+  push 7
+  push 2
+  pop rdi
+  mov dword ptr [rbp-468], edi
+  push rdi
+  add rsp, 8
+  add dword ptr [rbp-468], 5
+  mov eax, dword ptr [rbp-468]
+  push rax
+  lea rax, [rip+.L.str.fef02e81ed9483c1e09932a9e6acc77a]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.319
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.319
+.L.call.main.319:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.319:
+  push rax
+  add rsp, 8
+  push 3
+  push 5
+  pop rdi
+  mov dword ptr [rbp-464], edi
+  push rdi
+  add rsp, 8
+  sub dword ptr [rbp-464], 2
+  mov eax, dword ptr [rbp-464]
+  push rax
+  lea rax, [rip+.L.str.ab1900584642b7c3ea4ef888824ede20]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.320
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.320
+.L.call.main.320:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.320:
+  push rax
+  add rsp, 8
+  push 6
+  push 3
+  pop rdi
+  mov dword ptr [rbp-460], edi
+  push rdi
+  add rsp, 8
+  mov rdi, 2
+  mov eax, dword ptr [rbp-460]
+  imul eax, edi
+  mov dword ptr [rbp-460], eax
+  mov eax, dword ptr [rbp-460]
+  push rax
+  lea rax, [rip+.L.str.f6aca27649cd629a220ac44cf2a71f0b]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.321
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.321
+.L.call.main.321:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.321:
+  push rax
+  add rsp, 8
+  push 3
+  push 7
+  pop rdi
+  mov dword ptr [rbp-456], edi
+  push rdi
+  add rsp, 8
+  mov rdi, 2
+  mov eax, dword ptr [rbp-456]
+  cdq
+  idiv edi
+  mov dword ptr [rbp-456], eax
+  mov eax, dword ptr [rbp-456]
+  push rax
+  lea rax, [rip+.L.str.93ca8075e659effa9aef013f8b0fd369]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.322
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.322
+.L.call.main.322:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.322:
+  push rax
+  add rsp, 8
+  push 3
+  push 2
+  pop rdi
+  mov dword ptr [rbp-452], edi
+  push rdi
+  add rsp, 8
+  add dword ptr [rbp-452], 1
+  mov eax, dword ptr [rbp-452]
+  push rax
+  lea rax, [rip+.L.str.003629b6af7aeaa613eef983412b0411]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.323
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.323
+.L.call.main.323:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.323:
+  push rax
+  add rsp, 8
+  push 1
+  push 2
+  pop rdi
+  mov dword ptr [rbp-448], edi
+  push rdi
+  add rsp, 8
+  sub dword ptr [rbp-448], 1
+  mov eax, dword ptr [rbp-448]
+  push rax
+  lea rax, [rip+.L.str.69640d600d59fbb199270a5b57c74f5e]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.324
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.324
+.L.call.main.324:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.324:
+  push rax
+  add rsp, 8
+  push 2
+  push 2
+  pop rdi
+  mov dword ptr [rbp-444], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-444]
+  add dword ptr [rbp-444], 1
+  push rax
+  lea rax, [rip+.L.str.2ec2c60e7cd52148882b3c2cf9cab606]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.325
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.325
+.L.call.main.325:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.325:
+  push rax
+  add rsp, 8
+  push 2
+  push 2
+  pop rdi
+  mov dword ptr [rbp-440], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-440]
+  sub dword ptr [rbp-440], 1
+  push rax
+  lea rax, [rip+.L.str.ae3ec36ff434da4a426dc1ed7cba449a]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.326
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.326
+.L.call.main.326:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.326:
+  push rax
+  add rsp, 8
+  push 3
+  push 2
+  pop rdi
+  mov dword ptr [rbp-436], edi
+  push rdi
+  add rsp, 8
+  add dword ptr [rbp-436], 1
+  mov eax, dword ptr [rbp-436]
+  push rax
+  lea rax, [rip+.L.str.7da29f77d6a82c24fed284cd206b18da]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.327
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.327
+.L.call.main.327:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.327:
+  push rax
+  add rsp, 8
+  push 1
+  push 2
+  pop rdi
+  mov dword ptr [rbp-432], edi
+  push rdi
+  add rsp, 8
+  sub dword ptr [rbp-432], 1
+  mov eax, dword ptr [rbp-432]
+  push rax
+  lea rax, [rip+.L.str.12256247d11889ddd89cccbe8259df5f]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.328
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.328
+.L.call.main.328:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.328:
+  push rax
+  add rsp, 8
+  push 5
+  mov rax, rbp
+  sub rax, 428
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 428
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 428
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 428
+  push rax
+  pop rdi
+  mov qword ptr [rbp-416], rdi
+  push rdi
+  add rsp, 8
+  add qword ptr [rbp-416], 8
+  mov rax, qword ptr [rbp-416]
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.67a49b6aea5f52da89ead7d8a301ec0e]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.329
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.329
+.L.call.main.329:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.329:
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, rbp
+  sub rax, 404
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 404
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 404
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 404
+  push rax
+  pop rdi
+  mov qword ptr [rbp-392], rdi
+  push rdi
+  add rsp, 8
+  add qword ptr [rbp-392], 4
+  mov rax, qword ptr [rbp-392]
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.a8a37ffe62568d14ee0d83d14408dbd8]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.330
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.330
+.L.call.main.330:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.330:
+  push rax
+  add rsp, 8
+  push 1
+  mov rax, rbp
+  sub rax, 380
+  push rax
+  push 0
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 380
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 380
+  push rax
+  push 2
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 5
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 380
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rdi
+  mov qword ptr [rbp-368], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-368]
+  sub qword ptr [rbp-368], 4
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  add rsp, 8
+  mov rax, qword ptr [rbp-368]
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.ba4dc2ad9da3dea9c14998e180bdcd01]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.331
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.331
+.L.call.main.331:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.331:
+  push rax
+  add rsp, 8
+  push 4
+  mov rax, rbp
+  sub rax, 360
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 360
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rcx
+  add dword ptr [rcx], 1
+  mov rax, rbp
+  sub rax, 360
+  push rax
+  push 1
+  pop rdi
+  pop rax
+  movsxd rdi, edi
+  imul rdi, 4
+  add rax, rdi
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.35b13059603584f4d370b8e902e9dab6]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.332
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.332
+.L.call.main.332:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.332:
+  push rax
+  add rsp, 8
+  push 0
+  push 128
+  pop rdi
+  pop rax
+  sub eax, edi
+  push rax
+  push 127
+  pop rdi
+  movsx edi, dil
+  mov byte ptr [rbp-349], dil
+  push rdi
+  add rsp, 8
+  add byte ptr [rbp-349], 1
+  movsx eax, byte ptr [rbp-349]
+  push rax
+  lea rax, [rip+.L.str.f0ab0331e8926c9a46f0731b226ee9c6]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.333
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.333
+.L.call.main.333:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.333:
+  push rax
+  add rsp, 8
+  push 0
+  push 10
+  pop rdi
+  mov dword ptr [rbp-348], edi
+  push rdi
+  add rsp, 8
+  movabs rax, 4294967298
+  push rax
+  pop rdi
+  mov eax, dword ptr [rbp-348]
+  movsxd rax, eax
+  cqo
+  idiv rdi
+  mov dword ptr [rbp-348], eax
+  mov eax, dword ptr [rbp-348]
+  push rax
+  lea rax, [rip+.L.str.2f4a7fbf9dd607f3e32a348ffca12151]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.334
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.334
+.L.call.main.334:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.334:
+  push rax
+  add rsp, 8
+  movabs rax, 4294967296
+  push rax
+  movabs rax, 2147483648
+  push rax
+  pop rdi
+  mov qword ptr [rbp-344], rdi
+  push rdi
+  add rsp, 8
+  mov rdi, 2
+  mov rax, qword ptr [rbp-344]
+  movsxd rdi, edi
+  imul rax, rdi
+  mov qword ptr [rbp-344], rax
+  mov rax, qword ptr [rbp-344]
+  push rax
+  lea rax, [rip+.L.str.1265dfea306e217b83e0bc20ccff4679]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.335
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.335
+.L.call.main.335:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.335:
+  push rax
+  add rsp, 8
+  push 45
+  push 0
+  pop rdi
+  mov dword ptr [rbp-328], edi
+  push rdi
+  add rsp, 8
+  push 0
+  pop rdi
+  mov dword ptr [rbp-332], edi
+  push rdi
+  add rsp, 8
+.L.begin.main.336:
+  mov eax, dword ptr [rbp-332]
+  push rax
+  push 8
+  pop rdi
+  pop rax
+  cmp eax, edi
+  jge .L.end.main.336
+  mov eax, dword ptr [rbp-332]
+  push rax
+  pop rdi
+  add dword ptr [rbp-328], edi
+  add dword ptr [rbp-332], 1
+  mov eax, dword ptr [rbp-332]
+  push rax
+  pop rdi
+  add dword ptr [rbp-328], edi
+  add dword ptr [rbp-332], 1
+  mov eax, dword ptr [rbp-332]
+  push rax
+  pop rdi
+  add dword ptr [rbp-328], edi
+  add dword ptr [rbp-332], 1
+  mov eax, dword ptr [rbp-332]
+  push rax
+  pop rdi
+  add dword ptr [rbp-328], edi
+  add dword ptr [rbp-332], 1
+  jmp .L.begin.main.336
+.L.end.main.336:
+  mov eax, dword ptr [rbp-332]
+  push rax
+  pop rdi
+  add dword ptr [rbp-328], edi
+  add dword ptr [rbp-332], 1
+  mov eax, dword ptr [rbp-332]
+  push rax
+  pop rdi
+  add dword ptr [rbp-328], edi
+  add dword ptr [rbp-332], 1
+  mov eax, dword ptr [rbp-328]
+  push rax
+  lea rax, [rip+.L.str.1812ac021bef972d704ae9fa1e610d46]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.337
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.337
+.L.call.main.337:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.337:
+  push rax
+  add rsp, 8
+  push 45
+  push 0
+  pop rdi
+  mov dword ptr [rbp-320], edi
+  push rdi
+  add rsp, 8
+  push 0
+  pop rdi
+  mov dword ptr [rbp-324], edi
+  push rdi
+  add rsp, 8
+.L.begin.main.338:
+  mov eax, dword ptr [rbp-324]
+  push rax
+  push 8
+  pop rdi
+  pop rax
+  cmp eax, edi
+  jge .L.end.main.338
+  mov eax, dword ptr [rbp-324]
+  push rax
+  pop rdi
+  add dword ptr [rbp-320], edi
+  add dword ptr [rbp-324], 1
+  mov eax, dword ptr [rbp-324]
+  push rax
+  pop rdi
+  add dword ptr [rbp-320], edi
+  add dword ptr [rbp-324], 1
+  mov eax, dword ptr [rbp-324]
+  push rax
+  pop rdi
+  add dword ptr [rbp-320], edi
+  add dword ptr [rbp-324], 1
+  mov eax, dword ptr [rbp-324]
+  push rax
+  pop rdi
+  add dword ptr [rbp-320], edi
+  add dword ptr [rbp-324], 1
+  jmp .L.begin.main.338
+.L.end.main.338:
+  mov eax, dword ptr [rbp-324]
+  push rax
+  pop rdi
+  add dword ptr [rbp-320], edi
+  add dword ptr [rbp-324], 1
+  mov eax, dword ptr [rbp-324]
+  push rax
+  pop rdi
+  add dword ptr [rbp-320], edi
+  add dword ptr [rbp-324], 1
+  mov eax, dword ptr [rbp-320]
+  push rax
+  lea rax, [rip+.L.str.02b5f7f889ebfd57475e201b8c75d846]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.339
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.339
+.L.call.main.339:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.339:
+  push rax
+  add rsp, 8
+  push 1
+  push 0
+  pop rdi
+  cmp edi, 0
+  setne dil
+  movzx edi, dil
+  mov byte ptr [rbp-314], dil
+  push rdi
+  add rsp, 8
+  mov rdi, 1
+  movzx eax, byte ptr [rbp-314]
+  mov rsi, rax
+  add eax, edi
+  cmp eax, 0
+  setne al
+  movzx eax, al
+  mov byte ptr [rbp-314], al
+  movzx eax, byte ptr [rbp-314]
+  push rax
+  lea rax, [rip+.L.str.59621272fef1cf6331a9b435f0d392c5]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.340
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.340
+.L.call.main.340:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.340:
+  push rax
+  add rsp, 8
+  push 1
+  push 0
+  pop rdi
+  cmp edi, 0
+  setne dil
+  movzx edi, dil
+  mov byte ptr [rbp-313], dil
+  push rdi
+  add rsp, 8
+  mov rdi, 1
+  movzx eax, byte ptr [rbp-313]
+  mov rsi, rax
+  sub eax, edi
+  cmp eax, 0
+  setne al
+  movzx eax, al
+  mov byte ptr [rbp-313], al
+  movzx eax, byte ptr [rbp-313]
+  push rax
+  lea rax, [rip+.L.str.398b1264350125de2e04b49f436ffce3]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.341
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.341
+.L.call.main.341:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.341:
+  push rax
+  add rsp, 8
+  push 5
+  mov rax, qword ptr ext_var@GOTPCREL[rip]
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.74bc4fd2b43fba1083fabc53c60269f6]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.342
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.342
+.L.call.main.342:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.342:
+  push rax
+  add rsp, 8
+  push 7
+  mov rax, qword ptr ext_var@GOTPCREL[rip]
+  push rax
+  push 7
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr ext_var@GOTPCREL[rip]
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.20c4fa3a9e0566bbbe635f9dcd8bfcc6]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.343
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.343
+.L.call.main.343:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.343:
+  push rax
+  add rsp, 8
+  push 8
+  mov rax, qword ptr ext_var@GOTPCREL[rip]
+  push rax
+  pop rcx
+  add dword ptr [rcx], 1
+  mov rax, qword ptr ext_var@GOTPCREL[rip]
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.8c006d8e1ba33251cf7b7c1b767d50b9]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.344
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.344
+.L.call.main.344:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.344:
+  push rax
+  add rsp, 8
+  push 3
+  mov rax, qword ptr ext_var@GOTPCREL[rip]
+  push rax
+  pop rdi
+  mov qword ptr [rbp-312], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-312]
+  push rax
+  push 3
+  pop rdi
+  pop rax
+  mov dword ptr [rax], edi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr ext_var@GOTPCREL[rip]
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.022267a8f7e6276661dea7211e933297]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.345
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.345
+.L.call.main.345:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.345:
+  push rax
+  add rsp, 8
+  push 3
+  push 3
+  pop rdi
+  mov dword ptr [rbp-304], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-304]
+  push rax
+  lea rax, [rip+.L.str.b9d7d38977ed0294676e508d1bf772fe]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.346
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.346
+.L.call.main.346:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.346:
+  push rax
+  add rsp, 8
+  push 3
+  push 3
+  pop rdi
+  mov dword ptr [rbp-300], edi
+  push rdi
+  add rsp, 8
+  push 3
+  pop rdi
+  mov dword ptr [rbp-300], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-300]
+  push rax
+  lea rax, [rip+.L.str.38e8474815dde26b7d709b09499cbd5b]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.347
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.347
+.L.call.main.347:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.347:
+  push rax
+  add rsp, 8
+  push 0
+  push 0
+  pop rdi
+  cmp edi, 0
+  setne dil
+  movzx edi, dil
+  mov byte ptr [rbp-283], dil
+  push rdi
+  add rsp, 8
+  movzx eax, byte ptr [rbp-283]
+  push rax
+  lea rax, [rip+.L.str.81bb5ded49f5bb2da11a57834052435e]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.348
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.348
+.L.call.main.348:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.348:
+  push rax
+  add rsp, 8
+  push 1
+  push 1
+  pop rdi
+  cmp edi, 0
+  setne dil
+  movzx edi, dil
+  mov byte ptr [rbp-282], dil
+  push rdi
+  add rsp, 8
+  movzx eax, byte ptr [rbp-282]
+  push rax
+  lea rax, [rip+.L.str.980d1a779c50f50aa019a4e6da5aec94]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.349
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.349
+.L.call.main.349:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.349:
+  push rax
+  add rsp, 8
+  push 1
+  push 2
+  pop rdi
+  cmp edi, 0
+  setne dil
+  movzx edi, dil
+  mov byte ptr [rbp-281], dil
+  push rdi
+  add rsp, 8
+  movzx eax, byte ptr [rbp-281]
+  push rax
+  lea rax, [rip+.L.str.670c1131975590e1a728be9d4ce9726d]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.350
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.350
+.L.call.main.350:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.350:
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  lea rax, [rip+.L.str.7ae900c7015cac9e2ad803c2e23112b7]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.351
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.351
+.L.call.main.351:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.351:
+  push rax
+  add rsp, 8
+  push 1
+  push 1
+  lea rax, [rip+.L.str.77f136a7fde31280ec22f06a60f71b10]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.352
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.352
+.L.call.main.352:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.352:
+  push rax
+  add rsp, 8
+  push 2
+  push 2
+  lea rax, [rip+.L.str.7117d3914679e49707e6868bf8582f89]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.353
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.353
+.L.call.main.353:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.353:
+  push rax
+  add rsp, 8
+  push 2
+  push 2
+  lea rax, [rip+.L.str.49bfec0c1029b910014f410d0d65191b]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.354
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.354
+.L.call.main.354:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.354:
+  push rax
+  add rsp, 8
+  push 4
+  push 4
+  lea rax, [rip+.L.str.06236a87c1c77a2c4d3f653082b54204]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.355
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.355
+.L.call.main.355:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.355:
+  push rax
+  add rsp, 8
+  push 4
+  push 4
+  lea rax, [rip+.L.str.62989980a56306dbf9f3fb966f967533]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.356
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.356
+.L.call.main.356:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.356:
+  push rax
+  add rsp, 8
+  push 4
+  push 4
+  lea rax, [rip+.L.str.90963e0f34119cf766492c04fc6a1bb3]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.357
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.357
+.L.call.main.357:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.357:
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  lea rax, [rip+.L.str.617e6589d50834f26595c3ec227728a6]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.358
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.358
+.L.call.main.358:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.358:
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  lea rax, [rip+.L.str.31dfd8dab42f9df415358cf93844f717]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.359
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.359
+.L.call.main.359:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.359:
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  lea rax, [rip+.L.str.7ae900c7015cac9e2ad803c2e23112b7]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.360
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.360
+.L.call.main.360:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.360:
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  lea rax, [rip+.L.str.9b72946ba14451ef88bed149bfea9da5]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.361
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.361
+.L.call.main.361:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.361:
+  push rax
+  add rsp, 8
+  push 3
+  push 3
+  pop rdi
+  mov dword ptr [rbp-216], edi
+  push rdi
+  add rsp, 8
+  mov eax, dword ptr [rbp-216]
+  push rax
+  lea rax, [rip+.L.str.e63271fb4a3739eb00ff4968ddf2bb64]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.362
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.362
+.L.call.main.362:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.362:
+  push rax
+  add rsp, 8
+  push 1
+  push 1
+  lea rax, [rip+.L.str.28a9586c5eb89e7dc0341c4a34b80381]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.363
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.363
+.L.call.main.363:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.363:
+  push rax
+  add rsp, 8
+  push 2
+  push 2
+  lea rax, [rip+.L.str.055a5294750582ce3e25a649529c81b7]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.364
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.364
+.L.call.main.364:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.364:
+  push rax
+  add rsp, 8
+  push 2
+  push 2
+  lea rax, [rip+.L.str.8106660d799d6b2d424204074b734ce4]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.365
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.365
+.L.call.main.365:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.365:
+  push rax
+  add rsp, 8
+  push 2
+  push 2
+  lea rax, [rip+.L.str.9d5087796ea9aa4e5509249d9c10ab03]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.366
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.366
+.L.call.main.366:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.366:
+  push rax
+  add rsp, 8
+  push 4
+  push 4
+  lea rax, [rip+.L.str.33fce0a8c77e7651cc8e955585fbf538]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.367
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.367
+.L.call.main.367:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.367:
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  lea rax, [rip+.L.str.029591dc2e1ed78a5ea73ea7dd426cee]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.368
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.368
+.L.call.main.368:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.368:
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  lea rax, [rip+.L.str.f0347494906049277393903f0fe3ec80]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.369
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.369
+.L.call.main.369:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.369:
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  lea rax, [rip+.L.str.f0347494906049277393903f0fe3ec80]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.370
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.370
+.L.call.main.370:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.370:
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  lea rax, [rip+.L.str.e76a2f0cd71fdd2b88fa8c4e6a7b000c]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.371
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.371
+.L.call.main.371:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.371:
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  lea rax, [rip+.L.str.844e3762e9972cbf82858d282ab9544d]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.372
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.372
+.L.call.main.372:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.372:
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  lea rax, [rip+.L.str.7ef3ceda88b6d082b0b5905e789197d1]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.373
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.373
+.L.call.main.373:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.373:
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  lea rax, [rip+.L.str.2d263ea17f5ed81941975c3b4aec3ac4]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.374
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.374
+.L.call.main.374:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.374:
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  lea rax, [rip+.L.str.6a0455dc011cc0ad76ba920292de017a]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.375
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.375
+.L.call.main.375:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.375:
+  push rax
+  add rsp, 8
+  push 32
+  push 32
+  lea rax, [rip+.L.str.6a0455dc011cc0ad76ba920292de017a]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.376
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.376
+.L.call.main.376:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.376:
+  push rax
+  add rsp, 8
+  push 16
+  push 16
+  lea rax, [rip+.L.str.6556dda1315f084c09eafc8757fc8d97]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.377
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.377
+.L.call.main.377:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.377:
+  push rax
+  add rsp, 8
+  push 48
+  push 48
+  lea rax, [rip+.L.str.df8ffa80c3534702da83b5b11cbf24df]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.378
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.378
+.L.call.main.378:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.378:
+  push rax
+  add rsp, 8
+  push 8
+  push 8
+  lea rax, [rip+.L.str.78aa51470699b0d15abc5c6c315449d9]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.379
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.379
+.L.call.main.379:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.379:
+  push rax
+  add rsp, 8
+  push 131585
+  movabs rax, 8590066177
+  push rax
+  pop rax
+  push rax
+  lea rax, [rip+.L.str.2adeb3104c2d0fbf11e458a655ac05be]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.380
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.380
+.L.call.main.380:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.380:
+  push rax
+  add rsp, 8
+  push 513
+  movabs rax, 8590066177
+  push rax
+  pop rax
+  movsx eax, ax
+  push rax
+  lea rax, [rip+.L.str.99d195a0d8aee13f5fa1d8d987244381]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.381
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.381
+.L.call.main.381:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.381:
+  push rax
+  add rsp, 8
+  push 1
+  movabs rax, 8590066177
+  push rax
+  pop rax
+  movsx eax, al
+  push rax
+  lea rax, [rip+.L.str.a72110c33c03a0ce5d6bffc7cf5f9d4d]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.382
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.382
+.L.call.main.382:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.382:
+  push rax
+  add rsp, 8
+  push 1
+  push 1
+  pop rax
+  cmp eax, 0
+  setne al
+  movzx eax, al
+  push rax
+  lea rax, [rip+.L.str.8311e6343bbedd4860bff1037e2622c5]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.383
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.383
+.L.call.main.383:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.383:
+  push rax
+  add rsp, 8
+  push 1
+  push 2
+  pop rax
+  cmp eax, 0
+  setne al
+  movzx eax, al
+  push rax
+  lea rax, [rip+.L.str.795f22f7de2dfb656de56611668e7e20]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.384
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.384
+.L.call.main.384:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.384:
+  push rax
+  add rsp, 8
+  push 0
+  push 256
+  pop rax
+  movsx eax, al
+  push rax
+  pop rax
+  cmp eax, 0
+  setne al
+  movzx eax, al
+  push rax
+  lea rax, [rip+.L.str.0a93f3a2970ffb7e2a4992181f8a8769]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.385
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.385
+.L.call.main.385:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.385:
+  push rax
+  add rsp, 8
+  push 1
+  push 1
+  pop rax
+  movsxd rax, eax
+  push rax
+  lea rax, [rip+.L.str.812dd478527b978d9f6b99070372bc0c]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.386
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.386
+.L.call.main.386:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.386:
+  push rax
+  add rsp, 8
+  push 0
+  push 0
+  pop rax
+  movsxd rax, eax
+  push rax
+  pop rax
+  push rax
+  lea rax, [rip+.L.str.e5bfb1ad6d144f304448700a2a7fd7c5]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.387
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.387
+.L.call.main.387:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.387:
+  push rax
+  add rsp, 8
+  push 5
+  push 5
+  pop rdi
+  mov dword ptr [rbp-212], edi
+  push rdi
+  add rsp, 8
+  mov rax, rbp
+  sub rax, 212
+  push rax
+  pop rax
+  push rax
+  pop rdi
+  mov qword ptr [rbp-208], rdi
+  push rdi
+  add rsp, 8
+  mov rax, qword ptr [rbp-208]
+  push rax
+  pop rax
+  push rax
+  pop rax
+  mov eax, dword ptr [rax]
+  push rax
+  lea rax, [rip+.L.str.88d4f4fdbdb8045e712c67678a150d3f]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.388
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.388
+.L.call.main.388:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.388:
+  push rax
+  add rsp, 8
+  push 97
+  push 97
+  lea rax, [rip+.L.str.c4a22671064cce89ee32bf8bdf13314f]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.389
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.389
+.L.call.main.389:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.389:
+  push rax
+  add rsp, 8
+  push 10
+  push 10
+  lea rax, [rip+.L.str.3de678646d93ee7f0fd1281fba18dae2]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.390
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.390
+.L.call.main.390:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.390:
+  push rax
+  add rsp, 8
+  push 0
+  push 0
+  lea rax, [rip+.L.str.66f69ee0a861237f78aaa0495dc13b2b]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.391
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.391
+.L.call.main.391:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.391:
+  push rax
+  add rsp, 8
+  push 1
+  push 1
+  lea rax, [rip+.L.str.ab9a5a7438c6dec5978de0b8f949c977]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.392
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.392
+.L.call.main.392:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.392:
+  push rax
+  add rsp, 8
+  push 2
+  push 2
+  lea rax, [rip+.L.str.40d3c989fe21a9ea656431446d082fd5]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.393
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.393
+.L.call.main.393:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.393:
+  push rax
+  add rsp, 8
+  push 5
+  push 5
+  lea rax, [rip+.L.str.321c5604317f9159e4465fa82bc39b95]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.394
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.394
+.L.call.main.394:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.394:
+  push rax
+  add rsp, 8
+  push 6
+  push 6
+  lea rax, [rip+.L.str.69517039e7cbd135cbe09aa3b05d377d]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.395
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.395
+.L.call.main.395:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.395:
+  push rax
+  add rsp, 8
+  push 0
+  push 0
+  lea rax, [rip+.L.str.1fa86f80ef4e8ecf49917ac491cec917]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.396
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.396
+.L.call.main.396:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.396:
+  push rax
+  add rsp, 8
+  push 5
+  push 5
+  lea rax, [rip+.L.str.4e55b007d5f9357bca8c30a394a8da4a]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.397
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.397
+.L.call.main.397:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.397:
+  push rax
+  add rsp, 8
+  push 3
+  push 3
+  lea rax, [rip+.L.str.0e1560a14ea59705d567906227a961eb]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.398
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.398
+.L.call.main.398:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.398:
+  push rax
+  add rsp, 8
+  push 4
+  push 4
+  lea rax, [rip+.L.str.383da69f7fd89d8099d0422f9a57d8aa]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.399
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.399
+.L.call.main.399:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.399:
+  push rax
+  add rsp, 8
+  push 4
+  push 4
+  lea rax, [rip+.L.str.546756f578f12c00689b89cf87c05d54]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.400
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.400
+.L.call.main.400:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.400:
+  push rax
+  add rsp, 8
+  push 4
+  push 4
+  lea rax, [rip+.L.str.cdfa864dc21a45f7e07299625170454d]
+  push rax
+  pop rdx
+  pop rsi
+  pop rdi
+  movsxd rdi, edi
+  movsxd rsi, esi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.401
+  mov eax, 0
+  call assert@PLT
+  jmp .L.end.main.401
+.L.call.main.401:
+  sub rsp, 8
+  mov eax, 0
+  call assert@PLT
+  add rsp, 8
+.L.end.main.401:
+  push rax
+  add rsp, 8
+  lea rax, [rip+.L.str.c9a18416659e4d3a4f61d143a1830006]
+  push rax
+  pop rdi
+  mov rax, rsp
+  and rax, 15
+  jnz .L.call.main.402
+  mov eax, 0
+  call printf@PLT
+  jmp .L.end.main.402
+.L.call.main.402:
+  sub rsp, 8
+  mov eax, 0
+  call printf@PLT
+  add rsp, 8
+.L.end.main.402:
+  push rax
+  add rsp, 8
+  push 0
+  pop rax
+  jmp .L.return.main
+.L.return.main:
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -1,127 +1,153 @@
 #include "9cc.h"
 
-// 現在着目しているトークン
-Token *token;
-
-// 入力プログラム
-char *user_input;
-char *filename;
-
-char *strndup(char *s, size_t n) {
-  char *t = calloc(n + 1, sizeof(char));
-  memcpy(t, s, n);
-  t[n] = '\0';
-  return t;
+// 診断メッセージを1件記録する。loc が NULL なら位置なし。
+static CcDiag *add_diag(CcDiagKind kind, char *loc, char *fmt, va_list ap) {
+  CcDiag *d = calloc(1, sizeof(CcDiag));
+  d->kind = kind;
+  d->filename = strdup(ctx->filename);
+
+  size_t size;
+  FILE *fp = open_memstream(&d->message, &size);
+  vfprintf(fp, fmt, ap);
+  fclose(fp);
+
+  fp = open_memstream(&d->text, &size);
+  if (!loc) {
+    fprintf(fp, "%s\n", d->message);
+  } else {
+    // locが含まれている行の開始地点と終了地点を取得
+    char *line = loc;
+    while (ctx->user_input < line && line[-1] != '\n') line--;
+
+    char *end = loc;
+    while (*end != '\n') end++;
+
+    // 見つかった行が全体の何行目なのかを調べる
+    int line_num = 1;
+    for (char *p = ctx->user_input; p < line; p++)
+      if (*p == '\n') line_num++;
+    d->line = line_num;
+    d->column = loc - line + 1;
+
+    // 見つかった行を、ファイル名と行番号と一緒に表示
+    int indent = fprintf(fp, "%s:%d: ", ctx->filename, line_num);
+    fprintf(fp, "%.*s\n", (int)(end - line), line);
+
+    // エラー箇所を"^"で指し示して、エラーメッセージを表示
+    int pos = loc - line + indent;
+    fprintf(fp, "%*s", pos, "");  // pos個の空白を出力
+    fprintf(fp, "^ %s\n", d->message);
+  }
+  fclose(fp);
+
+  if (ctx->diag_fn) ctx->diag_fn->has_diag = true;
+  if (ctx->diags_last)
+    ctx->diags_last->next = d;
+  else
+    ctx->diags = d;
+  ctx->diags_last = d;
+  return d;
 }
 
+// コンパイルを打ち切って cc_compile に戻る
+static _Noreturn void bail(void) { longjmp(ctx->bail, 1); }
+
 // エラーを報告するための関数
 // printfと同じ引数を取る
 void error(char *fmt, ...) {
   va_list ap;
   va_start(ap, fmt);
-  vfprintf(stderr, fmt, ap);
-  fprintf(stderr, "\n");
-  exit(1);
-}
-
-// Reports an error location and exit.
-static void verror_at(char *loc, char *fmt, va_list ap) {
-  // locが含まれている行の開始地点と終了地点を取得
-  char *line = loc;
-  while (user_input < line && line[-1] != '\n') line--;
-
-  char *end = loc;
-  while (*end != '\n') end++;
-
-  // 見つかった行が全体の何行目なのかを調べる
-  int line_num = 1;
-  for (char *p = user_input; p < line; p++)
-    if (*p == '\n') line_num++;
-
-  // 見つかった行を、ファイル名と行番号と一緒に表示
-  int indent = fprintf(stderr, "%s:%d: ", filename, line_num);
-  fprintf(stderr, "%.*s\n", (int)(end - line), line);
-
-  // エラー箇所を"^"で指し示して、エラーメッセージを表示
-  int pos = loc - line + indent;
-  fprintf(stderr, "%*s", pos, "");  // pos個の空白を出力
-  fprintf(stderr, "^ ");
-  vfprintf(stderr, fmt, ap);
-  fprintf(stderr, "\n");
+  if (!ctx) {
+    // コンパイル外 (引数の解析など) ではその場で終了する
+    vfprintf(stderr, fmt, ap);
+    fprintf(stderr, "\n");
+    exit(1);
+  }
+  add_diag(CC_ERROR, NULL, fmt, ap);
+  bail();
 }
 
 // エラー箇所を報告する
 void error_at(char *loc, char *fmt, ...) {
   va_list ap;
   va_start(ap, fmt);
-  verror_at(loc, fmt, ap);
+  add_diag(CC_ERROR, loc, fmt, ap);
+  bail();
 }
 
-// Reports an error location and exit.
 void error_tok(Token *tok, char *fmt, ...) {
   va_list ap;
   va_start(ap, fmt);
-  verror_at(tok->str, fmt, ap);
-  exit(1);
+  add_diag(CC_ERROR, tok->str, fmt, ap);
+  bail();
 }
 
 void warn_tok(Token *tok, char *fmt, ...) {
   va_list ap;
   va_start(ap, fmt);
-  verror_at(tok->str, fmt, ap);
+  add_diag(CC_WARNING, tok->str, fmt, ap);
+}
+
+// -fopt-report などの情報を出力する
+void note_tok(Token *tok, char *fmt, ...) {
+  va_list ap;
+  va_start(ap, fmt);
+  add_diag(CC_NOTE, tok->str, fmt, ap);
 }
 
 Token *peek(char *s) {
-  if (token->kind != TK_RESERVED || strlen(s) != token->len ||
-      memcmp(token->str, s, token->len))
+  if (ctx->token->kind != TK_RESERVED || strlen(s) != ctx->token->len ||
+      memcmp(ctx->token->str, s, ctx->token->len))
     return NULL;
-  return token;
+  return ctx->token;
 }
 
 // 次のトークンが期待している記号のときには、トークンを1つ読み進めて
 // 真を返す。それ以外の場合には偽を返す。
 Token *consume(char *op) {
   if (!peek(op)) return false;
-  Token *t = token;
-  token = token->next;
+  Token *t = ctx->token;
+  ctx->token = next_token(ctx->token);
   return t;
 }
 
 Token *consume_ident(void) {
-  if (token->kind != TK_IDENT) return NULL;
-  Token *tok = token;
-  token = token->next;
+  if (ctx->token->kind != TK_IDENT) return NULL;
+  Token *tok = ctx->token;
+  ctx->token = next_token(ctx->token);
   return tok;
 }
 
 // 次のトークンが期待している記号のときには、トークンを1つ読み進める。
 // それ以外の場合にはエラーを報告する。
 void expect(char *op) {
-  if (!peek(op)) error_at(token->str, "'%s'ではありません", op);
-  token = token->next;
+  if (!peek(op)) error_at(ctx->token->str, "'%s'ではありません", op);
+  ctx->token = next_token(ctx->token);
 }
 
 // 次のトークンが数値の場合、トークンを1つ読み進めてその数値を返す。
 // それ以外の場合にはエラーを報告する。
-int expect_number(void) {
-  if (token->kind != TK_NUM) error_at(token->str, "数ではありません");
-  int val = token->val;
-  token = token->next;
+long expect_number(void) {
+  if (ctx->token->kind != TK_NUM)
+    error_at(ctx->token->str, "数ではありません");
+  long val = ctx->token->val;
+  ctx->token = next_token(ctx->token);
   return val;
 }
 
 char *expect_ident(void) {
-  if (token->kind != TK_IDENT) error_at(token->str, "識別子ではありません");
-  char *name = strndup(token->str, token->len);
-  token = token->next;
+  if (ctx->token->kind != TK_IDENT)
+    error_at(ctx->token->str, "識別子ではありません");
+  char *name = arena_strndup(ctx->token->str, ctx->token->len);
+  ctx->token = next_token(ctx->token);
   return name;
 }
 
-bool at_eof() { return token->kind == TK_EOF; }
+bool at_eof() { return ctx->token->kind == TK_EOF; }
 
 // 新しいトークンを作成してcurに繋げる
 Token *new_token(TokenKind kind, Token *cur, char *str, int len) {
-  Token *tok = calloc(1, sizeof(Token));
+  Token *tok = arena_calloc(1, sizeof(Token));
   tok->kind = kind;
   tok->str = str;
   tok->len = len;
@@ -142,15 +168,17 @@ static char *starts_with_reserved(char *p) {
   static char *kw[] = {
       "return", "if",  "else", "while", "for",    "void",    "_Bool",  "char",
       "short",  "int", "long", "enum",  "struct", "typedef", "sizeof",
+      "static", "switch", "case", "default", "break", "extern",
   };
 
   for (int i = 0; i < sizeof(kw) / sizeof(*kw); i++) {
     int len = strlen(kw[i]);
-    if (startswith(p, kw[i]) && !isalnum(p[len])) return kw[i];
+    if (startswith(p, kw[i]) && !is_alnum(p[len])) return kw[i];
   }
 
   // Multi-letter punctuator
-  static char *ops[] = {"==", "!=", "<=", ">=", "->"};
+  static char *ops[] = {"==", "!=", "<=", ">=", "->", "&&", "||",
+                        "+=", "-=", "*=", "/=", "++", "--"};
 
   for (int i = 0; i < sizeof(ops) / sizeof(*ops); i++)
     if (startswith(p, ops[i])) return ops[i];
@@ -185,11 +213,17 @@ static char get_escape_char(char c) {
 
 static Token *read_string_literal(Token *cur, char *start) {
   char *p = start + 1;
-  char buf[1024];
+  int cap = 16;
+  char *buf = arena_calloc(1, cap);
   int len = 0;
 
   for (;;) {
-    if (len == sizeof(buf)) error_at(start, "string literal too large");
+    // 終端の '\0' の分も含めて足りなくなったら広げる
+    if (len + 1 == cap) {
+      char *tmp = arena_calloc(1, cap *= 2);
+      memcpy(tmp, buf, len);
+      buf = tmp;
+    }
     if (*p == '\0') error_at(start, "unclosed string literal");
     if (*p == '"') break;
 
@@ -202,8 +236,7 @@ static Token *read_string_literal(Token *cur, char *start) {
   }
 
   Token *tok = new_token(TK_STR, cur, start, p - start + 1);
-  tok->contents = malloc(len + 1);
-  memcpy(tok->contents, buf, len);
+  tok->contents = buf;
   tok->contents[len] = '\0';
   tok->cont_len = len + 1;
   return tok;
@@ -232,15 +265,9 @@ static Token *read_char_literal(Token *cur, char *start) {
   return tok;
 }
 
-// 入力文字列pをトークナイズしてそれを返す
-Token *tokenize() {
-  char *p = user_input;
-  Token head;
-  head.next = NULL;
-  Token *cur = &head;
-
-  while (*p) {
-    // 空白文字をスキップ
+// 空白とコメントを読み飛ばす
+static char *skip_space(char *p) {
+  for (;;) {
     if (isspace(*p)) {
       p++;
       continue;
@@ -260,54 +287,225 @@ Token *tokenize() {
       p = q + 2;
       continue;
     }
+    return p;
+  }
+}
 
-    // Character literal
-    if (*p == '\'') {
-      cur = read_char_literal(cur, p);
-      p += cur->len;
-      continue;
-    }
+// p から始まるトークンを1つ読んで cur に繋げる
+static Token *read_token(char *p, Token *cur) {
+  // Character literal
+  if (*p == '\'') return read_char_literal(cur, p);
+
+  // Keywords or multi-letter punctuators
+  char *kw = starts_with_reserved(p);
+  if (kw) return new_token(TK_RESERVED, cur, p, strlen(kw));
+
+  // 変数名を獲得する
+  if (is_alpha(*p)) {
+    char *q = p++;
+    while (is_alnum(*p)) p++;
+    return new_token(TK_IDENT, cur, q, p - q);
+  }
+
+  // 文字列
+  if (*p == '"') return read_string_literal(cur, p);
+
+  if (ispunct(*p)) return new_token(TK_RESERVED, cur, p, 1);
+
+  if (isdigit(*p)) {
+    Token *tok = new_token(TK_NUM, cur, p, 0);
+    char *q = p;
+    tok->val = strtol(p, &p, 10);
+    tok->len = p - q;
+    return tok;
+  }
+
+  error_at(p, "トークナイズできません");
+}
+
+// [p, end) をトークナイズして cur に繋げ、最後のトークンを返す
+static Token *tokenize_range(char *p, char *end, Token *cur) {
+  for (;;) {
+    p = skip_space(p);
+    if (p >= end) return cur;
+    cur = read_token(p, cur);
+    p = cur->str + cur->len;
+  }
+}
+
+//
+// -j N: 大きな入力は行の区切りで分割し、チャンクごとに並列にトークナイズする
+//
 
-    // Keywords or multi-letter punctuators
-    char *kw = starts_with_reserved(p);
-    if (kw) {
-      int len = strlen(kw);
-      cur = new_token(TK_RESERVED, cur, p, len);
-      p += len;
+// これより小さいチャンクには分けない
+#define TOKENIZE_CHUNK_MIN (64 * 1024)
+
+typedef struct {
+  char *start;
+  char *end;
+  Token head;
+  Token *last;
+} Chunk;
+
+// start から始まるチャンクの区切りを最大 n - 1 個探し、チャンクの数を返す。
+// 区切りはコメント、文字列リテラル、文字リテラルの外にある改行の直後に置く。
+// トークンは改行をまたがないので、区切りの前後は独立にトークナイズできる。
+static int split_chunks(char *start, char *end, Chunk *chunks, int n) {
+  long size = (end - start) / n;
+  char *next = start + size;
+  int nchunks = 0;
+  chunks[0].start = start;
+
+  for (char *p = start; p < end && nchunks < n - 1;) {
+    if (p[0] == '/' && p[1] == '/') {
+      while (*p != '\n') p++;
       continue;
     }
-
-    // 変数名を獲得する
-    if (is_alpha(*p)) {
-      char *q = p++;
-      while (is_alnum(*p)) p++;
-      cur = new_token(TK_IDENT, cur, q, p - q);
+    if (p[0] == '/' && p[1] == '*') {
+      char *q = strstr(p + 2, "*/");
+      if (!q) break;
+      p = q + 2;
       continue;
     }
-
-    // 文字列
     if (*p == '"') {
-      cur = read_string_literal(cur, p);
-      p += cur->len;
+      for (p++; *p && *p != '"'; p++)
+        if (*p == '\\' && p[1]) p++;
+      if (!*p) break;
+      p++;
       continue;
     }
-
-    if (ispunct(*p)) {
-      cur = new_token(TK_RESERVED, cur, p++, 1);
+    if (*p == '\'') {
+      p += p[1] == '\\' ? 3 : 2;
+      if (*p == '\'') p++;
       continue;
     }
+    if (*p++ == '\n' && p >= next) {
+      chunks[nchunks].end = p;
+      chunks[++nchunks].start = p;
+      next = p + size;
+    }
+  }
+  chunks[nchunks++].end = end;
+  return nchunks;
+}
 
-    if (isdigit(*p)) {
-      cur = new_token(TK_NUM, cur, p, 0);
-      char *q = p;
-      cur->val = strtol(p, &p, 10);
-      cur->len = p - q;
-      continue;
+static void tokenize_chunk(int i, void *arg) {
+  Chunk *c = (Chunk *)arg + i;
+  c->last = tokenize_range(c->start, c->end, &c->head);
+}
+
+// 入力文字列をトークナイズしてそれを返す
+Token *tokenize() {
+  char *start = ctx->user_input;
+  char *end = start + strlen(start);
+
+  long len = end - start;
+  int n = ctx->opts.jobs * 4;
+  if (n > len / TOKENIZE_CHUNK_MIN) n = len / TOKENIZE_CHUNK_MIN;
+  if (ctx->opts.jobs <= 1 || n <= 1) {
+    Token head = {};
+    Token *cur = tokenize_range(start, end, &head);
+    new_token(TK_EOF, cur, end, 0);
+    return head.next;
+  }
+
+  Chunk *chunks = arena_calloc(n, sizeof(Chunk));
+  n = split_chunks(start, end, chunks, n);
+  parallel_for(n, tokenize_chunk, chunks);
+
+  // チャンクのトークン列を順につなぐ
+  Token head = {};
+  Token *cur = &head;
+  for (int i = 0; i < n; i++) {
+    if (!chunks[i].head.next) continue;  // 空白やコメントだけのチャンク
+    cur->next = chunks[i].head.next;
+    cur = chunks[i].last;
+  }
+  new_token(TK_EOF, cur, end, 0);
+  return head.next;
+}
+
+//
+// -fpipeline: トークンは最上位の宣言1つ分ずつ、パーサが必要になったときに読む。
+// 読み終わった宣言のトークンはまとめて解放する。
+//
+
+struct TokenBatch {
+  TokenBatch *next;
+  Token *first;
+  ArenaBlock *arena;
+};
+
+// 次の最上位の宣言の終わり (深さ0の ";" か "}") までトークナイズして
+// cur に繋げる
+static void read_batch(Token *cur) {
+  TokenBatch *b = calloc(1, sizeof(TokenBatch));
+  TokenBatch **last = &ctx->batches;
+  while (*last) last = &(*last)->next;
+  *last = b;
+
+  ArenaBlock **saved = ctx->alloc;
+  ctx->alloc = &b->arena;
+
+  Token *start = cur;
+  char *p = ctx->lex_pos;
+  int depth = 0;
+  for (;;) {
+    p = skip_space(p);
+    if (!*p) {
+      cur = new_token(TK_EOF, cur, p, 0);
+      break;
     }
+    cur = read_token(p, cur);
+    p = cur->str + cur->len;
 
-    error_at(p, "トークナイズできません");
+    if (cur->kind != TK_RESERVED || cur->len != 1) continue;
+    if (*cur->str == '{') depth++;
+    if (*cur->str == '}' && --depth <= 0) break;
+    if (*cur->str == ';' && depth <= 0) break;
   }
 
-  new_token(TK_EOF, cur, p, 0);
+  ctx->lex_pos = p;
+  ctx->alloc = saved;
+  b->first = start->next;
+}
+
+Token *tokenize_lazy(void) {
+  ctx->lex_pos = ctx->user_input;
+  Token head = {};
+  read_batch(&head);
   return head.next;
 }
+
+// tok の次のトークンを返す。-fpipeline ではまだ読んでいなければ読む
+Token *next_token(Token *tok) {
+  if (!tok->next && tok->kind != TK_EOF) read_batch(tok);
+  return tok->next;
+}
+
+static bool in_batch(TokenBatch *b, Token *tok) {
+  Token *end = b->next ? b->next->first : NULL;
+  for (Token *t = b->first; t != end; t = t->next)
+    if (t == tok) return true;
+  return false;
+}
+
+// 最上位の宣言を読み終えたところで呼ぶ。現在のトークンより前のバッチを解放する
+void release_tokens(void) {
+  while (ctx->batches && ctx->batches->next &&
+         !in_batch(ctx->batches, ctx->token)) {
+    TokenBatch *b = ctx->batches;
+    ctx->batches = b->next;
+    free_arena(b->arena);
+    free(b);
+  }
+}
+
+void free_token_batches(TokenBatch *b) {
+  while (b) {
+    TokenBatch *next = b->next;
+    free_arena(b->arena);
+    free(b);
+    b = next;
+  }
+}
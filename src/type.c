@@ -15,7 +15,7 @@ bool is_integer(Type *ty) {
 int align_to(int n, int align) { return (n + align - 1) & ~(align - 1); }
 
 Type *new_type(TypeKind kind, int size, int align) {
-  Type *ty = calloc(1, sizeof(Type));
+  Type *ty = arena_calloc(1, sizeof(Type));
   ty->kind = kind;
   ty->size = size;
   ty->align = align;
@@ -60,20 +60,38 @@ void add_type(Node *node) {
   switch (node->kind) {
     case ND_ADD:
     case ND_SUB:
-    case ND_PTR_DIFF:
     case ND_MUL:
     case ND_DIV:
+      // どちらかが long なら long で計算する
+      if (node->lhs->ty->size == 8 || node->rhs->ty->size == 8)
+        node->ty = long_type;
+      else
+        node->ty = int_type;
+      return;
     case ND_EQ:
     case ND_NE:
     case ND_LT:
     case ND_LE:
-    // case ND_FUNCALL:
-    case ND_NUM:
+    case ND_LOGAND:
+    case ND_LOGOR:
+    case ND_NOT:
       node->ty = int_type;
       return;
+    case ND_NUM:
+      node->ty = node->val == (int)node->val ? int_type : long_type;
+      return;
+    case ND_PTR_DIFF:
+      node->ty = long_type;
+      return;
     case ND_PTR_ADD:
     case ND_PTR_SUB:
     case ND_ASSIGN:
+    case ND_ADD_ASSIGN:
+    case ND_SUB_ASSIGN:
+    case ND_MUL_ASSIGN:
+    case ND_DIV_ASSIGN:
+    case ND_POST_INC:
+    case ND_POST_DEC:
       node->ty = node->lhs->ty;
       return;
     case ND_ADDR: